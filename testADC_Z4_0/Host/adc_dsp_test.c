@@ -0,0 +1,564 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_dsp_test.c
+ *
+ * Host unit tests and benchmarks of the ADC DSP kernels.
+ *
+ *   make test     checks the block kernels bit-exact against the _Ref kernels
+ *                 over random FIR, biquad and CIC configurations, fed in random
+ *                 block sizes, and the other kernels against C models
+ *   make bench    also prints the cycles per sample of each kernel and of its
+ *                 reference implementation
+ *
+ * Cycles are read from the time stamp counter on x86 hosts and derived from
+ * nanoseconds (1 cycle per ns) elsewhere. They compare the implementations
+ * with each other; they are not e200z4 cycle counts.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "adc_dsp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_CONFIGS        3000U
+#define TEST_STREAM         512U
+#define TEST_MAX_TAPS       64U
+#define TEST_MAX_STAGES     4U
+#define TEST_MAX_STRIDE     4U
+
+#define BENCH_BLOCK         256U
+#define BENCH_ROUNDS        2000U
+#define BENCH_TAPS          32U
+#define BENCH_STAGES        2U
+
+#define CHECK(cond)    TEST_Check((cond), #cond, __LINE__)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_failures = 0U;
+static uint32_t s_checks = 0U;
+static uint32_t s_seed = 2019U;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char * text, int line)
+{
+    s_checks++;
+    if (!cond)
+    {
+        s_failures++;
+        printf("FAIL line %d: %s\n", line, text);
+    }
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+static int32_t TEST_RandomQ31(uint32_t bits)
+{
+    /* Random value of the given magnitude, mixed with full scale values */
+    uint32_t r = TEST_Random();
+
+    if ((r & 0x3FU) == 0U)
+    {
+        return ((r & 0x40U) != 0U) ? INT32_MAX : INT32_MIN;
+    }
+
+    return (int32_t)((TEST_Random() << 8U) ^ (TEST_Random() << 16U)) >> (32U - bits);
+}
+
+/* Splits the stream into random blocks, including empty ones */
+static uint32_t TEST_NextBlock(uint32_t left)
+{
+    uint32_t block = TEST_Random() % 80U;
+
+    return (block > left) ? left : block;
+}
+
+/*******************************************************************************
+ * Block kernels against the reference kernels
+ ******************************************************************************/
+
+static bool TEST_FirQ15(void)
+{
+    int16_t coeffs[TEST_MAX_TAPS];
+    int16_t history[2U][2U * TEST_MAX_TAPS];
+    int16_t in[TEST_STREAM];
+    int16_t out[2U][TEST_STREAM];
+    adc_dsp_fir_q15_t fir[2U];
+    uint32_t taps = 1U + (TEST_Random() % TEST_MAX_TAPS);
+    uint32_t bits = 4U + (TEST_Random() % 13U);
+    uint32_t idx = 0U;
+    uint32_t block;
+    uint32_t i;
+
+    for (i = 0U; i < taps; i++)
+    {
+        coeffs[i] = (int16_t)(TEST_RandomQ31(bits) >> 16U);
+    }
+    for (i = 0U; i < TEST_STREAM; i++)
+    {
+        in[i] = (int16_t)(TEST_RandomQ31(16U) >> 16U);
+    }
+
+    ADC_DSP_FirInitQ15(&fir[0], coeffs, history[0], taps);
+    ADC_DSP_FirInitQ15(&fir[1], coeffs, history[1], taps);
+    /* The block kernel runs in place */
+    memcpy(out[0], in, sizeof(in));
+    while (idx < TEST_STREAM)
+    {
+        block = TEST_NextBlock(TEST_STREAM - idx);
+        ADC_DSP_FirQ15(&fir[0], &out[0][idx], &out[0][idx], block);
+        ADC_DSP_FirQ15_Ref(&fir[1], &in[idx], &out[1][idx], block);
+        idx += block;
+    }
+
+    return memcmp(out[0], out[1], sizeof(out[0])) == 0;
+}
+
+static bool TEST_FirQ31(void)
+{
+    int32_t coeffs[TEST_MAX_TAPS];
+    int32_t history[2U][2U * TEST_MAX_TAPS];
+    int32_t in[TEST_STREAM];
+    int32_t out[2U][TEST_STREAM];
+    adc_dsp_fir_q31_t fir[2U];
+    uint32_t taps = 1U + (TEST_Random() % TEST_MAX_TAPS);
+    uint32_t bits = 8U + (TEST_Random() % 25U);
+    uint32_t idx = 0U;
+    uint32_t block;
+    uint32_t i;
+
+    for (i = 0U; i < taps; i++)
+    {
+        coeffs[i] = TEST_RandomQ31(bits);
+    }
+    for (i = 0U; i < TEST_STREAM; i++)
+    {
+        in[i] = TEST_RandomQ31(32U);
+    }
+
+    ADC_DSP_FirInitQ31(&fir[0], coeffs, history[0], taps);
+    ADC_DSP_FirInitQ31(&fir[1], coeffs, history[1], taps);
+    memcpy(out[0], in, sizeof(in));
+    while (idx < TEST_STREAM)
+    {
+        block = TEST_NextBlock(TEST_STREAM - idx);
+        ADC_DSP_FirQ31(&fir[0], &out[0][idx], &out[0][idx], block);
+        ADC_DSP_FirQ31_Ref(&fir[1], &in[idx], &out[1][idx], block);
+        idx += block;
+    }
+
+    return memcmp(out[0], out[1], sizeof(out[0])) == 0;
+}
+
+static bool TEST_BiquadQ15(void)
+{
+    int16_t coeffs[5U * TEST_MAX_STAGES];
+    int16_t delay[2U][4U * TEST_MAX_STAGES];
+    int16_t in[TEST_STREAM];
+    int16_t out[2U][TEST_STREAM];
+    adc_dsp_biquad_q15_t iir[2U];
+    uint32_t stages = 1U + (TEST_Random() % TEST_MAX_STAGES);
+    uint32_t postShift = TEST_Random() % 3U;
+    uint32_t bits = 8U + (TEST_Random() % 9U);
+    uint32_t idx = 0U;
+    uint32_t block;
+    uint32_t i;
+
+    for (i = 0U; i < (5U * stages); i++)
+    {
+        coeffs[i] = (int16_t)(TEST_RandomQ31(bits) >> 16U);
+    }
+    for (i = 0U; i < TEST_STREAM; i++)
+    {
+        in[i] = (int16_t)(TEST_RandomQ31(16U) >> 16U);
+    }
+
+    ADC_DSP_BiquadInitQ15(&iir[0], coeffs, delay[0], stages, postShift);
+    ADC_DSP_BiquadInitQ15(&iir[1], coeffs, delay[1], stages, postShift);
+    memcpy(out[0], in, sizeof(in));
+    while (idx < TEST_STREAM)
+    {
+        block = TEST_NextBlock(TEST_STREAM - idx);
+        ADC_DSP_BiquadQ15(&iir[0], &out[0][idx], &out[0][idx], block);
+        ADC_DSP_BiquadQ15_Ref(&iir[1], &in[idx], &out[1][idx], block);
+        idx += block;
+    }
+
+    return memcmp(out[0], out[1], sizeof(out[0])) == 0;
+}
+
+static bool TEST_BiquadQ31(void)
+{
+    int32_t coeffs[5U * TEST_MAX_STAGES];
+    int32_t delay[2U][4U * TEST_MAX_STAGES];
+    int32_t in[TEST_STREAM];
+    int32_t out[2U][TEST_STREAM];
+    adc_dsp_biquad_q31_t iir[2U];
+    uint32_t stages = 1U + (TEST_Random() % TEST_MAX_STAGES);
+    uint32_t postShift = TEST_Random() % 3U;
+    uint32_t bits = 16U + (TEST_Random() % 17U);
+    uint32_t idx = 0U;
+    uint32_t block;
+    uint32_t i;
+
+    for (i = 0U; i < (5U * stages); i++)
+    {
+        coeffs[i] = TEST_RandomQ31(bits);
+    }
+    for (i = 0U; i < TEST_STREAM; i++)
+    {
+        in[i] = TEST_RandomQ31(32U);
+    }
+
+    ADC_DSP_BiquadInitQ31(&iir[0], coeffs, delay[0], stages, postShift);
+    ADC_DSP_BiquadInitQ31(&iir[1], coeffs, delay[1], stages, postShift);
+    memcpy(out[0], in, sizeof(in));
+    while (idx < TEST_STREAM)
+    {
+        block = TEST_NextBlock(TEST_STREAM - idx);
+        ADC_DSP_BiquadQ31(&iir[0], &out[0][idx], &out[0][idx], block);
+        ADC_DSP_BiquadQ31_Ref(&iir[1], &in[idx], &out[1][idx], block);
+        idx += block;
+    }
+
+    return memcmp(out[0], out[1], sizeof(out[0])) == 0;
+}
+
+static bool TEST_Cic(void)
+{
+    uint16_t in[TEST_STREAM * TEST_MAX_STRIDE];
+    uint16_t out[2U][TEST_STREAM + 1U];
+    adc_dsp_cic_t cic[2U];
+    uint32_t order = 1U + (TEST_Random() % ADC_DSP_CIC_MAX_ORDER);
+    uint32_t inputBits = 8U + (TEST_Random() % 9U);
+    uint32_t log2Dec = 1U + (TEST_Random() % ((32U - inputBits) / order));
+    uint32_t stride = 1U + (TEST_Random() % TEST_MAX_STRIDE);
+    uint32_t count[2U] = { 0U, 0U };
+    uint32_t idx = 0U;
+    uint32_t block;
+    uint32_t i;
+
+    for (i = 0U; i < (TEST_STREAM * stride); i++)
+    {
+        in[i] = (uint16_t)(TEST_Random() & ((1UL << inputBits) - 1U));
+    }
+
+    if ((ADC_DSP_CicInit(&cic[0], order, 1UL << log2Dec, inputBits) != STATUS_SUCCESS) ||
+        (ADC_DSP_CicInit(&cic[1], order, 1UL << log2Dec, inputBits) != STATUS_SUCCESS))
+    {
+        return false;
+    }
+    while (idx < TEST_STREAM)
+    {
+        block = TEST_NextBlock(TEST_STREAM - idx);
+        count[0] += ADC_DSP_CicDecimate(&cic[0], &in[idx * stride], stride, block, &out[0][count[0]]);
+        count[1] += ADC_DSP_CicDecimate_Ref(&cic[1], &in[idx * stride], stride, block, &out[1][count[1]]);
+        idx += block;
+    }
+
+    return (count[0] == count[1]) &&
+           (count[0] == (TEST_STREAM >> log2Dec)) &&
+           (memcmp(out[0], out[1], count[0] * sizeof(uint16_t)) == 0);
+}
+
+static void TEST_RandomConfigs(void)
+{
+    uint32_t pass[5] = { 0U, 0U, 0U, 0U, 0U };
+    uint32_t runs[5] = { 0U, 0U, 0U, 0U, 0U };
+    uint32_t n;
+    uint32_t k;
+    bool ok;
+
+    for (n = 0U; n < TEST_CONFIGS; n++)
+    {
+        k = n % 5U;
+        switch (k)
+        {
+            case 0U:  ok = TEST_FirQ15();    break;
+            case 1U:  ok = TEST_FirQ31();    break;
+            case 2U:  ok = TEST_BiquadQ15(); break;
+            case 3U:  ok = TEST_BiquadQ31(); break;
+            default:  ok = TEST_Cic();       break;
+        }
+        runs[k]++;
+        pass[k] += ok ? 1U : 0U;
+        CHECK(ok);
+    }
+
+    printf("bit-exact against _Ref: FIR Q15 %u/%u, FIR Q31 %u/%u, biquad Q15 %u/%u, biquad Q31 %u/%u, CIC %u/%u\n",
+           pass[0], runs[0], pass[1], runs[1], pass[2], runs[2], pass[3], runs[3], pass[4], runs[4]);
+}
+
+/*******************************************************************************
+ * Other kernels against C models
+ ******************************************************************************/
+
+static void TEST_Models(void)
+{
+    static uint16_t raw[TEST_STREAM * TEST_MAX_STRIDE];
+    int16_t q15[TEST_STREAM];
+    uint16_t out[TEST_STREAM + 1U];
+    adc_dsp_boxcar_t boxcar;
+    adc_dsp_stats_t stats;
+    uint32_t round;
+    uint32_t stride;
+    uint32_t decimation;
+    uint32_t bits;
+    uint32_t count;
+    uint32_t outCount;
+    uint32_t idx;
+    uint32_t block;
+    uint32_t i;
+    uint32_t j;
+    bool same;
+
+    for (round = 0U; round < 200U; round++)
+    {
+        stride = 1U + (TEST_Random() % TEST_MAX_STRIDE);
+        bits = 1U + (TEST_Random() % 16U);
+        for (i = 0U; i < (TEST_STREAM * stride); i++)
+        {
+            raw[i] = (uint16_t)(TEST_Random() & ((1UL << bits) - 1U));
+        }
+
+        /* RawToQ15: mid-scale to 0, full scale to [-1, 1) */
+        ADC_DSP_RawToQ15(raw, stride, q15, TEST_STREAM, bits);
+        same = true;
+        for (i = 0U; i < TEST_STREAM; i++)
+        {
+            same = same && (q15[i] == (int16_t)(((int32_t)raw[i * stride] << (16U - bits)) - 32768));
+        }
+        CHECK(same);
+
+        /* Boxcar: rounded mean of each group, whatever the block split */
+        decimation = 1U + (TEST_Random() % 40U);
+        ADC_DSP_BoxcarInit(&boxcar, decimation);
+        outCount = 0U;
+        idx = 0U;
+        while (idx < TEST_STREAM)
+        {
+            block = TEST_NextBlock(TEST_STREAM - idx);
+            outCount += ADC_DSP_BoxcarDecimate(&boxcar, &raw[idx * stride], stride, block, &out[outCount]);
+            idx += block;
+        }
+        same = (outCount == (TEST_STREAM / decimation));
+        for (i = 0U; same && (i < outCount); i++)
+        {
+            uint32_t sum = 0U;
+            for (j = 0U; j < decimation; j++)
+            {
+                sum += raw[((i * decimation) + j) * stride];
+            }
+            same = (out[i] == (uint16_t)((sum + (decimation / 2U)) / decimation));
+        }
+        CHECK(same);
+
+        /* Window statistics against double precision */
+        count = 1U + (TEST_Random() % TEST_STREAM);
+        ADC_DSP_WindowStats(raw, stride, count, &stats);
+        {
+            double sum = 0.0;
+            double sumSq = 0.0;
+            uint32_t minValue = 0xFFFFU;
+            uint32_t maxValue = 0U;
+            double mean;
+            double rms;
+            double acRms;
+
+            for (i = 0U; i < count; i++)
+            {
+                const uint32_t x = raw[i * stride];
+                sum += x;
+                sumSq += (double)x * x;
+                minValue = (x < minValue) ? x : minValue;
+                maxValue = (x > maxValue) ? x : maxValue;
+            }
+            mean = sum / count;
+            rms = sqrt(sumSq / count);
+            acRms = sqrt(fmax((sumSq / count) - (mean * mean), 0.0));
+
+            CHECK((stats.min == minValue) && (stats.max == maxValue));
+            CHECK(fabs(stats.mean - mean) <= 0.5);
+            /* integer square roots of truncated means */
+            CHECK(fabs(stats.rms - rms) <= 1.0);
+            CHECK(fabs(stats.acRms - acRms) <= 1.5);
+        }
+    }
+
+    /* CIC parameters whose gain does not fit in 32 bits are rejected */
+    {
+        adc_dsp_cic_t cic;
+        CHECK(ADC_DSP_CicInit(&cic, 4U, 256U, 12U) == STATUS_ERROR);
+        CHECK(ADC_DSP_CicInit(&cic, 4U, 32U, 12U) == STATUS_SUCCESS);
+        CHECK(ADC_DSP_CicInit(&cic, 2U, 24U, 12U) == STATUS_ERROR);
+    }
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+
+static uint64_t BENCH_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void BENCH_Report(const char * name, uint64_t cycles)
+{
+    printf("  %-32s %7.2f cycles/sample\n", name, (double)cycles / (double)BENCH_BLOCK);
+}
+
+static void BENCH_Run(void)
+{
+    static uint16_t raw[BENCH_BLOCK];
+    static int16_t q15[2U][BENCH_BLOCK];
+    static int32_t q31[2U][BENCH_BLOCK];
+    static uint16_t out[BENCH_BLOCK];
+    static int16_t coeffs15[BENCH_TAPS];
+    static int32_t coeffs31[BENCH_TAPS];
+    static int16_t history15[2U * BENCH_TAPS];
+    static int32_t history31[2U * BENCH_TAPS];
+    /* Two stable low pass sections, coefficients scaled by 2^-postShift (postShift 1) */
+    static const int16_t sos15[5U * BENCH_STAGES] =
+    {
+        170, 340, 170, 17358, -5474,
+        8192, 16384, 8192, 21810, -11786
+    };
+    static const int32_t sos31[5U * BENCH_STAGES] =
+    {
+        11141120, 22282240, 11141120, 1137573888, -358744064,
+        536870912, 1073741824, 536870912, 1429340160, -772407296
+    };
+    static int16_t delay15[4U * BENCH_STAGES];
+    static int32_t delay31[4U * BENCH_STAGES];
+    adc_dsp_fir_q15_t fir15;
+    adc_dsp_fir_q31_t fir31;
+    adc_dsp_biquad_q15_t iir15;
+    adc_dsp_biquad_q31_t iir31;
+    adc_dsp_cic_t cic;
+    adc_dsp_boxcar_t boxcar;
+    adc_dsp_stats_t stats;
+    uint64_t best;
+    uint64_t start;
+    uint64_t cycles;
+    uint32_t round;
+    uint32_t i;
+
+    for (i = 0U; i < BENCH_BLOCK; i++)
+    {
+        raw[i] = (uint16_t)(TEST_Random() & 0xFFFU);
+    }
+    ADC_DSP_RawToQ15(raw, 1U, q15[0], BENCH_BLOCK, 12U);
+    for (i = 0U; i < BENCH_BLOCK; i++)
+    {
+        q31[0][i] = (int32_t)q15[0][i] << 16U;
+    }
+    for (i = 0U; i < BENCH_TAPS; i++)
+    {
+        coeffs15[i] = (int16_t)(32768 / BENCH_TAPS);
+        coeffs31[i] = (int32_t)(0x80000000UL / BENCH_TAPS);
+    }
+    ADC_DSP_FirInitQ15(&fir15, coeffs15, history15, BENCH_TAPS);
+    ADC_DSP_FirInitQ31(&fir31, coeffs31, history31, BENCH_TAPS);
+    ADC_DSP_BiquadInitQ15(&iir15, sos15, delay15, BENCH_STAGES, 1U);
+    ADC_DSP_BiquadInitQ31(&iir31, sos31, delay31, BENCH_STAGES, 1U);
+    (void)ADC_DSP_CicInit(&cic, 3U, 16U, 12U);
+    ADC_DSP_BoxcarInit(&boxcar, 16U);
+
+    printf("Benchmarks, %u-sample blocks, best of %u runs:\n", BENCH_BLOCK, BENCH_ROUNDS);
+
+#define BENCH(name, expr)                                        \
+    do                                                           \
+    {                                                            \
+        best = UINT64_MAX;                                       \
+        for (round = 0U; round < BENCH_ROUNDS; round++)          \
+        {                                                        \
+            start = BENCH_Cycles();                              \
+            expr;                                                \
+            cycles = BENCH_Cycles() - start;                     \
+            best = (cycles < best) ? cycles : best;              \
+        }                                                        \
+        BENCH_Report((name), best);                              \
+    } while (false)
+
+    BENCH("RawToQ15", ADC_DSP_RawToQ15(raw, 1U, q15[1], BENCH_BLOCK, 12U));
+    BENCH("Boxcar / 16", (void)ADC_DSP_BoxcarDecimate(&boxcar, raw, 1U, BENCH_BLOCK, out));
+    BENCH("CIC order 3 / 16", (void)ADC_DSP_CicDecimate(&cic, raw, 1U, BENCH_BLOCK, out));
+    BENCH("CIC order 3 / 16 _Ref", (void)ADC_DSP_CicDecimate_Ref(&cic, raw, 1U, BENCH_BLOCK, out));
+    BENCH("FIR Q15 32 taps", ADC_DSP_FirQ15(&fir15, q15[0], q15[1], BENCH_BLOCK));
+    BENCH("FIR Q15 32 taps _Ref", ADC_DSP_FirQ15_Ref(&fir15, q15[0], q15[1], BENCH_BLOCK));
+    BENCH("FIR Q31 32 taps", ADC_DSP_FirQ31(&fir31, q31[0], q31[1], BENCH_BLOCK));
+    BENCH("FIR Q31 32 taps _Ref", ADC_DSP_FirQ31_Ref(&fir31, q31[0], q31[1], BENCH_BLOCK));
+    BENCH("Biquad Q15 2 stages", ADC_DSP_BiquadQ15(&iir15, q15[0], q15[1], BENCH_BLOCK));
+    BENCH("Biquad Q15 2 stages _Ref", ADC_DSP_BiquadQ15_Ref(&iir15, q15[0], q15[1], BENCH_BLOCK));
+    BENCH("Biquad Q31 2 stages", ADC_DSP_BiquadQ31(&iir31, q31[0], q31[1], BENCH_BLOCK));
+    BENCH("Biquad Q31 2 stages _Ref", ADC_DSP_BiquadQ31_Ref(&iir31, q31[0], q31[1], BENCH_BLOCK));
+    BENCH("Window stats", ADC_DSP_WindowStats(raw, 1U, BENCH_BLOCK, &stats));
+
+#undef BENCH
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+    TEST_RandomConfigs();
+    TEST_Models();
+
+    if ((argc > 1) && (strcmp(argv[1], "--bench") == 0))
+    {
+        BENCH_Run();
+    }
+
+    printf("adc_dsp: %u checks, %u failures\n", s_checks, s_failures);
+
+    return (s_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
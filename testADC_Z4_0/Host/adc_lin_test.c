@@ -0,0 +1,370 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_lin_test.c
+ *
+ * Host unit tests and benchmarks of the ADC linearisation tables.
+ *
+ *   make test     checks the conversion functions against each other, and the
+ *                 NTC table of the project (g_adcLinNtc10k) against the nominal
+ *                 B3950 curve it was generated from, over the calibrated codes:
+ *                 its error must stay within TEST_NTC_MAX_ERROR and below the
+ *                 error of a least-squares polynomial of TEST_POLY_ORDER
+ *                 evaluated by ADC_LIN_ConvertBlockPoly_Ref()
+ *   make bench    also prints the cycles per sample of ADC_LIN_ConvertBlock()
+ *                 and of ADC_LIN_ConvertBlockPoly_Ref() on the same codes
+ *
+ * Cycles are read from the time stamp counter on x86 hosts and derived from
+ * nanoseconds (1 cycle per ns) elsewhere. They compare the implementations
+ * with each other; they are not e200z4 cycle counts.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "adc_lin.h"
+#include "adc_lin_ntc10k.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_CODES          4096U
+#define TEST_MAX_STRIDE     4U
+
+/* Calibrated range of ntc_10k_b3950.txt, in codes (110 C to -30 C) */
+#define TEST_NTC_FIRST      206U
+#define TEST_NTC_LAST       3901U
+
+/* Largest error of the NTC table against the nominal curve, in 0.01 C */
+#define TEST_NTC_MAX_ERROR  35
+
+/* Order of the reference polynomial */
+#define TEST_POLY_ORDER     7U
+
+#define BENCH_BLOCK         256U
+#define BENCH_ROUNDS        2000U
+
+#define CHECK(cond)    TEST_Check((cond), #cond, __LINE__)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_failures = 0U;
+static uint32_t s_checks = 0U;
+static uint32_t s_seed = 2019U;
+
+/* Coefficients of the reference polynomial, in powers of the raw code */
+static float s_poly[TEST_POLY_ORDER + 1U];
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char * text, int line)
+{
+    s_checks++;
+    if (!cond)
+    {
+        s_failures++;
+        printf("FAIL line %d: %s\n", line, text);
+    }
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* Nominal NTC curve of ntc_10k_b3950.txt, in 0.01 C: 10k B3950 to ground, 10k pull-up */
+static double TEST_NtcCurve(double code)
+{
+    double r = 10000.0 * code / (4096.0 - code);
+    double t = 1.0 / ((1.0 / 298.15) + (log(r / 10000.0) / 3950.0));
+
+    return (t - 273.15) * 100.0;
+}
+
+/* Least-squares fit of the NTC curve over the calibrated codes. The fit is done on
+ * code / 4096 to keep the normal equations well conditioned, then scaled to powers
+ * of the raw code as taken by ADC_LIN_ConvertBlockPoly_Ref() */
+static void TEST_FitPolynomial(void)
+{
+    double a[TEST_POLY_ORDER + 1U][TEST_POLY_ORDER + 2U];
+    double powers[(2U * TEST_POLY_ORDER) + 1U];
+    double x;
+    double y;
+    double f;
+    uint32_t code;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+
+    memset(a, 0, sizeof(a));
+    for (code = TEST_NTC_FIRST; code <= TEST_NTC_LAST; code++)
+    {
+        x = (double)code / 4096.0;
+        y = TEST_NtcCurve((double)code);
+        powers[0] = 1.0;
+        for (i = 1U; i <= (2U * TEST_POLY_ORDER); i++)
+        {
+            powers[i] = powers[i - 1U] * x;
+        }
+        for (i = 0U; i <= TEST_POLY_ORDER; i++)
+        {
+            for (j = 0U; j <= TEST_POLY_ORDER; j++)
+            {
+                a[i][j] += powers[i + j];
+            }
+            a[i][TEST_POLY_ORDER + 1U] += powers[i] * y;
+        }
+    }
+
+    /* Gaussian elimination; the matrix is symmetric positive definite */
+    for (i = 0U; i <= TEST_POLY_ORDER; i++)
+    {
+        for (k = i + 1U; k <= TEST_POLY_ORDER; k++)
+        {
+            f = a[k][i] / a[i][i];
+            for (j = i; j <= (TEST_POLY_ORDER + 1U); j++)
+            {
+                a[k][j] -= f * a[i][j];
+            }
+        }
+    }
+    for (i = TEST_POLY_ORDER + 1U; i > 0U; i--)
+    {
+        y = a[i - 1U][TEST_POLY_ORDER + 1U];
+        for (j = i; j <= TEST_POLY_ORDER; j++)
+        {
+            y -= a[i - 1U][j] * a[j][TEST_POLY_ORDER + 1U];
+        }
+        a[i - 1U][TEST_POLY_ORDER + 1U] = y / a[i - 1U][i - 1U];
+    }
+
+    for (i = 0U; i <= TEST_POLY_ORDER; i++)
+    {
+        s_poly[i] = (float)(a[i][TEST_POLY_ORDER + 1U] / pow(4096.0, (double)i));
+    }
+}
+
+/*******************************************************************************
+ * Tests
+ ******************************************************************************/
+
+/* The block and array conversions against the conversion of one result */
+static void TEST_Conversions(void)
+{
+    static uint16_t in[TEST_CODES * TEST_MAX_STRIDE];
+    static int32_t out[TEST_CODES];
+    static int32_t points[ADC_LIN_TABLE_POINTS(0U)];
+    static const adc_lin_table_t * tables[TEST_CODES];
+    adc_lin_table_t table;
+    uint32_t shift;
+    uint32_t stride;
+    uint32_t idx;
+    uint32_t value;
+    uint32_t step;
+    bool match;
+
+    for (shift = 0U; shift <= ADC_LIN_RESULT_BITS; shift++)
+    {
+        /* Random increasing points spanning up to 2^30 */
+        value = 0U;
+        for (idx = 0U; idx < ADC_LIN_TABLE_POINTS(shift); idx++)
+        {
+            points[idx] = (int32_t)value - 0x20000000;
+            step = TEST_Random() << 8U;
+            value += (step ^ TEST_Random()) % (0x40000000UL >> (ADC_LIN_RESULT_BITS - shift));
+        }
+        table.points = points;
+        table.segmentShift = (uint8_t)shift;
+        CHECK(ADC_LIN_CheckTable(&table) == STATUS_SUCCESS);
+
+        /* Exact at the segment boundaries */
+        match = true;
+        for (idx = 0U; idx < (ADC_LIN_TABLE_POINTS(shift) - 1U); idx++)
+        {
+            match = match && (ADC_LIN_Convert(&table, (uint16_t)(idx << shift)) == points[idx]);
+        }
+        CHECK(match);
+
+        for (stride = 1U; stride <= TEST_MAX_STRIDE; stride++)
+        {
+            for (idx = 0U; idx < (TEST_CODES * stride); idx++)
+            {
+                in[idx] = (uint16_t)TEST_Random();
+            }
+            ADC_LIN_ConvertBlock(&table, in, stride, out, TEST_CODES);
+            match = true;
+            for (idx = 0U; idx < TEST_CODES; idx++)
+            {
+                match = match && (out[idx] == ADC_LIN_Convert(&table, in[idx * stride]));
+            }
+            CHECK(match);
+        }
+
+        /* Every other result copied */
+        for (idx = 0U; idx < TEST_CODES; idx++)
+        {
+            tables[idx] = ((idx & 1U) != 0U) ? &table : NULL;
+        }
+        ADC_LIN_ConvertArray(tables, in, out, TEST_CODES);
+        match = true;
+        for (idx = 0U; idx < TEST_CODES; idx++)
+        {
+            match = match && (out[idx] == (((idx & 1U) != 0U) ? ADC_LIN_Convert(&table, in[idx]) : (int32_t)in[idx]));
+        }
+        CHECK(match);
+    }
+
+    /* Out of range shift, and points too far apart */
+    table.segmentShift = ADC_LIN_RESULT_BITS + 1U;
+    CHECK(ADC_LIN_CheckTable(&table) == STATUS_ERROR);
+    points[0] = INT32_MIN;
+    points[1] = INT32_MAX;
+    table.segmentShift = ADC_LIN_RESULT_BITS;
+    CHECK(ADC_LIN_CheckTable(&table) == STATUS_ERROR);
+}
+
+/* The NTC table against the nominal curve, and against the polynomial */
+static void TEST_NtcTable(void)
+{
+    static uint16_t in[TEST_CODES];
+    static int32_t table[TEST_CODES];
+    static int32_t poly[TEST_CODES];
+    uint32_t count = TEST_NTC_LAST - TEST_NTC_FIRST + 1U;
+    double curve;
+    double tableError = 0.0;
+    double polyError = 0.0;
+    uint32_t idx;
+
+    CHECK(ADC_LIN_CheckTable(&g_adcLinNtc10k) == STATUS_SUCCESS);
+
+    for (idx = 0U; idx < count; idx++)
+    {
+        in[idx] = (uint16_t)(TEST_NTC_FIRST + idx);
+    }
+    ADC_LIN_ConvertBlock(&g_adcLinNtc10k, in, 1U, table, count);
+    ADC_LIN_ConvertBlockPoly_Ref(s_poly, TEST_POLY_ORDER + 1U, in, 1U, poly, count);
+
+    for (idx = 0U; idx < count; idx++)
+    {
+        curve = TEST_NtcCurve((double)in[idx]);
+        tableError = fmax(tableError, fabs((double)table[idx] - curve));
+        polyError = fmax(polyError, fabs((double)poly[idx] - curve));
+    }
+
+    CHECK(tableError <= (double)TEST_NTC_MAX_ERROR);
+    CHECK(tableError < polyError);
+
+    printf("NTC 10k B3950, codes %u to %u, largest error against the nominal curve:\n",
+           TEST_NTC_FIRST, TEST_NTC_LAST);
+    printf("  %-32s %5.2f C\n", "table, 65 points", tableError / 100.0);
+    printf("  %-32s %5.2f C\n", "polynomial of order 7 (float)", polyError / 100.0);
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+
+static uint64_t BENCH_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void BENCH_Report(const char * name, uint64_t cycles)
+{
+    printf("  %-32s %7.2f cycles/sample\n", name, (double)cycles / (double)BENCH_BLOCK);
+}
+
+static void BENCH_Run(void)
+{
+    static uint16_t raw[BENCH_BLOCK];
+    static int32_t out[BENCH_BLOCK];
+    uint64_t start;
+    uint64_t cycles;
+    uint64_t best;
+    uint32_t round;
+    uint32_t idx;
+
+    for (idx = 0U; idx < BENCH_BLOCK; idx++)
+    {
+        raw[idx] = (uint16_t)(TEST_NTC_FIRST + (TEST_Random() % (TEST_NTC_LAST - TEST_NTC_FIRST + 1U)));
+    }
+
+    printf("Benchmarks, %u-sample blocks, best of %u runs:\n", BENCH_BLOCK, BENCH_ROUNDS);
+
+#define BENCH(name, expr)                                        \
+    do                                                           \
+    {                                                            \
+        best = UINT64_MAX;                                       \
+        for (round = 0U; round < BENCH_ROUNDS; round++)          \
+        {                                                        \
+            start = BENCH_Cycles();                              \
+            expr;                                                \
+            cycles = BENCH_Cycles() - start;                     \
+            best = (cycles < best) ? cycles : best;              \
+        }                                                        \
+        BENCH_Report((name), best);                              \
+    } while (false)
+
+    BENCH("ConvertBlock, 65 points", ADC_LIN_ConvertBlock(&g_adcLinNtc10k, raw, 1U, out, BENCH_BLOCK));
+    BENCH("ConvertBlockPoly_Ref, order 7", ADC_LIN_ConvertBlockPoly_Ref(s_poly, TEST_POLY_ORDER + 1U, raw, 1U, out, BENCH_BLOCK));
+
+#undef BENCH
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+    TEST_FitPolynomial();
+    TEST_Conversions();
+    TEST_NtcTable();
+
+    if ((argc > 1) && (strcmp(argv[1], "--bench") == 0))
+    {
+        BENCH_Run();
+    }
+
+    printf("adc_lin: %u checks, %u failures\n", s_checks, s_failures);
+
+    return (s_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,548 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_stats_test.c
+ *
+ * Host unit tests and benchmarks of the running ADC statistics.
+ *
+ *   make test     checks the window mode against a double precision two-pass
+ *                 computation (random layouts, masks and windows up to
+ *                 ADC_STATS_MAX_WINDOW of full-scale results, scans fed in
+ *                 random blocks), the exponential mode against a double
+ *                 precision model of the same recurrence, the sequence
+ *                 wrap-around, and ADC_STATS_GetSnapshot() preempted by
+ *                 ADC_STATS_Update(): a timer signal plays the conversion
+ *                 interrupt and publishes while the snapshots are copied
+ *   make bench    also prints the cycles per sample of ADC_STATS_Update()
+ *
+ * Cycles are read from the time stamp counter on x86 hosts and derived from
+ * nanoseconds (1 cycle per ns) elsewhere. They are not e200z4 cycle counts.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "adc_stats.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_FULL_SCALE       4095U
+#define TEST_WINDOW_CONFIGS   200U
+#define TEST_EXP_SCANS        20000U
+
+/* Timer signal playing the conversion interrupt in the preemption test */
+#define TEST_IRQ_PERIOD_US    20
+#define TEST_IRQ_MIN_PREEMPT  1000U
+#define TEST_IRQ_MAX_SECONDS  10
+
+#define BENCH_SCANS           256U
+#define BENCH_ROUNDS          2000U
+
+#define CHECK(cond)    TEST_Check((cond), #cond, __LINE__)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_failures = 0U;
+static uint32_t s_checks = 0U;
+static uint32_t s_seed = 2019U;
+
+/* Preemption test: statistics fed by the timer signal */
+static adc_stats_state_t s_irqState;
+static volatile uint32_t s_irqCount = 0U;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char * text, int line)
+{
+    s_checks++;
+    if (!cond)
+    {
+        s_failures++;
+        printf("FAIL line %d: %s\n", line, text);
+    }
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* Result of a scan: full scale, zero or uniform, so the extremes are exercised */
+static uint16_t TEST_Sample(uint32_t kind)
+{
+    uint16_t value;
+
+    switch (kind)
+    {
+        case 0U:
+            value = (uint16_t)TEST_FULL_SCALE;
+            break;
+        case 1U:
+            value = (uint16_t)(TEST_Random() % 2U) * (uint16_t)TEST_FULL_SCALE;
+            break;
+        default:
+            value = (uint16_t)(TEST_Random() % (TEST_FULL_SCALE + 1U));
+            break;
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+ * Window mode
+ ******************************************************************************/
+
+/* Two-pass statistics of one column of a window */
+static void TEST_CheckWindow(const adc_stats_snapshot_t * snapshot, const uint16_t * window,
+                             uint32_t scans, uint32_t channelCount, uint32_t channelMask)
+{
+    const adc_stats_channel_t * stats;
+    double mean;
+    double variance;
+    double diff;
+    uint32_t column;
+    uint32_t scan;
+    uint16_t min;
+    uint16_t max;
+    uint16_t value;
+
+    CHECK(snapshot->scans == scans);
+
+    for (column = 0U; column < ADC_STATS_MAX_CHANNELS; column++)
+    {
+        stats = &snapshot->channel[column];
+        if ((column >= channelCount) || ((channelMask & (1UL << column)) == 0U))
+        {
+            CHECK((stats->min == 0U) && (stats->max == 0U) && (stats->mean == 0U) && (stats->variance == 0U));
+            continue;
+        }
+
+        mean = 0.0;
+        min = UINT16_MAX;
+        max = 0U;
+        for (scan = 0U; scan < scans; scan++)
+        {
+            value = window[(scan * channelCount) + column];
+            mean += value;
+            min = (value < min) ? value : min;
+            max = (value > max) ? value : max;
+        }
+        mean /= scans;
+
+        variance = 0.0;
+        for (scan = 0U; scan < scans; scan++)
+        {
+            diff = window[(scan * channelCount) + column] - mean;
+            variance += diff * diff;
+        }
+        variance /= scans;
+
+        CHECK(stats->min == min);
+        CHECK(stats->max == max);
+        CHECK(fabs((double)stats->mean - (mean * 65536.0)) <= 1.0);
+        CHECK(fabs((double)stats->variance - (variance * 256.0)) <= 1.0);
+    }
+}
+
+static void TEST_WindowMode(void)
+{
+    static const uint32_t intervals[] = { 1U, 2U, 3U, 17U, 256U, 1000U, ADC_STATS_MAX_WINDOW };
+    static uint16_t window[ADC_STATS_MAX_WINDOW * ADC_STATS_MAX_CHANNELS];
+    static uint16_t block[64U * ADC_STATS_MAX_CHANNELS];
+    static adc_stats_state_t state;
+    adc_stats_user_config_t config;
+    adc_stats_snapshot_t snapshot;
+    uint32_t configIdx;
+    uint32_t windows;
+    uint32_t filled;
+    uint32_t blockScans;
+    uint32_t kind;
+    uint32_t idx;
+    uint32_t sequence;
+
+    for (configIdx = 0U; configIdx < TEST_WINDOW_CONFIGS; configIdx++)
+    {
+        config.mode = ADC_STATS_MODE_WINDOW;
+        config.channelCount = 1U + (TEST_Random() % ADC_STATS_MAX_CHANNELS);
+        config.channelMask = TEST_Random() & ((1UL << config.channelCount) - 1U);
+        config.publishInterval = intervals[configIdx % (sizeof(intervals) / sizeof(intervals[0]))];
+        config.expShift = 0U;
+        /* Long windows are costly to check: fewer of them, and always full scale once */
+        windows = (config.publishInterval > 1000U) ? 1U : 4U;
+        kind = (config.publishInterval == ADC_STATS_MAX_WINDOW) ? (configIdx / 7U) % 3U : TEST_Random() % 3U;
+
+        ADC_STATS_Init(&state, &config);
+        CHECK(ADC_STATS_GetSnapshot(&state, &snapshot) == STATUS_BUSY);
+
+        sequence = 0U;
+        filled = 0U;
+        while (sequence < windows)
+        {
+            /* Random block sizes, crossing the window boundaries */
+            blockScans = 1U + (TEST_Random() % 64U);
+            for (idx = 0U; idx < (blockScans * config.channelCount); idx++)
+            {
+                block[idx] = TEST_Sample(kind);
+            }
+            ADC_STATS_Update(&state, block, blockScans);
+
+            for (idx = 0U; idx < blockScans; idx++)
+            {
+                (void)memcpy(&window[filled * config.channelCount], &block[idx * config.channelCount],
+                             config.channelCount * sizeof(uint16_t));
+                filled++;
+                if (filled == config.publishInterval)
+                {
+                    /* A block can complete several windows: check the ones published last */
+                    sequence++;
+                    if (((blockScans - idx) - 1U) < config.publishInterval)
+                    {
+                        CHECK(ADC_STATS_GetSnapshot(&state, &snapshot) == STATUS_SUCCESS);
+                        CHECK(snapshot.sequence == sequence);
+                        TEST_CheckWindow(&snapshot, window, config.publishInterval,
+                                         config.channelCount, config.channelMask);
+                    }
+                    filled = 0U;
+                }
+            }
+        }
+
+        /* Reset drops the partial window, the last publication stays */
+        ADC_STATS_Reset(&state);
+        CHECK(ADC_STATS_GetSnapshot(&state, &snapshot) == STATUS_SUCCESS);
+        CHECK(snapshot.sequence == sequence);
+    }
+}
+
+/*******************************************************************************
+ * Exponential mode
+ ******************************************************************************/
+
+static void TEST_ExponentialMode(void)
+{
+    static adc_stats_state_t state;
+    adc_stats_user_config_t config;
+    adc_stats_snapshot_t snapshot;
+    uint16_t scan[2];
+    double alpha;
+    double mean;
+    double variance;
+    double delta;
+    double meanError;
+    double varianceError;
+    double varianceTolerance;
+    uint32_t shift;
+    uint32_t scanIdx;
+    uint32_t sequence;
+    uint16_t min;
+    uint16_t max;
+
+    for (shift = 1U; shift < 16U; shift++)
+    {
+        config.mode = ADC_STATS_MODE_EXPONENTIAL;
+        config.channelCount = 2U;
+        config.channelMask = 0x2U;
+        config.publishInterval = 100U;
+        config.expShift = (uint8_t)shift;
+        ADC_STATS_Init(&state, &config);
+
+        alpha = 1.0 / (double)(1UL << shift);
+        mean = 0.0;
+        variance = 0.0;
+        sequence = 0U;
+        min = UINT16_MAX;
+        max = 0U;
+        meanError = 0.0;
+        varianceError = 0.0;
+
+        for (scanIdx = 0U; scanIdx < TEST_EXP_SCANS; scanIdx++)
+        {
+            /* A noisy level stepping between quarter and three quarters of full scale */
+            scan[0] = (uint16_t)(TEST_Random() % (TEST_FULL_SCALE + 1U));
+            scan[1] = (uint16_t)((((scanIdx / 5000U) % 2U) == 0U) ? 1024U : 3072U);
+            scan[1] = (uint16_t)(scan[1] + (TEST_Random() % 257U) - 128U);
+            ADC_STATS_Update(&state, scan, 1U);
+
+            if (scanIdx == 0U)
+            {
+                mean = scan[1];
+            }
+            delta = scan[1] - mean;
+            mean += delta * alpha;
+            variance = (1.0 - alpha) * (variance + (delta * delta * alpha));
+            min = (scan[1] < min) ? scan[1] : min;
+            max = (scan[1] > max) ? scan[1] : max;
+
+            if (((scanIdx + 1U) % config.publishInterval) == 0U)
+            {
+                sequence++;
+                CHECK(ADC_STATS_GetSnapshot(&state, &snapshot) == STATUS_SUCCESS);
+                CHECK(snapshot.sequence == sequence);
+                CHECK(snapshot.scans == config.publishInterval);
+                CHECK(snapshot.channel[1].min == min);
+                CHECK(snapshot.channel[1].max == max);
+                CHECK(snapshot.channel[0].mean == 0U);
+
+                /* The fixed-point update truncates: a bias of up to 2^shift LSBs on each */
+                meanError = fabs((double)snapshot.channel[1].mean - (mean * 65536.0));
+                varianceTolerance = ((variance * 256.0) / 1024.0) + (double)(1UL << shift) + 2.0;
+                varianceError = fabs((double)snapshot.channel[1].variance - (variance * 256.0));
+                CHECK(meanError <= ((double)(1UL << shift) + 1.0));
+                CHECK(varianceError <= varianceTolerance);
+                min = UINT16_MAX;
+                max = 0U;
+            }
+        }
+    }
+
+    /* The first result seeds the mean, also after a reset: a constant input has no variance */
+    ADC_STATS_Reset(&state);
+    scan[0] = 0U;
+    scan[1] = 4000U;
+    for (scanIdx = 0U; scanIdx < config.publishInterval; scanIdx++)
+    {
+        ADC_STATS_Update(&state, scan, 1U);
+    }
+    CHECK(ADC_STATS_GetSnapshot(&state, &snapshot) == STATUS_SUCCESS);
+    CHECK(snapshot.channel[1].mean == (4000UL << 16U));
+    CHECK(snapshot.channel[1].variance == 0U);
+}
+
+/*******************************************************************************
+ * Publication
+ ******************************************************************************/
+
+static void TEST_SequenceWrap(void)
+{
+    static adc_stats_state_t state;
+    adc_stats_user_config_t config;
+    adc_stats_snapshot_t snapshot;
+    uint16_t value;
+
+    config.mode = ADC_STATS_MODE_WINDOW;
+    config.channelCount = 1U;
+    config.channelMask = 0x1U;
+    config.publishInterval = 1U;
+    config.expShift = 0U;
+    ADC_STATS_Init(&state, &config);
+
+    /* Publication 0xFFFFFFFF, then 2: 0 stays "nothing published" and the parity is kept */
+    state.sequence = UINT32_MAX - 1U;
+    value = 100U;
+    ADC_STATS_Update(&state, &value, 1U);
+    CHECK(ADC_STATS_GetSnapshot(&state, &snapshot) == STATUS_SUCCESS);
+    CHECK((snapshot.sequence == UINT32_MAX) && (snapshot.channel[0].min == 100U));
+
+    value = 200U;
+    ADC_STATS_Update(&state, &value, 1U);
+    CHECK(state.sequence == 2U);
+    CHECK(ADC_STATS_GetSnapshot(&state, &snapshot) == STATUS_SUCCESS);
+    CHECK((snapshot.sequence == 2U) && (snapshot.channel[0].min == 200U));
+}
+
+/* Result of publication n in the preemption test */
+static uint16_t TEST_IrqValue(uint32_t sequence)
+{
+    return (uint16_t)((sequence * 2473U) % (TEST_FULL_SCALE + 1U));
+}
+
+/* Conversion interrupt: one scan, every result of it equal, one publication */
+static void TEST_IrqHandler(int signal)
+{
+    uint16_t scan[ADC_STATS_MAX_CHANNELS];
+    uint16_t value = TEST_IrqValue(s_irqState.sequence + 1U);
+    uint32_t column;
+
+    (void)signal;
+    for (column = 0U; column < ADC_STATS_MAX_CHANNELS; column++)
+    {
+        scan[column] = value;
+    }
+    ADC_STATS_Update(&s_irqState, scan, 1U);
+    s_irqCount++;
+}
+
+static void TEST_Preemption(void)
+{
+    adc_stats_user_config_t config;
+    adc_stats_snapshot_t snapshot;
+    struct sigaction action;
+    struct itimerval timer;
+    uint32_t preempted = 0U;
+    uint32_t torn = 0U;
+    uint32_t reads = 0U;
+    uint32_t lastSequence = 0U;
+    uint32_t irqBefore;
+    uint32_t column;
+    uint16_t value;
+    bool consistent;
+    time_t end;
+
+    config.mode = ADC_STATS_MODE_WINDOW;
+    config.channelCount = ADC_STATS_MAX_CHANNELS;
+    config.channelMask = (1UL << ADC_STATS_MAX_CHANNELS) - 1U;
+    config.publishInterval = 1U;
+    config.expShift = 0U;
+    ADC_STATS_Init(&s_irqState, &config);
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_handler = TEST_IrqHandler;
+    (void)sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    (void)sigaction(SIGALRM, &action, NULL);
+
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = TEST_IRQ_PERIOD_US;
+    timer.it_value = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+
+    end = time(NULL) + TEST_IRQ_MAX_SECONDS;
+    while ((preempted < TEST_IRQ_MIN_PREEMPT) && (time(NULL) < end))
+    {
+        irqBefore = s_irqCount;
+        if (ADC_STATS_GetSnapshot(&s_irqState, &snapshot) != STATUS_SUCCESS)
+        {
+            continue;
+        }
+        if (s_irqCount != irqBefore)
+        {
+            preempted++;
+        }
+        reads++;
+
+        /* A copy mixing two publications has results of different scans */
+        value = TEST_IrqValue(snapshot.sequence);
+        consistent = (snapshot.sequence >= lastSequence) && (snapshot.scans == 1U);
+        for (column = 0U; column < ADC_STATS_MAX_CHANNELS; column++)
+        {
+            consistent = consistent && (snapshot.channel[column].min == value) &&
+                         (snapshot.channel[column].max == value) &&
+                         (snapshot.channel[column].mean == ((uint32_t)value << 16U)) &&
+                         (snapshot.channel[column].variance == 0U);
+        }
+        torn += consistent ? 0U : 1U;
+        lastSequence = snapshot.sequence;
+    }
+
+    timer.it_interval.tv_usec = 0;
+    timer.it_value = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+
+    printf("  preemption: %u snapshots, %u preempted, %u publications\n", reads, preempted, s_irqCount);
+    CHECK(preempted >= TEST_IRQ_MIN_PREEMPT);
+    CHECK(torn == 0U);
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+
+static uint64_t BENCH_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void BENCH_Run(void)
+{
+    static uint16_t scans[BENCH_SCANS * 8U];
+    static adc_stats_state_t state;
+    adc_stats_user_config_t config;
+    uint64_t start;
+    uint64_t cycles;
+    uint64_t best;
+    uint32_t round;
+    uint32_t idx;
+    uint32_t mode;
+
+    for (idx = 0U; idx < (BENCH_SCANS * 8U); idx++)
+    {
+        scans[idx] = (uint16_t)(TEST_Random() % (TEST_FULL_SCALE + 1U));
+    }
+
+    printf("Benchmarks, %u scans of 8 results, best of %u runs:\n", BENCH_SCANS, BENCH_ROUNDS);
+
+    for (mode = 0U; mode < 2U; mode++)
+    {
+        config.mode = (mode == 0U) ? ADC_STATS_MODE_WINDOW : ADC_STATS_MODE_EXPONENTIAL;
+        config.channelCount = 8U;
+        config.channelMask = 0xFFU;
+        config.publishInterval = 1000U;
+        config.expShift = 4U;
+        ADC_STATS_Init(&state, &config);
+
+        best = UINT64_MAX;
+        for (round = 0U; round < BENCH_ROUNDS; round++)
+        {
+            start = BENCH_Cycles();
+            ADC_STATS_Update(&state, scans, BENCH_SCANS);
+            cycles = BENCH_Cycles() - start;
+            best = (cycles < best) ? cycles : best;
+        }
+        printf("  %-32s %7.2f cycles/sample\n", (mode == 0U) ? "Update, window" : "Update, exponential",
+               (double)best / (double)(BENCH_SCANS * 8U));
+    }
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+    TEST_WindowMode();
+    TEST_ExponentialMode();
+    TEST_SequenceWrap();
+    TEST_Preemption();
+
+    if ((argc > 1) && (strcmp(argv[1], "--bench") == 0))
+    {
+        BENCH_Run();
+    }
+
+    printf("adc_stats: %u checks, %u failures\n", s_checks, s_failures);
+
+    return (s_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -425,6 +425,18 @@ void ADC_DRV_DisableChannel(const uint32_t instance,
 void ADC_DRV_StartConversion(const uint32_t instance,
                              const adc_conv_chain_t convChain);
 
+/*!
+ * @brief Stop scan conversion
+ *
+ * This function stops the Normal conversion chain started in Scan mode. The chain
+ * in progress is completed and no new chain is started.
+ *
+ * @param[in] instance the instance number
+ * @param[in] convChain conversion chain (only Normal is supported)
+ */
+void ADC_DRV_StopConversion(const uint32_t instance,
+                            const adc_conv_chain_t convChain);
+
 /*!
  * @brief Get the status flags
  *
@@ -462,6 +474,27 @@ uint32_t ADC_DRV_GetConvResultsToArray(const uint32_t instance,
                                        uint16_t * const results,
                                        const uint32_t length);
 
+/*!
+ * @brief Get conversion results for a conversion chain, indexed by channel
+ *
+ * This function stores the conversion data of each completed conversion of the
+ * selected Conversion Chain at the position of its channel in the results array,
+ * so the caller can access a channel result directly without searching for it.
+ * Entries of channels without a new result are left unchanged.
+ *
+ * @param[in] instance the instance number
+ * @param[in] convChain conversion chain (Normal, Injected or CTU)
+ * @param[out] results the output buffer, with ADC_CDR_COUNT elements
+ * @param[out] updatedMask optional bit-mask of the channels written in results,
+ *  with ADC_NUM_OF_GROUP_CHN elements (bit n of element m corresponds to channel m * 32 + n);
+ *  can be NULL
+ * @return the number of values written in the buffer
+ */
+uint32_t ADC_DRV_GetConvResultsToChannelArray(const uint32_t instance,
+                                              const adc_conv_chain_t convChain,
+                                              uint16_t * const results,
+                                              uint32_t * const updatedMask);
+
 /*!
  * @brief Perform Calibration of the ADC
  *
@@ -476,6 +509,68 @@ uint32_t ADC_DRV_GetConvResultsToArray(const uint32_t instance,
  */
 status_t ADC_DRV_DoCalibration(const uint32_t instance);
 
+/*!
+ * @brief Start the calibration of the ADC
+ *
+ * This function starts the same calibration sequence as ADC_DRV_DoCalibration and
+ * returns immediately, so the calibration of several instances can overlap or run
+ * while the application continues its initialization. No conversion can take place
+ * until the sequence is over.
+ *
+ * @param[in] instance the instance number
+ */
+void ADC_DRV_StartCalibration(const uint32_t instance);
+
+/*!
+ * @brief Get the state of the calibration of the ADC
+ *
+ * This function must be polled after ADC_DRV_StartCalibration until it returns
+ * a value other than STATUS_BUSY, then ADC_DRV_EndCalibration must be called.
+ *
+ * @param[in] instance the instance number
+ * @return the calibration state
+ *  - STATUS_BUSY: calibration in progress
+ *  - STATUS_SUCCESS: calibration successful
+ *  - STATUS_ERROR: calibration failed
+ */
+status_t ADC_DRV_GetCalibrationStatus(const uint32_t instance);
+
+/*!
+ * @brief End the calibration of the ADC
+ *
+ * This function restores the ADC clock selection changed by ADC_DRV_StartCalibration.
+ * It must be called once ADC_DRV_GetCalibrationStatus returns a value other than
+ * STATUS_BUSY, before the converter is configured again.
+ *
+ * @param[in] instance the instance number
+ */
+void ADC_DRV_EndCalibration(const uint32_t instance);
+
+/*!
+ * @brief Set the user offset and gain correction
+ *
+ * The correction is applied by the converter on top of the calibration and is
+ * kept across calibrations.
+ *
+ * @param[in] instance the instance number
+ * @param[in] offset the user offset correction (OFFSET_USER field)
+ * @param[in] gain the user gain correction (GAIN_USER field)
+ */
+void ADC_DRV_SetUserOffsetGain(const uint32_t instance,
+                               const uint8_t offset,
+                               const uint16_t gain);
+
+/*!
+ * @brief Get the user offset and gain correction
+ *
+ * @param[in] instance the instance number
+ * @param[out] offset the user offset correction (OFFSET_USER field)
+ * @param[out] gain the user gain correction (GAIN_USER field)
+ */
+void ADC_DRV_GetUserOffsetGain(const uint32_t instance,
+                               uint8_t * const offset,
+                               uint16_t * const gain);
+
 /*!
  * @brief Power up the ADC
  *
@@ -0,0 +1,337 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BCTU_DRIVER_H
+#define BCTU_DRIVER_H
+
+/*! @file */
+
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 2.5, Global macro not referenced.
+ * The macro defines a bitmask used to access status flags.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Directive 4.9, Function-like macro defined.
+ * The macros are defined to compute trigger indexes at compile time.
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "device_registers.h"
+#include "status.h"
+#include "edma_driver.h"
+
+/*!
+ * @defgroup bctu_driver BCTU Driver
+ * @brief Body Cross-Triggering Unit driver
+ *
+ * The BCTU starts ADC conversions on ADC0/ADC1 from hardware trigger events,
+ * without CPU involvement. Each trigger input converts either a single channel
+ * or a list of channels; the results are collected in one data register per
+ * ADC, which can be read by eDMA on each new result.
+ *
+ * The trigger inputs are driven by the eMIOS channel flags: trigger
+ * BCTU_TRIG_EMIOS(n, ch) fires when eMIOS_n channel ch raises its flag, e.g.
+ * at the position set with EMIOS_DRV_PWM_SetTriggerPlacement() in OPWMT mode.
+ * The ADC instances must be configured with ctuMode = ADC_CTU_MODE_TRIGGER.
+ *
+ * @addtogroup bctu_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of trigger inputs */
+#define BCTU_TRIG_COUNT          BCTU_TRGCFG__COUNT
+/*! @brief Number of entries in the channel list memory (two per LISTCHR register) */
+#define BCTU_LIST_SIZE           (2U * BCTU_LISTCHR__COUNT)
+/*! @brief Number of trigger inputs driven by each eMIOS instance */
+#define BCTU_TRIG_PER_EMIOS      32U
+/*! @brief Trigger input driven by the flag of eMIOS instance inst, channel chn */
+#define BCTU_TRIG_EMIOS(inst, chn)    (((uint32_t)(inst) * BCTU_TRIG_PER_EMIOS) + (uint32_t)(chn))
+
+/*! @brief ADC target mask selecting ADC0 */
+#define BCTU_ADC_TARGET_0        ((uint8_t)1U << 0U)
+/*! @brief ADC target mask selecting ADC1 */
+#define BCTU_ADC_TARGET_1        ((uint8_t)1U << 1U)
+
+/*!
+ * @brief Macros for status flags
+ *
+ * The flags of ADC1 are the flags of ADC0 shifted left by one.
+ */
+#define BCTU_FLAG_NEW_DATA(adcIdx)     (BCTU_MSR_NDATA0_MASK << (adcIdx))
+#define BCTU_FLAG_DATA_OVR(adcIdx)     (BCTU_MSR_DATAOVR0_MASK << (adcIdx))
+#define BCTU_FLAG_LIST_LAST(adcIdx)    (BCTU_MSR_LIST0_Last_MASK << (adcIdx))
+#define BCTU_FLAG_TRIGGER              (BCTU_MSR_TRGF_MASK)
+#define BCTU_FLAG_ALL                  (BCTU_MSR_NDATA0_MASK | BCTU_MSR_NDATA1_MASK | \
+                                        BCTU_MSR_DATAOVR0_MASK | BCTU_MSR_DATAOVR1_MASK | \
+                                        BCTU_MSR_LIST0_Last_MASK | BCTU_MSR_LIST1_Last_MASK | \
+                                        BCTU_MSR_TRGF_MASK)
+
+/*!
+ * @brief Defines the module configuration structure
+ *
+ * Implements : bctu_config_t_Class
+ */
+typedef struct
+{
+    bool freezeEnable;           /*!< Stop accepting triggers when the core is halted in debug mode */
+    bool globalTriggerEnable;    /*!< Accept all hardware triggers, regardless of their individual enable */
+    bool newDataIntEnable[FEATURE_BCTU_NUM_ADC]; /*!< Interrupt on new result, per ADC */
+    bool listLastIntEnable;      /*!< Interrupt on the conversion of the last list entry */
+    bool triggerIntEnable;       /*!< Interrupt on each accepted trigger */
+} bctu_config_t;
+
+/*!
+ * @brief Defines the trigger configuration structure
+ *
+ * Implements : bctu_trig_config_t_Class
+ */
+typedef struct
+{
+    uint8_t adcTargetMask;       /*!< ADCs started by the trigger (BCTU_ADC_TARGET_x) */
+    bool listMode;               /*!< true: convert the list starting at chanOrListIdx; false: convert a single channel */
+    uint8_t chanOrListIdx;       /*!< ADC channel, or index of the first list entry */
+    bool loopEnable;             /*!< In list mode, restart from the first entry after the last one */
+    bool hwTriggerEnable;        /*!< Enable the hardware trigger input */
+} bctu_trig_config_t;
+
+/*!
+ * @brief Defines the result returned by BCTU_DRV_GetConvResult()
+ *
+ * Implements : bctu_conv_result_t_Class
+ */
+typedef struct
+{
+    uint16_t adcData;            /*!< Conversion data */
+    uint8_t adcChan;             /*!< Converted ADC channel */
+    uint8_t triggerIdx;          /*!< Trigger input which started the conversion */
+    bool listFlag;               /*!< The conversion is part of a list */
+    bool lastFlag;               /*!< The conversion is the last entry of a list */
+} bctu_conv_result_t;
+
+/*!
+ * @brief Defines the configuration of the result transfer to memory
+ *
+ * With fullWord = false, each result is stored as a uint16_t holding the conversion
+ * data and the LIST/LAST flags (mask with BCTU_ADC0DR_ADC_DATA_MASK). With
+ * fullWord = true, each result is stored as the uint32_t image of the data register,
+ * which also identifies the channel and the trigger. A resultStride above 1 leaves
+ * room between consecutive results, e.g. to interleave the results of both ADCs.
+ *
+ * Implements : bctu_dma_config_t_Class
+ */
+typedef struct
+{
+    uint8_t dmaVirtualChannel;   /*!< eDMA virtual channel; its request source must be EDMA_REQ_BCTU_x */
+    void * buffer;               /*!< Destination buffer of resultCount results */
+    uint32_t resultCount;        /*!< Number of results transferred to the buffer */
+    uint8_t resultStride;        /*!< Distance between two results in the buffer, in elements; 0 or 1: contiguous */
+    bool fullWord;               /*!< Store the whole data register instead of the lower half */
+    bool circular;               /*!< Wrap to the start of the buffer after resultCount results */
+    edma_callback_t callback;    /*!< Invoked at the half and at the end of the buffer; can be NULL */
+    void * callbackParam;        /*!< Callback parameter */
+} bctu_dma_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Get the default module configuration
+ *
+ * All hardware triggers disabled by default, interrupts disabled, freeze enabled.
+ *
+ * @param[out] config the configuration structure
+ */
+void BCTU_DRV_GetDefaultConfig(bctu_config_t * const config);
+
+/*!
+ * @brief Initialize the module
+ *
+ * Enables the module and applies the configuration. The trigger and list
+ * configurations are not modified.
+ *
+ * @param[in] instance the instance number
+ * @param[in] config the configuration structure
+ */
+void BCTU_DRV_Init(const uint32_t instance,
+                   const bctu_config_t * const config);
+
+/*!
+ * @brief Reset the module
+ *
+ * Disables all the triggers, interrupts and DMA requests, clears the channel
+ * lists and the status flags.
+ *
+ * @param[in] instance the instance number
+ */
+void BCTU_DRV_Reset(const uint32_t instance);
+
+/*!
+ * @brief Write a list of channels
+ *
+ * Writes numChannels entries of the channel list memory, starting at listIdx,
+ * and marks the last one as the end of the list.
+ *
+ * @param[in] instance the instance number
+ * @param[in] listIdx index of the first list entry to write
+ * @param[in] channels array of ADC channel indexes
+ * @param[in] numChannels number of channels, listIdx + numChannels <= BCTU_LIST_SIZE
+ */
+void BCTU_DRV_SetChannelList(const uint32_t instance,
+                             const uint8_t listIdx,
+                             const uint8_t * const channels,
+                             const uint8_t numChannels);
+
+/*!
+ * @brief Configure a trigger input
+ *
+ * @param[in] instance the instance number
+ * @param[in] trigIdx the trigger input index
+ * @param[in] config the trigger configuration structure
+ */
+void BCTU_DRV_ConfigTrigger(const uint32_t instance,
+                            const uint32_t trigIdx,
+                            const bctu_trig_config_t * const config);
+
+/*!
+ * @brief Enable or disable a hardware trigger input
+ *
+ * @param[in] instance the instance number
+ * @param[in] trigIdx the trigger input index
+ * @param[in] enable true to accept the hardware trigger
+ */
+void BCTU_DRV_EnableHwTrigger(const uint32_t instance,
+                              const uint32_t trigIdx,
+                              const bool enable);
+
+/*!
+ * @brief Enable or disable all the hardware trigger inputs
+ *
+ * When enabled, all the hardware triggers are accepted, regardless of their
+ * individual enable.
+ *
+ * @param[in] instance the instance number
+ * @param[in] enable true to accept all the hardware triggers
+ */
+void BCTU_DRV_SetGlobalTriggerEnable(const uint32_t instance,
+                                     const bool enable);
+
+/*!
+ * @brief Start the conversions of a trigger by software
+ *
+ * @param[in] instance the instance number
+ * @param[in] trigIdx the trigger input index
+ */
+void BCTU_DRV_SoftwareTrigger(const uint32_t instance,
+                              const uint32_t trigIdx);
+
+/*!
+ * @brief Read the last result of an ADC
+ *
+ * Reading the result clears the new data flag of the ADC.
+ *
+ * @param[in] instance the instance number
+ * @param[in] adcIdx the ADC index
+ * @param[out] result the conversion result
+ */
+void BCTU_DRV_GetConvResult(const uint32_t instance,
+                            const uint32_t adcIdx,
+                            bctu_conv_result_t * const result);
+
+/*!
+ * @brief Get the status flags
+ *
+ * @param[in] instance the instance number
+ * @return the status flags (BCTU_FLAG_x)
+ */
+uint32_t BCTU_DRV_GetStatusFlags(const uint32_t instance);
+
+/*!
+ * @brief Clear status flags
+ *
+ * @param[in] instance the instance number
+ * @param[in] flags the flags to clear (BCTU_FLAG_x)
+ */
+void BCTU_DRV_ClearStatusFlags(const uint32_t instance,
+                               const uint32_t flags);
+
+/*!
+ * @brief Enable or disable the DMA request of an ADC
+ *
+ * When enabled, each new result of the ADC requests an eDMA transfer
+ * (EDMA_REQ_BCTU_0 for ADC0, EDMA_REQ_BCTU_1 for ADC1); the request is
+ * cleared when the eDMA reads the result data register.
+ *
+ * @param[in] instance the instance number
+ * @param[in] adcIdx the ADC index
+ * @param[in] enable true to enable the DMA request
+ */
+void BCTU_DRV_EnableDma(const uint32_t instance,
+                        const uint32_t adcIdx,
+                        const bool enable);
+
+/*!
+ * @brief Get the address of the result data register of an ADC
+ *
+ * @param[in] instance the instance number
+ * @param[in] adcIdx the ADC index
+ * @return the address of the ADCxDR register
+ */
+uint32_t BCTU_DRV_GetResultRegAddr(const uint32_t instance,
+                                   const uint32_t adcIdx);
+
+/*!
+ * @brief Configure the transfer of the results of an ADC to memory
+ *
+ * Configures the eDMA virtual channel to move one result per BCTU request into
+ * the buffer and enables the DMA request of the ADC. The eDMA module and the
+ * virtual channel must be initialized with the request source of the ADC before;
+ * the transfer begins when the channel is started with EDMA_DRV_StartChannel().
+ *
+ * @param[in] instance the instance number
+ * @param[in] adcIdx the ADC index
+ * @param[in] config the transfer configuration structure
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the eDMA transfer cannot be configured.
+ */
+status_t BCTU_DRV_ConfigResultDma(const uint32_t instance,
+                                  const uint32_t adcIdx,
+                                  const bctu_dma_config_t * const config);
+
+#if defined (__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* BCTU_DRIVER_H */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -106,6 +106,11 @@ static ADC_Type * const s_adcBase[ADC_INSTANCE_COUNT] = ADC_BASE_PTRS;
 static uint32_t const s_adcThrhlr_count[ADC_INSTANCE_COUNT] = ADC_THRHLR_PER_INSTANCE_COUNT;
 #endif
 
+/* ADCLKSEL state saved by ADC_DRV_StartCalibration, restored by ADC_DRV_EndCalibration */
+static uint32_t s_adcCalClkSel[ADC_INSTANCE_COUNT];
+/* Calibration started and not yet ended, per instance */
+static bool s_adcCalStarted[ADC_INSTANCE_COUNT];
+
 #if FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL
 static const uint32_t ADC_CHAN_BITMAP[ADC_INSTANCE_COUNT][ADC_SAR_MAX_GROUP_NUM] = FEATURE_ADC_CHN_AVAIL_BITMAP;
 #endif /* FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL */
@@ -196,25 +201,18 @@ static uint32_t ADC_GetConvResults(const uint32_t instance,
             continue; /* skip if the CEOCFR[vectAdr] is not available */
         }
 #endif /* FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL */
-        if (base->CEOCFR[vectAdr] == 0U)
-        {
-            continue; /* skip if there are no complete conversions in the group */
-        }
-        uint32_t vectBit;
-        /* go through each bit in the group, check if there is a completed conversion */
-        for (vectBit = 0u; vectBit < 32u; vectBit++)
-        {
-            if ((base->CEOCFR[vectAdr] & (1UL << vectBit)) == 0U)
-            {
-                continue; /* skip if the channel does not have a conversion ready */
-            }
-            uint8_t chnIdx = (uint8_t)((vectAdr * 32u) + vectBit);
+        /* read the volatile flags once, then walk the snapshot */
+        uint32_t pending = base->CEOCFR[vectAdr];
 #if FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL
-            if (!ADC_INST_HAS_CDRn(instance, chnIdx))
-            {
-                continue; /* skip if the CDR register is not available */
-            }
+        pending &= ADC_CHAN_BITMAP[instance][vectAdr]; /* skip channels without a CDR register */
 #endif /* FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL */
+        uint32_t consumed = 0u;
+        /* visit only the channels which have a conversion ready, lowest index first */
+        while (pending != 0u)
+        {
+            uint32_t vectBit = ADC_LowestSetBit(pending);
+            pending &= pending - 1u;
+            uint8_t chnIdx = (uint8_t)((vectAdr * 32u) + vectBit);
             if (chnIdx >= ADC_CDR_COUNT)
             {
                 /* terminate if we exceeded the maximum index of the channels */
@@ -238,8 +236,8 @@ static uint32_t ADC_GetConvResults(const uint32_t instance,
                     resultsStruct[index].valid = ((cdr & ADC_CDR_VALID_MASK) != 0U) ? true : false;
                     resultsStruct[index].overWritten = ((cdr & ADC_CDR_OVERW_MASK) != 0U) ? true : false;
                 }
-                /* increment the current index and reset the CEOCFR flag */
-                base->CEOCFR[vectAdr] = (1UL) << vectBit; /* w1c bit */
+                /* increment the current index and mark the CEOCFR flag for reset */
+                consumed |= (1UL) << vectBit;
                 index++;
                 if (index >= length)
                 {
@@ -251,6 +249,10 @@ static uint32_t ADC_GetConvResults(const uint32_t instance,
                 }
             }
         }
+        if (consumed != 0u)
+        {
+            base->CEOCFR[vectAdr] = consumed; /* w1c all the flags read from this group */
+        }
         if (length_exceeded)
         {
             break;
@@ -705,6 +707,25 @@ void ADC_DRV_StartConversion(const uint32_t instance,
     }
 }
 
+/*FUNCTION**********************************************************************
+*
+* Function Name : ADC_DRV_StopConversion
+* Description   : This function stops the Normal conversion chain running in Scan
+*  mode, by clearing NSTART; the hardware completes the current chain.
+*
+* Implements    : ADC_DRV_StopConversion_Activity
+* END**************************************************************************/
+void ADC_DRV_StopConversion(const uint32_t instance,
+                            const adc_conv_chain_t convChain)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+    DEV_ASSERT(convChain == ADC_CONV_CHAIN_NORMAL);
+    (void)convChain;
+
+    ADC_Type * const base = s_adcBase[instance];
+    REG_BIT_CLEAR32(&(base->MCR), ADC_MCR_NSTART(1U));
+}
+
 /*FUNCTION**********************************************************************
 *
 * Function Name : ADC_DRV_GetStatusFlags
@@ -804,15 +825,74 @@ uint32_t ADC_DRV_GetConvInfoToArray(const uint32_t instance,
 
 /*FUNCTION**********************************************************************
 *
-* Function Name : ADC_DRV_DoCalibration
-* Description   : This functions executes a calibration sequence. It is recommended
-*  to run this sequence before using the ADC converter. The maximum clock frequency
-*  for the calibration is 40 MHz, this function sets the ADCLKSEL bit resulting in
-*  a maximum input clock frequency of 80 MHz.
+* Function Name : ADC_DRV_GetConvResultsToChannelArray
+* Description   : This function reads the conversion result values for a conversion chain
+*  into an array indexed by channel number. Each CEOCFR register is read once and all
+*  the flags consumed from it are cleared with a single write.
 *
-* Implements    : ADC_DRV_DoCalibration_Activity
+* Implements    : ADC_DRV_GetConvResultsToChannelArray_Activity
 * END**************************************************************************/
-status_t ADC_DRV_DoCalibration(const uint32_t instance)
+uint32_t ADC_DRV_GetConvResultsToChannelArray(const uint32_t instance,
+                                              const adc_conv_chain_t convChain,
+                                              uint16_t * const results,
+                                              uint32_t * const updatedMask)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+    DEV_ASSERT(results != NULL);
+
+    uint32_t count = 0u;
+    ADC_Type * const base = s_adcBase[instance];
+    uint32_t vectAdr;
+
+    for (vectAdr = 0u; vectAdr < ADC_CEOCFR_COUNT; vectAdr++)
+    {
+        uint32_t consumed = 0u;
+#if FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL
+        if (ADC_INST_HAS_CEOCFRn(instance, vectAdr))
+#endif /* FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL */
+        {
+            uint32_t pending = base->CEOCFR[vectAdr];
+#if FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL
+            pending &= ADC_CHAN_BITMAP[instance][vectAdr]; /* skip channels without a CDR register */
+#endif /* FEATURE_ADC_BAD_ACCESS_PROT_CHANNEL */
+            while (pending != 0u)
+            {
+                uint32_t chnIdx = (vectAdr * 32u) + ADC_LowestSetBit(pending);
+                pending &= pending - 1u;
+                uint32_t cdr = base->CDR[chnIdx];
+                if (ADC_CDR_RESULT((uint32_t)convChain) == (cdr & ADC_CDR_RESULT_MASK))
+                {
+                    results[chnIdx] = (uint16_t)((cdr & ADC_CDR_CDATA_MASK) >> ADC_CDR_CDATA_SHIFT);
+                    consumed |= (1UL) << CHAN_2_BIT(chnIdx);
+                    count++;
+                }
+            }
+            if (consumed != 0u)
+            {
+                base->CEOCFR[vectAdr] = consumed; /* w1c all the flags read from this group */
+            }
+        }
+        if (updatedMask != NULL)
+        {
+            updatedMask[vectAdr] = consumed;
+        }
+    }
+
+    return count;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : ADC_DRV_StartCalibration
+* Description   : This function starts a calibration sequence and returns
+*  without waiting for its completion. The maximum clock frequency for the
+*  calibration is 40 MHz, this function clears the ADCLKSEL bit resulting in
+*  a maximum input clock frequency of 80 MHz. ADCLKSEL is restored by
+*  ADC_DRV_EndCalibration once the sequence is over.
+*
+* Implements    : ADC_DRV_StartCalibration_Activity
+* END**************************************************************************/
+void ADC_DRV_StartCalibration(const uint32_t instance)
 {
     DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
 #if defined(DEV_ERROR_DETECT) || defined(CUSTOM_DEVASSERT)
@@ -825,14 +905,14 @@ status_t ADC_DRV_DoCalibration(const uint32_t instance)
     DEV_ASSERT(adc_freq <= ADC_CLOCK_FREQ_MAX_CALIBRATION);
 #endif
 
-    status_t ret = STATUS_SUCCESS;
-
     ADC_Type * const base = s_adcBase[instance];
+    s_adcCalStarted[instance] = true;
 #if FEATURE_ADC_HAS_CALIBRATION_ALT
     /* Note: this mode implies FEATURE_ADC_HAS_CLKSEL_EXTENDED == 1 */
     ADC_Powerdown(base);
     /* Reset CLKSEL to 0x00 (will set to half bus speed) */
-    uint32_t mcr = base->MCR; /* save the current state of MCR to restore ADCLKSEL */
+    /* save the current state of MCR to restore ADCLKSEL */
+    s_adcCalClkSel[instance] = base->MCR & (ADC_MCR_ADCLKSE_MASK | ADC_MCR_ADCLKDIV_MASK);
     REG_BIT_CLEAR32(&(base->MCR), ADC_MCR_ADCLKSE_MASK | ADC_MCR_ADCLKDIV_MASK);
     ADC_Powerup(base);
 
@@ -841,25 +921,12 @@ status_t ADC_DRV_DoCalibration(const uint32_t instance)
     base->MCR |= ADC_MCR_NRSMPL(0x03u) | ADC_MCR_AVGEN(1U);
     /* start calibration */
     REG_BIT_SET32(&(base->MCR), ADC_MCR_CALSTART(1U));
-    while ((base->MSR & ADC_MSR_CALBUSY_MASK) != 0U)
-    {
-        /* Wait for calibration to finish */
-    }
-
-    /* If the calibration failed, return error */
-    if ((base->MSR & ADC_MSR_CALFAIL_MASK) != 0U)
-    {
-        ret = STATUS_ERROR;
-    }
-
-    /* restore the state of ADCLKSEL */
-    REG_BIT_SET32(&(base->MCR), (uint32_t) (mcr & (ADC_MCR_ADCLKSE_MASK | ADC_MCR_ADCLKDIV_MASK)));
-
 #else
     /* Note: this mode implies FEATURE_ADC_HAS_CLKSEL_EXTENDED == 0 */
     ADC_Powerdown(base);
     /* Reset CLKSEL to 0x00 (will set to half bus speed) */
-    uint32_t mcr = base->MCR; /* save the current state of MCR to restore ADCLKSEL */
+    /* save the current state of MCR to restore ADCLKSEL */
+    s_adcCalClkSel[instance] = base->MCR & ADC_MCR_ADCLKSEL_MASK;
     REG_BIT_CLEAR32(&(base->MCR), ADC_MCR_ADCLKSEL_MASK);
     ADC_Powerup(base);
     uint32_t calbistreg = base->CALBISTREG;
@@ -871,23 +938,145 @@ status_t ADC_DRV_DoCalibration(const uint32_t instance)
     REG_BIT_SET32(&(base->CALBISTREG), ADC_CALBISTREG_TEST_FAIL_MASK);
     /* start calibration */
     REG_BIT_SET32(&(base->CALBISTREG), ADC_CALBISTREG_TEST_EN(1U));
-    while ((base->CALBISTREG & ADC_CALBISTREG_C_T_BUSY_MASK) != 0U)
+#endif
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : ADC_DRV_GetCalibrationStatus
+* Description   : This function returns the state of the calibration sequence
+*  started by ADC_DRV_StartCalibration. The registers are only read.
+*
+* Implements    : ADC_DRV_GetCalibrationStatus_Activity
+* END**************************************************************************/
+status_t ADC_DRV_GetCalibrationStatus(const uint32_t instance)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+
+    status_t ret = STATUS_SUCCESS;
+    const ADC_Type * const base = s_adcBase[instance];
+
+#if FEATURE_ADC_HAS_CALIBRATION_ALT
+    if ((base->MSR & ADC_MSR_CALBUSY_MASK) != 0U)
     {
-        /* Wait for calibration to finish */
+        ret = STATUS_BUSY;
     }
-
     /* If the calibration failed, return error */
-    if ((base->CALBISTREG & ADC_CALBISTREG_TEST_FAIL_MASK) != 0U)
+    else if ((base->MSR & ADC_MSR_CALFAIL_MASK) != 0U)
+    {
+        ret = STATUS_ERROR;
+    }
+#else
+    if ((base->CALBISTREG & ADC_CALBISTREG_C_T_BUSY_MASK) != 0U)
+    {
+        ret = STATUS_BUSY;
+    }
+    /* If the calibration failed, return error */
+    else if ((base->CALBISTREG & ADC_CALBISTREG_TEST_FAIL_MASK) != 0U)
     {
         ret = STATUS_ERROR;
     }
-
-    /* restore the state of ADCLKSEL */
-    REG_BIT_SET32(&(base->MCR), (uint32_t) (mcr & ADC_MCR_ADCLKSEL_MASK));
 #endif
+    else
+    {
+        /* nothing to do */
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : ADC_DRV_EndCalibration
+* Description   : This function ends the calibration sequence started by
+*  ADC_DRV_StartCalibration, once ADC_DRV_GetCalibrationStatus reports it is
+*  over: the ADCLKSEL state saved at start is restored. Further calls before
+*  the next ADC_DRV_StartCalibration have no effect.
+*
+* Implements    : ADC_DRV_EndCalibration_Activity
+* END**************************************************************************/
+void ADC_DRV_EndCalibration(const uint32_t instance)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+    DEV_ASSERT(ADC_DRV_GetCalibrationStatus(instance) != STATUS_BUSY);
+
+    ADC_Type * const base = s_adcBase[instance];
+
+    if (s_adcCalStarted[instance])
+    {
+        /* restore the state of ADCLKSEL */
+        REG_BIT_SET32(&(base->MCR), s_adcCalClkSel[instance]);
+        s_adcCalStarted[instance] = false;
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : ADC_DRV_DoCalibration
+* Description   : This functions executes a calibration sequence. It is recommended
+*  to run this sequence before using the ADC converter. The maximum clock frequency
+*  for the calibration is 40 MHz, this function sets the ADCLKSEL bit resulting in
+*  a maximum input clock frequency of 80 MHz.
+*
+* Implements    : ADC_DRV_DoCalibration_Activity
+* END**************************************************************************/
+status_t ADC_DRV_DoCalibration(const uint32_t instance)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+
+    status_t ret;
+
+    ADC_DRV_StartCalibration(instance);
+    do
+    {
+        /* Wait for calibration to finish */
+        ret = ADC_DRV_GetCalibrationStatus(instance);
+    } while (ret == STATUS_BUSY);
+    ADC_DRV_EndCalibration(instance);
+
     return ret;
 }
 
+/*FUNCTION**********************************************************************
+*
+* Function Name : ADC_DRV_SetUserOffsetGain
+* Description   : This function writes the user offset and gain correction
+*  applied by the converter on top of its calibration.
+*
+* Implements    : ADC_DRV_SetUserOffsetGain_Activity
+* END**************************************************************************/
+void ADC_DRV_SetUserOffsetGain(const uint32_t instance,
+                               const uint8_t offset,
+                               const uint16_t gain)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+    DEV_ASSERT(gain <= (ADC_OFSGNUSR_GAIN_USER_MASK >> ADC_OFSGNUSR_GAIN_USER_SHIFT));
+
+    ADC_Type * const base = s_adcBase[instance];
+    base->OFSGNUSR = ADC_OFSGNUSR_OFFSET_USER(offset) | ADC_OFSGNUSR_GAIN_USER(gain);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : ADC_DRV_GetUserOffsetGain
+* Description   : This function reads the user offset and gain correction.
+*
+* Implements    : ADC_DRV_GetUserOffsetGain_Activity
+* END**************************************************************************/
+void ADC_DRV_GetUserOffsetGain(const uint32_t instance,
+                               uint8_t * const offset,
+                               uint16_t * const gain)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+    DEV_ASSERT((offset != NULL) && (gain != NULL));
+
+    const ADC_Type * const base = s_adcBase[instance];
+    const uint32_t ofsgnusr = base->OFSGNUSR;
+
+    *offset = (uint8_t)((ofsgnusr & ADC_OFSGNUSR_OFFSET_USER_MASK) >> ADC_OFSGNUSR_OFFSET_USER_SHIFT);
+    *gain = (uint16_t)((ofsgnusr & ADC_OFSGNUSR_GAIN_USER_MASK) >> ADC_OFSGNUSR_GAIN_USER_SHIFT);
+}
+
 /*FUNCTION**********************************************************************
 *
 * Function Name : ADC_DRV_Powerup
@@ -400,6 +400,26 @@ static inline void ADC_ResetWdogCWSELR(ADC_Type * const base, uint8_t cwselrId)
 #endif /* FEATURE_ADC_HAS_CWSELR_UNROLLED */
 }
 
+/* Returns the index of the least significant bit set in a non-zero value.
+ * Isolating the bit before counting the leading zeros maps to a single cntlzw. */
+static inline uint32_t ADC_LowestSetBit(const uint32_t value)
+{
+#if defined(__GNUC__)
+    return (ADC_HW_REG_SIZE - 1u) - (uint32_t)__builtin_clz(value & (0u - value));
+#else
+    uint32_t isolated = value & (0u - value);
+    uint32_t bitIdx = 0u;
+
+    if ((isolated & 0xFFFF0000u) != 0u) { bitIdx += 16u; }
+    if ((isolated & 0xFF00FF00u) != 0u) { bitIdx += 8u; }
+    if ((isolated & 0xF0F0F0F0u) != 0u) { bitIdx += 4u; }
+    if ((isolated & 0xCCCCCCCCu) != 0u) { bitIdx += 2u; }
+    if ((isolated & 0xAAAAAAAAu) != 0u) { bitIdx += 1u; }
+
+    return bitIdx;
+#endif
+}
+
 
 #if defined (__cplusplus)
 extern "C" {
@@ -0,0 +1,424 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.4, Conversion between a pointer and integer type.
+ * The cast is required to pass the register and buffer addresses to the eDMA driver.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.6, Cast from unsigned int to pointer.
+ * The cast is required to initialize a pointer with an unsigned long define, representing an address.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 10.5, Impermissible cast; cannot cast from 'essentially Boolean'
+ * to 'essentially unsigned'. This is required by the conversion of a bool into a bit.
+ *
+ */
+
+#include <stddef.h>
+#include "device_registers.h"
+#include "bctu_driver.h"
+#include "bctu_hw_access.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* The conversion data is the lower half of ADCxDR; on big endian cores it is at offset 2 */
+#if defined(CORE_BIG_ENDIAN)
+#define BCTU_DATA_HALF_OFFSET    2U
+#else
+#define BCTU_DATA_HALF_OFFSET    0U
+#endif
+
+/* Maximum major loop count of an eDMA channel with minor loop linking disabled */
+#define BCTU_DMA_MAX_RESULTS     0x7FFFU
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Table of base addresses for BCTU instances. */
+static BCTU_Type * const s_bctuBase[BCTU_INSTANCE_COUNT] = BCTU_BASE_PTRS;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_GetDefaultConfig
+* Description   : This function initializes the members of the bctu_config_t
+*  structure to default values: no global trigger, all interrupts disabled
+*  and triggers ignored while the core is halted in debug mode.
+*
+* Implements    : BCTU_DRV_GetDefaultConfig_Activity
+* END**************************************************************************/
+void BCTU_DRV_GetDefaultConfig(bctu_config_t * const config)
+{
+    DEV_ASSERT(config != NULL);
+
+    uint32_t adcIdx;
+
+    config->freezeEnable = true;
+    config->globalTriggerEnable = false;
+    for (adcIdx = 0u; adcIdx < FEATURE_BCTU_NUM_ADC; adcIdx++)
+    {
+        config->newDataIntEnable[adcIdx] = false;
+    }
+    config->listLastIntEnable = false;
+    config->triggerIntEnable = false;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_Init
+* Description   : This function enables the BCTU and configures the module
+*  level options. The DMA requests are configured by BCTU_DRV_EnableDma.
+*
+* Implements    : BCTU_DRV_Init_Activity
+* END**************************************************************************/
+void BCTU_DRV_Init(const uint32_t instance,
+                   const bctu_config_t * const config)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(config != NULL);
+
+    BCTU_Type * const base = s_bctuBase[instance];
+    uint32_t mcr = base->MCR & (BCTU_MCR_DMA0_MASK | BCTU_MCR_DMA1_MASK);
+
+    mcr |= BCTU_MCR_FRZ(config->freezeEnable ? 1u : 0u);
+    mcr |= BCTU_MCR_GTRGEN(config->globalTriggerEnable ? 1u : 0u);
+    mcr |= BCTU_MCR_IEN0(config->newDataIntEnable[0] ? 1u : 0u);
+    mcr |= BCTU_MCR_IEN1(config->newDataIntEnable[1] ? 1u : 0u);
+    mcr |= BCTU_MCR_LIST_IEN(config->listLastIntEnable ? 1u : 0u);
+    mcr |= BCTU_MCR_TRGEN(config->triggerIntEnable ? 1u : 0u);
+    /* MDIS stays cleared, the module is enabled */
+    base->MCR = mcr;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_Reset
+* Description   : This function writes the BCTU registers with their
+*  Reference Manual reset values and clears the status flags.
+*
+* Implements    : BCTU_DRV_Reset_Activity
+* END**************************************************************************/
+void BCTU_DRV_Reset(const uint32_t instance)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+
+    BCTU_Type * const base = s_bctuBase[instance];
+    uint32_t idx;
+
+    /* stop accepting triggers before touching their configuration */
+    base->MCR = 0u;
+    for (idx = 0u; idx < BCTU_TRGCFG__COUNT; idx++)
+    {
+        base->TRGCFG_[idx] = 0u;
+    }
+    for (idx = 0u; idx < BCTU_LISTCHR__COUNT; idx++)
+    {
+        base->LISTCHR_[idx] = 0u;
+    }
+    BCTU_ClearStatusFlags(base, BCTU_FLAG_ALL);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_SetChannelList
+* Description   : This function writes consecutive entries of the channel list
+*  memory and sets the LAST bit on the final entry only.
+*
+* Implements    : BCTU_DRV_SetChannelList_Activity
+* END**************************************************************************/
+void BCTU_DRV_SetChannelList(const uint32_t instance,
+                             const uint8_t listIdx,
+                             const uint8_t * const channels,
+                             const uint8_t numChannels)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(channels != NULL);
+    DEV_ASSERT(numChannels > 0u);
+    DEV_ASSERT(((uint32_t)listIdx + (uint32_t)numChannels) <= BCTU_LIST_SIZE);
+
+    BCTU_Type * const base = s_bctuBase[instance];
+    uint32_t idx;
+
+    for (idx = 0u; idx < numChannels; idx++)
+    {
+        DEV_ASSERT(channels[idx] < ADC_CDR_COUNT);
+        BCTU_SetListEntry(base, (uint32_t)listIdx + idx, channels[idx], (idx + 1u) == numChannels);
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_ConfigTrigger
+* Description   : This function configures the ADCs, the channel or list and
+*  the enable of a trigger input with a single register write.
+*
+* Implements    : BCTU_DRV_ConfigTrigger_Activity
+* END**************************************************************************/
+void BCTU_DRV_ConfigTrigger(const uint32_t instance,
+                            const uint32_t trigIdx,
+                            const bctu_trig_config_t * const config)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(trigIdx < BCTU_TRIG_COUNT);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->adcTargetMask != 0u);
+    DEV_ASSERT(config->adcTargetMask < ((uint8_t)1U << FEATURE_BCTU_NUM_ADC));
+    DEV_ASSERT(config->listMode ? (config->chanOrListIdx < BCTU_LIST_SIZE) : (config->chanOrListIdx < ADC_CDR_COUNT));
+    DEV_ASSERT(config->listMode || !config->loopEnable);
+
+    BCTU_Type * const base = s_bctuBase[instance];
+    uint32_t trgcfg = 0u;
+
+    trgcfg |= BCTU_TRGCFG__CHANNEL_VALUE_OR_LADDR(config->chanOrListIdx);
+    trgcfg |= BCTU_TRGCFG__ADC_SEL0(((config->adcTargetMask & BCTU_ADC_TARGET_0) != 0u) ? 1u : 0u);
+    trgcfg |= BCTU_TRGCFG__ADC_SEL1(((config->adcTargetMask & BCTU_ADC_TARGET_1) != 0u) ? 1u : 0u);
+    trgcfg |= BCTU_TRGCFG__TRS(config->listMode ? 1u : 0u);
+    trgcfg |= BCTU_TRGCFG__LOOP(config->loopEnable ? 1u : 0u);
+    trgcfg |= BCTU_TRGCFG__TRIGEN(config->hwTriggerEnable ? 1u : 0u);
+    base->TRGCFG_[trigIdx] = trgcfg;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_EnableHwTrigger
+* Description   : This function enables or disables a hardware trigger input.
+*
+* Implements    : BCTU_DRV_EnableHwTrigger_Activity
+* END**************************************************************************/
+void BCTU_DRV_EnableHwTrigger(const uint32_t instance,
+                              const uint32_t trigIdx,
+                              const bool enable)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(trigIdx < BCTU_TRIG_COUNT);
+
+    BCTU_SetTrgcfgBits(s_bctuBase[instance], trigIdx, BCTU_TRGCFG__TRIGEN_MASK, enable);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_SetGlobalTriggerEnable
+* Description   : This function enables or disables all the hardware trigger
+*  inputs at once.
+*
+* Implements    : BCTU_DRV_SetGlobalTriggerEnable_Activity
+* END**************************************************************************/
+void BCTU_DRV_SetGlobalTriggerEnable(const uint32_t instance,
+                                     const bool enable)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+
+    BCTU_SetMcrBits(s_bctuBase[instance], BCTU_MCR_GTRGEN_MASK, enable);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_SoftwareTrigger
+* Description   : This function starts the conversions configured for a
+*  trigger input, as if the hardware trigger had occurred.
+*
+* Implements    : BCTU_DRV_SoftwareTrigger_Activity
+* END**************************************************************************/
+void BCTU_DRV_SoftwareTrigger(const uint32_t instance,
+                              const uint32_t trigIdx)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(trigIdx < BCTU_TRIG_COUNT);
+
+    BCTU_SoftwareTrigger(s_bctuBase[instance], trigIdx);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_GetConvResult
+* Description   : This function reads the result data register of an ADC once
+*  and decodes the data, the channel and the trigger source.
+*
+* Implements    : BCTU_DRV_GetConvResult_Activity
+* END**************************************************************************/
+void BCTU_DRV_GetConvResult(const uint32_t instance,
+                            const uint32_t adcIdx,
+                            bctu_conv_result_t * const result)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(adcIdx < FEATURE_BCTU_NUM_ADC);
+    DEV_ASSERT(result != NULL);
+
+    /* the layout of ADC1DR is the same as ADC0DR */
+    const uint32_t data = *BCTU_GetDataReg(s_bctuBase[instance], adcIdx);
+
+    result->adcData = (uint16_t)((data & BCTU_ADC0DR_ADC_DATA_MASK) >> BCTU_ADC0DR_ADC_DATA_SHIFT);
+    result->adcChan = (uint8_t)((data & BCTU_ADC0DR_CH_MASK) >> BCTU_ADC0DR_CH_SHIFT);
+    result->triggerIdx = (uint8_t)((data & BCTU_ADC0DR_TRG_SRC_MASK) >> BCTU_ADC0DR_TRG_SRC_SHIFT);
+    result->listFlag = ((data & BCTU_ADC0DR_LIST_MASK) != 0u) ? true : false;
+    result->lastFlag = ((data & BCTU_ADC0DR_LAST_MASK) != 0u) ? true : false;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_GetStatusFlags
+* Description   : This function returns the status flags of the BCTU.
+*
+* Implements    : BCTU_DRV_GetStatusFlags_Activity
+* END**************************************************************************/
+uint32_t BCTU_DRV_GetStatusFlags(const uint32_t instance)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+
+    return s_bctuBase[instance]->MSR & BCTU_FLAG_ALL;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_ClearStatusFlags
+* Description   : This function clears the selected status flags of the BCTU.
+*
+* Implements    : BCTU_DRV_ClearStatusFlags_Activity
+* END**************************************************************************/
+void BCTU_DRV_ClearStatusFlags(const uint32_t instance,
+                               const uint32_t flags)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT((flags & ~BCTU_FLAG_ALL) == 0u);
+
+    BCTU_ClearStatusFlags(s_bctuBase[instance], flags);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_EnableDma
+* Description   : This function enables or disables the DMA request raised on
+*  each new result of an ADC.
+*
+* Implements    : BCTU_DRV_EnableDma_Activity
+* END**************************************************************************/
+void BCTU_DRV_EnableDma(const uint32_t instance,
+                        const uint32_t adcIdx,
+                        const bool enable)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(adcIdx < FEATURE_BCTU_NUM_ADC);
+
+    BCTU_SetMcrBits(s_bctuBase[instance], BCTU_MCR_DMA0_MASK << adcIdx, enable);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_GetResultRegAddr
+* Description   : This function returns the address of the result data
+*  register of an ADC, to be used as eDMA source address.
+*
+* Implements    : BCTU_DRV_GetResultRegAddr_Activity
+* END**************************************************************************/
+uint32_t BCTU_DRV_GetResultRegAddr(const uint32_t instance,
+                                   const uint32_t adcIdx)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(adcIdx < FEATURE_BCTU_NUM_ADC);
+
+    return (uint32_t)BCTU_GetDataReg(s_bctuBase[instance], adcIdx);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : BCTU_DRV_ConfigResultDma
+* Description   : This function configures an eDMA channel to move one result
+*  per BCTU request from the data register of an ADC to memory, then enables the
+*  DMA request of the ADC. The source address is fixed; one major loop covers
+*  the buffer, which is rewound after the last result in circular mode.
+*
+* Implements    : BCTU_DRV_ConfigResultDma_Activity
+* END**************************************************************************/
+status_t BCTU_DRV_ConfigResultDma(const uint32_t instance,
+                                  const uint32_t adcIdx,
+                                  const bctu_dma_config_t * const config)
+{
+    DEV_ASSERT(instance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(adcIdx < FEATURE_BCTU_NUM_ADC);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->buffer != NULL);
+    DEV_ASSERT((config->resultCount > 0u) && (config->resultCount <= BCTU_DMA_MAX_RESULTS));
+
+    status_t status;
+    const uint32_t resultSize = config->fullWord ? (uint32_t)sizeof(uint32_t) : (uint32_t)sizeof(uint16_t);
+    const uint32_t resultPitch = resultSize * ((config->resultStride > 1u) ? (uint32_t)config->resultStride : 1u);
+    const edma_transfer_size_t transferSize = config->fullWord ? EDMA_TRANSFER_SIZE_4B : EDMA_TRANSFER_SIZE_2B;
+    const uint32_t srcAddr = BCTU_DRV_GetResultRegAddr(instance, adcIdx) + (config->fullWord ? 0u : BCTU_DATA_HALF_OFFSET);
+    const bool interruptEnable = (config->callback != NULL) ? true : false;
+
+    edma_loop_transfer_config_t loopConfig =
+    {
+        .majorLoopIterationCount = config->resultCount,
+        .srcOffsetEnable = false,
+        .dstOffsetEnable = false,
+        .minorLoopOffset = 0,
+        .minorLoopChnLinkEnable = false,
+        .minorLoopChnLinkNumber = 0U,
+        .majorLoopChnLinkEnable = false,
+        .majorLoopChnLinkNumber = 0U
+    };
+    edma_transfer_config_t transferConfig =
+    {
+        .srcAddr = srcAddr,
+        .destAddr = (uint32_t)config->buffer,
+        .srcTransferSize = transferSize,
+        .destTransferSize = transferSize,
+        .srcOffset = 0,
+        .destOffset = (int16_t)resultPitch,
+        .srcLastAddrAdjust = 0,
+        .destLastAddrAdjust = config->circular ? -(int32_t)(config->resultCount * resultPitch) : 0,
+        .srcModulo = EDMA_MODULO_OFF,
+        .destModulo = EDMA_MODULO_OFF,
+        .minorByteTransferCount = resultSize,
+        .scatterGatherEnable = false,
+        .scatterGatherNextDescAddr = 0U,
+        .interruptEnable = interruptEnable,
+        .loopTransferConfig = &loopConfig
+    };
+
+    status = EDMA_DRV_ConfigLoopTransfer(config->dmaVirtualChannel, &transferConfig);
+    if (status == STATUS_SUCCESS)
+    {
+        EDMA_DRV_ConfigureInterrupt(config->dmaVirtualChannel, EDMA_CHN_HALF_MAJOR_LOOP_INT, interruptEnable);
+        /* a one-shot transfer stops accepting BCTU requests once the buffer is full */
+        EDMA_DRV_DisableRequestsOnTransferComplete(config->dmaVirtualChannel, !config->circular);
+        status = EDMA_DRV_InstallCallback(config->dmaVirtualChannel, config->callback, config->callbackParam);
+    }
+    if (status == STATUS_SUCCESS)
+    {
+        BCTU_DRV_EnableDma(instance, adcIdx, true);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BCTU_HW_ACCESS_H
+#define BCTU_HW_ACCESS_H
+
+/*! @file */
+
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 18.4, The +, -, += and -= operators should
+ * not be applied to an expression of pointer type.
+ * The software trigger and the result data registers are consecutive in the
+ * memory map but are not declared as arrays; they are indexed from the first one.
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "device_registers.h"
+
+/*!
+ * @defgroup bctu_hw_access BCTU Hardware Access
+ * @brief BCTU register access functions
+ * @{
+ */
+
+/*******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/* Number of trigger bits in each software trigger register */
+#define BCTU_SFTRGR_SIZE           (32u)
+
+/* The write 1 to clear bits of MSR are the status bits shifted by 16 */
+#define BCTU_MSR_CLR_SHIFT         (16u)
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static inline void BCTU_SetMcrBits(BCTU_Type * const base,
+                                   const uint32_t mask,
+                                   const bool enable)
+{
+    if (enable)
+    {
+        REG_BIT_SET32(&(base->MCR), mask);
+    }
+    else
+    {
+        REG_BIT_CLEAR32(&(base->MCR), mask);
+    }
+}
+
+static inline void BCTU_SetTrgcfgBits(BCTU_Type * const base,
+                                      const uint32_t trigIdx,
+                                      const uint32_t mask,
+                                      const bool enable)
+{
+    if (enable)
+    {
+        REG_BIT_SET32(&(base->TRGCFG_[trigIdx]), mask);
+    }
+    else
+    {
+        REG_BIT_CLEAR32(&(base->TRGCFG_[trigIdx]), mask);
+    }
+}
+
+/* Each LISTCHR register holds two entries: the even one in the upper half,
+ * the odd one in the lower half */
+static inline void BCTU_SetListEntry(BCTU_Type * const base,
+                                     const uint32_t listIdx,
+                                     const uint8_t adcChan,
+                                     const bool last)
+{
+    const uint32_t regIdx = listIdx >> 1u;
+
+    if ((listIdx & 1u) == 0u)
+    {
+        REG_RMW32(&(base->LISTCHR_[regIdx]),
+                  BCTU_LISTCHR__ADC_CH_y_MASK | BCTU_LISTCHR__LAST_y_MASK,
+                  BCTU_LISTCHR__ADC_CH_y(adcChan) | BCTU_LISTCHR__LAST_y(last ? 1u : 0u));
+    }
+    else
+    {
+        REG_RMW32(&(base->LISTCHR_[regIdx]),
+                  BCTU_LISTCHR__ADC_CHL_y_plus_1_MASK | BCTU_LISTCHR__LAST_y_plus_1_MASK,
+                  BCTU_LISTCHR__ADC_CHL_y_plus_1(adcChan) | BCTU_LISTCHR__LAST_y_plus_1(last ? 1u : 0u));
+    }
+}
+
+static inline void BCTU_SoftwareTrigger(BCTU_Type * const base,
+                                        const uint32_t trigIdx)
+{
+    volatile uint32_t * const sftrgr = &(base->SFTRGR1);
+
+    /* the bits are write 1 to trigger, writing 0 has no effect */
+    sftrgr[trigIdx / BCTU_SFTRGR_SIZE] = (uint32_t)1u << (trigIdx % BCTU_SFTRGR_SIZE);
+}
+
+static inline volatile const uint32_t * BCTU_GetDataReg(const BCTU_Type * const base,
+                                                        const uint32_t adcIdx)
+{
+    return &(base->ADC0DR) + adcIdx;
+}
+
+static inline void BCTU_ClearStatusFlags(BCTU_Type * const base,
+                                         const uint32_t flags)
+{
+    base->MSR = flags << BCTU_MSR_CLR_SHIFT;
+}
+
+/*! @} */
+
+#endif /* BCTU_HW_ACCESS_H */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -517,6 +517,107 @@ typedef struct
     pins_level_type_t           initValue;         /*!< Initial value                             */
 } pin_settings_config_t;
 
+/*!
+ * @brief Index of a port in the parallel GPIO registers, from its GPIO base address
+ * (PTA_BASE, PTB_BASE, etc.); usable in static initializers.
+ */
+#define PINS_PORT_IDX(gpioBaseAddr)     ((uint8_t)(((gpioBaseAddr) - PTA_BASE) >> 1U))
+
+/*!
+ * @brief Bit of a pin in the parallel GPIO registers; pin 0 is the most significant bit.
+ */
+#define PINS_PORT_PIN_MASK(pin)         ((uint16_t)(0x8000U >> (pin)))
+
+/*!
+ * @brief Port of a pin set
+ *
+ * Implements : pins_set_port_t_Class
+ */
+typedef struct
+{
+    uint8_t                     portIdx;           /*!< Port index, see PINS_PORT_IDX().          */
+    uint16_t                    mask;              /*!< Pins of the set on this port, OR of
+                                                        PINS_PORT_PIN_MASK() values.               */
+} pins_set_port_t;
+
+/*!
+ * @brief Pin of a pin set
+ *
+ * Implements : pins_set_pin_t_Class
+ */
+typedef struct
+{
+    uint8_t                     portEntry;         /*!< Entry of the port in the ports table.     */
+    uint16_t                    mask;              /*!< PINS_PORT_PIN_MASK() of the pin.          */
+} pins_set_pin_t;
+
+/*!
+ * @brief Set of pins written together
+ *
+ * The set is resolved when it is declared: the pins are grouped by port and
+ * converted to register masks, so that a write costs one access to the masked
+ * parallel output register (MPGPDO) of each port, without reading the output
+ * registers back. The mask of each port must be the OR of the masks of its pins.
+ *
+ * Implements : pins_set_t_Class
+ */
+typedef struct
+{
+    const pins_set_port_t     * ports;             /*!< Ports of the set.                         */
+    uint8_t                     portCount;         /*!< Number of ports.                          */
+    const pins_set_pin_t      * pins;              /*!< Pins of the set; pin n takes bit n of
+                                                        the value written.                         */
+    uint8_t                     pinCount;          /*!< Number of pins, at most 32.               */
+} pins_set_t;
+
+/*!
+ * @brief Register write of a pin configuration image
+ *
+ * Implements : pins_reg_write_t_Class
+ */
+typedef struct
+{
+    uint32_t                    address;           /*!< Address of a SIUL2 register.              */
+    uint32_t                    value;             /*!< Value written to the register.            */
+} pins_reg_write_t;
+
+/*!
+ * @brief Register writes switching from one pin profile to another
+ *
+ * Implements : pins_profile_transition_t_Class
+ */
+typedef struct
+{
+    uint32_t                    regCount;          /*!< Number of register writes.                */
+    const pins_reg_write_t    * writes;            /*!< Register writes, in order.                */
+} pins_profile_transition_t;
+
+/*!
+ * @brief Table of pin profiles
+ *
+ * Produced on the host by the pins_profile_gen tool.
+ *
+ * Implements : pins_profile_table_t_Class
+ */
+typedef struct
+{
+    uint8_t                     profileCount;      /*!< Number of profiles.                       */
+    const char * const        * names;             /*!< Profile names.                            */
+    const pins_profile_transition_t * transitions; /*!< Transition from profile i to profile j at
+                                                        index i * profileCount + j.                */
+} pins_profile_table_t;
+
+/*!
+ * @brief Pin profile switching state
+ *
+ * Implements : pins_profile_state_t_Class
+ */
+typedef struct
+{
+    const pins_profile_table_t * table;            /*!< Table of profiles.                        */
+    uint8_t                     current;           /*!< Current profile.                          */
+} pins_profile_state_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -663,6 +764,93 @@ void PINS_DRV_ClearExIntFlag(void);
  */
 uint32_t PINS_DRV_GetExIntFlag(void);
 
+/*!
+ * @brief Initializes the pins from a precomputed register image
+ *
+ * This function writes the given SIUL2 registers in order. The image is
+ * produced on the host from the pin configuration structures by the
+ * pins_image_gen tool, and gives the same register state as PINS_DRV_Init()
+ * with the same configuration, when the SIUL2 registers are at their reset
+ * values: the initial output levels are written first through the masked
+ * parallel output registers, then the MSCR and IMCR registers, then the
+ * external interrupt registers.
+ *
+ * @param[in] regCount The number of register writes in the image
+ * @param[in] image The register image
+ * @return The status of the operation
+ */
+status_t PINS_DRV_InitFromImage(uint32_t regCount,
+                                const pins_reg_write_t image[]);
+
+/*!
+ * @brief Initializes the pin profile switching
+ *
+ * This function records the table of profiles and the current profile. No
+ * register is written: the pins must already be configured as the initial
+ * profile, by PINS_DRV_Init() or PINS_DRV_InitFromImage().
+ *
+ * @param[out] state The profile switching state
+ * @param[in] table The table of profiles
+ * @param[in] initialProfile The profile the pins are configured as
+ */
+void PINS_DRV_InitProfiles(pins_profile_state_t * state,
+                           const pins_profile_table_t * table,
+                           uint8_t initialProfile);
+
+/*!
+ * @brief Switches the pins to another profile
+ *
+ * This function writes the registers which differ between the current and
+ * the requested profile, as computed by the pins_profile_gen tool, with the
+ * interrupts disabled. The writes are ordered so that no pin glitches: the
+ * levels of the GPIO outputs are written before their output buffers are
+ * enabled, the output buffers turned off before the others are turned on, and
+ * the input buffers enabled before and disabled after the input multiplexers
+ * are moved.
+ *
+ * @param[in] state The profile switching state
+ * @param[in] profile The requested profile
+ * @return The status of the operation
+ */
+status_t PINS_DRV_SwitchProfile(pins_profile_state_t * state,
+                                uint8_t profile);
+
+/*!
+ * @brief Returns the current pin profile
+ *
+ * @param[in] state The profile switching state
+ * @return The current profile
+ */
+uint8_t PINS_DRV_GetProfile(const pins_profile_state_t * state);
+
+/*!
+ * @brief Writes the pins of a set
+ *
+ * This function writes pin n of the set with bit n of value ('0' represents
+ * LOW, '1' represents HIGH), with one masked write per port of the set. The
+ * other pins of the ports are unaffected, also when they are written from an
+ * interrupt at the same time.
+ *
+ * @param[in] pinSet The pin set
+ * @param[in] value Pin values, one bit per pin of the set
+ */
+void PINS_DRV_WritePinSet(const pins_set_t * pinSet,
+                          uint32_t value);
+
+/*!
+ * @brief Writes all pins of a set with the same value
+ *
+ * This function writes all pins of the set with the given value, with one
+ * masked write per port of the set.
+ *
+ * @param[in] pinSet The pin set
+ * @param[in] value Pin value to be written
+ *        - 0: the pins are set to LOW
+ *        - 1: the pins are set to HIGH
+ */
+void PINS_DRV_WritePinSetLevel(const pins_set_t * pinSet,
+                               pins_level_type_t value);
+
 /*! @} */
 
 #if defined(__cplusplus)
@@ -74,6 +74,30 @@ extern "C" {
   */
 void PINS_Init(const pin_settings_config_t * config);
 
+/*!
+ * @brief Computes the Multiplexed Signal Configuration Register value of a pin
+ *
+ * This function returns the MSCR value that PINS_Init() writes for the given
+ * configuration, without accessing the hardware.
+ *
+ * @param[in] config the configuration structure
+ * @return MSCR value
+ */
+uint32_t PINS_GetMscrValue(const pin_settings_config_t * config);
+
+/*!
+ * @brief Computes an Input Multiplexed Signal Configuration Register value
+ *
+ * This function returns the value that PINS_Init() writes to the IMCR register
+ * selected by the given input mux entry, without accessing the hardware.
+ *
+ * @param[in] config the configuration structure
+ * @param[in] inputMuxIdx the input mux entry
+ * @return IMCR value
+ */
+uint32_t PINS_GetImcrValue(const pin_settings_config_t * config,
+                           uint8_t inputMuxIdx);
+
 /*!
  * @brief Configures the internal resistor.
  *
@@ -451,6 +475,27 @@ static inline void PINS_TogglePins(GPIO_Type * const base,
     base->PGPDO ^= REV_BIT_16(pins);
 }
 
+/*!
+ * @brief Write the pins of a port selected by a mask
+ *
+ * This function writes the pins selected by mask with the corresponding bits
+ * of value in one access to the masked parallel output register; the other
+ * pins of the port are unaffected. Both parameters use the register bit order
+ * (pin 0 is the MSB). The MPGPDO registers are 32-bit wide and do not follow
+ * the 16-bit spacing of GPIO_Type, so they are addressed by port index.
+ *
+ * @param portIdx port index (0 for PTA, 1 for PTB, etc.)
+ * @param mask pins to be written
+ * @param value pin values
+ */
+static inline void PINS_WriteMaskedPins(uint32_t portIdx,
+                                        uint16_t mask,
+                                        uint16_t value)
+{
+    DEV_ASSERT(portIdx < SIUL2_MPGPDO_COUNT);
+    SIUL2->MPGPDO[portIdx] = SIUL2_MPGPDO_MASK(mask) | SIUL2_MPGPDO_MPPDO(value);
+}
+
 /*!
  * @brief Read input pins
  *
@@ -0,0 +1,206 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_BAND_H
+#define ADC_BAND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_sar_driver.h"
+
+/*!
+ * @defgroup adc_band ADC Band Events
+ * @brief Band change notifications driven by the analog watchdog
+ *
+ * The range of each monitored channel is split into bands by an ascending list of
+ * edges: N edges define N + 1 bands, band 0 being below the first edge. The analog
+ * watchdog threshold register assigned to the channel is programmed with the window
+ * of the current band, widened on both sides by the hysteresis, so the converter
+ * keeps scanning without interrupting the CPU until the signal leaves the band.
+ * ADC_BAND_IRQHandler(), called from the watchdog interrupt of the instance, works
+ * out the new band, moves the window around it and notifies the application.
+ *
+ * The conversions are left to the application (e.g. a continuous normal scan with
+ * the end of conversion interrupts disabled). Each channel needs a threshold
+ * register of its own.
+ *
+ * @addtogroup adc_band
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of channels monitored by one instance of the band service */
+#define ADC_BAND_MAX_CHANNELS    ADC_THRHLR_COUNT
+
+/*! @brief Maximum number of edges of a channel */
+#define ADC_BAND_MAX_EDGES       15U
+
+/*! @brief Largest conversion result, used as the upper end of the last band */
+#define ADC_BAND_RESULT_MAX      0xFFFU
+
+/*!
+ * @brief Band change notification
+ *
+ * Called from ADC_BAND_IRQHandler(), in interrupt context. The band can move by more
+ * than one step when the signal changes faster than the interrupt is serviced.
+ *
+ * @param[in] channel      Index of the channel in the channel configuration array.
+ * @param[in] previousBand Band before the change.
+ * @param[in] band         New band.
+ * @param[in] value        Conversion result which caused the change.
+ * @param[in] userData     Parameter of the callback.
+ *
+ * Implements : adc_band_callback_t_Class
+ */
+typedef void (*adc_band_callback_t)(uint8_t channel,
+                                    uint8_t previousBand,
+                                    uint8_t band,
+                                    uint16_t value,
+                                    void * userData);
+
+/*!
+ * @brief Defines the configuration of a monitored channel
+ *
+ * Implements : adc_band_chan_config_t_Class
+ */
+typedef struct
+{
+    uint8_t chnIdx;               /*!< ADC channel index */
+    uint8_t registerIdx;          /*!< Watchdog threshold register dedicated to the channel */
+    const uint16_t * edges;       /*!< Band edges, strictly ascending; a result equal to an edge belongs to the upper band */
+    uint8_t numEdges;             /*!< Number of edges, 1 to ADC_BAND_MAX_EDGES */
+    uint16_t hysteresis;          /*!< Distance the signal must travel past an edge to change band */
+} adc_band_chan_config_t;
+
+/*!
+ * @brief Defines the band service configuration
+ *
+ * Implements : adc_band_user_config_t_Class
+ */
+typedef struct
+{
+    uint32_t instance;                           /*!< ADC instance */
+    const adc_band_chan_config_t * channels;     /*!< Monitored channels */
+    uint8_t numChannels;                         /*!< Number of monitored channels, up to ADC_BAND_MAX_CHANNELS */
+    adc_band_callback_t callback;                /*!< Band change notification; can be NULL */
+    void * callbackParam;                        /*!< Parameter of the callback */
+} adc_band_user_config_t;
+
+/*!
+ * @brief Defines the band service statistics
+ *
+ * Implements : adc_band_stats_t_Class
+ */
+typedef struct
+{
+    uint32_t interrupts;         /*!< Calls of ADC_BAND_IRQHandler() */
+    uint32_t bandChanges;        /*!< Band changes notified */
+    uint32_t spurious;           /*!< Watchdog events which did not change the band */
+} adc_band_stats_t;
+
+/*!
+ * @brief Runtime state of the band service
+ *
+ * The fields are internal to the service and must not be accessed by the application.
+ *
+ * Implements : adc_band_state_t_Class
+ */
+typedef struct
+{
+    adc_band_user_config_t config;               /*!< Service configuration */
+    uint8_t band[ADC_BAND_MAX_CHANNELS];         /*!< Current band of each channel */
+    uint32_t flagMask;                           /*!< Watchdog flags owned by the service */
+    adc_band_stats_t stats;                      /*!< Statistics */
+} adc_band_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Starts monitoring the configured channels
+ *
+ * Maps every channel to its threshold register, computes the initial band from the
+ * last conversion result, programs the window of that band and enables the channel
+ * watchdog. A stale initial result is harmless: the first conversion outside the
+ * window raises a band change. The watchdog interrupt of the instance must be
+ * enabled by the application and routed to ADC_BAND_IRQHandler().
+ *
+ * @param[out] state  Pointer to the band service state structure.
+ * @param[in]  config Pointer to the band service configuration structure.
+ *
+ * @return    STATUS_SUCCESS: the channels are monitored;
+ *            STATUS_ERROR  : a threshold register is out of range or shared by two channels.
+ */
+status_t ADC_BAND_Init(adc_band_state_t * state,
+                       const adc_band_user_config_t * config);
+
+/*!
+ * @brief Stops monitoring the configured channels
+ *
+ * Disables the channel watchdogs and clears the flags owned by the service.
+ *
+ * @param[in] state Pointer to the band service state structure.
+ */
+void ADC_BAND_Deinit(adc_band_state_t * state);
+
+/*!
+ * @brief Handles the watchdog interrupt of the instance
+ *
+ * To be called from the ADCn_WD interrupt handler. Flags of threshold registers
+ * not owned by the service are left untouched.
+ *
+ * @param[in] state Pointer to the band service state structure.
+ */
+void ADC_BAND_IRQHandler(adc_band_state_t * state);
+
+/*!
+ * @brief Returns the current band of a channel
+ *
+ * @param[in] state   Pointer to the band service state structure.
+ * @param[in] channel Index of the channel in the channel configuration array.
+ *
+ * @return    Current band, 0 to numEdges.
+ */
+uint8_t ADC_BAND_GetBand(const adc_band_state_t * state, uint8_t channel);
+
+/*!
+ * @brief Returns the band service statistics
+ *
+ * @param[in]  state Pointer to the band service state structure.
+ * @param[out] stats Pointer to the statistics structure.
+ */
+void ADC_BAND_GetStatistics(const adc_band_state_t * state, adc_band_stats_t * stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* ADC_BAND_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
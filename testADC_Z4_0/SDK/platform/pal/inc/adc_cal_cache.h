@@ -0,0 +1,229 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_CAL_CACHE_H
+#define ADC_CAL_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_sar_driver.h"
+
+/*!
+ * @defgroup adc_cal_cache ADC Calibration Cache
+ * @brief Calibration outcome persisted in non-volatile memory
+ *
+ * The cache keeps, for each ADC instance, the outcome of the last calibration,
+ * the user offset/gain correction and the conditions it was obtained under
+ * (converter clock frequency and an application defined temperature band),
+ * protected by a CRC. At boot, ADC_CAL_Boot() accepts the stored record when
+ * the conditions still match and returns without running the calibration
+ * sequence; otherwise all the instances are calibrated in parallel and the
+ * record is rewritten.
+ *
+ * The SAR calibration coefficients are internal to the converter and are lost
+ * on reset, so a converter started from the cache runs on its reset trim until
+ * it is calibrated again: the restored instances are always scheduled for
+ * ADC_CAL_Task(), which runs the calibration in the background when the
+ * application allows the converter to be taken offline. The instances reported
+ * by ADC_CAL_UpdateConditions() as calibrated under other conditions, and the
+ * failed calibrations (up to ADC_CAL_MAX_RETRIES times), are scheduled as well.
+ *
+ * The non-volatile storage is accessed through application callbacks (e.g. a
+ * data flash sector or an emulated EEPROM record).
+ *
+ * @addtogroup adc_cal_cache
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Record layout version, increment when adc_cal_record_t changes */
+#define ADC_CAL_RECORD_VERSION    1U
+
+/*! @brief Number of times a failed calibration is scheduled again */
+#define ADC_CAL_MAX_RETRIES       3U
+
+/*!
+ * @brief Calibration record stored in non-volatile memory
+ *
+ * Implements : adc_cal_record_t_Class
+ */
+typedef struct
+{
+    uint32_t magic;                                   /*!< Record marker */
+    uint32_t version;                                 /*!< ADC_CAL_RECORD_VERSION */
+    uint32_t calibratedMask;                          /*!< Instances with a successful calibration */
+    uint32_t clockFreq[ADC_INSTANCE_COUNT];           /*!< Converter clock frequency during the calibration, in Hz */
+    uint32_t temperatureBand[ADC_INSTANCE_COUNT];     /*!< Temperature band during the calibration */
+    uint8_t userOffset[ADC_INSTANCE_COUNT];           /*!< User offset correction */
+    uint16_t userGain[ADC_INSTANCE_COUNT];            /*!< User gain correction */
+    uint32_t calibrationTicks[ADC_INSTANCE_COUNT];    /*!< Duration of the calibration, in timestamp ticks */
+    uint32_t crc;                                     /*!< CRC-32 of all the previous fields */
+} adc_cal_record_t;
+
+/*!
+ * @brief Reads the record from non-volatile memory
+ *
+ * Returns STATUS_SUCCESS if a record was read; its content is validated by the cache.
+ *
+ * Implements : adc_cal_nvm_read_t_Class
+ */
+typedef status_t (*adc_cal_nvm_read_t)(adc_cal_record_t * record, void * userData);
+
+/*!
+ * @brief Writes the record to non-volatile memory
+ *
+ * Implements : adc_cal_nvm_write_t_Class
+ */
+typedef status_t (*adc_cal_nvm_write_t)(const adc_cal_record_t * record, void * userData);
+
+/*!
+ * @brief Free running timestamp source (e.g. a read of the STM counter)
+ *
+ * Implements : adc_cal_timestamp_t_Class
+ */
+typedef uint32_t (*adc_cal_timestamp_t)(void);
+
+/*!
+ * @brief Defines the cache configuration structure
+ *
+ * Implements : adc_cal_user_config_t_Class
+ */
+typedef struct
+{
+    uint32_t instanceMask;               /*!< ADC instances handled by the cache (bit n: instance n) */
+    adc_cal_nvm_read_t nvmRead;          /*!< Record read callback */
+    adc_cal_nvm_write_t nvmWrite;        /*!< Record write callback */
+    void * nvmParam;                     /*!< Parameter of the storage callbacks */
+    adc_cal_timestamp_t timestamp;       /*!< Timestamp source, used for the statistics; can be NULL */
+} adc_cal_user_config_t;
+
+/*!
+ * @brief Defines the cache statistics
+ *
+ * Implements : adc_cal_stats_t_Class
+ */
+typedef struct
+{
+    uint32_t calibratedMask;     /*!< Instances calibrated since reset; not the restored ones until recalibrated */
+    uint32_t restoredMask;       /*!< Instances restored from the cache at boot, running on reset trim */
+    uint32_t bootTicks;          /*!< Time spent in ADC_CAL_Boot() */
+    uint32_t savedTicks;         /*!< Calibration time moved from boot to ADC_CAL_Task(), from the stored durations */
+    uint32_t calibrations;       /*!< Calibration sequences run, boot and background */
+    uint32_t failures;           /*!< Calibration sequences which failed */
+    uint32_t nvmWrites;          /*!< Records written */
+} adc_cal_stats_t;
+
+/*!
+ * @brief Runtime state of the cache
+ *
+ * The fields are internal to the cache and must not be accessed by the application.
+ *
+ * Implements : adc_cal_state_t_Class
+ */
+typedef struct
+{
+    adc_cal_user_config_t config;                     /*!< Cache configuration */
+    adc_cal_record_t record;                          /*!< Image of the stored record */
+    uint32_t pendingMask;                             /*!< Instances waiting for a background calibration */
+    uint32_t activeMask;                              /*!< Instances being calibrated */
+    uint32_t startTicks[ADC_INSTANCE_COUNT];          /*!< Start of the calibration in progress */
+    uint8_t retries[ADC_INSTANCE_COUNT];              /*!< Failed calibrations scheduled again since the last success */
+    uint32_t temperatureBand;                         /*!< Last reported temperature band */
+    bool recordDirty;                                 /*!< The record changed since it was last written */
+    adc_cal_stats_t stats;                            /*!< Statistics */
+} adc_cal_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Brings the converters to a calibrated state at boot
+ *
+ * Must be called after the clock configuration and before ADC_DRV_ConfigConverter().
+ * If the stored record is valid and was obtained at the current clock frequencies and
+ * temperature band, the user offset/gain corrections are restored and the function
+ * returns without calibrating; these instances run on their reset trim and are
+ * scheduled for ADC_CAL_Task(). The instances without a valid record are calibrated
+ * in parallel and the record is written. A failed calibration is scheduled again.
+ *
+ * @param[out] state           Pointer to the cache state structure.
+ * @param[in]  config          Pointer to the cache configuration structure.
+ * @param[in]  temperatureBand Current temperature band, application defined.
+ *
+ * @return    STATUS_SUCCESS: if all the instances are calibrated or restored;
+ *            STATUS_ERROR  : if a calibration failed or the record cannot be written.
+ */
+status_t ADC_CAL_Boot(adc_cal_state_t * state,
+                      const adc_cal_user_config_t * config,
+                      uint32_t temperatureBand);
+
+/*!
+ * @brief Reports the current operating conditions
+ *
+ * The instances calibrated under a different clock frequency or temperature band
+ * are scheduled for recalibration by ADC_CAL_Task().
+ *
+ * @param[in] state           Pointer to the cache state structure.
+ * @param[in] temperatureBand Current temperature band.
+ *
+ * @return    Mask of the instances scheduled for recalibration.
+ */
+uint32_t ADC_CAL_UpdateConditions(adc_cal_state_t * state, uint32_t temperatureBand);
+
+/*!
+ * @brief Runs the background calibrations
+ *
+ * Starts the calibration of the scheduled instances in idleMask and polls the
+ * calibrations in progress; the record is written when all of them are over.
+ * The calibration powers the converter down and back up: the instances in idleMask
+ * must have no conversion in progress and must be reconfigured with
+ * ADC_DRV_ConfigConverter() once they leave the returned busy mask.
+ *
+ * @param[in] state    Pointer to the cache state structure.
+ * @param[in] idleMask Instances which can be taken offline now.
+ *
+ * @return    Mask of the instances being calibrated.
+ */
+uint32_t ADC_CAL_Task(adc_cal_state_t * state, uint32_t idleMask);
+
+/*!
+ * @brief Returns the cache statistics
+ *
+ * @param[in]  state Pointer to the cache state structure.
+ * @param[out] stats Pointer to the statistics structure.
+ */
+void ADC_CAL_GetStatistics(const adc_cal_state_t * state, adc_cal_stats_t * stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* ADC_CAL_CACHE_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,397 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_DSP_H
+#define ADC_DSP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*!
+ * @defgroup adc_dsp ADC DSP kernels
+ * @brief Fixed-point block processing of ADC result buffers
+ *
+ * The kernels process blocks of samples as delivered by
+ * ADC_DRV_GetConvResultsToArray() or by an eDMA buffer (see adc_stream).
+ * Kernels reading raw results take an input stride, so one channel can be
+ * processed directly from a buffer of interleaved scans.
+ *
+ * Q15 samples are int16_t in [-1, 1), Q31 samples are int32_t in [-1, 1).
+ * Filters keep their history in a state structure, so consecutive blocks are
+ * processed as one continuous stream.
+ *
+ * When ADC_DSP_REFERENCE_KERNELS is defined to 1, straightforward per-sample
+ * implementations of the filters are also built (suffix _Ref), which can be used
+ * to check the block kernels on the target.
+ *
+ * @addtogroup adc_dsp
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifndef ADC_DSP_REFERENCE_KERNELS
+/*! @brief Build the reference implementations of the filters */
+#define ADC_DSP_REFERENCE_KERNELS    0
+#endif
+
+/*! @brief Maximum order of the CIC decimator */
+#define ADC_DSP_CIC_MAX_ORDER        4U
+
+/*!
+ * @brief State of a boxcar (moving sum) decimator
+ *
+ * Implements : adc_dsp_boxcar_t_Class
+ */
+typedef struct
+{
+    uint32_t decimation;     /*!< Number of input samples averaged in each output sample */
+    uint32_t sum;            /*!< Sum of the samples of the current output */
+    uint32_t phase;          /*!< Number of samples in the current output */
+} adc_dsp_boxcar_t;
+
+/*!
+ * @brief State of a CIC decimator
+ *
+ * The integrators and combs use modulo 2^32 arithmetic; the output is exact as
+ * long as inputBits + order * log2(decimation) <= 32.
+ *
+ * Implements : adc_dsp_cic_t_Class
+ */
+typedef struct
+{
+    uint32_t order;                              /*!< Number of integrator/comb stages */
+    uint32_t decimation;                         /*!< Decimation ratio, power of two */
+    uint32_t gainShift;                          /*!< order * log2(decimation) */
+    uint32_t phase;                              /*!< Input samples since the last output */
+    uint32_t integrator[ADC_DSP_CIC_MAX_ORDER];  /*!< Integrator registers */
+    uint32_t comb[ADC_DSP_CIC_MAX_ORDER];        /*!< Comb delay registers */
+} adc_dsp_cic_t;
+
+/*!
+ * @brief State of a Q15 FIR filter
+ *
+ * history must hold 2 * numTaps samples: each sample is stored twice, so the
+ * last numTaps samples are always contiguous and the filter never wraps inside
+ * the convolution.
+ *
+ * Implements : adc_dsp_fir_q15_t_Class
+ */
+typedef struct
+{
+    const int16_t * coeffs;  /*!< numTaps coefficients, coeffs[0] applied to the newest sample */
+    int16_t * history;       /*!< History buffer of 2 * numTaps samples */
+    uint32_t numTaps;        /*!< Number of taps */
+    uint32_t index;          /*!< Position of the oldest sample in the history */
+} adc_dsp_fir_q15_t;
+
+/*!
+ * @brief State of a Q31 FIR filter
+ *
+ * Same layout as adc_dsp_fir_q15_t.
+ *
+ * Implements : adc_dsp_fir_q31_t_Class
+ */
+typedef struct
+{
+    const int32_t * coeffs;  /*!< numTaps coefficients, coeffs[0] applied to the newest sample */
+    int32_t * history;       /*!< History buffer of 2 * numTaps samples */
+    uint32_t numTaps;        /*!< Number of taps */
+    uint32_t index;          /*!< Position of the oldest sample in the history */
+} adc_dsp_fir_q31_t;
+
+/*!
+ * @brief State of a Q15 biquad cascade (direct form I)
+ *
+ * Each stage computes
+ * y[n] = (b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2]) << postShift
+ * with coefficients stored as {b0, b1, b2, a1, a2} per stage. The feedback
+ * coefficients have the opposite sign of the usual transfer function notation.
+ * Coefficients larger than 1 in magnitude are scaled down by 2^postShift.
+ *
+ * Implements : adc_dsp_biquad_q15_t_Class
+ */
+typedef struct
+{
+    const int16_t * coeffs;  /*!< 5 * numStages coefficients */
+    int16_t * delay;         /*!< 4 * numStages samples: {x[n-1], x[n-2], y[n-1], y[n-2]} per stage */
+    uint32_t numStages;      /*!< Number of second order stages */
+    uint32_t postShift;      /*!< Left shift applied to the output of each stage */
+} adc_dsp_biquad_q15_t;
+
+/*!
+ * @brief State of a Q31 biquad cascade (direct form I)
+ *
+ * Same layout and conventions as adc_dsp_biquad_q15_t.
+ *
+ * Implements : adc_dsp_biquad_q31_t_Class
+ */
+typedef struct
+{
+    const int32_t * coeffs;  /*!< 5 * numStages coefficients */
+    int32_t * delay;         /*!< 4 * numStages samples: {x[n-1], x[n-2], y[n-1], y[n-2]} per stage */
+    uint32_t numStages;      /*!< Number of second order stages */
+    uint32_t postShift;      /*!< Left shift applied to the output of each stage */
+} adc_dsp_biquad_q31_t;
+
+/*!
+ * @brief Statistics of a window of raw results
+ *
+ * Implements : adc_dsp_stats_t_Class
+ */
+typedef struct
+{
+    uint16_t mean;           /*!< Mean value, rounded */
+    uint16_t rms;            /*!< Root mean square */
+    uint16_t acRms;          /*!< Root mean square of the samples minus their mean */
+    uint16_t min;            /*!< Minimum value */
+    uint16_t max;            /*!< Maximum value */
+} adc_dsp_stats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Converts raw results to Q15
+ *
+ * The mid-scale code maps to 0 and the full scale to [-1, 1).
+ *
+ * @param[in]  in             Pointer to the first raw result.
+ * @param[in]  inStride       Distance between two consecutive results of the channel.
+ * @param[out] out            Pointer to count Q15 samples.
+ * @param[in]  count          Number of samples.
+ * @param[in]  resolutionBits Resolution of the raw results (1 to 16).
+ */
+void ADC_DSP_RawToQ15(const uint16_t * in,
+                      uint32_t inStride,
+                      int16_t * out,
+                      uint32_t count,
+                      uint32_t resolutionBits);
+
+/*!
+ * @brief Initializes a boxcar decimator
+ *
+ * @param[out] state      Pointer to the decimator state.
+ * @param[in]  decimation Number of input samples per output sample (1 to 65536).
+ */
+void ADC_DSP_BoxcarInit(adc_dsp_boxcar_t * state, uint32_t decimation);
+
+/*!
+ * @brief Decimates raw results by averaging
+ *
+ * Each output sample is the rounded mean of decimation consecutive input samples.
+ * An output in progress at the end of the block is completed by the next call.
+ *
+ * @param[in]  state    Pointer to the decimator state.
+ * @param[in]  in       Pointer to the first raw result.
+ * @param[in]  inStride Distance between two consecutive results of the channel.
+ * @param[in]  count    Number of input samples.
+ * @param[out] out      Pointer to the output buffer (count / decimation + 1 samples at most).
+ *
+ * @return    Number of output samples written.
+ */
+uint32_t ADC_DSP_BoxcarDecimate(adc_dsp_boxcar_t * state,
+                                const uint16_t * in,
+                                uint32_t inStride,
+                                uint32_t count,
+                                uint16_t * out);
+
+/*!
+ * @brief Initializes a CIC decimator
+ *
+ * @param[out] state      Pointer to the decimator state.
+ * @param[in]  order      Number of stages (1 to ADC_DSP_CIC_MAX_ORDER).
+ * @param[in]  decimation Decimation ratio, power of two.
+ * @param[in]  inputBits  Resolution of the raw results.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the parameters are out of range or the gain does not fit in 32 bits.
+ */
+status_t ADC_DSP_CicInit(adc_dsp_cic_t * state,
+                         uint32_t order,
+                         uint32_t decimation,
+                         uint32_t inputBits);
+
+/*!
+ * @brief Decimates raw results with a CIC filter
+ *
+ * The output has the resolution of the input (the filter gain is removed).
+ *
+ * @param[in]  state    Pointer to the decimator state.
+ * @param[in]  in       Pointer to the first raw result.
+ * @param[in]  inStride Distance between two consecutive results of the channel.
+ * @param[in]  count    Number of input samples.
+ * @param[out] out      Pointer to the output buffer (count / decimation + 1 samples at most).
+ *
+ * @return    Number of output samples written.
+ */
+uint32_t ADC_DSP_CicDecimate(adc_dsp_cic_t * state,
+                             const uint16_t * in,
+                             uint32_t inStride,
+                             uint32_t count,
+                             uint16_t * out);
+
+/*!
+ * @brief Initializes a Q15 FIR filter and clears its history
+ *
+ * @param[out] state   Pointer to the filter state.
+ * @param[in]  coeffs  Pointer to numTaps Q15 coefficients.
+ * @param[in]  history Pointer to a buffer of 2 * numTaps samples.
+ * @param[in]  numTaps Number of taps.
+ */
+void ADC_DSP_FirInitQ15(adc_dsp_fir_q15_t * state,
+                        const int16_t * coeffs,
+                        int16_t * history,
+                        uint32_t numTaps);
+
+/*!
+ * @brief Filters a block of Q15 samples
+ *
+ * The sum of products is accumulated on 64 bits and saturated once per output.
+ * in and out can be the same buffer.
+ *
+ * @param[in]  state Pointer to the filter state.
+ * @param[in]  in    Pointer to the input samples.
+ * @param[out] out   Pointer to the output samples.
+ * @param[in]  count Number of samples.
+ */
+void ADC_DSP_FirQ15(adc_dsp_fir_q15_t * state, const int16_t * in, int16_t * out, uint32_t count);
+
+/*!
+ * @brief Initializes a Q31 FIR filter and clears its history
+ *
+ * @param[out] state   Pointer to the filter state.
+ * @param[in]  coeffs  Pointer to numTaps Q31 coefficients.
+ * @param[in]  history Pointer to a buffer of 2 * numTaps samples.
+ * @param[in]  numTaps Number of taps.
+ */
+void ADC_DSP_FirInitQ31(adc_dsp_fir_q31_t * state,
+                        const int32_t * coeffs,
+                        int32_t * history,
+                        uint32_t numTaps);
+
+/*!
+ * @brief Filters a block of Q31 samples
+ *
+ * in and out can be the same buffer.
+ *
+ * @param[in]  state Pointer to the filter state.
+ * @param[in]  in    Pointer to the input samples.
+ * @param[out] out   Pointer to the output samples.
+ * @param[in]  count Number of samples.
+ */
+void ADC_DSP_FirQ31(adc_dsp_fir_q31_t * state, const int32_t * in, int32_t * out, uint32_t count);
+
+/*!
+ * @brief Initializes a Q15 biquad cascade and clears its delay line
+ *
+ * @param[out] state     Pointer to the filter state.
+ * @param[in]  coeffs    Pointer to 5 * numStages Q15 coefficients.
+ * @param[in]  delay     Pointer to a buffer of 4 * numStages samples.
+ * @param[in]  numStages Number of second order stages.
+ * @param[in]  postShift Left shift applied to the output of each stage (0 to 14).
+ */
+void ADC_DSP_BiquadInitQ15(adc_dsp_biquad_q15_t * state,
+                           const int16_t * coeffs,
+                           int16_t * delay,
+                           uint32_t numStages,
+                           uint32_t postShift);
+
+/*!
+ * @brief Filters a block of Q15 samples through a biquad cascade
+ *
+ * The block is processed one stage at a time; in and out can be the same buffer.
+ *
+ * @param[in]  state Pointer to the filter state.
+ * @param[in]  in    Pointer to the input samples.
+ * @param[out] out   Pointer to the output samples.
+ * @param[in]  count Number of samples.
+ */
+void ADC_DSP_BiquadQ15(adc_dsp_biquad_q15_t * state, const int16_t * in, int16_t * out, uint32_t count);
+
+/*!
+ * @brief Initializes a Q31 biquad cascade and clears its delay line
+ *
+ * @param[out] state     Pointer to the filter state.
+ * @param[in]  coeffs    Pointer to 5 * numStages Q31 coefficients.
+ * @param[in]  delay     Pointer to a buffer of 4 * numStages samples.
+ * @param[in]  numStages Number of second order stages.
+ * @param[in]  postShift Left shift applied to the output of each stage (0 to 30).
+ */
+void ADC_DSP_BiquadInitQ31(adc_dsp_biquad_q31_t * state,
+                           const int32_t * coeffs,
+                           int32_t * delay,
+                           uint32_t numStages,
+                           uint32_t postShift);
+
+/*!
+ * @brief Filters a block of Q31 samples through a biquad cascade
+ *
+ * @param[in]  state Pointer to the filter state.
+ * @param[in]  in    Pointer to the input samples.
+ * @param[out] out   Pointer to the output samples.
+ * @param[in]  count Number of samples.
+ */
+void ADC_DSP_BiquadQ31(adc_dsp_biquad_q31_t * state, const int32_t * in, int32_t * out, uint32_t count);
+
+/*!
+ * @brief Computes mean, RMS and peak values of a window of raw results
+ *
+ * @param[in]  in       Pointer to the first raw result.
+ * @param[in]  inStride Distance between two consecutive results of the channel.
+ * @param[in]  count    Number of samples in the window (at least 1).
+ * @param[out] stats    Pointer to the statistics structure.
+ */
+void ADC_DSP_WindowStats(const uint16_t * in,
+                         uint32_t inStride,
+                         uint32_t count,
+                         adc_dsp_stats_t * stats);
+
+#if (ADC_DSP_REFERENCE_KERNELS == 1)
+/*!
+ * @brief Reference implementations, same semantic as the kernels without suffix
+ */
+void ADC_DSP_FirQ15_Ref(adc_dsp_fir_q15_t * state, const int16_t * in, int16_t * out, uint32_t count);
+void ADC_DSP_FirQ31_Ref(adc_dsp_fir_q31_t * state, const int32_t * in, int32_t * out, uint32_t count);
+void ADC_DSP_BiquadQ15_Ref(adc_dsp_biquad_q15_t * state, const int16_t * in, int16_t * out, uint32_t count);
+void ADC_DSP_BiquadQ31_Ref(adc_dsp_biquad_q31_t * state, const int32_t * in, int32_t * out, uint32_t count);
+uint32_t ADC_DSP_CicDecimate_Ref(adc_dsp_cic_t * state,
+                                 const uint16_t * in,
+                                 uint32_t inStride,
+                                 uint32_t count,
+                                 uint16_t * out);
+#endif /* ADC_DSP_REFERENCE_KERNELS */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* ADC_DSP_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_LIN_H
+#define ADC_LIN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*!
+ * @defgroup adc_lin ADC Linearisation
+ * @brief Conversion of raw results to engineering units through breakpoint tables
+ *
+ * The 12-bit result range is split into 2^(12 - segmentShift) segments of
+ * 2^segmentShift codes each. A table holds the engineering value at every segment
+ * boundary, points[i] = f(i << segmentShift) for i = 0 to 2^(12 - segmentShift),
+ * the last point being the value extrapolated at code 4096. Tables are generated
+ * on the host by tools/adc_lin/adc_lin_gen.c from the calibration data of the
+ * sensor (e.g. the NTC resistance curve through the divider) in the fixed-point
+ * unit chosen by the application, and stored as constant arrays.
+ *
+ * A conversion is a shift and a mask to find the segment, two table reads and
+ * a linear interpolation in integer arithmetic, with no branch. The error of a
+ * table is the deviation of the curve from its chords; halving segmentShift
+ * divides it by about four for a smooth curve.
+ *
+ * When ADC_LIN_REFERENCE_KERNELS is defined to 1, a floating point polynomial
+ * evaluation with the same interface is also built (suffix _Ref), to compare
+ * accuracy and throughput with the per-sample polynomial approach on the target.
+ *
+ * @addtogroup adc_lin
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifndef ADC_LIN_REFERENCE_KERNELS
+/*! @brief Build the reference polynomial evaluation */
+#define ADC_LIN_REFERENCE_KERNELS    0
+#endif
+
+/*! @brief Resolution of the converted results */
+#define ADC_LIN_RESULT_BITS          12U
+
+/*! @brief Number of points of a table with the given segment shift */
+#define ADC_LIN_TABLE_POINTS(segmentShift)  (((uint32_t)1U << (ADC_LIN_RESULT_BITS - (segmentShift))) + 1U)
+
+/*!
+ * @brief Breakpoint table of a sensor
+ *
+ * Implements : adc_lin_table_t_Class
+ */
+typedef struct
+{
+    const int32_t * points;      /*!< ADC_LIN_TABLE_POINTS(segmentShift) values at the segment boundaries */
+    uint8_t segmentShift;        /*!< log2 of the number of codes per segment, 0 to ADC_LIN_RESULT_BITS */
+} adc_lin_table_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Checks a table against the constraints of the engine
+ *
+ * Meant to be called once at initialization on each table; the conversion functions
+ * do not check their tables. Adjacent points must differ by less than 2^31.
+ *
+ * @param[in] table Pointer to the table.
+ *
+ * @return    STATUS_SUCCESS: the table can be used;
+ *            STATUS_ERROR  : the segment shift is out of range or two points are too far apart.
+ */
+status_t ADC_LIN_CheckTable(const adc_lin_table_t * table);
+
+/*!
+ * @brief Converts one raw result
+ *
+ * Bits of the result above ADC_LIN_RESULT_BITS are ignored.
+ *
+ * @param[in] table Pointer to the table.
+ * @param[in] code  Raw result.
+ *
+ * @return    Value in the unit of the table, rounded to nearest.
+ */
+int32_t ADC_LIN_Convert(const adc_lin_table_t * table, uint16_t code);
+
+/*!
+ * @brief Converts a block of raw results of one sensor
+ *
+ * @param[in]  table    Pointer to the table.
+ * @param[in]  in       Pointer to the first raw result.
+ * @param[in]  inStride Distance between two consecutive results of the sensor.
+ * @param[out] out      Pointer to the converted values.
+ * @param[in]  count    Number of results.
+ */
+void ADC_LIN_ConvertBlock(const adc_lin_table_t * table,
+                          const uint16_t * in,
+                          uint32_t inStride,
+                          int32_t * out,
+                          uint32_t count);
+
+/*!
+ * @brief Converts an array of results, each with its own table
+ *
+ * Suited to the output of ADC_DRV_GetConvResultsToArray(): in[i] is converted
+ * with tables[i]. A NULL table copies the raw result.
+ *
+ * @param[in]  tables Pointer to the array of tables.
+ * @param[in]  in     Pointer to the raw results.
+ * @param[out] out    Pointer to the converted values.
+ * @param[in]  count  Number of results.
+ */
+void ADC_LIN_ConvertArray(const adc_lin_table_t * const * tables,
+                          const uint16_t * in,
+                          int32_t * out,
+                          uint32_t count);
+
+#if (ADC_LIN_REFERENCE_KERNELS == 1)
+/*!
+ * @brief Converts a block of raw results with a polynomial, in single precision
+ *
+ * value = coeffs[0] + coeffs[1] * code + ... + coeffs[numCoeffs - 1] * code^(numCoeffs - 1),
+ * rounded to nearest.
+ */
+void ADC_LIN_ConvertBlockPoly_Ref(const float * coeffs,
+                                  uint32_t numCoeffs,
+                                  const uint16_t * in,
+                                  uint32_t inStride,
+                                  int32_t * out,
+                                  uint32_t count);
+#endif /* ADC_LIN_REFERENCE_KERNELS */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* ADC_LIN_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
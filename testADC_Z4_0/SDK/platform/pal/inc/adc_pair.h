@@ -0,0 +1,247 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_PAIR_H
+#define ADC_PAIR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bctu_driver.h"
+#include "edma_driver.h"
+
+/*!
+ * @defgroup adc_pair ADC Paired Sampling
+ * @brief Simultaneous sampling on ADC0 and ADC1 into a paired buffer
+ *
+ * One BCTU trigger targets both converters, so ADC0 and ADC1 start sampling on the
+ * same event instead of one after the other. The trigger converts numPairs channels
+ * on each converter (the channel index is the same on both, through the BCTU list
+ * when numPairs > 1), each pair being e.g. a voltage on ADC0 and a current on ADC1.
+ *
+ * Two eDMA channels, requested by the BCTU result registers of each ADC, interleave
+ * the results in a ping-pong buffer: pairs[(((s * numPairs) + p) * 2) + a] is the
+ * result of ADC a for pair p of scan s. Each element also carries the BCTU LIST/LAST
+ * flags; mask it with ADC_PAIR_DATA_MASK.
+ *
+ * Both converters must be configured with ADC_DRV_ConfigConverter() in CTU trigger
+ * mode, with the same clock and sampling settings, so the conversions also end
+ * together. ADC_PAIR_MeasureSkew() measures the remaining skew.
+ *
+ * @addtogroup adc_pair
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of converters in a pair */
+#define ADC_PAIR_ADC_COUNT      2U
+
+/*! @brief Mask of the conversion data in a buffer element */
+#define ADC_PAIR_DATA_MASK      ((uint16_t)BCTU_ADC0DR_ADC_DATA_MASK)
+
+/*!
+ * @brief Paired sampling events
+ *
+ * Implements : adc_pair_event_t_Class
+ */
+typedef enum
+{
+    ADC_PAIR_EVENT_HALF      = 0x00U,    /*!< The first half of the buffer is filled */
+    ADC_PAIR_EVENT_FULL      = 0x01U,    /*!< The second half of the buffer is filled */
+    ADC_PAIR_EVENT_DMA_ERROR = 0x02U     /*!< The eDMA reported an error; the sampling is stopped */
+} adc_pair_event_t;
+
+/*!
+ * @brief Callback invoked when a buffer half is filled
+ *
+ * pairs points to scanCount scans of numPairs pairs each. The data is overwritten
+ * one half-buffer period after the callback is invoked. For ADC_PAIR_EVENT_DMA_ERROR,
+ * pairs is NULL.
+ *
+ * Implements : adc_pair_callback_t_Class
+ */
+typedef void (*adc_pair_callback_t)(const uint16_t * pairs,
+                                    uint32_t scanCount,
+                                    adc_pair_event_t event,
+                                    void * userData);
+
+/*!
+ * @brief Free running timestamp source (e.g. a read of the STM counter)
+ *
+ * Implements : adc_pair_timestamp_t_Class
+ */
+typedef uint32_t (*adc_pair_timestamp_t)(void);
+
+/*!
+ * @brief Defines the paired sampling configuration structure
+ *
+ * Implements : adc_pair_user_config_t_Class
+ */
+typedef struct
+{
+    uint32_t bctuInstance;                         /*!< BCTU instance */
+    uint8_t triggerIdx;                            /*!< BCTU trigger input starting both converters */
+    const uint8_t * channels;                      /*!< Channel converted on both ADCs for each pair */
+    uint8_t numPairs;                              /*!< Number of pairs per trigger */
+    uint8_t listIdx;                               /*!< First BCTU list entry used when numPairs > 1 */
+    uint8_t dmaVirtualChannel[ADC_PAIR_ADC_COUNT]; /*!< eDMA virtual channels, requested by EDMA_REQ_BCTU_0 and EDMA_REQ_BCTU_1 */
+    uint16_t * buffer;                             /*!< Ping-pong buffer of 2 * scansPerBuffer * numPairs pairs */
+    uint32_t scansPerBuffer;                       /*!< Number of scans in each buffer half */
+    adc_pair_callback_t callback;                  /*!< Callback to invoke when a buffer half is filled; can be NULL */
+    void * callbackParam;                          /*!< Callback parameter */
+} adc_pair_user_config_t;
+
+/*!
+ * @brief Skew between the paired conversions
+ *
+ * Positive values mean ADC1 completes after ADC0.
+ *
+ * Implements : adc_pair_skew_t_Class
+ */
+typedef struct
+{
+    int32_t minTicks;        /*!< Smallest skew, in timestamp ticks */
+    int32_t maxTicks;        /*!< Largest skew, in timestamp ticks */
+    int32_t meanTicks;       /*!< Mean skew, in timestamp ticks */
+    uint32_t resolution;     /*!< Duration of one poll of the result flags, in timestamp ticks */
+} adc_pair_skew_t;
+
+/*!
+ * @brief Defines the paired sampling statistics
+ *
+ * Implements : adc_pair_stats_t_Class
+ */
+typedef struct
+{
+    uint32_t halfBuffers;    /*!< Number of buffer halves delivered */
+    uint32_t missedHalves;   /*!< Number of buffer halves overwritten before they were delivered */
+    uint32_t unpairedHalves; /*!< Halves delivered while the ADC0 transfer was not aligned with ADC1 */
+} adc_pair_stats_t;
+
+/*!
+ * @brief Runtime state of the paired sampling
+ *
+ * The fields are internal to the paired sampling and must not be accessed by the application.
+ *
+ * Implements : adc_pair_state_t_Class
+ */
+typedef struct
+{
+    adc_pair_user_config_t config;       /*!< Paired sampling configuration */
+    adc_pair_event_t lastEvent;          /*!< Last buffer half delivered */
+    volatile bool running;               /*!< True between ADC_PAIR_Start() and ADC_PAIR_Stop() */
+    adc_pair_stats_t stats;              /*!< Statistics */
+} adc_pair_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the paired sampling
+ *
+ * Writes the BCTU list, configures the trigger for both converters with its hardware
+ * input disabled, and configures both eDMA channels as circular transfers into the
+ * interleaved buffer. The BCTU and the eDMA channels must be initialized before.
+ *
+ * @param[out] state  Pointer to the paired sampling state structure.
+ * @param[in]  config Pointer to the paired sampling configuration structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if an eDMA transfer cannot be configured.
+ */
+status_t ADC_PAIR_Init(adc_pair_state_t * state, const adc_pair_user_config_t * config);
+
+/*!
+ * @brief Starts the sampling on the hardware trigger
+ *
+ * @param[in] state Pointer to the paired sampling state structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if the sampling is already running.
+ */
+status_t ADC_PAIR_Start(adc_pair_state_t * state);
+
+/*!
+ * @brief Stops the sampling
+ *
+ * @param[in] state Pointer to the paired sampling state structure.
+ *
+ * @return    STATUS_SUCCESS
+ */
+status_t ADC_PAIR_Stop(adc_pair_state_t * state);
+
+/*!
+ * @brief De-initializes the paired sampling
+ *
+ * Stops the sampling and disables the BCTU DMA requests.
+ *
+ * @param[in] state Pointer to the paired sampling state structure.
+ *
+ * @return    STATUS_SUCCESS
+ */
+status_t ADC_PAIR_Deinit(adc_pair_state_t * state);
+
+/*!
+ * @brief Measures the skew between the paired conversions
+ *
+ * With the sampling stopped, starts the trigger by software rounds times and
+ * timestamps the new data flag of each converter by polling. The DMA requests are
+ * suspended during the measurement. As both converters start on the same trigger,
+ * the completion skew is the sampling skew when their settings are identical.
+ *
+ * @param[in]  state        Pointer to the paired sampling state structure.
+ * @param[in]  timestamp    Timestamp source.
+ * @param[in]  rounds       Number of conversions to measure (at least 1).
+ * @param[in]  timeoutTicks Maximum duration of one round, in timestamp ticks.
+ * @param[out] skew         Pointer to the measured skew.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if the sampling is running;
+ *            STATUS_TIMEOUT: if a converter did not complete within timeoutTicks.
+ */
+status_t ADC_PAIR_MeasureSkew(adc_pair_state_t * state,
+                              adc_pair_timestamp_t timestamp,
+                              uint32_t rounds,
+                              uint32_t timeoutTicks,
+                              adc_pair_skew_t * skew);
+
+/*!
+ * @brief Returns the paired sampling statistics
+ *
+ * @param[in]  state Pointer to the paired sampling state structure.
+ * @param[out] stats Pointer to the statistics structure.
+ */
+void ADC_PAIR_GetStatistics(const adc_pair_state_t * state, adc_pair_stats_t * stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* ADC_PAIR_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_STATS_H
+#define ADC_STATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*!
+ * @defgroup adc_stats ADC Running Statistics
+ * @brief Per channel minimum, maximum, mean and variance updated in the conversion path
+ *
+ * ADC_STATS_Update() is meant to be called where the results are already at hand:
+ * the end of chain interrupt, after ADC_DRV_GetConvResultsToArray(), or the callback
+ * of an ADC stream, with the same channel-interleaved layout. Each enabled channel
+ * costs a fixed amount of work per sample and the sample memory is not read again.
+ *
+ * Two modes are available:
+ * - window: exact statistics of consecutive windows of publishInterval scans;
+ * - exponential: exponentially weighted mean and variance with a smoothing factor
+ *   of 2^-expShift, published every publishInterval scans; the minimum and maximum
+ *   cover the scans since the previous publication.
+ *
+ * The results are published in a double-buffered block. ADC_STATS_GetSnapshot()
+ * copies the last published block without masking interrupts and retries if a
+ * publication happened meanwhile.
+ *
+ * @addtogroup adc_stats
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of results in a scan */
+#define ADC_STATS_MAX_CHANNELS    16U
+
+/*! @brief Maximum number of scans in a window */
+#define ADC_STATS_MAX_WINDOW      65535U
+
+/*!
+ * @brief Statistics modes
+ *
+ * Implements : adc_stats_mode_t_Class
+ */
+typedef enum
+{
+    ADC_STATS_MODE_WINDOW      = 0x00U,    /*!< Statistics of consecutive windows */
+    ADC_STATS_MODE_EXPONENTIAL = 0x01U     /*!< Exponentially weighted mean and variance */
+} adc_stats_mode_t;
+
+/*!
+ * @brief Defines the statistics configuration structure
+ *
+ * Implements : adc_stats_user_config_t_Class
+ */
+typedef struct
+{
+    adc_stats_mode_t mode;         /*!< Statistics mode */
+    uint32_t channelCount;         /*!< Number of results in each scan, up to ADC_STATS_MAX_CHANNELS */
+    uint32_t channelMask;          /*!< Results with statistics (bit c: result c of the scan) */
+    uint32_t publishInterval;      /*!< Scans between publications (window length), 1 to ADC_STATS_MAX_WINDOW */
+    uint8_t expShift;              /*!< Exponential mode: smoothing factor is 2^-expShift, 1 to 15 */
+} adc_stats_user_config_t;
+
+/*!
+ * @brief Statistics of one channel
+ *
+ * Implements : adc_stats_channel_t_Class
+ */
+typedef struct
+{
+    uint16_t min;                  /*!< Minimum result */
+    uint16_t max;                  /*!< Maximum result */
+    uint32_t mean;                 /*!< Mean result, Q16 (result * 65536) */
+    uint32_t variance;             /*!< Population variance, Q8 (result^2 * 256) */
+} adc_stats_channel_t;
+
+/*!
+ * @brief Published statistics
+ *
+ * Implements : adc_stats_snapshot_t_Class
+ */
+typedef struct
+{
+    uint32_t sequence;                                   /*!< Publication number, starting at 1 */
+    uint32_t scans;                                      /*!< Scans covered by min/max (and mean/variance in window mode) */
+    adc_stats_channel_t channel[ADC_STATS_MAX_CHANNELS]; /*!< Statistics, indexed by result position; zero when disabled */
+} adc_stats_snapshot_t;
+
+/*!
+ * @brief Running accumulators of one channel
+ *
+ * Implements : adc_stats_accu_t_Class
+ */
+typedef struct
+{
+    uint32_t sum;                  /*!< Window mode: sum of the results */
+    uint64_t sumSq;                /*!< Window mode: sum of the squared results */
+    int32_t mean;                  /*!< Exponential mode: mean, Q16 */
+    int64_t variance;              /*!< Exponential mode: variance, Q16 */
+    uint16_t min;                  /*!< Minimum since the last publication */
+    uint16_t max;                  /*!< Maximum since the last publication */
+} adc_stats_accu_t;
+
+/*!
+ * @brief Runtime state of the statistics
+ *
+ * The fields are internal to the statistics and must not be accessed by the application.
+ *
+ * Implements : adc_stats_state_t_Class
+ */
+typedef struct
+{
+    adc_stats_user_config_t config;                      /*!< Statistics configuration */
+    uint8_t columns[ADC_STATS_MAX_CHANNELS];             /*!< Positions of the enabled results in a scan */
+    uint8_t numColumns;                                  /*!< Number of enabled results */
+    adc_stats_accu_t accu[ADC_STATS_MAX_CHANNELS];       /*!< Accumulators, indexed like columns */
+    uint32_t scans;                                      /*!< Scans since the last publication */
+    bool seeded;                                         /*!< Exponential mode: the mean holds a result */
+    volatile adc_stats_snapshot_t published[2];          /*!< Double-buffered published statistics */
+    volatile uint32_t sequence;                          /*!< Last publication; published[sequence & 1] is valid */
+} adc_stats_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the statistics
+ *
+ * @param[out] state  Pointer to the statistics state structure.
+ * @param[in]  config Pointer to the statistics configuration structure.
+ */
+void ADC_STATS_Init(adc_stats_state_t * state, const adc_stats_user_config_t * config);
+
+/*!
+ * @brief Restarts the accumulation; the last publication stays available
+ *
+ * @param[in] state Pointer to the statistics state structure.
+ */
+void ADC_STATS_Reset(adc_stats_state_t * state);
+
+/*!
+ * @brief Accumulates a block of scans
+ *
+ * scans[(s * channelCount) + c] is result c of scan s. Publishes the statistics
+ * each time publishInterval scans have been accumulated. Must not be preempted by
+ * another call for the same state.
+ *
+ * @param[in] state     Pointer to the statistics state structure.
+ * @param[in] scans     Pointer to the results.
+ * @param[in] scanCount Number of scans.
+ */
+void ADC_STATS_Update(adc_stats_state_t * state, const uint16_t * scans, uint32_t scanCount);
+
+/*!
+ * @brief Copies the last published statistics
+ *
+ * Can be called from a context preempted by ADC_STATS_Update().
+ *
+ * @param[in]  state    Pointer to the statistics state structure.
+ * @param[out] snapshot Pointer to the copy.
+ *
+ * @return    STATUS_SUCCESS: a publication was copied;
+ *            STATUS_BUSY   : nothing was published yet.
+ */
+status_t ADC_STATS_GetSnapshot(const adc_stats_state_t * state, adc_stats_snapshot_t * snapshot);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* ADC_STATS_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
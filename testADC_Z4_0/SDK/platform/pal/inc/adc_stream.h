@@ -0,0 +1,214 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_STREAM_H
+#define ADC_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_sar_driver.h"
+#include "edma_driver.h"
+
+/*!
+ * @defgroup adc_stream ADC Stream
+ * @brief Continuous ADC scan acquisition into ping-pong buffers
+ *
+ * The ADC runs a Normal chain in Scan mode over a contiguous range of channels.
+ * The end of conversion of the last channel of the range raises an eDMA request
+ * which copies the results of the whole scan from the CDR registers to memory, so
+ * the CPU is only involved once per buffer half. The buffer is split in two halves
+ * of scansPerBuffer scans each; the callback is invoked when a half is filled,
+ * while the eDMA fills the other half.
+ *
+ * The application must configure the converter in Scan mode (ADC_CONV_MODE_SCAN),
+ * initialize the eDMA module and the virtual channel with the request source of the
+ * ADC instance (EDMA_REQ_ADC_x_MUXy) before calling ADC_STREAM_Init().
+ *
+ * @addtogroup adc_stream
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of channels converted in each scan */
+#define ADC_STREAM_MAX_CHANNELS    32U
+
+/*!
+ * @brief Defines the events reported by the stream
+ *
+ * Implements : adc_stream_event_t_Class
+ */
+typedef enum
+{
+    ADC_STREAM_EVENT_HALF      = 0x00U,    /*!< The first half of the buffer is filled */
+    ADC_STREAM_EVENT_FULL      = 0x01U,    /*!< The second half of the buffer is filled */
+    ADC_STREAM_EVENT_DMA_ERROR = 0x02U     /*!< The eDMA reported an error; the stream is stopped */
+} adc_stream_event_t;
+
+/*!
+ * @brief Callback invoked when a buffer half is filled
+ *
+ * scans points to scanCount scans of channelCount results each, stored channel
+ * after channel (scans[(s * channelCount) + c] is channel firstChannel + c of scan s).
+ * The data is overwritten by the eDMA one half-buffer period after the callback is
+ * invoked. timestamp is the value of the timestamp source read when the interrupt
+ * was serviced. For ADC_STREAM_EVENT_DMA_ERROR, scans is NULL.
+ *
+ * Implements : adc_stream_callback_t_Class
+ */
+typedef void (*adc_stream_callback_t)(const uint16_t * scans,
+                                      uint32_t scanCount,
+                                      uint32_t timestamp,
+                                      adc_stream_event_t event,
+                                      void * userData);
+
+/*!
+ * @brief Free running timestamp source (e.g. a read of the STM counter)
+ *
+ * Implements : adc_stream_timestamp_t_Class
+ */
+typedef uint32_t (*adc_stream_timestamp_t)(void);
+
+/*!
+ * @brief Defines the stream configuration structure
+ *
+ * Implements : adc_stream_user_config_t_Class
+ */
+typedef struct
+{
+    uint32_t instance;                   /*!< ADC instance number */
+    uint32_t firstChannel;               /*!< First channel of the scanned range */
+    uint32_t channelCount;               /*!< Number of consecutive channels converted in each scan */
+    uint8_t dmaVirtualChannel;           /*!< eDMA virtual channel triggered by the ADC */
+    uint16_t * buffer;                   /*!< Ping-pong buffer of 2 * scansPerBuffer * channelCount elements */
+    uint32_t scansPerBuffer;             /*!< Number of scans in each buffer half */
+    adc_stream_callback_t callback;      /*!< Callback to invoke when a buffer half is filled */
+    void * callbackParam;                /*!< Callback parameter */
+    adc_stream_timestamp_t timestamp;    /*!< Timestamp source; can be NULL */
+    uint32_t timestampFreq;              /*!< Frequency of the timestamp source in Hz */
+} adc_stream_user_config_t;
+
+/*!
+ * @brief Defines the stream statistics
+ *
+ * Implements : adc_stream_stats_t_Class
+ */
+typedef struct
+{
+    uint32_t halfBuffers;          /*!< Number of buffer halves delivered */
+    uint32_t missedHalves;         /*!< Number of buffer halves overwritten before they were delivered */
+    uint32_t samplesPerSecond;     /*!< Sustained sample rate, all channels included */
+    uint32_t cpuLoad;              /*!< Time spent in the stream interrupt and callback, in per mille */
+} adc_stream_stats_t;
+
+/*!
+ * @brief Runtime state of a stream
+ *
+ * The fields are internal to the stream and must not be accessed by the application.
+ *
+ * Implements : adc_stream_state_t_Class
+ */
+typedef struct
+{
+    adc_stream_user_config_t config;     /*!< Stream configuration */
+    adc_stream_event_t lastEvent;        /*!< Last buffer half delivered */
+    volatile bool running;               /*!< True between ADC_STREAM_Start() and ADC_STREAM_Stop() */
+    uint32_t halfBuffers;                /*!< Number of buffer halves delivered */
+    uint32_t missedHalves;               /*!< Number of buffer halves overwritten before delivery */
+    uint32_t firstTimestamp;             /*!< Timestamp of the first delivered half */
+    uint32_t lastTimestamp;              /*!< Timestamp of the last delivered half */
+    uint32_t busyTicks;                  /*!< Time spent in the interrupt and callback */
+} adc_stream_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes a stream
+ *
+ * Enables the channels in the Normal chain, the DMA request of the last channel and
+ * configures the eDMA virtual channel as a circular transfer into the buffer.
+ *
+ * @param[out] state  Pointer to the stream state structure.
+ * @param[in]  config Pointer to the stream configuration structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the eDMA transfer cannot be configured.
+ */
+status_t ADC_STREAM_Init(adc_stream_state_t * state, const adc_stream_user_config_t * config);
+
+/*!
+ * @brief Starts the acquisition
+ *
+ * @param[in] state Pointer to the stream state structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if the stream is already running.
+ */
+status_t ADC_STREAM_Start(adc_stream_state_t * state);
+
+/*!
+ * @brief Stops the acquisition
+ *
+ * The scan in progress is completed; the partially filled buffer half is not delivered.
+ *
+ * @param[in] state Pointer to the stream state structure.
+ *
+ * @return    STATUS_SUCCESS
+ */
+status_t ADC_STREAM_Stop(adc_stream_state_t * state);
+
+/*!
+ * @brief De-initializes a stream
+ *
+ * Stops the acquisition and disables the channels and DMA requests enabled by ADC_STREAM_Init().
+ *
+ * @param[in] state Pointer to the stream state structure.
+ *
+ * @return    STATUS_SUCCESS
+ */
+status_t ADC_STREAM_Deinit(adc_stream_state_t * state);
+
+/*!
+ * @brief Returns the stream statistics
+ *
+ * The sample rate and CPU load are computed from the timestamps and are 0 if
+ * no timestamp source is configured or less than two halves were delivered.
+ *
+ * @param[in]  state Pointer to the stream state structure.
+ * @param[out] stats Pointer to the statistics structure.
+ */
+void ADC_STREAM_GetStatistics(const adc_stream_state_t * state, adc_stream_stats_t * stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* ADC_STREAM_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
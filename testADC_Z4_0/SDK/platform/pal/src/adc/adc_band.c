@@ -0,0 +1,316 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_band.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ */
+
+#include <stddef.h>
+#include "adc_band.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+#ifdef ADC_THRHLR_PER_INSTANCE_COUNT
+/* Number of watchdog threshold registers of each instance */
+static const uint32_t s_adcBandThrhlrCount[ADC_INSTANCE_COUNT] = ADC_THRHLR_PER_INSTANCE_COUNT;
+#endif
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_BAND_Locate
+ * Description   : Returns the band of a conversion result, i.e. the number of
+ * edges lower than or equal to it.
+ *
+ *END**************************************************************************/
+static uint8_t ADC_BAND_Locate(const adc_band_chan_config_t * chan, uint16_t value)
+{
+    uint8_t band = 0U;
+
+    while ((band < chan->numEdges) && (value >= chan->edges[band]))
+    {
+        band++;
+    }
+
+    return band;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_BAND_SetWindow
+ * Description   : Programs the threshold register of a channel with the window
+ * of a band, widened by the hysteresis. The side of the first and last bands
+ * which is open has its interrupt disabled.
+ *
+ *END**************************************************************************/
+static void ADC_BAND_SetWindow(uint32_t instance, const adc_band_chan_config_t * chan, uint8_t band)
+{
+    adc_wdg_threshold_values_t window;
+    uint32_t limit;
+
+    if (band > 0U)
+    {
+        limit = chan->edges[band - 1U];
+        window.lowThreshold = (limit > chan->hysteresis) ? (uint16_t)(limit - chan->hysteresis) : 0U;
+        window.lowThresholdIntEn = true;
+    }
+    else
+    {
+        window.lowThreshold = 0U;
+        window.lowThresholdIntEn = false;
+    }
+
+    if (band < chan->numEdges)
+    {
+        limit = (uint32_t)chan->edges[band] + chan->hysteresis;
+        window.highThreshold = (limit < ADC_BAND_RESULT_MAX) ? (uint16_t)limit : (uint16_t)ADC_BAND_RESULT_MAX;
+        window.highThresholdIntEn = true;
+    }
+    else
+    {
+        window.highThreshold = (uint16_t)ADC_BAND_RESULT_MAX;
+        window.highThresholdIntEn = false;
+    }
+
+    ADC_DRV_SetWdgThreshold(instance, chan->registerIdx, &window);
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_BAND_Init
+ * Description   : Programs the watchdog window of every channel around its
+ * current band and enables the channel watchdogs.
+ *
+ * Implements : ADC_BAND_Init_Activity
+ *END**************************************************************************/
+status_t ADC_BAND_Init(adc_band_state_t * state,
+                       const adc_band_user_config_t * config)
+{
+    const adc_band_chan_config_t * chan;
+    uint32_t registerCount = ADC_THRHLR_COUNT;
+    uint32_t flagMask = 0U;
+    uint32_t regMask;
+    uint8_t idx;
+    uint8_t edge;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->instance < ADC_INSTANCE_COUNT);
+    DEV_ASSERT(config->channels != NULL);
+    DEV_ASSERT((config->numChannels > 0U) && (config->numChannels <= ADC_BAND_MAX_CHANNELS));
+
+#ifdef ADC_THRHLR_PER_INSTANCE_COUNT
+    registerCount = s_adcBandThrhlrCount[config->instance];
+#endif
+
+    /* Validate all the channels before touching the hardware */
+    for (idx = 0U; idx < config->numChannels; idx++)
+    {
+        chan = &config->channels[idx];
+        DEV_ASSERT(chan->chnIdx < ADC_CDR_COUNT);
+        DEV_ASSERT(chan->edges != NULL);
+        DEV_ASSERT((chan->numEdges > 0U) && (chan->numEdges <= ADC_BAND_MAX_EDGES));
+        for (edge = 1U; edge < chan->numEdges; edge++)
+        {
+            DEV_ASSERT(chan->edges[edge] > chan->edges[edge - 1U]);
+        }
+
+        if (chan->registerIdx >= registerCount)
+        {
+            return STATUS_ERROR;
+        }
+
+        regMask = ADC_WDOG_REG_MASK_HIGH(chan->registerIdx) | ADC_WDOG_REG_MASK_LOW(chan->registerIdx);
+        if ((flagMask & regMask) != 0U)
+        {
+            return STATUS_ERROR;
+        }
+        flagMask |= regMask;
+    }
+
+    state->config = *config;
+    state->flagMask = flagMask;
+    state->stats.interrupts = 0U;
+    state->stats.bandChanges = 0U;
+    state->stats.spurious = 0U;
+
+    for (idx = 0U; idx < config->numChannels; idx++)
+    {
+        chan = &config->channels[idx];
+        state->band[idx] = ADC_BAND_Locate(chan, ADC_DRV_GetConvResult(config->instance, chan->chnIdx));
+
+        ADC_DRV_SetWdgChannelMapping(config->instance, chan->chnIdx, chan->registerIdx);
+        ADC_BAND_SetWindow(config->instance, chan, state->band[idx]);
+        ADC_DRV_ClearWdgOutOfRangeFlag(config->instance, chan->chnIdx);
+    }
+
+    ADC_DRV_ClearWdgThresholdFlags(config->instance, flagMask);
+
+    for (idx = 0U; idx < config->numChannels; idx++)
+    {
+        ADC_DRV_EnableChannelWdg(config->instance, config->channels[idx].chnIdx);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_BAND_Deinit
+ * Description   : Disables the channel watchdogs and their interrupts.
+ *
+ * Implements : ADC_BAND_Deinit_Activity
+ *END**************************************************************************/
+void ADC_BAND_Deinit(adc_band_state_t * state)
+{
+    const adc_band_user_config_t * config;
+    const adc_band_chan_config_t * chan;
+    const adc_wdg_threshold_values_t open = {
+        .lowThreshold = 0U,
+        .highThreshold = (uint16_t)ADC_BAND_RESULT_MAX,
+        .lowThresholdIntEn = false,
+        .highThresholdIntEn = false
+    };
+    uint8_t idx;
+
+    DEV_ASSERT(state != NULL);
+    config = &state->config;
+
+    for (idx = 0U; idx < config->numChannels; idx++)
+    {
+        chan = &config->channels[idx];
+        ADC_DRV_DisableChannelWdg(config->instance, chan->chnIdx);
+        ADC_DRV_SetWdgThreshold(config->instance, chan->registerIdx, &open);
+        ADC_DRV_ClearWdgOutOfRangeFlag(config->instance, chan->chnIdx);
+    }
+
+    ADC_DRV_ClearWdgThresholdFlags(config->instance, state->flagMask);
+    state->flagMask = 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_BAND_IRQHandler
+ * Description   : Moves the window of every channel whose threshold register
+ * fired around the band of its latest result and notifies the change. The
+ * window is reprogrammed before the flags are cleared: a conversion flagged in
+ * between is out of the new window as well and flags it again on the next scan.
+ *
+ * Implements : ADC_BAND_IRQHandler_Activity
+ *END**************************************************************************/
+void ADC_BAND_IRQHandler(adc_band_state_t * state)
+{
+    const adc_band_user_config_t * config;
+    const adc_band_chan_config_t * chan;
+    uint32_t flags;
+    uint32_t regMask;
+    uint16_t value;
+    uint8_t previousBand;
+    uint8_t idx;
+
+    DEV_ASSERT(state != NULL);
+    config = &state->config;
+
+    flags = ADC_DRV_GetWdgThresholdFlags(config->instance) & state->flagMask;
+    state->stats.interrupts++;
+
+    for (idx = 0U; (idx < config->numChannels) && (flags != 0U); idx++)
+    {
+        chan = &config->channels[idx];
+        regMask = ADC_WDOG_REG_MASK_HIGH(chan->registerIdx) | ADC_WDOG_REG_MASK_LOW(chan->registerIdx);
+        if ((flags & regMask) == 0U)
+        {
+            continue;
+        }
+        flags &= ~regMask;
+
+        value = ADC_DRV_GetConvResult(config->instance, chan->chnIdx);
+        previousBand = state->band[idx];
+        state->band[idx] = ADC_BAND_Locate(chan, value);
+
+        if (state->band[idx] != previousBand)
+        {
+            ADC_BAND_SetWindow(config->instance, chan, state->band[idx]);
+        }
+        ADC_DRV_ClearWdgOutOfRangeFlag(config->instance, chan->chnIdx);
+        ADC_DRV_ClearWdgThresholdFlags(config->instance, regMask);
+
+        if (state->band[idx] == previousBand)
+        {
+            /* The result is back inside the band by the time it is read */
+            state->stats.spurious++;
+        }
+        else
+        {
+            state->stats.bandChanges++;
+            if (config->callback != NULL)
+            {
+                config->callback(idx, previousBand, state->band[idx], value, config->callbackParam);
+            }
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_BAND_GetBand
+ * Description   : Returns the current band of a channel.
+ *
+ * Implements : ADC_BAND_GetBand_Activity
+ *END**************************************************************************/
+uint8_t ADC_BAND_GetBand(const adc_band_state_t * state, uint8_t channel)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(channel < state->config.numChannels);
+
+    return state->band[channel];
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_BAND_GetStatistics
+ * Description   : Returns the band service statistics.
+ *
+ * Implements : ADC_BAND_GetStatistics_Activity
+ *END**************************************************************************/
+void ADC_BAND_GetStatistics(const adc_band_state_t * state, adc_band_stats_t * stats)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(stats != NULL);
+
+    *stats = state->stats;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
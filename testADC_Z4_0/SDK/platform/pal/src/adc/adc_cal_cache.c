@@ -0,0 +1,401 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.3, Cast performed between a pointer to object type
+ * and a pointer to a different object type.
+ * The record is hashed and cleared as an array of bytes.
+ *
+ */
+
+#include <stddef.h>
+#include "adc_cal_cache.h"
+#include "clock_manager.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Marker of a record written by this module ("ADCC") */
+#define ADC_CAL_RECORD_MAGIC    0x41444343UL
+
+/* Reflected CRC-32 (IEEE 802.3) polynomial */
+#define ADC_CAL_CRC32_POLY      0xEDB88320UL
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_ReadTimestamp
+ * Description   : Reads the configured timestamp source, or returns 0.
+ *
+ *END**************************************************************************/
+static inline uint32_t ADC_CAL_ReadTimestamp(const adc_cal_state_t * state)
+{
+    return (state->config.timestamp != NULL) ? state->config.timestamp() : 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_ClearRecord
+ * Description   : Clears the record, padding bytes included, so that a rebuilt
+ * record always hashes the same way.
+ *
+ *END**************************************************************************/
+static void ADC_CAL_ClearRecord(adc_cal_record_t * record)
+{
+    uint8_t * data = (uint8_t *)record;
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(*record); i++)
+    {
+        data[i] = 0U;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_RecordCrc
+ * Description   : CRC-32 of the record, CRC field excluded. Bitwise: the record
+ * is hashed once per boot and once per write, a table is not worth the flash.
+ *
+ *END**************************************************************************/
+static uint32_t ADC_CAL_RecordCrc(const adc_cal_record_t * record)
+{
+    const uint8_t * data = (const uint8_t *)record;
+    uint32_t crc = 0xFFFFFFFFUL;
+    uint32_t i;
+    uint32_t bit;
+
+    for (i = 0U; i < offsetof(adc_cal_record_t, crc); i++)
+    {
+        crc ^= data[i];
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ ADC_CAL_CRC32_POLY) : (crc >> 1U);
+        }
+    }
+    return ~crc;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_GetClockFreq
+ * Description   : Returns the clock frequency of a converter, 0 if unknown.
+ *
+ *END**************************************************************************/
+static uint32_t ADC_CAL_GetClockFreq(uint32_t instance)
+{
+    static const clock_names_t adcClocks[ADC_INSTANCE_COUNT] = ADC_CLOCKS;
+    uint32_t freq = 0U;
+
+    if (CLOCK_SYS_GetFreq(adcClocks[instance], &freq) != STATUS_SUCCESS)
+    {
+        freq = 0U;
+    }
+    return freq;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_GetStaleMask
+ * Description   : Returns the calibrated instances whose calibration conditions
+ * differ from the current ones.
+ *
+ *END**************************************************************************/
+static uint32_t ADC_CAL_GetStaleMask(const adc_cal_state_t * state)
+{
+    const adc_cal_record_t * record = &state->record;
+    uint32_t staleMask = 0U;
+    uint32_t instance;
+
+    for (instance = 0U; instance < ADC_INSTANCE_COUNT; instance++)
+    {
+        const uint32_t mask = (uint32_t)1U << instance;
+
+        if ((record->calibratedMask & mask) != 0U)
+        {
+            if ((record->clockFreq[instance] != ADC_CAL_GetClockFreq(instance)) ||
+                (record->temperatureBand[instance] != state->temperatureBand))
+            {
+                staleMask |= mask;
+            }
+        }
+    }
+    return staleMask & state->config.instanceMask;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_StartInstances
+ * Description   : Starts the calibration of the instances in mask.
+ *
+ *END**************************************************************************/
+static void ADC_CAL_StartInstances(adc_cal_state_t * state, uint32_t mask)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ADC_INSTANCE_COUNT; instance++)
+    {
+        if ((mask & ((uint32_t)1U << instance)) != 0U)
+        {
+            state->startTicks[instance] = ADC_CAL_ReadTimestamp(state);
+            ADC_DRV_StartCalibration(instance);
+        }
+    }
+    state->activeMask |= mask;
+    state->pendingMask &= ~mask;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_PollInstances
+ * Description   : Polls the calibrations in progress and records the outcome of
+ * the completed ones. A failed calibration is scheduled again, up to
+ * ADC_CAL_MAX_RETRIES times. Returns STATUS_ERROR if one of them failed.
+ *
+ *END**************************************************************************/
+static status_t ADC_CAL_PollInstances(adc_cal_state_t * state)
+{
+    adc_cal_record_t * record = &state->record;
+    status_t result = STATUS_SUCCESS;
+    uint32_t instance;
+
+    for (instance = 0U; instance < ADC_INSTANCE_COUNT; instance++)
+    {
+        const uint32_t mask = (uint32_t)1U << instance;
+
+        if ((state->activeMask & mask) != 0U)
+        {
+            const status_t status = ADC_DRV_GetCalibrationStatus(instance);
+
+            if (status != STATUS_BUSY)
+            {
+                ADC_DRV_EndCalibration(instance);
+                state->activeMask &= ~mask;
+                state->stats.calibrations++;
+                state->recordDirty = true;
+                if (status == STATUS_SUCCESS)
+                {
+                    state->retries[instance] = 0U;
+                    state->stats.calibratedMask |= mask;
+                    record->calibratedMask |= mask;
+                    record->clockFreq[instance] = ADC_CAL_GetClockFreq(instance);
+                    record->temperatureBand[instance] = state->temperatureBand;
+                    record->calibrationTicks[instance] = ADC_CAL_ReadTimestamp(state) - state->startTicks[instance];
+                    ADC_DRV_GetUserOffsetGain(instance, &record->userOffset[instance], &record->userGain[instance]);
+                }
+                else
+                {
+                    state->stats.calibratedMask &= ~mask;
+                    record->calibratedMask &= ~mask;
+                    state->stats.failures++;
+                    if (state->retries[instance] < ADC_CAL_MAX_RETRIES)
+                    {
+                        state->retries[instance]++;
+                        state->pendingMask |= mask;
+                    }
+                    result = STATUS_ERROR;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_WriteRecord
+ * Description   : Seals the record with its CRC and writes it.
+ *
+ *END**************************************************************************/
+static status_t ADC_CAL_WriteRecord(adc_cal_state_t * state)
+{
+    status_t status = STATUS_ERROR;
+
+    state->record.crc = ADC_CAL_RecordCrc(&state->record);
+    if (state->config.nvmWrite != NULL)
+    {
+        status = state->config.nvmWrite(&state->record, state->config.nvmParam);
+    }
+    if (status == STATUS_SUCCESS)
+    {
+        state->recordDirty = false;
+        state->stats.nvmWrites++;
+    }
+    return status;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_Boot
+ * Description   : Restores the instances with a valid record matching the
+ * current conditions and calibrates the other ones in parallel.
+ *
+ * Implements    : ADC_CAL_Boot_Activity
+ *END**************************************************************************/
+status_t ADC_CAL_Boot(adc_cal_state_t * state,
+                      const adc_cal_user_config_t * config,
+                      uint32_t temperatureBand)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->nvmRead != NULL);
+    DEV_ASSERT((config->instanceMask >> ADC_INSTANCE_COUNT) == 0U);
+
+    adc_cal_record_t * record = &state->record;
+    status_t status = STATUS_SUCCESS;
+    uint32_t restoreMask;
+    uint32_t instance;
+    uint32_t entry;
+
+    state->config = *config;
+    state->pendingMask = 0U;
+    state->activeMask = 0U;
+    state->temperatureBand = temperatureBand;
+    state->recordDirty = false;
+    for (instance = 0U; instance < ADC_INSTANCE_COUNT; instance++)
+    {
+        state->retries[instance] = 0U;
+    }
+    state->stats.calibratedMask = 0U;
+    state->stats.restoredMask = 0U;
+    state->stats.savedTicks = 0U;
+    state->stats.calibrations = 0U;
+    state->stats.failures = 0U;
+    state->stats.nvmWrites = 0U;
+    entry = ADC_CAL_ReadTimestamp(state);
+
+    if ((config->nvmRead(record, config->nvmParam) != STATUS_SUCCESS) ||
+        (record->magic != ADC_CAL_RECORD_MAGIC) ||
+        (record->version != ADC_CAL_RECORD_VERSION) ||
+        (record->crc != ADC_CAL_RecordCrc(record)))
+    {
+        ADC_CAL_ClearRecord(record);
+        record->magic = ADC_CAL_RECORD_MAGIC;
+        record->version = ADC_CAL_RECORD_VERSION;
+    }
+
+    restoreMask = record->calibratedMask & config->instanceMask & ~ADC_CAL_GetStaleMask(state);
+    for (instance = 0U; instance < ADC_INSTANCE_COUNT; instance++)
+    {
+        if ((restoreMask & ((uint32_t)1U << instance)) != 0U)
+        {
+            ADC_DRV_SetUserOffsetGain(instance, record->userOffset[instance], record->userGain[instance]);
+            state->stats.savedTicks += record->calibrationTicks[instance];
+        }
+    }
+    state->stats.restoredMask = restoreMask;
+
+    /* the instances without a usable record are calibrated now, all at the same time;
+     * the failed ones are scheduled for ADC_CAL_Task() */
+    ADC_CAL_StartInstances(state, config->instanceMask & ~restoreMask);
+    while (state->activeMask != 0U)
+    {
+        if (ADC_CAL_PollInstances(state) != STATUS_SUCCESS)
+        {
+            status = STATUS_ERROR;
+        }
+    }
+    if (state->recordDirty)
+    {
+        if (ADC_CAL_WriteRecord(state) != STATUS_SUCCESS)
+        {
+            status = STATUS_ERROR;
+        }
+    }
+
+    /* the restored instances run on their reset trim until calibrated in the background */
+    state->pendingMask |= restoreMask;
+    state->stats.bootTicks = ADC_CAL_ReadTimestamp(state) - entry;
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_UpdateConditions
+ * Description   : Schedules the instances calibrated under other conditions.
+ *
+ * Implements    : ADC_CAL_UpdateConditions_Activity
+ *END**************************************************************************/
+uint32_t ADC_CAL_UpdateConditions(adc_cal_state_t * state, uint32_t temperatureBand)
+{
+    DEV_ASSERT(state != NULL);
+
+    state->temperatureBand = temperatureBand;
+    state->pendingMask |= ADC_CAL_GetStaleMask(state) & ~state->activeMask;
+
+    return state->pendingMask;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_Task
+ * Description   : Starts the scheduled calibrations allowed by idleMask, polls
+ * the ones in progress and writes the record once none is left running.
+ *
+ * Implements    : ADC_CAL_Task_Activity
+ *END**************************************************************************/
+uint32_t ADC_CAL_Task(adc_cal_state_t * state, uint32_t idleMask)
+{
+    DEV_ASSERT(state != NULL);
+
+    ADC_CAL_StartInstances(state, state->pendingMask & idleMask & ~state->activeMask);
+    (void)ADC_CAL_PollInstances(state);
+
+    /* a failed write is retried on the next call */
+    if ((state->activeMask == 0U) && state->recordDirty)
+    {
+        (void)ADC_CAL_WriteRecord(state);
+    }
+
+    return state->activeMask;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_CAL_GetStatistics
+ * Description   : Returns the cache statistics.
+ *
+ * Implements    : ADC_CAL_GetStatistics_Activity
+ *END**************************************************************************/
+void ADC_CAL_GetStatistics(const adc_cal_state_t * state, adc_cal_stats_t * stats)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(stats != NULL);
+
+    *stats = state->stats;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,950 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 10.1, Operands shall not be of an inappropriate essential type.
+ * The right shift of signed accumulators is used to rescale fixed-point products;
+ * the compilers supported by the SDK implement it as an arithmetic shift.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 18.4, The +, -, += and -= operators should
+ * not be applied to an expression of pointer type.
+ * Pointer increments are used to walk the sample buffers.
+ *
+ */
+
+#include <stddef.h>
+#include "device_registers.h"
+#include "adc_dsp.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Number of coefficients and delay elements of one biquad stage */
+#define ADC_DSP_BIQUAD_COEFFS    5U
+#define ADC_DSP_BIQUAD_DELAYS    4U
+
+/* Longest window handled by ADC_DSP_WindowStats(): the sum of the samples fits in 32 bits */
+#define ADC_DSP_STATS_MAX_COUNT  65536U
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_SatQ15
+ * Description   : Saturates a value to the int16_t range.
+ *
+ *END**************************************************************************/
+static inline int16_t ADC_DSP_SatQ15(int64_t value)
+{
+    int16_t result;
+
+    if (value > (int64_t)INT16_MAX)
+    {
+        result = INT16_MAX;
+    }
+    else if (value < (int64_t)INT16_MIN)
+    {
+        result = INT16_MIN;
+    }
+    else
+    {
+        result = (int16_t)value;
+    }
+    return result;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_SatQ31
+ * Description   : Saturates a value to the int32_t range.
+ *
+ *END**************************************************************************/
+static inline int32_t ADC_DSP_SatQ31(int64_t value)
+{
+    int32_t result;
+
+    if (value > (int64_t)INT32_MAX)
+    {
+        result = INT32_MAX;
+    }
+    else if (value < (int64_t)INT32_MIN)
+    {
+        result = INT32_MIN;
+    }
+    else
+    {
+        result = (int32_t)value;
+    }
+    return result;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_MulQ30
+ * Description   : Multiplies two Q31 values and returns the upper word of the
+ * product (Q30). This is a single mulhw instruction on the e200 cores and leaves
+ * 33 bits of headroom in a 64-bit accumulator.
+ *
+ *END**************************************************************************/
+static inline int32_t ADC_DSP_MulQ30(int32_t a, int32_t b)
+{
+    return (int32_t)(((int64_t)a * (int64_t)b) >> 32);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_Sqrt
+ * Description   : Integer square root, rounded down.
+ *
+ *END**************************************************************************/
+static uint32_t ADC_DSP_Sqrt(uint32_t value)
+{
+    uint32_t root = 0U;
+    uint32_t bit = (uint32_t)1U << 30U;
+    uint32_t rem = value;
+
+    while (bit > rem)
+    {
+        bit >>= 2U;
+    }
+    while (bit != 0U)
+    {
+        if (rem >= (root + bit))
+        {
+            rem -= root + bit;
+            root = (root >> 1U) + bit;
+        }
+        else
+        {
+            root >>= 1U;
+        }
+        bit >>= 2U;
+    }
+    return root;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_RawToQ15
+ * Description   : Scales the raw results to 16 bits and moves the mid-scale
+ * code to 0.
+ *
+ * Implements    : ADC_DSP_RawToQ15_Activity
+ *END**************************************************************************/
+void ADC_DSP_RawToQ15(const uint16_t * in,
+                      uint32_t inStride,
+                      int16_t * out,
+                      uint32_t count,
+                      uint32_t resolutionBits)
+{
+    DEV_ASSERT((in != NULL) && (out != NULL));
+    DEV_ASSERT((resolutionBits > 0U) && (resolutionBits <= 16U));
+
+    const uint32_t shift = 16U - resolutionBits;
+    const uint16_t * src = in;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        out[i] = (int16_t)((int32_t)((uint32_t)(*src) << shift) - 0x8000);
+        src += inStride;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BoxcarInit
+ * Description   : Initializes a boxcar decimator.
+ *
+ * Implements    : ADC_DSP_BoxcarInit_Activity
+ *END**************************************************************************/
+void ADC_DSP_BoxcarInit(adc_dsp_boxcar_t * state, uint32_t decimation)
+{
+    DEV_ASSERT(state != NULL);
+    /* the sum of decimation 16-bit samples must fit in 32 bits */
+    DEV_ASSERT((decimation > 0U) && (decimation <= 0x10000U));
+
+    state->decimation = decimation;
+    state->sum = 0U;
+    state->phase = 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BoxcarDecimate
+ * Description   : Sums the samples of each output in a local accumulator and
+ * divides once per output.
+ *
+ * Implements    : ADC_DSP_BoxcarDecimate_Activity
+ *END**************************************************************************/
+uint32_t ADC_DSP_BoxcarDecimate(adc_dsp_boxcar_t * state,
+                                const uint16_t * in,
+                                uint32_t inStride,
+                                uint32_t count,
+                                uint16_t * out)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((in != NULL) && (out != NULL));
+
+    const uint32_t decimation = state->decimation;
+    const uint16_t * src = in;
+    uint32_t sum = state->sum;
+    uint32_t phase = state->phase;
+    uint32_t left = count;
+    uint32_t outCount = 0U;
+
+    while (left > 0U)
+    {
+        /* samples needed to complete the current output, bounded by the block */
+        uint32_t run = decimation - phase;
+        if (run > left)
+        {
+            run = left;
+        }
+        left -= run;
+        phase += run;
+
+        while (run >= 4U)
+        {
+            sum += (uint32_t)src[0] + (uint32_t)src[inStride] +
+                   (uint32_t)src[2U * inStride] + (uint32_t)src[3U * inStride];
+            src += 4U * inStride;
+            run -= 4U;
+        }
+        while (run > 0U)
+        {
+            sum += *src;
+            src += inStride;
+            run--;
+        }
+
+        if (phase == decimation)
+        {
+            out[outCount] = (uint16_t)((sum + (decimation >> 1U)) / decimation);
+            outCount++;
+            sum = 0U;
+            phase = 0U;
+        }
+    }
+
+    state->sum = sum;
+    state->phase = phase;
+    return outCount;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_CicInit
+ * Description   : Initializes a CIC decimator and checks the register growth.
+ *
+ * Implements    : ADC_DSP_CicInit_Activity
+ *END**************************************************************************/
+status_t ADC_DSP_CicInit(adc_dsp_cic_t * state,
+                         uint32_t order,
+                         uint32_t decimation,
+                         uint32_t inputBits)
+{
+    DEV_ASSERT(state != NULL);
+
+    status_t status = STATUS_SUCCESS;
+    uint32_t log2Decimation = 0U;
+    uint32_t i;
+
+    while (((uint32_t)1U << log2Decimation) < decimation)
+    {
+        log2Decimation++;
+    }
+
+    if ((order == 0U) || (order > ADC_DSP_CIC_MAX_ORDER) || (decimation == 0U) ||
+        (((uint32_t)1U << log2Decimation) != decimation) ||
+        ((inputBits + (order * log2Decimation)) > 32U))
+    {
+        status = STATUS_ERROR;
+    }
+    else
+    {
+        state->order = order;
+        state->decimation = decimation;
+        state->gainShift = order * log2Decimation;
+        state->phase = 0U;
+        for (i = 0U; i < ADC_DSP_CIC_MAX_ORDER; i++)
+        {
+            state->integrator[i] = 0U;
+            state->comb[i] = 0U;
+        }
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_CicDecimate
+ * Description   : Runs the integrators at the input rate and the combs at the
+ * output rate. The registers are kept in locals for the whole block and the
+ * integrator cascade is unrolled for the supported orders.
+ *
+ * Implements    : ADC_DSP_CicDecimate_Activity
+ *END**************************************************************************/
+uint32_t ADC_DSP_CicDecimate(adc_dsp_cic_t * state,
+                             const uint16_t * in,
+                             uint32_t inStride,
+                             uint32_t count,
+                             uint16_t * out)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((in != NULL) && (out != NULL));
+
+    const uint32_t order = state->order;
+    const uint32_t decimation = state->decimation;
+    const uint16_t * src = in;
+    uint32_t i0 = state->integrator[0];
+    uint32_t i1 = state->integrator[1];
+    uint32_t i2 = state->integrator[2];
+    uint32_t i3 = state->integrator[3];
+    uint32_t phase = state->phase;
+    uint32_t outCount = 0U;
+    uint32_t n;
+    uint32_t k;
+
+    for (n = 0U; n < count; n++)
+    {
+        i0 += *src;
+        i1 += i0;
+        i2 += i1;
+        i3 += i2;
+        src += inStride;
+        phase++;
+
+        if (phase == decimation)
+        {
+            /* the output of the integrator cascade is the register of the last used stage;
+             * the unused stages integrate too but never reach the output */
+            uint32_t value = (order == 1U) ? i0 : ((order == 2U) ? i1 : ((order == 3U) ? i2 : i3));
+            for (k = 0U; k < order; k++)
+            {
+                const uint32_t delayed = state->comb[k];
+                state->comb[k] = value;
+                value -= delayed;
+            }
+            out[outCount] = (uint16_t)(value >> state->gainShift);
+            outCount++;
+            phase = 0U;
+        }
+    }
+
+    state->integrator[0] = i0;
+    state->integrator[1] = i1;
+    state->integrator[2] = i2;
+    state->integrator[3] = i3;
+    state->phase = phase;
+    return outCount;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_FirInitQ15
+ * Description   : Initializes a Q15 FIR filter and clears its history.
+ *
+ * Implements    : ADC_DSP_FirInitQ15_Activity
+ *END**************************************************************************/
+void ADC_DSP_FirInitQ15(adc_dsp_fir_q15_t * state,
+                        const int16_t * coeffs,
+                        int16_t * history,
+                        uint32_t numTaps)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((coeffs != NULL) && (history != NULL));
+    DEV_ASSERT(numTaps > 0U);
+
+    uint32_t i;
+
+    state->coeffs = coeffs;
+    state->history = history;
+    state->numTaps = numTaps;
+    state->index = 0U;
+    for (i = 0U; i < (2U * numTaps); i++)
+    {
+        history[i] = 0;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_FirQ15
+ * Description   : Each sample is written at index and index + numTaps, so the
+ * last numTaps samples are contiguous in history[index + 1 .. index + numTaps]
+ * and the dot product is a linear walk, unrolled by 4 taps.
+ *
+ * Implements    : ADC_DSP_FirQ15_Activity
+ *END**************************************************************************/
+void ADC_DSP_FirQ15(adc_dsp_fir_q15_t * state, const int16_t * in, int16_t * out, uint32_t count)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((in != NULL) && (out != NULL));
+
+    const uint32_t numTaps = state->numTaps;
+    const int16_t * const coeffs = state->coeffs;
+    int16_t * const history = state->history;
+    uint32_t index = state->index;
+    uint32_t n;
+
+    for (n = 0U; n < count; n++)
+    {
+        const int16_t * x;
+        const int16_t * c = coeffs;
+        int64_t acc = 0;
+        uint32_t k = numTaps;
+
+        history[index] = in[n];
+        history[index + numTaps] = in[n];
+        /* newest sample first, walking back in time */
+        x = &history[index + numTaps];
+
+        while (k >= 4U)
+        {
+            acc += (int32_t)c[0] * (int32_t)x[0];
+            acc += (int32_t)c[1] * (int32_t)x[-1];
+            acc += (int32_t)c[2] * (int32_t)x[-2];
+            acc += (int32_t)c[3] * (int32_t)x[-3];
+            c += 4;
+            x -= 4;
+            k -= 4U;
+        }
+        while (k > 0U)
+        {
+            acc += (int32_t)(*c) * (int32_t)(*x);
+            c++;
+            x--;
+            k--;
+        }
+
+        index++;
+        if (index == numTaps)
+        {
+            index = 0U;
+        }
+        out[n] = ADC_DSP_SatQ15(acc >> 15);
+    }
+
+    state->index = index;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_FirInitQ31
+ * Description   : Initializes a Q31 FIR filter and clears its history.
+ *
+ * Implements    : ADC_DSP_FirInitQ31_Activity
+ *END**************************************************************************/
+void ADC_DSP_FirInitQ31(adc_dsp_fir_q31_t * state,
+                        const int32_t * coeffs,
+                        int32_t * history,
+                        uint32_t numTaps)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((coeffs != NULL) && (history != NULL));
+    DEV_ASSERT(numTaps > 0U);
+
+    uint32_t i;
+
+    state->coeffs = coeffs;
+    state->history = history;
+    state->numTaps = numTaps;
+    state->index = 0U;
+    for (i = 0U; i < (2U * numTaps); i++)
+    {
+        history[i] = 0;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_FirQ31
+ * Description   : Same history layout as ADC_DSP_FirQ15; the products are
+ * truncated to Q30 and accumulated on 64 bits.
+ *
+ * Implements    : ADC_DSP_FirQ31_Activity
+ *END**************************************************************************/
+void ADC_DSP_FirQ31(adc_dsp_fir_q31_t * state, const int32_t * in, int32_t * out, uint32_t count)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((in != NULL) && (out != NULL));
+
+    const uint32_t numTaps = state->numTaps;
+    const int32_t * const coeffs = state->coeffs;
+    int32_t * const history = state->history;
+    uint32_t index = state->index;
+    uint32_t n;
+
+    for (n = 0U; n < count; n++)
+    {
+        const int32_t * x;
+        const int32_t * c = coeffs;
+        int64_t acc = 0;
+        uint32_t k = numTaps;
+
+        history[index] = in[n];
+        history[index + numTaps] = in[n];
+        x = &history[index + numTaps];
+
+        while (k >= 4U)
+        {
+            acc += ADC_DSP_MulQ30(c[0], x[0]);
+            acc += ADC_DSP_MulQ30(c[1], x[-1]);
+            acc += ADC_DSP_MulQ30(c[2], x[-2]);
+            acc += ADC_DSP_MulQ30(c[3], x[-3]);
+            c += 4;
+            x -= 4;
+            k -= 4U;
+        }
+        while (k > 0U)
+        {
+            acc += ADC_DSP_MulQ30(*c, *x);
+            c++;
+            x--;
+            k--;
+        }
+
+        index++;
+        if (index == numTaps)
+        {
+            index = 0U;
+        }
+        out[n] = ADC_DSP_SatQ31(acc * 2);
+    }
+
+    state->index = index;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BiquadInitQ15
+ * Description   : Initializes a Q15 biquad cascade and clears its delay line.
+ *
+ * Implements    : ADC_DSP_BiquadInitQ15_Activity
+ *END**************************************************************************/
+void ADC_DSP_BiquadInitQ15(adc_dsp_biquad_q15_t * state,
+                           const int16_t * coeffs,
+                           int16_t * delay,
+                           uint32_t numStages,
+                           uint32_t postShift)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((coeffs != NULL) && (delay != NULL));
+    DEV_ASSERT(numStages > 0U);
+    DEV_ASSERT(postShift <= 14U);
+
+    uint32_t i;
+
+    state->coeffs = coeffs;
+    state->delay = delay;
+    state->numStages = numStages;
+    state->postShift = postShift;
+    for (i = 0U; i < (ADC_DSP_BIQUAD_DELAYS * numStages); i++)
+    {
+        delay[i] = 0;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BiquadQ15
+ * Description   : Runs the whole block through one stage before moving to the
+ * next one, so the coefficients and the delay line of the stage stay in
+ * registers; the output buffer is the input of the next stage.
+ *
+ * Implements    : ADC_DSP_BiquadQ15_Activity
+ *END**************************************************************************/
+void ADC_DSP_BiquadQ15(adc_dsp_biquad_q15_t * state, const int16_t * in, int16_t * out, uint32_t count)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((in != NULL) && (out != NULL));
+
+    const uint32_t shift = 15U - state->postShift;
+    const int16_t * c = state->coeffs;
+    int16_t * d = state->delay;
+    const int16_t * src = in;
+    uint32_t stage;
+    uint32_t n;
+
+    for (stage = 0U; stage < state->numStages; stage++)
+    {
+        const int32_t b0 = c[0];
+        const int32_t b1 = c[1];
+        const int32_t b2 = c[2];
+        const int32_t a1 = c[3];
+        const int32_t a2 = c[4];
+        int32_t x1 = d[0];
+        int32_t x2 = d[1];
+        int32_t y1 = d[2];
+        int32_t y2 = d[3];
+
+        for (n = 0U; n < count; n++)
+        {
+            const int32_t x0 = src[n];
+            /* each product fits in 31 bits, their sum does not */
+            int64_t acc = (int64_t)(b0 * x0) + (int64_t)(b1 * x1);
+            acc += (int64_t)(b2 * x2) + (int64_t)(a1 * y1);
+            acc += (int64_t)(a2 * y2);
+            const int32_t y0 = ADC_DSP_SatQ15(acc >> shift);
+
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            out[n] = (int16_t)y0;
+        }
+
+        d[0] = (int16_t)x1;
+        d[1] = (int16_t)x2;
+        d[2] = (int16_t)y1;
+        d[3] = (int16_t)y2;
+        c += ADC_DSP_BIQUAD_COEFFS;
+        d += ADC_DSP_BIQUAD_DELAYS;
+        src = out;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BiquadInitQ31
+ * Description   : Initializes a Q31 biquad cascade and clears its delay line.
+ *
+ * Implements    : ADC_DSP_BiquadInitQ31_Activity
+ *END**************************************************************************/
+void ADC_DSP_BiquadInitQ31(adc_dsp_biquad_q31_t * state,
+                           const int32_t * coeffs,
+                           int32_t * delay,
+                           uint32_t numStages,
+                           uint32_t postShift)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((coeffs != NULL) && (delay != NULL));
+    DEV_ASSERT(numStages > 0U);
+    DEV_ASSERT(postShift <= 30U);
+
+    uint32_t i;
+
+    state->coeffs = coeffs;
+    state->delay = delay;
+    state->numStages = numStages;
+    state->postShift = postShift;
+    for (i = 0U; i < (ADC_DSP_BIQUAD_DELAYS * numStages); i++)
+    {
+        delay[i] = 0;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BiquadQ31
+ * Description   : Stage by stage like ADC_DSP_BiquadQ15; the products are
+ * truncated to Q30 and accumulated on 64 bits.
+ *
+ * Implements    : ADC_DSP_BiquadQ31_Activity
+ *END**************************************************************************/
+void ADC_DSP_BiquadQ31(adc_dsp_biquad_q31_t * state, const int32_t * in, int32_t * out, uint32_t count)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((in != NULL) && (out != NULL));
+
+    const uint32_t shift = 1U + state->postShift;
+    const int32_t * c = state->coeffs;
+    int32_t * d = state->delay;
+    const int32_t * src = in;
+    uint32_t stage;
+    uint32_t n;
+
+    for (stage = 0U; stage < state->numStages; stage++)
+    {
+        const int32_t b0 = c[0];
+        const int32_t b1 = c[1];
+        const int32_t b2 = c[2];
+        const int32_t a1 = c[3];
+        const int32_t a2 = c[4];
+        int32_t x1 = d[0];
+        int32_t x2 = d[1];
+        int32_t y1 = d[2];
+        int32_t y2 = d[3];
+
+        for (n = 0U; n < count; n++)
+        {
+            const int32_t x0 = src[n];
+            int64_t acc = (int64_t)ADC_DSP_MulQ30(b0, x0) + (int64_t)ADC_DSP_MulQ30(b1, x1);
+            acc += (int64_t)ADC_DSP_MulQ30(b2, x2) + (int64_t)ADC_DSP_MulQ30(a1, y1);
+            acc += (int64_t)ADC_DSP_MulQ30(a2, y2);
+            const int32_t y0 = ADC_DSP_SatQ31(acc * ((int64_t)1 << shift));
+
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            out[n] = y0;
+        }
+
+        d[0] = x1;
+        d[1] = x2;
+        d[2] = y1;
+        d[3] = y2;
+        c += ADC_DSP_BIQUAD_COEFFS;
+        d += ADC_DSP_BIQUAD_DELAYS;
+        src = out;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_WindowStats
+ * Description   : Computes all the statistics in a single pass over the window.
+ *
+ * Implements    : ADC_DSP_WindowStats_Activity
+ *END**************************************************************************/
+void ADC_DSP_WindowStats(const uint16_t * in,
+                         uint32_t inStride,
+                         uint32_t count,
+                         adc_dsp_stats_t * stats)
+{
+    DEV_ASSERT((in != NULL) && (stats != NULL));
+    DEV_ASSERT((count > 0U) && (count <= ADC_DSP_STATS_MAX_COUNT));
+
+    const uint16_t * src = in;
+    uint32_t sum = 0U;
+    uint64_t sumSq = 0U;
+    uint32_t minValue = 0xFFFFU;
+    uint32_t maxValue = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        const uint32_t x = *src;
+
+        sum += x;
+        sumSq += (uint64_t)(x * x);
+        minValue = (x < minValue) ? x : minValue;
+        maxValue = (x > maxValue) ? x : maxValue;
+        src += inStride;
+    }
+
+    /* sum < 2^32, so sum * sum fits in 64 bits */
+    const uint64_t meanSq = sumSq / count;
+    const uint64_t sqMean = ((uint64_t)sum * sum) / count / count;
+
+    stats->mean = (uint16_t)((sum + (count >> 1U)) / count);
+    stats->rms = (uint16_t)ADC_DSP_Sqrt((uint32_t)meanSq);
+    stats->acRms = (uint16_t)ADC_DSP_Sqrt((meanSq > sqMean) ? (uint32_t)(meanSq - sqMean) : 0U);
+    stats->min = (uint16_t)minValue;
+    stats->max = (uint16_t)maxValue;
+}
+
+#if (ADC_DSP_REFERENCE_KERNELS == 1)
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_FirQ15_Ref
+ * Description   : Reference FIR: modulo indexing in the first numTaps history
+ * elements; keeps the mirror copy up to date so the state stays compatible
+ * with ADC_DSP_FirQ15.
+ *
+ *END**************************************************************************/
+void ADC_DSP_FirQ15_Ref(adc_dsp_fir_q15_t * state, const int16_t * in, int16_t * out, uint32_t count)
+{
+    const uint32_t numTaps = state->numTaps;
+    uint32_t n;
+    uint32_t k;
+
+    for (n = 0U; n < count; n++)
+    {
+        int64_t acc = 0;
+
+        state->history[state->index] = in[n];
+        state->history[state->index + numTaps] = in[n];
+        for (k = 0U; k < numTaps; k++)
+        {
+            const uint32_t pos = (state->index + numTaps - k) % numTaps;
+            acc += (int32_t)state->coeffs[k] * (int32_t)state->history[pos];
+        }
+        state->index = (state->index + 1U) % numTaps;
+        out[n] = ADC_DSP_SatQ15(acc >> 15);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_FirQ31_Ref
+ * Description   : Reference Q31 FIR, see ADC_DSP_FirQ15_Ref.
+ *
+ *END**************************************************************************/
+void ADC_DSP_FirQ31_Ref(adc_dsp_fir_q31_t * state, const int32_t * in, int32_t * out, uint32_t count)
+{
+    const uint32_t numTaps = state->numTaps;
+    uint32_t n;
+    uint32_t k;
+
+    for (n = 0U; n < count; n++)
+    {
+        int64_t acc = 0;
+
+        state->history[state->index] = in[n];
+        state->history[state->index + numTaps] = in[n];
+        for (k = 0U; k < numTaps; k++)
+        {
+            const uint32_t pos = (state->index + numTaps - k) % numTaps;
+            acc += ADC_DSP_MulQ30(state->coeffs[k], state->history[pos]);
+        }
+        state->index = (state->index + 1U) % numTaps;
+        out[n] = ADC_DSP_SatQ31(acc * 2);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BiquadQ15_Ref
+ * Description   : Reference biquad cascade: each sample goes through all the
+ * stages, the delay line is read and written in memory.
+ *
+ *END**************************************************************************/
+void ADC_DSP_BiquadQ15_Ref(adc_dsp_biquad_q15_t * state, const int16_t * in, int16_t * out, uint32_t count)
+{
+    uint32_t n;
+    uint32_t stage;
+
+    for (n = 0U; n < count; n++)
+    {
+        int16_t x = in[n];
+
+        for (stage = 0U; stage < state->numStages; stage++)
+        {
+            const int16_t * c = &state->coeffs[stage * ADC_DSP_BIQUAD_COEFFS];
+            int16_t * d = &state->delay[stage * ADC_DSP_BIQUAD_DELAYS];
+            int64_t acc = 0;
+
+            acc += (int32_t)c[0] * (int32_t)x;
+            acc += (int32_t)c[1] * (int32_t)d[0];
+            acc += (int32_t)c[2] * (int32_t)d[1];
+            acc += (int32_t)c[3] * (int32_t)d[2];
+            acc += (int32_t)c[4] * (int32_t)d[3];
+            d[1] = d[0];
+            d[0] = x;
+            d[3] = d[2];
+            d[2] = ADC_DSP_SatQ15(acc >> (15U - state->postShift));
+            x = d[2];
+        }
+        out[n] = x;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_BiquadQ31_Ref
+ * Description   : Reference Q31 biquad cascade, see ADC_DSP_BiquadQ15_Ref.
+ *
+ *END**************************************************************************/
+void ADC_DSP_BiquadQ31_Ref(adc_dsp_biquad_q31_t * state, const int32_t * in, int32_t * out, uint32_t count)
+{
+    uint32_t n;
+    uint32_t stage;
+
+    for (n = 0U; n < count; n++)
+    {
+        int32_t x = in[n];
+
+        for (stage = 0U; stage < state->numStages; stage++)
+        {
+            const int32_t * c = &state->coeffs[stage * ADC_DSP_BIQUAD_COEFFS];
+            int32_t * d = &state->delay[stage * ADC_DSP_BIQUAD_DELAYS];
+            int64_t acc = 0;
+
+            acc += ADC_DSP_MulQ30(c[0], x);
+            acc += ADC_DSP_MulQ30(c[1], d[0]);
+            acc += ADC_DSP_MulQ30(c[2], d[1]);
+            acc += ADC_DSP_MulQ30(c[3], d[2]);
+            acc += ADC_DSP_MulQ30(c[4], d[3]);
+            d[1] = d[0];
+            d[0] = x;
+            d[3] = d[2];
+            d[2] = ADC_DSP_SatQ31(acc * ((int64_t)1 << (1U + state->postShift)));
+            x = d[2];
+        }
+        out[n] = x;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DSP_CicDecimate_Ref
+ * Description   : Reference CIC decimator: only the used stages, registers
+ * updated in the state structure.
+ *
+ *END**************************************************************************/
+uint32_t ADC_DSP_CicDecimate_Ref(adc_dsp_cic_t * state,
+                                 const uint16_t * in,
+                                 uint32_t inStride,
+                                 uint32_t count,
+                                 uint16_t * out)
+{
+    uint32_t outCount = 0U;
+    uint32_t n;
+    uint32_t k;
+
+    for (n = 0U; n < count; n++)
+    {
+        uint32_t value = in[n * inStride];
+
+        for (k = 0U; k < state->order; k++)
+        {
+            state->integrator[k] += value;
+            value = state->integrator[k];
+        }
+        state->phase++;
+        if (state->phase == state->decimation)
+        {
+            for (k = 0U; k < state->order; k++)
+            {
+                const uint32_t delayed = state->comb[k];
+                state->comb[k] = value;
+                value -= delayed;
+            }
+            out[outCount] = (uint16_t)(value >> state->gainShift);
+            outCount++;
+            state->phase = 0U;
+        }
+    }
+    return outCount;
+}
+
+#endif /* ADC_DSP_REFERENCE_KERNELS */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
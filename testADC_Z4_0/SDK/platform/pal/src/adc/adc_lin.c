@@ -0,0 +1,226 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_lin.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 10.1, Unpermitted operand to operator.
+ * The interpolation relies on arithmetic right shifts of signed values.
+ */
+
+#include <stddef.h>
+#include "device_registers.h"
+#include "adc_lin.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Mask of the significant bits of a raw result */
+#define ADC_LIN_CODE_MASK    (((uint32_t)1U << ADC_LIN_RESULT_BITS) - 1U)
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_LIN_Interpolate
+ * Description   : Segment lookup and linear interpolation, rounded to nearest.
+ *
+ *END**************************************************************************/
+static inline int32_t ADC_LIN_Interpolate(const int32_t * points, uint32_t shift, uint32_t code)
+{
+    uint32_t masked = code & ADC_LIN_CODE_MASK;
+    uint32_t segment = masked >> shift;
+    uint32_t fraction = masked & (((uint32_t)1U << shift) - 1U);
+    int32_t base = points[segment];
+    int32_t delta = points[segment + 1U] - base;
+    int64_t step = ((int64_t)delta * (int64_t)fraction) + (int64_t)(((uint32_t)1U << shift) >> 1U);
+
+    return base + (int32_t)(step >> shift);
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_LIN_CheckTable
+ * Description   : Checks the segment shift and the distance between adjacent
+ * points, so the interpolation cannot overflow.
+ *
+ * Implements : ADC_LIN_CheckTable_Activity
+ *END**************************************************************************/
+status_t ADC_LIN_CheckTable(const adc_lin_table_t * table)
+{
+    uint32_t numPoints;
+    uint32_t idx;
+    int64_t delta;
+
+    DEV_ASSERT(table != NULL);
+
+    if ((table->points == NULL) || (table->segmentShift > ADC_LIN_RESULT_BITS))
+    {
+        return STATUS_ERROR;
+    }
+
+    numPoints = ADC_LIN_TABLE_POINTS(table->segmentShift);
+    for (idx = 1U; idx < numPoints; idx++)
+    {
+        delta = (int64_t)table->points[idx] - (int64_t)table->points[idx - 1U];
+        if ((delta > (int64_t)INT32_MAX) || (delta < -(int64_t)INT32_MAX))
+        {
+            return STATUS_ERROR;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_LIN_Convert
+ * Description   : Converts one raw result.
+ *
+ * Implements : ADC_LIN_Convert_Activity
+ *END**************************************************************************/
+int32_t ADC_LIN_Convert(const adc_lin_table_t * table, uint16_t code)
+{
+    DEV_ASSERT(table != NULL);
+
+    return ADC_LIN_Interpolate(table->points, table->segmentShift, code);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_LIN_ConvertBlock
+ * Description   : Converts a block of results with one table, two results per
+ * iteration so the table reads of one overlap the multiply of the other.
+ *
+ * Implements : ADC_LIN_ConvertBlock_Activity
+ *END**************************************************************************/
+void ADC_LIN_ConvertBlock(const adc_lin_table_t * table,
+                          const uint16_t * in,
+                          uint32_t inStride,
+                          int32_t * out,
+                          uint32_t count)
+{
+    const int32_t * points;
+    const uint16_t * src = in;
+    uint32_t shift;
+    uint32_t idx = 0U;
+
+    DEV_ASSERT(table != NULL);
+    DEV_ASSERT((in != NULL) || (count == 0U));
+    DEV_ASSERT((out != NULL) || (count == 0U));
+
+    points = table->points;
+    shift = table->segmentShift;
+
+    for (; (idx + 1U) < count; idx += 2U)
+    {
+        out[idx] = ADC_LIN_Interpolate(points, shift, src[0U]);
+        out[idx + 1U] = ADC_LIN_Interpolate(points, shift, src[inStride]);
+        src = &src[2U * inStride];
+    }
+
+    if (idx < count)
+    {
+        out[idx] = ADC_LIN_Interpolate(points, shift, src[0U]);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_LIN_ConvertArray
+ * Description   : Converts each result with its own table.
+ *
+ * Implements : ADC_LIN_ConvertArray_Activity
+ *END**************************************************************************/
+void ADC_LIN_ConvertArray(const adc_lin_table_t * const * tables,
+                          const uint16_t * in,
+                          int32_t * out,
+                          uint32_t count)
+{
+    const adc_lin_table_t * table;
+    uint32_t idx;
+
+    DEV_ASSERT((tables != NULL) || (count == 0U));
+    DEV_ASSERT((in != NULL) || (count == 0U));
+    DEV_ASSERT((out != NULL) || (count == 0U));
+
+    for (idx = 0U; idx < count; idx++)
+    {
+        table = tables[idx];
+        if (table != NULL)
+        {
+            out[idx] = ADC_LIN_Interpolate(table->points, table->segmentShift, in[idx]);
+        }
+        else
+        {
+            out[idx] = (int32_t)in[idx];
+        }
+    }
+}
+
+#if (ADC_LIN_REFERENCE_KERNELS == 1)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_LIN_ConvertBlockPoly_Ref
+ * Description   : Horner evaluation of a polynomial for each result.
+ *
+ *END**************************************************************************/
+void ADC_LIN_ConvertBlockPoly_Ref(const float * coeffs,
+                                  uint32_t numCoeffs,
+                                  const uint16_t * in,
+                                  uint32_t inStride,
+                                  int32_t * out,
+                                  uint32_t count)
+{
+    uint32_t idx;
+    uint32_t term;
+    float code;
+    float value;
+
+    DEV_ASSERT((coeffs != NULL) && (numCoeffs > 0U));
+
+    for (idx = 0U; idx < count; idx++)
+    {
+        code = (float)in[idx * inStride];
+        value = coeffs[numCoeffs - 1U];
+        for (term = numCoeffs - 1U; term > 0U; term--)
+        {
+            value = (value * code) + coeffs[term - 1U];
+        }
+        out[idx] = (int32_t)((value >= 0.0f) ? (value + 0.5f) : (value - 0.5f));
+    }
+}
+#endif /* ADC_LIN_REFERENCE_KERNELS */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,401 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_pair.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.5, Conversion from pointer to void to pointer to other type.
+ * The eDMA callback parameter is the paired sampling state passed at installation.
+ */
+
+#include <stddef.h>
+#include "adc_pair.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Polls of the ADC0 transfer count before a half is reported as unpaired */
+#define ADC_PAIR_SYNC_POLLS    16U
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void ADC_PAIR_DmaCallback(void * parameter, edma_chn_status_t status);
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_PAIR_DmaCallback
+ * Description   : Half/major loop interrupt of the ADC1 transfer. The half just
+ * filled is deduced from the remaining major loop count, as for an ADC stream.
+ * The ADC0 request of the last pair is raised together with the ADC1 one but
+ * may be serviced slightly later, so the ADC0 count is given a few polls to
+ * catch up before the half is delivered.
+ *
+ *END**************************************************************************/
+static void ADC_PAIR_DmaCallback(void * parameter, edma_chn_status_t status)
+{
+    adc_pair_state_t * state = (adc_pair_state_t *)parameter;
+    const adc_pair_user_config_t * config = &state->config;
+    uint32_t halfPairs = config->scansPerBuffer * config->numPairs;
+    uint32_t remaining;
+    uint32_t polls = 0U;
+    adc_pair_event_t event;
+    const uint16_t * pairs;
+
+    if (status == EDMA_CHN_ERROR)
+    {
+        (void)ADC_PAIR_Stop(state);
+        if (config->callback != NULL)
+        {
+            config->callback(NULL, 0U, ADC_PAIR_EVENT_DMA_ERROR, config->callbackParam);
+        }
+        return;
+    }
+
+    remaining = EDMA_DRV_GetRemainingMajorIterationsCount(config->dmaVirtualChannel[1U]);
+    if (remaining > halfPairs)
+    {
+        event = ADC_PAIR_EVENT_FULL;
+        pairs = &config->buffer[halfPairs * ADC_PAIR_ADC_COUNT];
+    }
+    else
+    {
+        event = ADC_PAIR_EVENT_HALF;
+        pairs = config->buffer;
+    }
+
+    while ((EDMA_DRV_GetRemainingMajorIterationsCount(config->dmaVirtualChannel[0U]) != remaining) &&
+           (polls < ADC_PAIR_SYNC_POLLS))
+    {
+        polls++;
+    }
+    if (polls == ADC_PAIR_SYNC_POLLS)
+    {
+        state->stats.unpairedHalves++;
+    }
+
+    /* Two consecutive events for the same half mean the other half was not serviced */
+    if (event == state->lastEvent)
+    {
+        state->stats.missedHalves++;
+    }
+    state->lastEvent = event;
+    state->stats.halfBuffers++;
+
+    if (config->callback != NULL)
+    {
+        config->callback(pairs, config->scansPerBuffer, event, config->callbackParam);
+    }
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_PAIR_Init
+ * Description   : Targets one BCTU trigger to both converters and sets up one
+ * circular eDMA transfer per converter, each writing every other element of
+ * the buffer.
+ *
+ * Implements    : ADC_PAIR_Init_Activity
+ *END**************************************************************************/
+status_t ADC_PAIR_Init(adc_pair_state_t * state, const adc_pair_user_config_t * config)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->bctuInstance < BCTU_INSTANCE_COUNT);
+    DEV_ASSERT(config->triggerIdx < BCTU_TRIG_COUNT);
+    DEV_ASSERT(config->channels != NULL);
+    DEV_ASSERT(config->numPairs > 0U);
+    DEV_ASSERT((config->numPairs == 1U) || (((uint32_t)config->listIdx + config->numPairs) <= BCTU_LIST_SIZE));
+    DEV_ASSERT(config->buffer != NULL);
+    DEV_ASSERT(config->scansPerBuffer > 0U);
+
+    bctu_trig_config_t trigConfig;
+    bctu_dma_config_t dmaConfig;
+    uint32_t adcIdx;
+    status_t status = STATUS_SUCCESS;
+
+    state->config = *config;
+    state->running = false;
+    state->lastEvent = ADC_PAIR_EVENT_FULL;
+    state->stats.halfBuffers = 0U;
+    state->stats.missedHalves = 0U;
+    state->stats.unpairedHalves = 0U;
+
+    trigConfig.adcTargetMask = BCTU_ADC_TARGET_0 | BCTU_ADC_TARGET_1;
+    trigConfig.loopEnable = false;
+    trigConfig.hwTriggerEnable = false;
+    if (config->numPairs > 1U)
+    {
+        BCTU_DRV_SetChannelList(config->bctuInstance, config->listIdx, config->channels, config->numPairs);
+        trigConfig.listMode = true;
+        trigConfig.chanOrListIdx = config->listIdx;
+    }
+    else
+    {
+        trigConfig.listMode = false;
+        trigConfig.chanOrListIdx = config->channels[0U];
+    }
+    BCTU_DRV_ConfigTrigger(config->bctuInstance, config->triggerIdx, &trigConfig);
+
+    /* Element 2n + a of the buffer receives result n of ADC a */
+    dmaConfig.resultCount = 2U * config->scansPerBuffer * config->numPairs;
+    dmaConfig.resultStride = (uint8_t)ADC_PAIR_ADC_COUNT;
+    dmaConfig.fullWord = false;
+    dmaConfig.circular = true;
+
+    for (adcIdx = 0U; (adcIdx < ADC_PAIR_ADC_COUNT) && (status == STATUS_SUCCESS); adcIdx++)
+    {
+        dmaConfig.dmaVirtualChannel = config->dmaVirtualChannel[adcIdx];
+        dmaConfig.buffer = &config->buffer[adcIdx];
+        /* Only the transfer of ADC1 reports the buffer halves */
+        dmaConfig.callback = (adcIdx == 1U) ? ADC_PAIR_DmaCallback : NULL;
+        dmaConfig.callbackParam = (adcIdx == 1U) ? state : NULL;
+
+        status = BCTU_DRV_ConfigResultDma(config->bctuInstance, adcIdx, &dmaConfig);
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_PAIR_Start
+ * Description   : Starts both eDMA channels, then enables the hardware trigger.
+ *
+ * Implements    : ADC_PAIR_Start_Activity
+ *END**************************************************************************/
+status_t ADC_PAIR_Start(adc_pair_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    const adc_pair_user_config_t * config = &state->config;
+
+    if (state->running)
+    {
+        return STATUS_BUSY;
+    }
+
+    state->lastEvent = ADC_PAIR_EVENT_FULL;
+    state->stats.halfBuffers = 0U;
+    state->stats.missedHalves = 0U;
+    state->stats.unpairedHalves = 0U;
+    state->running = true;
+
+    (void)EDMA_DRV_StartChannel(config->dmaVirtualChannel[0U]);
+    (void)EDMA_DRV_StartChannel(config->dmaVirtualChannel[1U]);
+    BCTU_DRV_EnableHwTrigger(config->bctuInstance, config->triggerIdx, true);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_PAIR_Stop
+ * Description   : Disables the hardware trigger and stops both eDMA channels.
+ *
+ * Implements    : ADC_PAIR_Stop_Activity
+ *END**************************************************************************/
+status_t ADC_PAIR_Stop(adc_pair_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    const adc_pair_user_config_t * config = &state->config;
+
+    BCTU_DRV_EnableHwTrigger(config->bctuInstance, config->triggerIdx, false);
+    (void)EDMA_DRV_StopChannel(config->dmaVirtualChannel[0U]);
+    (void)EDMA_DRV_StopChannel(config->dmaVirtualChannel[1U]);
+    state->running = false;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_PAIR_Deinit
+ * Description   : Stops the sampling and releases the BCTU DMA requests and
+ * the eDMA callback.
+ *
+ * Implements    : ADC_PAIR_Deinit_Activity
+ *END**************************************************************************/
+status_t ADC_PAIR_Deinit(adc_pair_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    const adc_pair_user_config_t * config = &state->config;
+    uint32_t adcIdx;
+
+    (void)ADC_PAIR_Stop(state);
+    (void)EDMA_DRV_InstallCallback(config->dmaVirtualChannel[1U], NULL, NULL);
+
+    for (adcIdx = 0U; adcIdx < ADC_PAIR_ADC_COUNT; adcIdx++)
+    {
+        BCTU_DRV_EnableDma(config->bctuInstance, adcIdx, false);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_PAIR_MeasureSkew
+ * Description   : Triggers the pair by software and timestamps the new data
+ * flag of each converter. The skew of a round is the difference between the
+ * two timestamps; its resolution is the duration of one poll.
+ *
+ * Implements    : ADC_PAIR_MeasureSkew_Activity
+ *END**************************************************************************/
+status_t ADC_PAIR_MeasureSkew(adc_pair_state_t * state,
+                              adc_pair_timestamp_t timestamp,
+                              uint32_t rounds,
+                              uint32_t timeoutTicks,
+                              adc_pair_skew_t * skew)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(timestamp != NULL);
+    DEV_ASSERT(rounds > 0U);
+    DEV_ASSERT(skew != NULL);
+
+    const adc_pair_user_config_t * config = &state->config;
+    const uint32_t newData = BCTU_FLAG_NEW_DATA(0U) | BCTU_FLAG_NEW_DATA(1U);
+    const uint32_t done = (config->numPairs > 1U) ? (BCTU_FLAG_LIST_LAST(0U) | BCTU_FLAG_LIST_LAST(1U)) : newData;
+    bctu_conv_result_t result;
+    uint32_t completion[ADC_PAIR_ADC_COUNT] = {0U, 0U};
+    uint32_t round;
+    uint32_t start;
+    uint32_t now;
+    uint32_t flags;
+    uint32_t pending;
+    uint32_t seen;
+    uint32_t polls;
+    uint32_t adcIdx;
+    int32_t delta;
+    int64_t total = 0;
+    status_t status = STATUS_SUCCESS;
+
+    if (state->running)
+    {
+        return STATUS_BUSY;
+    }
+
+    skew->minTicks = INT32_MAX;
+    skew->maxTicks = INT32_MIN;
+    skew->meanTicks = 0;
+    skew->resolution = 0U;
+
+    /* The flags must stay visible to the CPU: the eDMA would consume the results */
+    for (adcIdx = 0U; adcIdx < ADC_PAIR_ADC_COUNT; adcIdx++)
+    {
+        BCTU_DRV_EnableDma(config->bctuInstance, adcIdx, false);
+    }
+
+    for (round = 0U; (round < rounds) && (status == STATUS_SUCCESS); round++)
+    {
+        BCTU_DRV_ClearStatusFlags(config->bctuInstance, BCTU_FLAG_ALL);
+        pending = newData;
+        seen = 0U;
+        polls = 0U;
+
+        start = timestamp();
+        BCTU_DRV_SoftwareTrigger(config->bctuInstance, config->triggerIdx);
+        now = start;
+
+        while (((pending != 0U) || ((seen & done) != done)) && ((now - start) < timeoutTicks))
+        {
+            flags = BCTU_DRV_GetStatusFlags(config->bctuInstance);
+            now = timestamp();
+            polls++;
+
+            for (adcIdx = 0U; adcIdx < ADC_PAIR_ADC_COUNT; adcIdx++)
+            {
+                if ((flags & pending & BCTU_FLAG_NEW_DATA(adcIdx)) != 0U)
+                {
+                    completion[adcIdx] = now;
+                    pending &= ~BCTU_FLAG_NEW_DATA(adcIdx);
+                }
+            }
+            seen |= flags;
+        }
+
+        if ((pending != 0U) || ((seen & done) != done))
+        {
+            status = STATUS_TIMEOUT;
+        }
+        else
+        {
+            delta = (int32_t)(completion[1U] - completion[0U]);
+            skew->minTicks = (delta < skew->minTicks) ? delta : skew->minTicks;
+            skew->maxTicks = (delta > skew->maxTicks) ? delta : skew->maxTicks;
+            total += delta;
+            if (((now - start) / polls) > skew->resolution)
+            {
+                skew->resolution = (now - start) / polls;
+            }
+        }
+
+        /* Release the result registers for the next round */
+        for (adcIdx = 0U; adcIdx < ADC_PAIR_ADC_COUNT; adcIdx++)
+        {
+            BCTU_DRV_GetConvResult(config->bctuInstance, adcIdx, &result);
+        }
+    }
+
+    BCTU_DRV_ClearStatusFlags(config->bctuInstance, BCTU_FLAG_ALL);
+    for (adcIdx = 0U; adcIdx < ADC_PAIR_ADC_COUNT; adcIdx++)
+    {
+        BCTU_DRV_EnableDma(config->bctuInstance, adcIdx, true);
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        skew->meanTicks = (int32_t)(total / (int64_t)rounds);
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_PAIR_GetStatistics
+ * Description   : Returns the paired sampling statistics.
+ *
+ * Implements    : ADC_PAIR_GetStatistics_Activity
+ *END**************************************************************************/
+void ADC_PAIR_GetStatistics(const adc_pair_state_t * state, adc_pair_stats_t * stats)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(stats != NULL);
+
+    *stats = state->stats;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,315 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_stats.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 10.1, Unpermitted operand to operator.
+ * The exponential mode relies on arithmetic right shifts of signed values.
+ */
+
+#include <stddef.h>
+#include "device_registers.h"
+#include "adc_stats.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Initial minimum, above any conversion result */
+#define ADC_STATS_MIN_INIT    0xFFFFU
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STATS_RestartWindow
+ * Description   : Clears the per publication accumulators. The exponential
+ * mean and variance carry over.
+ *
+ *END**************************************************************************/
+static void ADC_STATS_RestartWindow(adc_stats_state_t * state)
+{
+    uint8_t idx;
+
+    for (idx = 0U; idx < state->numColumns; idx++)
+    {
+        state->accu[idx].sum = 0U;
+        state->accu[idx].sumSq = 0U;
+        state->accu[idx].min = (uint16_t)ADC_STATS_MIN_INIT;
+        state->accu[idx].max = 0U;
+    }
+
+    state->scans = 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STATS_Publish
+ * Description   : Writes the statistics to the block not exposed to the
+ * readers, then exposes it. The block and the sequence are volatile so the
+ * block is complete before the sequence changes.
+ *
+ *END**************************************************************************/
+static void ADC_STATS_Publish(adc_stats_state_t * state)
+{
+    const adc_stats_accu_t * accu;
+    volatile adc_stats_snapshot_t * block;
+    uint32_t sequence = state->sequence + 1U;
+    uint64_t scans = state->scans;
+    uint64_t spread;
+    uint64_t variance;
+    uint8_t column;
+    uint8_t idx;
+
+    /* 0 means nothing published; skip it on wrap-around, keeping the parity */
+    if (sequence == 0U)
+    {
+        sequence = 2U;
+    }
+    block = &state->published[sequence & 1U];
+
+    for (idx = 0U; idx < state->numColumns; idx++)
+    {
+        accu = &state->accu[idx];
+        column = state->columns[idx];
+
+        block->channel[column].min = accu->min;
+        block->channel[column].max = accu->max;
+
+        if (state->config.mode == ADC_STATS_MODE_WINDOW)
+        {
+            block->channel[column].mean = (uint32_t)(((uint64_t)accu->sum << 16U) / scans);
+            /* n * sum(x^2) - sum(x)^2 is exact and below n^2 * 2^22 for 12-bit results */
+            spread = (scans * accu->sumSq) - ((uint64_t)accu->sum * accu->sum);
+            block->channel[column].variance = (uint32_t)((spread << 8U) / (scans * scans));
+        }
+        else
+        {
+            block->channel[column].mean = (uint32_t)accu->mean;
+            variance = (uint64_t)accu->variance >> 8U;
+            block->channel[column].variance = (variance > UINT32_MAX) ? UINT32_MAX : (uint32_t)variance;
+        }
+    }
+
+    block->scans = state->scans;
+    block->sequence = sequence;
+    state->sequence = sequence;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STATS_Init
+ * Description   : Builds the list of enabled results and clears the
+ * accumulators and the published blocks.
+ *
+ * Implements : ADC_STATS_Init_Activity
+ *END**************************************************************************/
+void ADC_STATS_Init(adc_stats_state_t * state, const adc_stats_user_config_t * config)
+{
+    uint32_t column;
+    uint32_t block;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT((config->channelCount > 0U) && (config->channelCount <= ADC_STATS_MAX_CHANNELS));
+    DEV_ASSERT((config->channelMask >> config->channelCount) == 0U);
+    DEV_ASSERT((config->publishInterval > 0U) && (config->publishInterval <= ADC_STATS_MAX_WINDOW));
+    DEV_ASSERT((config->mode == ADC_STATS_MODE_WINDOW) ||
+               ((config->expShift > 0U) && (config->expShift < 16U)));
+
+    state->config = *config;
+    state->numColumns = 0U;
+    for (column = 0U; column < config->channelCount; column++)
+    {
+        if ((config->channelMask & ((uint32_t)1U << column)) != 0U)
+        {
+            state->columns[state->numColumns] = (uint8_t)column;
+            state->numColumns++;
+        }
+    }
+
+    for (block = 0U; block < 2U; block++)
+    {
+        state->published[block].sequence = 0U;
+        state->published[block].scans = 0U;
+        for (column = 0U; column < ADC_STATS_MAX_CHANNELS; column++)
+        {
+            state->published[block].channel[column].min = 0U;
+            state->published[block].channel[column].max = 0U;
+            state->published[block].channel[column].mean = 0U;
+            state->published[block].channel[column].variance = 0U;
+        }
+    }
+    state->sequence = 0U;
+
+    ADC_STATS_Reset(state);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STATS_Reset
+ * Description   : Restarts the accumulation from scratch.
+ *
+ * Implements : ADC_STATS_Reset_Activity
+ *END**************************************************************************/
+void ADC_STATS_Reset(adc_stats_state_t * state)
+{
+    uint8_t idx;
+
+    DEV_ASSERT(state != NULL);
+
+    for (idx = 0U; idx < state->numColumns; idx++)
+    {
+        state->accu[idx].mean = 0;
+        state->accu[idx].variance = 0;
+    }
+    state->seeded = false;
+
+    ADC_STATS_RestartWindow(state);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STATS_Update
+ * Description   : Accumulates the enabled results of each scan. The window
+ * mode keeps exact integer sums; the exponential mode runs the incremental
+ * (Welford/West) update of the weighted mean and variance in Q16:
+ *   d = x - mean; mean += d * a; var = (1 - a) * (var + d * d * a)
+ *
+ * Implements : ADC_STATS_Update_Activity
+ *END**************************************************************************/
+void ADC_STATS_Update(adc_stats_state_t * state, const uint16_t * scans, uint32_t scanCount)
+{
+    const uint16_t * scan = scans;
+    adc_stats_accu_t * accu;
+    uint32_t shift = state->config.expShift;
+    uint32_t scanIdx;
+    uint8_t idx;
+    uint16_t value;
+    int32_t delta;
+    int64_t variance;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT((scans != NULL) || (scanCount == 0U));
+
+    for (scanIdx = 0U; scanIdx < scanCount; scanIdx++)
+    {
+        if (state->config.mode == ADC_STATS_MODE_WINDOW)
+        {
+            for (idx = 0U; idx < state->numColumns; idx++)
+            {
+                accu = &state->accu[idx];
+                value = scan[state->columns[idx]];
+
+                accu->sum += value;
+                accu->sumSq += (uint32_t)value * value;
+                accu->min = (value < accu->min) ? value : accu->min;
+                accu->max = (value > accu->max) ? value : accu->max;
+            }
+        }
+        else
+        {
+            for (idx = 0U; idx < state->numColumns; idx++)
+            {
+                accu = &state->accu[idx];
+                value = scan[state->columns[idx]];
+
+                if (!state->seeded)
+                {
+                    accu->mean = (int32_t)((uint32_t)value << 16U);
+                }
+                delta = (int32_t)((uint32_t)value << 16U) - accu->mean;
+                accu->mean += delta >> shift;
+                variance = accu->variance + (((int64_t)delta * delta) >> (16U + shift));
+                accu->variance = variance - (variance >> shift);
+
+                accu->min = (value < accu->min) ? value : accu->min;
+                accu->max = (value > accu->max) ? value : accu->max;
+            }
+            state->seeded = true;
+        }
+
+        state->scans++;
+        if (state->scans >= state->config.publishInterval)
+        {
+            ADC_STATS_Publish(state);
+            ADC_STATS_RestartWindow(state);
+        }
+
+        scan = &scan[state->config.channelCount];
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STATS_GetSnapshot
+ * Description   : Copies the exposed block, then checks that no publication
+ * started meanwhile; the next publication writes the other block, the one
+ * after it the block being copied.
+ *
+ * Implements : ADC_STATS_GetSnapshot_Activity
+ *END**************************************************************************/
+status_t ADC_STATS_GetSnapshot(const adc_stats_state_t * state, adc_stats_snapshot_t * snapshot)
+{
+    const volatile adc_stats_snapshot_t * block;
+    uint32_t sequence;
+    uint32_t column;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(snapshot != NULL);
+
+    do
+    {
+        sequence = state->sequence;
+        if (sequence == 0U)
+        {
+            return STATUS_BUSY;
+        }
+
+        block = &state->published[sequence & 1U];
+        snapshot->sequence = block->sequence;
+        snapshot->scans = block->scans;
+        for (column = 0U; column < ADC_STATS_MAX_CHANNELS; column++)
+        {
+            snapshot->channel[column].min = block->channel[column].min;
+            snapshot->channel[column].max = block->channel[column].max;
+            snapshot->channel[column].mean = block->channel[column].mean;
+            snapshot->channel[column].variance = block->channel[column].variance;
+        }
+    } while (state->sequence != sequence);
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
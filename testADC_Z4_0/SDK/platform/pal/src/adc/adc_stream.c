@@ -0,0 +1,343 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_stream.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.4, Conversion between a pointer and integer type.
+ * The cast is required to pass the register and buffer addresses to the eDMA driver.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.5, Conversion from pointer to void to pointer to other type.
+ * The eDMA callback parameter is the stream state passed at installation.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.6, Cast from unsigned int to pointer.
+ * The cast is required to initialize a pointer with an unsigned long define, representing an address.
+ */
+
+#include <stddef.h>
+#include "adc_stream.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Distance between two consecutive CDR registers */
+#define ADC_STREAM_CDR_STRIDE    4U
+
+/* The conversion data is the lower half of CDR; on big endian cores it is at offset 2 */
+#if defined(CORE_BIG_ENDIAN)
+#define ADC_STREAM_CDATA_OFFSET  2U
+#else
+#define ADC_STREAM_CDATA_OFFSET  0U
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Table of base addresses for ADC instances */
+static ADC_Type * const s_adcStreamBase[ADC_INSTANCE_COUNT] = ADC_BASE_PTRS;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void ADC_STREAM_DmaCallback(void * parameter, edma_chn_status_t status);
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STREAM_ReadTimestamp
+ * Description   : Reads the configured timestamp source, or returns 0.
+ *
+ *END**************************************************************************/
+static inline uint32_t ADC_STREAM_ReadTimestamp(const adc_stream_state_t * state)
+{
+    return (state->config.timestamp != NULL) ? state->config.timestamp() : 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STREAM_DmaCallback
+ * Description   : eDMA half/major loop interrupt handler. The buffer half just
+ * filled is deduced from the remaining major loop count: the counter is reloaded
+ * when the second half completes, so more than scansPerBuffer iterations left
+ * means the second half is ready.
+ *
+ *END**************************************************************************/
+static void ADC_STREAM_DmaCallback(void * parameter, edma_chn_status_t status)
+{
+    adc_stream_state_t * state = (adc_stream_state_t *)parameter;
+    const adc_stream_user_config_t * config = &state->config;
+    uint32_t entry = ADC_STREAM_ReadTimestamp(state);
+    adc_stream_event_t event;
+    const uint16_t * scans;
+
+    if (status == EDMA_CHN_ERROR)
+    {
+        (void)ADC_STREAM_Stop(state);
+        if (config->callback != NULL)
+        {
+            config->callback(NULL, 0U, entry, ADC_STREAM_EVENT_DMA_ERROR, config->callbackParam);
+        }
+        return;
+    }
+
+    if (EDMA_DRV_GetRemainingMajorIterationsCount(config->dmaVirtualChannel) > config->scansPerBuffer)
+    {
+        event = ADC_STREAM_EVENT_FULL;
+        scans = &config->buffer[config->scansPerBuffer * config->channelCount];
+    }
+    else
+    {
+        event = ADC_STREAM_EVENT_HALF;
+        scans = config->buffer;
+    }
+
+    /* Two consecutive events for the same half mean the other half was not serviced */
+    if (event == state->lastEvent)
+    {
+        state->missedHalves++;
+    }
+    state->lastEvent = event;
+
+    if (state->halfBuffers == 0U)
+    {
+        state->firstTimestamp = entry;
+    }
+    state->lastTimestamp = entry;
+    state->halfBuffers++;
+
+    if (config->callback != NULL)
+    {
+        config->callback(scans, config->scansPerBuffer, entry, event, config->callbackParam);
+    }
+
+    state->busyTicks += ADC_STREAM_ReadTimestamp(state) - entry;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STREAM_Init
+ * Description   : Enables the scanned channels and the DMA request of the last
+ * one, and configures the eDMA channel to copy one scan per request into the
+ * ping-pong buffer, wrapping around at the end of the buffer.
+ *
+ * Implements    : ADC_STREAM_Init_Activity
+ *END**************************************************************************/
+status_t ADC_STREAM_Init(adc_stream_state_t * state, const adc_stream_user_config_t * config)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->instance < ADC_INSTANCE_COUNT);
+    DEV_ASSERT((config->channelCount > 0U) && (config->channelCount <= ADC_STREAM_MAX_CHANNELS));
+    DEV_ASSERT((config->firstChannel + config->channelCount) <= ADC_CDR_COUNT);
+    DEV_ASSERT(config->buffer != NULL);
+    DEV_ASSERT(config->scansPerBuffer > 0U);
+
+    const ADC_Type * const base = s_adcStreamBase[config->instance];
+    uint32_t lastChannel = (config->firstChannel + config->channelCount) - 1U;
+    uint32_t scanBytes = config->channelCount * (uint32_t)sizeof(uint16_t);
+    uint32_t chnIdx;
+    status_t status;
+
+    state->config = *config;
+    state->running = false;
+    state->lastEvent = ADC_STREAM_EVENT_FULL;
+    state->halfBuffers = 0U;
+    state->missedHalves = 0U;
+    state->firstTimestamp = 0U;
+    state->lastTimestamp = 0U;
+    state->busyTicks = 0U;
+
+    for (chnIdx = config->firstChannel; chnIdx <= lastChannel; chnIdx++)
+    {
+        ADC_DRV_EnableChannel(config->instance, ADC_CONV_CHAIN_NORMAL, chnIdx);
+    }
+
+    /* The last channel of the scan requests the transfer of the whole scan; the
+     * request is cleared when the eDMA reads its data register */
+    ADC_DRV_SetDmaClearSource(config->instance, ADC_DMA_REQ_CLEAR_ON_READ);
+    ADC_DRV_EnableChannelDma(config->instance, lastChannel);
+
+    /* One minor loop per scan: read the CDRs of the range, then rewind the source;
+     * one major loop for the two buffer halves, then rewind the destination */
+    edma_loop_transfer_config_t loopConfig =
+    {
+        .majorLoopIterationCount = 2U * config->scansPerBuffer,
+        .srcOffsetEnable = true,
+        .dstOffsetEnable = false,
+        .minorLoopOffset = -(int32_t)(config->channelCount * ADC_STREAM_CDR_STRIDE),
+        .minorLoopChnLinkEnable = false,
+        .minorLoopChnLinkNumber = 0U,
+        .majorLoopChnLinkEnable = false,
+        .majorLoopChnLinkNumber = 0U
+    };
+    edma_transfer_config_t transferConfig =
+    {
+        .srcAddr = (uint32_t)&base->CDR[config->firstChannel] + ADC_STREAM_CDATA_OFFSET,
+        .destAddr = (uint32_t)config->buffer,
+        .srcTransferSize = EDMA_TRANSFER_SIZE_2B,
+        .destTransferSize = EDMA_TRANSFER_SIZE_2B,
+        .srcOffset = (int16_t)ADC_STREAM_CDR_STRIDE,
+        .destOffset = (int16_t)sizeof(uint16_t),
+        .srcLastAddrAdjust = -(int32_t)(config->channelCount * ADC_STREAM_CDR_STRIDE),
+        .destLastAddrAdjust = -(int32_t)(2U * config->scansPerBuffer * scanBytes),
+        .srcModulo = EDMA_MODULO_OFF,
+        .destModulo = EDMA_MODULO_OFF,
+        .minorByteTransferCount = scanBytes,
+        .scatterGatherEnable = false,
+        .scatterGatherNextDescAddr = 0U,
+        .interruptEnable = true,
+        .loopTransferConfig = &loopConfig
+    };
+
+    status = EDMA_DRV_ConfigLoopTransfer(config->dmaVirtualChannel, &transferConfig);
+    if (status == STATUS_SUCCESS)
+    {
+        EDMA_DRV_ConfigureInterrupt(config->dmaVirtualChannel, EDMA_CHN_HALF_MAJOR_LOOP_INT, true);
+        EDMA_DRV_DisableRequestsOnTransferComplete(config->dmaVirtualChannel, false);
+        status = EDMA_DRV_InstallCallback(config->dmaVirtualChannel, ADC_STREAM_DmaCallback, state);
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STREAM_Start
+ * Description   : Resets the statistics, enables the eDMA requests and starts
+ * the Normal chain in Scan mode.
+ *
+ * Implements    : ADC_STREAM_Start_Activity
+ *END**************************************************************************/
+status_t ADC_STREAM_Start(adc_stream_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    if (state->running)
+    {
+        return STATUS_BUSY;
+    }
+
+    state->lastEvent = ADC_STREAM_EVENT_FULL;
+    state->halfBuffers = 0U;
+    state->missedHalves = 0U;
+    state->busyTicks = 0U;
+    state->running = true;
+
+    (void)EDMA_DRV_StartChannel(state->config.dmaVirtualChannel);
+    ADC_DRV_EnableDma(state->config.instance);
+    ADC_DRV_StartConversion(state->config.instance, ADC_CONV_CHAIN_NORMAL);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STREAM_Stop
+ * Description   : Stops the scan and the eDMA requests.
+ *
+ * Implements    : ADC_STREAM_Stop_Activity
+ *END**************************************************************************/
+status_t ADC_STREAM_Stop(adc_stream_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    ADC_DRV_StopConversion(state->config.instance, ADC_CONV_CHAIN_NORMAL);
+    ADC_DRV_DisableDma(state->config.instance);
+    (void)EDMA_DRV_StopChannel(state->config.dmaVirtualChannel);
+    state->running = false;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STREAM_Deinit
+ * Description   : Stops the stream and disables the channels and DMA request.
+ *
+ * Implements    : ADC_STREAM_Deinit_Activity
+ *END**************************************************************************/
+status_t ADC_STREAM_Deinit(adc_stream_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    const adc_stream_user_config_t * config = &state->config;
+    uint32_t lastChannel = (config->firstChannel + config->channelCount) - 1U;
+    uint32_t chnIdx;
+
+    (void)ADC_STREAM_Stop(state);
+    (void)EDMA_DRV_InstallCallback(config->dmaVirtualChannel, NULL, NULL);
+    ADC_DRV_DisableChannelDma(config->instance, lastChannel);
+
+    for (chnIdx = config->firstChannel; chnIdx <= lastChannel; chnIdx++)
+    {
+        ADC_DRV_DisableChannel(config->instance, ADC_CONV_CHAIN_NORMAL, chnIdx);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_STREAM_GetStatistics
+ * Description   : Computes the sustained sample rate and the CPU load from the
+ * timestamps of the delivered buffer halves.
+ *
+ * Implements    : ADC_STREAM_GetStatistics_Activity
+ *END**************************************************************************/
+void ADC_STREAM_GetStatistics(const adc_stream_state_t * state, adc_stream_stats_t * stats)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(stats != NULL);
+
+    const adc_stream_user_config_t * config = &state->config;
+    uint32_t halves = state->halfBuffers;
+    uint32_t elapsed = state->lastTimestamp - state->firstTimestamp;
+    uint64_t samples;
+
+    stats->halfBuffers = halves;
+    stats->missedHalves = state->missedHalves;
+    stats->samplesPerSecond = 0U;
+    stats->cpuLoad = 0U;
+
+    if ((halves > 1U) && (elapsed != 0U) && (config->timestamp != NULL))
+    {
+        /* Samples acquired between the first and the last delivered half, missed halves included */
+        samples = (uint64_t)((halves - 1U) + state->missedHalves) * config->scansPerBuffer * config->channelCount;
+        stats->samplesPerSecond = (uint32_t)((samples * config->timestampFreq) / elapsed);
+        stats->cpuLoad = (uint32_t)(((uint64_t)state->busyTicks * 1000U) / elapsed);
+    }
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,23 @@
+/* Generated by adc_lin_gen from ntc_10k_b3950.txt. Do not modify it. */
+
+#include "adc_lin_ntc10k.h"
+
+/* Value x 100 at code (i << 6) */
+static const int32_t g_adcLinNtc10kPoints[65U] =
+{
+    14623, 13496, 12370, 11243, 10161, 9326, 8661, 8107,
+    7633, 7218, 6849, 6515, 6211, 5930, 5669, 5425,
+    5196, 4979, 4772, 4576, 4387, 4205, 4030, 3860,
+    3696, 3536, 3379, 3226, 3077, 2929, 2784, 2642,
+    2500, 2360, 2221, 2083, 1945, 1807, 1670, 1532,
+    1393, 1254, 1113, 970, 825, 678, 528, 374,
+    217, 55, -114, -288, -471, -663, -866, -1084,
+    -1318, -1575, -1859, -2182, -2561, -3021, -3474, -3928,
+    -4382,
+};
+
+const adc_lin_table_t g_adcLinNtc10k =
+{
+    .points = g_adcLinNtc10kPoints,
+    .segmentShift = 6U
+};
@@ -0,0 +1,11 @@
+/* Generated by adc_lin_gen from ntc_10k_b3950.txt. Do not modify it. */
+
+#ifndef ADC_LIN_NTC10K_H
+#define ADC_LIN_NTC10K_H
+
+#include "adc_lin.h"
+
+/*! @brief Breakpoint table, converted by ADC_LIN_Convert() */
+extern const adc_lin_table_t g_adcLinNtc10k;
+
+#endif /* ADC_LIN_NTC10K_H */
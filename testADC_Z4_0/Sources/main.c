@@ -30,6 +30,7 @@
 #include "pin_mux.h"
 volatile int exit_code = 0;
 /* User includes (#include below this line is not maintained by Processor Expert) */
+#include "pin_mux_image.h"
 #include <stdint.h>
 #include <stdbool.h>
 /* This example is setup to work by default with DEVKIT. To use it with other boards
@@ -39,22 +40,25 @@ volatile int exit_code = 0;
 #ifdef DEVKIT
 
 
-#define PORT0	PTA
-#define LED0	10
-#define PORT1	PTA
-#define LED1 	7
-#define PORT2	PTH
-#define LED2	13
-#define PORT3	PTC
-#define LED3	4
-#define PORT4	PTH
-#define LED4	5
-#define PORT5   PTJ
-#define LED5    4U
-#define PORT6	PTA
-#define LED6 	0
-#define PORT7	PTA
-#define LED7 	4
+/* LED bar, LED0 to LED7: PTA10, PTA7, PTH13, PTC4, PTH5, PTJ4, PTA0, PTA4 */
+static const pins_set_port_t ledBarPorts[] = {
+	{ PINS_PORT_IDX(PTA_BASE), PINS_PORT_PIN_MASK(10U) | PINS_PORT_PIN_MASK(7U) |
+	                           PINS_PORT_PIN_MASK(0U) | PINS_PORT_PIN_MASK(4U) },
+	{ PINS_PORT_IDX(PTC_BASE), PINS_PORT_PIN_MASK(4U) },
+	{ PINS_PORT_IDX(PTH_BASE), PINS_PORT_PIN_MASK(13U) | PINS_PORT_PIN_MASK(5U) },
+	{ PINS_PORT_IDX(PTJ_BASE), PINS_PORT_PIN_MASK(4U) },
+};
+static const pins_set_pin_t ledBarPins[] = {
+	{ 0U, PINS_PORT_PIN_MASK(10U) },	/* LED0 */
+	{ 0U, PINS_PORT_PIN_MASK(7U) },		/* LED1 */
+	{ 2U, PINS_PORT_PIN_MASK(13U) },	/* LED2 */
+	{ 1U, PINS_PORT_PIN_MASK(4U) },		/* LED3 */
+	{ 2U, PINS_PORT_PIN_MASK(5U) },		/* LED4 */
+	{ 3U, PINS_PORT_PIN_MASK(4U) },		/* LED5 */
+	{ 0U, PINS_PORT_PIN_MASK(0U) },		/* LED6 */
+	{ 0U, PINS_PORT_PIN_MASK(4U) },		/* LED7 */
+};
+static const pins_set_t ledBar = { ledBarPorts, 4U, ledBarPins, 8U };
 
 #define ADC_CHAN_NUM (9u)		/* ADC1_P[0] corresponding to PB[4] */
 uint16_t result;				/* 读取PB[4]的结果 */
@@ -75,7 +79,7 @@ int main(void)
   #endif
   /*** End of Processor Expert internal initialization.                    ***/
   /* Initialize and configure pins */
-  PINS_DRV_Init(NUM_OF_CONFIGURED_PINS, g_pin_mux_InitConfigArr);
+  PINS_DRV_InitFromImage(PIN_MUX_INIT_IMAGE_COUNT, g_pin_mux_InitImage);
   
   /* Initialize clocks */
   CLOCK_SYS_Init(g_clockManConfigsArr,   CLOCK_MANAGER_CONFIG_CNT,
@@ -135,14 +139,7 @@ int main(void)
     {
 
     }
-	PINS_DRV_WritePin(PORT0, LED0, (ledValue & 0x01) ? 0 : 1);
-	PINS_DRV_WritePin(PORT1, LED1, (ledValue & 0x02) ? 0 : 1);
-	PINS_DRV_WritePin(PORT2, LED2, (ledValue & 0x04) ? 0 : 1);
-	PINS_DRV_WritePin(PORT3, LED3, (ledValue & 0x08) ? 0 : 1);
-	PINS_DRV_WritePin(PORT4, LED4, (ledValue & 0x10) ? 0 : 1);
-	PINS_DRV_WritePin(PORT5, LED5, (ledValue & 0x20) ? 0 : 1);
-	PINS_DRV_WritePin(PORT6, LED6, (ledValue & 0x40) ? 0 : 1);
-	PINS_DRV_WritePin(PORT7, LED7, (ledValue & 0x80) ? 0 : 1);
+	PINS_DRV_WritePinSet(&ledBar, (uint8_t)~ledValue);	/* LEDs are active low */
 
   }
   /*** Don't write any code pass this line, or it will be deleted during code generation. ***/
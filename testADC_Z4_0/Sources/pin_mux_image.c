@@ -0,0 +1,20 @@
+/* Generated by pins_image_gen from g_pin_mux_InitConfigArr. Do not modify it. */
+
+#include "pin_mux_image.h"
+
+const pins_reg_write_t g_pin_mux_InitImage[PIN_MUX_INIT_IMAGE_COUNT] =
+{
+    { 0xFFFC17A4u, 0x08000000u },    /* MPGPDO[9] */
+    { 0xFFFC0490u, 0x02000000u },    /* MSCR[148] */
+    { 0xFFFC0290u, 0x00480000u },    /* MSCR[20] */
+    { 0xFFFC0310u, 0x00480000u },    /* MSCR[52] */
+    { 0xFFFC0300u, 0x00480000u },    /* MSCR[48] */
+    { 0xFFFC030Cu, 0x00480000u },    /* MSCR[51] */
+    { 0xFFFC031Cu, 0x00480000u },    /* MSCR[55] */
+    { 0xFFFC0304u, 0x00480000u },    /* MSCR[49] */
+    { 0xFFFC0308u, 0x00480000u },    /* MSCR[50] */
+    { 0xFFFC0314u, 0x00480000u },    /* MSCR[53] */
+    { 0xFFFC0318u, 0x00480000u },    /* MSCR[54] */
+    { 0xFFFC02A4u, 0x00480000u },    /* MSCR[25] */
+    { 0xFFFC02A0u, 0x00480000u },    /* MSCR[24] */
+};
@@ -0,0 +1,14 @@
+/* Generated by pins_image_gen from g_pin_mux_InitConfigArr. Do not modify it. */
+
+#ifndef PIN_MUX_IMAGE_H
+#define PIN_MUX_IMAGE_H
+
+#include "pins_driver.h"
+
+/*! @brief Number of register writes in the pin configuration image */
+#define PIN_MUX_INIT_IMAGE_COUNT 13U
+
+/*! @brief Pin configuration image, applied by PINS_DRV_InitFromImage() */
+extern const pins_reg_write_t g_pin_mux_InitImage[PIN_MUX_INIT_IMAGE_COUNT];
+
+#endif /* PIN_MUX_IMAGE_H */
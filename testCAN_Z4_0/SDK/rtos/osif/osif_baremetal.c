@@ -67,13 +67,35 @@
 
 /*! @cond DRIVER_INTERNAL_USE_ONLY */
 
+#ifndef FEATURE_OSIF_USE_STM
+#define FEATURE_OSIF_USE_STM (0)
+#endif
+
+#if FEATURE_OSIF_USE_STM
+
+/*! @brief Time in STM ticks, extended to 64 bits */
+typedef uint64_t osif_tick_t;
+
+#else
+
+/*! @brief Time in milliseconds */
+typedef uint32_t osif_tick_t;
+
 /*! @brief Converts milliseconds to ticks - in this case, one tick = one millisecond */
-#define MSEC_TO_TICK(msec) (msec)
+#define MSEC_TO_TICK(msec) ((osif_tick_t)(msec))
 
-#if (FEATURE_OSIF_USE_SYSTICK != 0) || (FEATURE_OSIF_USE_PIT != 0)
+/*! @brief Converts ticks to milliseconds */
+#define TICK_TO_MSEC(ticks) ((uint32_t)(ticks))
+
+#endif /* FEATURE_OSIF_USE_STM */
+
+#if (FEATURE_OSIF_USE_SYSTICK != 0) || (FEATURE_OSIF_USE_PIT != 0) || (FEATURE_OSIF_USE_STM != 0)
 /* Only include headers for configurations that need them. */
 #include "interrupt_manager.h"
 #include "clock_manager.h"
+#endif
+
+#if (FEATURE_OSIF_USE_SYSTICK != 0) || (FEATURE_OSIF_USE_PIT != 0)
 
 static volatile uint32_t s_osif_tick_cnt = 0u;
 
@@ -129,6 +151,143 @@ static inline void osif_EnableIrqGlobal(void)
     INT_SYS_EnableIRQGlobal();
 }
 
+#elif FEATURE_OSIF_USE_STM
+
+/* The time is read from the free-running STM counter instead of being counted by a
+ * periodic interrupt. The counter is extended to 64 bits with the number of halves of
+ * its range it has gone through, counted by the interrupt of one compare channel
+ * programmed at each half: one interrupt per 2^31 STM ticks, whether or not someone
+ * is waiting. The waits poll the counter and need no interrupt.
+ *
+ * The STM is started with the system clock and no prescaler if it is not running. If
+ * the application runs it, its configuration is used, but its counter must not be
+ * written. The clock frequency is read when the STM configuration is first seen or
+ * changes, not on each call.
+ */
+
+/* application is allowed to change the stm channel used by osif
+ * but care must be taken in multicore environments to not use
+ * the same channel for multiple cores
+ */
+#ifndef OSIF_STM_CHAN_ID
+#define OSIF_STM_CHAN_ID (OSIF_STM_CHAN_ID_MAX - (uint32_t)GET_CORE_ID())
+#endif /* OSIF_STM_CHAN_ID */
+
+/* Halves of the counter range elapsed */
+static volatile uint32_t s_osif_stm_epoch = 0u;
+/* STM configuration the tick rate was computed for, 0 before the first initialization */
+static uint32_t s_osif_stm_cr = 0u;
+/* STM ticks per millisecond */
+static uint32_t s_osif_ticks_per_ms = 1u;
+
+/*! @brief Converts milliseconds to STM ticks */
+#define MSEC_TO_TICK(msec) ((osif_tick_t)(msec) * s_osif_ticks_per_ms)
+
+/*! @brief Converts STM ticks to milliseconds */
+#define TICK_TO_MSEC(ticks) ((uint32_t)((ticks) / s_osif_ticks_per_ms))
+
+void OSIF_STM_IRQHandler(void);
+
+void OSIF_STM_IRQHandler(void)
+{
+    STM_Type * base = OSIF_STM;
+    uint32_t epoch = s_osif_stm_epoch + 1u;
+
+    base->CHANNEL[OSIF_STM_CHAN_ID].CIR = STM_CIR_CIF(1u);
+    s_osif_stm_epoch = epoch;
+    /* next half of the counter range */
+    base->CHANNEL[OSIF_STM_CHAN_ID].CMP = (epoch + 1u) << 31u;
+}
+
+static inline osif_tick_t osif_GetCurrentTickCount(void)
+{
+    const STM_Type * base = OSIF_STM;
+    uint32_t epoch;
+    uint32_t count;
+
+    /* read again if the interrupt ran in between */
+    do
+    {
+        epoch = s_osif_stm_epoch;
+        count = base->CNT;
+    } while (epoch != s_osif_stm_epoch);
+
+    /* the counter entered the next half, the interrupt is pending */
+    if ((count >> 31u) != (epoch & 1u))
+    {
+        epoch++;
+    }
+
+    return ((osif_tick_t)epoch << 31u) | (osif_tick_t)(count & 0x7FFFFFFFu);
+}
+
+static inline void osif_UpdateTickConfig(void)
+{
+    uint32_t stm_chan_id = OSIF_STM_CHAN_ID;
+    STM_Type * base = OSIF_STM;
+    uint32_t tick_freq = 0u;
+    uint32_t cr = base->CR;
+
+    if ((cr & STM_CR_TEN_MASK) == 0u)
+    {
+#if FEATURE_OSIF_STM_FRZ_IN_DEBUG
+        base->CR |= STM_CR_FRZ(1u); /* stop the timer in debug */
+#endif /* FEATURE_OSIF_STM_FRZ_IN_DEBUG */
+        base->CR |= STM_CR_TEN(1u);
+        cr = base->CR;
+    }
+
+    /* nothing to do while the STM runs with the same configuration */
+    if (cr == s_osif_stm_cr)
+    {
+        return;
+    }
+
+    /* get the clock frequency for the timer and compute ticks for 1 ms */
+    static const clock_names_t stmClkNames[] = STM_CLOCK_NAMES;
+    status_t clk_status = CLOCK_SYS_GetFreq(stmClkNames[(cr & STM_CR_CSL_MASK) >> STM_CR_CSL_SHIFT], &tick_freq);
+    DEV_ASSERT(clk_status == STATUS_SUCCESS);
+    (void)clk_status;
+    s_osif_ticks_per_ms = (tick_freq / (((cr & STM_CR_CPS_MASK) >> STM_CR_CPS_SHIFT) + 1u)) / 1000u;
+    DEV_ASSERT(s_osif_ticks_per_ms > 0u);
+
+    if (s_osif_stm_cr == 0u)
+    {
+        /* check if the channel is already used. If it is, we cannot use it. */
+        DEV_ASSERT((base->CHANNEL[stm_chan_id].CCR & STM_CCR_CEN_MASK) == 0u);
+        static const IRQn_Type stmIrqId[STM_INSTANCE_COUNT][STM_CHANNEL_COUNT] = STM_IRQS;
+
+        /* start counting from the half of the range the counter is in */
+        s_osif_stm_epoch = base->CNT >> 31u;
+        base->CHANNEL[stm_chan_id].CIR = STM_CIR_CIF(1u);
+        base->CHANNEL[stm_chan_id].CMP = (s_osif_stm_epoch + 1u) << 31u;
+        base->CHANNEL[stm_chan_id].CCR = STM_CCR_CEN(1u);
+        /* the counter may have reached the next half before the channel was
+         * enabled; if it did after, the flag is set and the interrupt counts it */
+        if (((base->CNT >> 31u) != (s_osif_stm_epoch & 1u)) &&
+            ((base->CHANNEL[stm_chan_id].CIR & STM_CIR_CIF_MASK) == 0u))
+        {
+            s_osif_stm_epoch++;
+            base->CHANNEL[stm_chan_id].CMP = (s_osif_stm_epoch + 1u) << 31u;
+        }
+
+        INT_SYS_InstallHandler(stmIrqId[0U][stm_chan_id], OSIF_STM_IRQHandler, NULL);
+        INT_SYS_EnableIRQ(stmIrqId[0U][stm_chan_id]);
+    }
+
+    s_osif_stm_cr = cr;
+}
+
+static inline void osif_DisableIrqGlobal(void)
+{
+    INT_SYS_DisableIRQGlobal();
+}
+
+static inline void osif_EnableIrqGlobal(void)
+{
+    INT_SYS_EnableIRQGlobal();
+}
+
 #elif FEATURE_OSIF_USE_PIT
 
 #ifndef OSIF_CLK
@@ -203,7 +362,7 @@ static inline void osif_EnableIrqGlobal(void)
 
 #else /* FEATURE_OSIF_USE_SYSTICK == 0, FEATURE_OSIF_USE_PIT == 0 */
 
-static inline uint32_t osif_GetCurrentTickCount(void)
+static inline osif_tick_t osif_GetCurrentTickCount(void)
 {
     return 0u;
 }
@@ -235,10 +394,10 @@ static inline void osif_UpdateTickConfig(void)
 void OSIF_TimeDelay(const uint32_t delay)
 {
     osif_UpdateTickConfig();
-    uint32_t start = osif_GetCurrentTickCount();
-    uint32_t crt_ticks = osif_GetCurrentTickCount();
-    uint32_t delta = crt_ticks - start;
-    uint32_t delay_ticks = MSEC_TO_TICK(delay);
+    osif_tick_t start = osif_GetCurrentTickCount();
+    osif_tick_t crt_ticks = osif_GetCurrentTickCount();
+    osif_tick_t delta = crt_ticks - start;
+    osif_tick_t delay_ticks = MSEC_TO_TICK(delay);
     while (delta < delay_ticks)
     {
         crt_ticks = osif_GetCurrentTickCount();
@@ -265,7 +424,7 @@ uint32_t OSIF_GetMilliseconds(void)
      * without any other side-effects. If OSIF_TimeDelay or OSIF_SemaWait functions
      * have been called, the timer is already initialized.
      */
-    return osif_GetCurrentTickCount(); /* This assumes that 1 tick = 1 millisecond */
+    return TICK_TO_MSEC(osif_GetCurrentTickCount());
 }
 
 /*FUNCTION**********************************************************************
@@ -356,24 +515,18 @@ status_t OSIF_SemaWait(semaphore_t * const pSem,
     else
     {
         /* timeout is not 0 */
-        uint32_t timeoutTicks;
-        if (timeout == OSIF_WAIT_FOREVER)
-        {
-            timeoutTicks = OSIF_WAIT_FOREVER;
-        }
-        else
+        osif_tick_t timeoutTicks = 0u;
+        if (timeout != OSIF_WAIT_FOREVER)
         {
             /* Convert timeout from milliseconds to ticks. */
             timeoutTicks = MSEC_TO_TICK(timeout);
         }
-        uint32_t start = osif_GetCurrentTickCount();
-        uint32_t end = (uint32_t)(start + timeoutTicks);
-        uint32_t max = end - start;
+        osif_tick_t start = osif_GetCurrentTickCount();
         while (*pSem == 0u)
         {
-            uint32_t crt_ticks = osif_GetCurrentTickCount();
-            uint32_t delta = crt_ticks - start;
-            if ((timeoutTicks != OSIF_WAIT_FOREVER) && (delta > max))
+            osif_tick_t crt_ticks = osif_GetCurrentTickCount();
+            osif_tick_t delta = crt_ticks - start;
+            if ((timeout != OSIF_WAIT_FOREVER) && (delta > timeoutTicks))
             {
                 /* Timeout occured, stop waiting and return fail code */
                 osif_ret_code = STATUS_TIMEOUT;
@@ -0,0 +1,481 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file emios_ic_test.c
+ *
+ * Host unit tests of the eMIOS input capture ring.
+ *
+ *   make test     plays random edge sequences into a channel in SAIC, IPM and
+ *                 IPWM mode, through EMIOS_DRV_IC_InitInputCaptureMode(),
+ *                 EMIOS_DRV_IC_InitRing() and the eDMA model of host_platform.c,
+ *                 with the timebase wrapping every TEST_PERIOD ticks. Each result
+ *                 of EMIOS_DRV_IC_Measure() is compared with the edge times:
+ *                 timestamps, mean period, pulse width, duty, frequency and lost
+ *                 records. The runs cover:
+ *                 - edges less than one period apart, without wrap counting;
+ *                 - wrap counting with edges up to 100 periods apart, for handler
+ *                   latencies from 0 to half a period; the latency is constant
+ *                   within a run, as a varying latency can assign a wrap to the
+ *                   wrong interval (see EMIOS_DRV_IC_TimebaseWrapHandler());
+ *                 - the eDMA interrupt of a ring pass served up to a few periods
+ *                   late, before the next pass completes;
+ *                 - records overwritten before they are measured;
+ *                 - the wrap log overflowing between two measurements.
+ *   make bench    same as make test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "emios_ic_driver.h"
+#include "emios_mc_driver.h"
+#include "emios_hw_access.h"
+#include "host_platform.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_GROUP          0U
+#define TEST_CHANNEL        0U
+#define TEST_TIMEBASE       23U
+#define TEST_DMA_CHANNEL    1U
+
+/* Timebase period and counter clock */
+#define TEST_PERIOD         1000U
+#define TEST_CLOCK_HZ       1000000U
+
+#define TEST_RING_LENGTH    64U
+#define TEST_RECORDS        20000U
+
+#define CHECK(cond)    TEST_Check((cond), #cond, __LINE__)
+
+/*! @brief One run of the simulation */
+typedef struct
+{
+    emios_input_capture_mode_t mode;
+    bool countWraps;
+    uint32_t maxPulse;             /* IPWM: pulse widths, 1 to maxPulse ticks */
+    uint32_t maxGap;               /* Ticks from an edge (IPWM: trailing edge) to the next one, 1 to maxGap */
+    uint32_t latency;              /* Ticks from a timebase wrap to its handler */
+    uint32_t maxDmaLatency;        /* Ticks from a pass completion to the eDMA interrupt, 0 to maxDmaLatency */
+    uint32_t measureEvery;         /* Records between measurements, 1 to measureEvery */
+    bool expectLost;               /* Records are overwritten */
+    bool expectWrapLoss;           /* The wrap log overflows */
+} test_run_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_failures = 0U;
+static uint32_t s_checks = 0U;
+static uint32_t s_seed = 2019U;
+
+static uint32_t s_ring[TEST_RING_LENGTH * 2U];
+static emios_ic_ring_state_t s_state;
+
+/* Reference edge time and pulse width of each record */
+static uint64_t s_refTime[TEST_RECORDS];
+static uint32_t s_pulse[TEST_RECORDS];
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char * text, int line)
+{
+    s_checks++;
+    if (!cond)
+    {
+        s_failures++;
+        printf("FAIL line %d: %s\n", line, text);
+    }
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* Random value from 1 to max; max can exceed the 24 bits of TEST_Random() */
+static uint32_t TEST_RandomRange(uint32_t max)
+{
+    uint32_t high = TEST_Random();
+    uint32_t low = TEST_Random();
+
+    return 1U + ((((high & 0xFFU) << 24U) | low) % max);
+}
+
+static const char * TEST_ModeName(emios_input_capture_mode_t mode)
+{
+    return (mode == EMIOS_MODE_IPWM) ? "IPWM" : ((mode == EMIOS_MODE_IPM) ? "IPM " : "SAIC");
+}
+
+/*******************************************************************************
+ * Simulation
+ ******************************************************************************/
+
+/* Timebase in MC up mode on counter bus A, as set up by EMIOS_DRV_MC_InitCounterMode() */
+static void TEST_InitTimebase(void)
+{
+    eMIOS[TEST_GROUP]->UC[TEST_TIMEBASE].C = eMIOS_C_MODE(EMIOS_MODE_MC_UP_CNT_CLR_START_INT_CLK);
+    eMIOS[TEST_GROUP]->UC[TEST_TIMEBASE].A = TEST_PERIOD;
+    eMIOS[TEST_GROUP]->UC[TEST_TIMEBASE].CNT = 0U;
+}
+
+/* Checks a successful measurement of edges records from record first, knowing
+ * whether the timeline continues from the record before */
+static void TEST_CheckMeasurement(const emios_ic_measurement_t * result, uint32_t first, uint32_t edges,
+                                  bool continuous, uint32_t previousTimestamp, bool pulseWidth)
+{
+    uint32_t last = first + edges - 1U;
+    uint32_t reference = continuous ? (first - 1U) : first;
+    uint32_t periods = last - reference;
+    uint64_t periodSum = s_refTime[last] - s_refTime[reference];
+    uint64_t pulseSum = 0U;
+    uint64_t period;
+    uint64_t frequency;
+    uint32_t idx;
+
+    CHECK(result->periods == periods);
+    if (continuous)
+    {
+        CHECK((uint32_t)(result->timestamp - previousTimestamp) == (uint32_t)periodSum);
+    }
+
+    period = (periods > 0U) ? (periodSum / periods) : 0U;
+    CHECK(result->periodTicks == ((period > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)period));
+
+    if (pulseWidth)
+    {
+        for (idx = first; idx <= last; idx++)
+        {
+            pulseSum += s_pulse[idx];
+        }
+        CHECK(result->pulseTicks == (uint32_t)(pulseSum / edges));
+    }
+
+    if (result->periodTicks > 0U)
+    {
+        frequency = (((uint64_t)TEST_CLOCK_HZ * 1000ULL) * periods) / periodSum;
+        CHECK(result->dutyQ16 == (uint32_t)(((uint64_t)result->pulseTicks << 16U) / result->periodTicks));
+        CHECK(result->frequencyMilliHz == ((frequency > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)frequency));
+    }
+    CHECK(!result->overrun);
+}
+
+/* Plays TEST_RECORDS records. Events at the same tick are ordered: timebase wrap,
+ * edge, wrap handler, eDMA interrupt. The application measures when the wrap
+ * handler is not pending; the eDMA interrupt of a pass can be, as when measuring
+ * from a task of higher priority, unless the ring is overrun: the records
+ * pending are then only known once the interrupt has run. */
+static void TEST_Run(const test_run_t * run)
+{
+    emios_input_capture_param_t icParam;
+    emios_ic_ring_config_t ringConfig;
+    emios_ic_measurement_t result;
+    bool pulseWidth = (run->mode == EMIOS_MODE_IPWM);
+    uint64_t time = 0U;
+    uint64_t nextWrap = TEST_PERIOD;
+    uint64_t handlerAt = 0U;
+    uint64_t dmaIrqAt = 0U;
+    uint64_t nextEdge;
+    uint64_t lead = 0U;
+    bool handlerPending = false;
+    bool dmaIrqPending = false;
+    uint32_t written = 0U;
+    uint32_t consumed = 0U;
+    uint32_t measureAt;
+    uint32_t pending;
+    uint32_t edges;
+    uint32_t lost;
+    uint32_t measurements = 0U;
+    uint32_t lostTotal = 0U;
+    uint32_t wrapErrors = 0U;
+    uint32_t previousTimestamp = 0U;
+    uint32_t previousCapture = 0U;
+    bool continuous = false;
+    status_t status;
+
+    (void)memset(eMIOS[TEST_GROUP], 0, sizeof(eMIOS_Type));
+    TEST_InitTimebase();
+
+    icParam.mode = run->mode;
+    icParam.timebase = EMIOS_BUS_SEL_A;
+    icParam.filterInput = EMIOS_INPUT_FILTER_BYPASS;
+    icParam.filterEn = false;
+    icParam.inputCaptureMode = EMIOS_TRIGGER_EDGE_RISING;
+    CHECK(EMIOS_DRV_IC_InitInputCaptureMode(TEST_GROUP, TEST_CHANNEL, &icParam) == STATUS_SUCCESS);
+
+    ringConfig.dmaVirtualChannel = TEST_DMA_CHANNEL;
+    ringConfig.buffer = s_ring;
+    ringConfig.bufferLength = TEST_RING_LENGTH;
+    ringConfig.counterClockHz = TEST_CLOCK_HZ;
+    ringConfig.countTimebaseWraps = run->countWraps;
+    CHECK(EMIOS_DRV_IC_InitRing(TEST_GROUP, TEST_CHANNEL, &ringConfig, &s_state) == STATUS_SUCCESS);
+    CHECK(EMIOS_DRV_IC_StartRing(&s_state) == STATUS_SUCCESS);
+    CHECK(EMIOS_DRV_IC_StartRing(&s_state) == STATUS_BUSY);
+    CHECK(EMIOS_DRV_IC_GetPendingRecords(&s_state) == 0U);
+
+    /* First edge: the leading edge in IPWM mode */
+    nextEdge = TEST_RandomRange(run->maxGap);
+    if (pulseWidth)
+    {
+        lead = nextEdge;
+        s_pulse[0] = TEST_RandomRange(run->maxPulse);
+        nextEdge = lead + s_pulse[0];
+    }
+    measureAt = TEST_RandomRange(run->measureEvery);
+
+    while (written < TEST_RECORDS)
+    {
+        if ((nextWrap <= nextEdge) && (!handlerPending || (nextWrap <= handlerAt)) &&
+            (!dmaIrqPending || (nextWrap <= dmaIrqAt)))
+        {
+            time = nextWrap;
+            nextWrap += TEST_PERIOD;
+            if (run->countWraps)
+            {
+                /* A wrap before the handler of the previous one ran is merged with it */
+                handlerAt = handlerPending ? handlerAt : (time + run->latency);
+                handlerPending = true;
+            }
+        }
+        else if ((!handlerPending || (nextEdge <= handlerAt)) && (!dmaIrqPending || (nextEdge <= dmaIrqAt)))
+        {
+            /* Record completion: A, and B in IPWM (leading edge) and IPM (previous edge) modes */
+            time = nextEdge;
+            if (dmaIrqPending && (((written + 1U) % TEST_RING_LENGTH) == 0U))
+            {
+                /* The interrupt of a pass is served before the next pass completes */
+                dmaIrqPending = false;
+                CHECK(HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+            }
+            s_refTime[written] = pulseWidth ? lead : time;
+            eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].A = (uint32_t)(time % TEST_PERIOD);
+            if (pulseWidth)
+            {
+                eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B = (uint32_t)(lead % TEST_PERIOD);
+            }
+            else if (run->mode == EMIOS_MODE_IPM)
+            {
+                eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B = previousCapture;
+            }
+            else
+            {
+                /* SAIC: B is not used */
+            }
+            previousCapture = (uint32_t)(time % TEST_PERIOD);
+            CHECK(HOST_EMIOS_SetFlag(TEST_GROUP, TEST_CHANNEL, TEST_DMA_CHANNEL));
+            written++;
+            if (((written % TEST_RING_LENGTH) == 0U) && !dmaIrqPending)
+            {
+                dmaIrqAt = time + (TEST_Random() % (run->maxDmaLatency + 1U));
+                dmaIrqPending = true;
+            }
+
+            nextEdge = time + TEST_RandomRange(run->maxGap);
+            if (pulseWidth && (written < TEST_RECORDS))
+            {
+                lead = nextEdge;
+                s_pulse[written] = TEST_RandomRange(run->maxPulse);
+                nextEdge = lead + s_pulse[written];
+            }
+        }
+        else if (handlerPending && (!dmaIrqPending || (handlerAt <= dmaIrqAt)))
+        {
+            time = handlerAt;
+            handlerPending = false;
+            eMIOS[TEST_GROUP]->UC[TEST_TIMEBASE].CNT = (uint32_t)(time % TEST_PERIOD);
+            EMIOS_DRV_IC_TimebaseWrapHandler(&s_state);
+        }
+        else
+        {
+            time = dmaIrqAt;
+            dmaIrqPending = false;
+            CHECK(HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+        }
+
+        if (handlerPending || (dmaIrqPending && run->expectLost) || ((written - consumed) < measureAt))
+        {
+            continue;
+        }
+
+        /* Main loop */
+        pending = EMIOS_DRV_IC_GetPendingRecords(&s_state);
+        CHECK(pending == (written - consumed));
+        edges = (pending < TEST_RING_LENGTH) ? pending : TEST_RING_LENGTH;
+        edges = TEST_RandomRange(edges);
+        lost = (pending > TEST_RING_LENGTH) ? (pending - TEST_RING_LENGTH) : 0U;
+
+        status = EMIOS_DRV_IC_Measure(&s_state, edges, &result);
+        if (status == STATUS_ERROR)
+        {
+            /* Wraps lost: the records pending are dropped */
+            wrapErrors++;
+            consumed = written;
+            continuous = false;
+        }
+        else
+        {
+            CHECK(status == STATUS_SUCCESS);
+            CHECK(result.lostRecords == lost);
+            continuous = continuous && (lost == 0U);
+            TEST_CheckMeasurement(&result, consumed + lost, edges, continuous, previousTimestamp, pulseWidth);
+            previousTimestamp = result.timestamp;
+            consumed += lost + edges;
+            lostTotal += lost;
+            continuous = true;
+        }
+        measurements++;
+        measureAt = TEST_RandomRange(run->measureEvery);
+    }
+
+    /* Nothing more than pending; lost wraps are reported first */
+    pending = EMIOS_DRV_IC_GetPendingRecords(&s_state);
+    if ((pending > 0U) && (pending < TEST_RING_LENGTH) && !dmaIrqPending && !run->expectWrapLoss)
+    {
+        CHECK(EMIOS_DRV_IC_Measure(&s_state, pending + 1U, &result) == STATUS_BUSY);
+    }
+    CHECK(EMIOS_DRV_IC_DeinitRing(&s_state) == STATUS_SUCCESS);
+    CHECK(!HOST_EDMA_RequestsEnabled(TEST_DMA_CHANNEL));
+
+    CHECK(run->expectLost == (lostTotal > 0U));
+    CHECK(run->expectWrapLoss == (wrapErrors > 0U));
+
+    printf("  %s, wraps %s, gaps up to %6u, latency %3u: %5u measurements, %5u records lost, %2u wrap log overflows\n",
+           TEST_ModeName(run->mode), run->countWraps ? "counted" : "ignored", run->maxGap, run->latency,
+           measurements, lostTotal, wrapErrors);
+}
+
+/*******************************************************************************
+ * Tests
+ ******************************************************************************/
+
+static void TEST_Runs(void)
+{
+    static const emios_input_capture_mode_t modes[] = { EMIOS_MODE_IC, EMIOS_MODE_IPM, EMIOS_MODE_IPWM };
+    static const uint32_t gaps[] = { TEST_PERIOD / 4U, 2U * TEST_PERIOD, 100U * TEST_PERIOD };
+    static const uint32_t latencies[] = { 0U, 1U, TEST_PERIOD / 10U, TEST_PERIOD / 2U };
+    test_run_t run;
+    uint32_t modeIdx;
+    uint32_t gapIdx;
+    uint32_t latencyIdx;
+
+    for (modeIdx = 0U; modeIdx < (sizeof(modes) / sizeof(modes[0])); modeIdx++)
+    {
+        run.mode = modes[modeIdx];
+        run.maxDmaLatency = 4U * TEST_PERIOD;
+        run.expectLost = false;
+        run.expectWrapLoss = false;
+
+        /* Without wrap counting: reference edges less than one period apart */
+        run.countWraps = false;
+        run.maxPulse = TEST_PERIOD / 2U;
+        run.maxGap = (run.mode == EMIOS_MODE_IPWM) ? ((TEST_PERIOD / 2U) - 1U) : (TEST_PERIOD - 1U);
+        run.latency = 0U;
+        run.measureEvery = TEST_RING_LENGTH / 2U;
+        TEST_Run(&run);
+
+        /* Records overwritten */
+        run.maxDmaLatency = 0U;
+        run.measureEvery = 4U * TEST_RING_LENGTH;
+        run.expectLost = true;
+        TEST_Run(&run);
+        run.expectLost = false;
+
+        /* Wrap counting; a measurement at least every 8 records keeps the log from overflowing */
+        run.countWraps = true;
+        run.maxPulse = TEST_PERIOD - 1U;
+        run.measureEvery = 8U;
+        for (gapIdx = 0U; gapIdx < (sizeof(gaps) / sizeof(gaps[0])); gapIdx++)
+        {
+            for (latencyIdx = 0U; latencyIdx < (sizeof(latencies) / sizeof(latencies[0])); latencyIdx++)
+            {
+                run.maxGap = gaps[gapIdx];
+                run.latency = latencies[latencyIdx];
+                /* The eDMA interrupt is late by up to a few periods */
+                run.maxDmaLatency = (gapIdx == 0U) ? (TEST_RING_LENGTH / 2U) : (4U * TEST_PERIOD);
+                TEST_Run(&run);
+            }
+        }
+
+        /* Wrap log overflow: edges at distinct wraps, measured rarely */
+        run.maxGap = 2U * TEST_PERIOD;
+        run.latency = TEST_PERIOD / 10U;
+        run.measureEvery = 4U * EMIOS_IC_WRAP_LOG_LENGTH;
+        run.expectWrapLoss = true;
+        TEST_Run(&run);
+    }
+}
+
+/* Without a ring: the last measurement, modulo the period */
+static void TEST_LastMeasurement(void)
+{
+    emios_input_capture_param_t icParam;
+    uint32_t value = 0U;
+
+    (void)memset(eMIOS[TEST_GROUP], 0, sizeof(eMIOS_Type));
+    icParam.mode = EMIOS_MODE_IPWM;
+    icParam.timebase = EMIOS_BUS_SEL_A;
+    icParam.filterInput = EMIOS_INPUT_FILTER_BYPASS;
+    icParam.filterEn = false;
+    icParam.inputCaptureMode = EMIOS_TRIGGER_EDGE_RISING;
+
+    /* The timebase must be a counter in up mode */
+    CHECK(EMIOS_DRV_IC_InitInputCaptureMode(TEST_GROUP, TEST_CHANNEL, &icParam) == STATUS_EMIOS_WRONG_CNT_BUS);
+    icParam.inputCaptureMode = EMIOS_TRIGGER_EDGE_ANY;
+    CHECK(EMIOS_DRV_IC_InitInputCaptureMode(TEST_GROUP, TEST_CHANNEL, &icParam) == STATUS_ERROR);
+    icParam.inputCaptureMode = EMIOS_TRIGGER_EDGE_RISING;
+
+    TEST_InitTimebase();
+    CHECK(EMIOS_DRV_IC_InitInputCaptureMode(TEST_GROUP, TEST_CHANNEL, &icParam) == STATUS_SUCCESS);
+
+    eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B = 900U;
+    eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].A = 150U;
+    CHECK(EMIOS_DRV_IC_GetLastMeasurement(TEST_GROUP, TEST_CHANNEL, &value) == STATUS_SUCCESS);
+    CHECK(value == 250U);
+
+    eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B = 150U;
+    eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].A = 900U;
+    CHECK(EMIOS_DRV_IC_GetLastMeasurement(TEST_GROUP, TEST_CHANNEL, &value) == STATUS_SUCCESS);
+    CHECK(value == 750U);
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(void)
+{
+    printf("Capture ring, timebase period %u ticks, ring of %u records, %u records per run:\n",
+           TEST_PERIOD, TEST_RING_LENGTH, TEST_RECORDS);
+    TEST_Runs();
+    TEST_LastMeasurement();
+
+    printf("emios_ic: %u checks, %u failures\n", s_checks, s_failures);
+
+    return (s_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,480 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file host_platform.c
+ *
+ * Host replacements of the eMIOS register blocks and of the eDMA driver, see
+ * host_platform.h. The status registers are plain memory: their write-1-to-clear
+ * bits are not modelled, and a FLAG is only an event passed to the eDMA.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "host_platform.h"
+#include "emios_mc_driver.h"
+#include "emios_hw_access.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Transfer control descriptor of a simulated eDMA channel */
+typedef struct
+{
+    uint32_t saddr;
+    int16_t soff;
+    uint16_t attr;
+    uint32_t nbytes;
+    int32_t slast;
+    uint32_t daddr;
+    int16_t doff;
+    uint16_t citer;
+    int32_t dlastSga;
+    uint16_t biter;
+    uint16_t csr;
+    bool requests;                 /* ERQ */
+    bool interrupt;                /* INT */
+    edma_callback_t callback;
+    void * callbackParam;
+} host_edma_channel_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* eMIOS groups; the eDMA source modulo needs the blocks aligned as on the target */
+static eMIOS_Type s_emiosGroups[EMIOS_NUMBER_GROUP_MAX] __attribute__((aligned(0x4000)));
+
+eMIOS_Type * const eMIOS[EMIOS_NUMBER_GROUP_MAX] = { &s_emiosGroups[0], &s_emiosGroups[1], &s_emiosGroups[2] };
+
+static host_edma_channel_t s_edma[HOST_EDMA_CHANNELS];
+
+bool (*g_hostEdmaLinkHook)(uint8_t virtualChannel) = NULL;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : HOST_EDMA_Channel
+ * Description   : Returns the model of a virtual channel.
+ *
+ *END**************************************************************************/
+static host_edma_channel_t * HOST_EDMA_Channel(uint8_t virtualChannel)
+{
+    DEV_ASSERT(virtualChannel < HOST_EDMA_CHANNELS);
+
+    return &s_edma[virtualChannel];
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : HOST_EDMA_Advance
+ * Description   : Adds an offset to an address, keeping the bits above the
+ * modulo unchanged.
+ *
+ *END**************************************************************************/
+static uint32_t HOST_EDMA_Advance(uint32_t address, int32_t offset, uint32_t modulo)
+{
+    uint32_t mask = (modulo == 0U) ? 0xFFFFFFFFUL : ((1UL << modulo) - 1UL);
+
+    return (address & ~mask) | ((address + (uint32_t)offset) & mask);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : HOST_EDMA_LoadDescriptor
+ * Description   : Scatter/gather: loads the descriptor stored at an address.
+ *
+ *END**************************************************************************/
+static void HOST_EDMA_LoadDescriptor(host_edma_channel_t * channel, uint32_t address)
+{
+    const edma_software_tcd_t * stcd = (const edma_software_tcd_t *)(uintptr_t)address;
+
+    DEV_ASSERT((address & 0x1FUL) == 0U);
+
+    channel->saddr = stcd->SADDR;
+    channel->soff = stcd->SOFF;
+    channel->attr = stcd->ATTR;
+    channel->nbytes = stcd->NBYTES;
+    channel->slast = stcd->SLAST;
+    channel->daddr = stcd->DADDR;
+    channel->doff = stcd->DOFF;
+    channel->citer = stcd->CITER;
+    channel->dlastSga = stcd->DLAST_SGA;
+    channel->biter = stcd->BITER;
+    channel->csr = stcd->CSR;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : HOST_EDMA_Request
+ * Description   : Serves one request: a minor loop of 32-bit transfers, then,
+ * at the end of the major loop, the last adjustments or the reload of the next
+ * descriptor.
+ *
+ *END**************************************************************************/
+static bool HOST_EDMA_Request(uint8_t virtualChannel)
+{
+    host_edma_channel_t * channel = HOST_EDMA_Channel(virtualChannel);
+    uint32_t smod = ((uint32_t)channel->attr & DMA_TCD_ATTR_SMOD_MASK) >> DMA_TCD_ATTR_SMOD_SHIFT;
+    uint32_t dmod = ((uint32_t)channel->attr & DMA_TCD_ATTR_DMOD_MASK) >> DMA_TCD_ATTR_DMOD_SHIFT;
+    uint16_t csr = channel->csr;
+    uint32_t byte;
+
+    if (!channel->requests)
+    {
+        return false;
+    }
+
+    DEV_ASSERT(((channel->nbytes % 4U) == 0U) && (channel->citer > 0U));
+    for (byte = 0U; byte < channel->nbytes; byte += 4U)
+    {
+        *(volatile uint32_t *)(uintptr_t)channel->daddr = *(const volatile uint32_t *)(uintptr_t)channel->saddr;
+        channel->saddr = HOST_EDMA_Advance(channel->saddr, channel->soff, smod);
+        channel->daddr = HOST_EDMA_Advance(channel->daddr, channel->doff, dmod);
+    }
+
+    channel->citer--;
+    if (((csr & DMA_TCD_CSR_INTHALF_MASK) != 0U) && (channel->citer == (channel->biter / 2U)))
+    {
+        channel->interrupt = true;
+    }
+
+    if (channel->citer == 0U)
+    {
+        if ((csr & DMA_TCD_CSR_ESG_MASK) != 0U)
+        {
+            HOST_EDMA_LoadDescriptor(channel, (uint32_t)channel->dlastSga);
+        }
+        else
+        {
+            channel->saddr += (uint32_t)channel->slast;
+            channel->daddr += (uint32_t)channel->dlastSga;
+            channel->citer = channel->biter;
+        }
+
+        channel->interrupt = channel->interrupt || ((csr & DMA_TCD_CSR_INTMAJOR_MASK) != 0U);
+        if ((csr & DMA_TCD_CSR_DREQ_MASK) != 0U)
+        {
+            channel->requests = false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+ * Simulation API
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : HOST_EMIOS_SetFlag
+ * Description   : Passes the FLAG to the eDMA if the channel routes it there.
+ *
+ *END**************************************************************************/
+bool HOST_EMIOS_SetFlag(uint8_t emiosGroup, uint8_t channel, uint8_t dmaVirtualChannel)
+{
+    uint32_t control = eMIOS[emiosGroup]->UC[channel].C;
+
+    if (((control & eMIOS_C_DMA_MASK) == 0U) || ((control & eMIOS_C_FEN_MASK) == 0U))
+    {
+        return false;
+    }
+
+    return HOST_EDMA_Request(dmaVirtualChannel);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : HOST_EDMA_ServiceInterrupt
+ * Description   : Clears the interrupt flag and invokes the channel callback.
+ *
+ *END**************************************************************************/
+bool HOST_EDMA_ServiceInterrupt(uint8_t virtualChannel)
+{
+    host_edma_channel_t * channel = HOST_EDMA_Channel(virtualChannel);
+
+    if (!channel->interrupt)
+    {
+        return false;
+    }
+
+    channel->interrupt = false;
+    if (channel->callback != NULL)
+    {
+        channel->callback(channel->callbackParam, EDMA_CHN_NORMAL);
+    }
+
+    return true;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : HOST_EDMA_RequestsEnabled
+ * Description   : Returns the ERQ bit of the channel.
+ *
+ *END**************************************************************************/
+bool HOST_EDMA_RequestsEnabled(uint8_t virtualChannel)
+{
+    return HOST_EDMA_Channel(virtualChannel)->requests;
+}
+
+/*******************************************************************************
+ * Replacements of the platform drivers
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_ClrFlagState
+ * Description   : Writes the FLAG clear, as the driver of emios_common.c.
+ *
+ *END**************************************************************************/
+void EMIOS_DRV_ClrFlagState(uint8_t emiosGroup,
+                            uint8_t channel)
+{
+    uint8_t restChannel = 0U;
+
+    (void)EMIOS_ValidateChannel(channel, &restChannel);
+    EMIOS_SetUCRegSFlag(emiosGroup, restChannel);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_MC_GetCounterPeriod
+ * Description   : Returns the A register of a counter in MC or MCB up mode, as
+ * the driver of emios_mc_driver.c, which does not build in this project.
+ *
+ *END**************************************************************************/
+uint32_t EMIOS_DRV_MC_GetCounterPeriod(uint8_t emiosGroup,
+                                       uint8_t channel)
+{
+    uint8_t restChannel = 0U;
+    uint32_t mode;
+
+    (void)EMIOS_ValidateChannel(channel, &restChannel);
+    mode = EMIOS_GetUCRegCMode(emiosGroup, restChannel);
+
+    return (((mode & EMIOS_FILTER_MC) == EMIOS_MASK_MC_UP) || ((mode & EMIOS_FILTER_MCB) == EMIOS_MASK_MCB_UP))
+           ? EMIOS_GetUCRegA(emiosGroup, restChannel) : 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_PushConfigToSTCD
+ * Description   : Writes a descriptor to memory, as the eDMA driver.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_PushConfigToSTCD(const edma_transfer_config_t *config,
+                               edma_software_tcd_t *stcd)
+{
+    stcd->ATTR = (uint16_t)(DMA_TCD_ATTR_SMOD(config->srcModulo) | DMA_TCD_ATTR_SSIZE(config->srcTransferSize) |
+                            DMA_TCD_ATTR_DMOD(config->destModulo) | DMA_TCD_ATTR_DSIZE(config->destTransferSize));
+    stcd->SADDR = config->srcAddr;
+    stcd->SOFF = config->srcOffset;
+    stcd->NBYTES = config->minorByteTransferCount;
+    stcd->SLAST = config->srcLastAddrAdjust;
+    stcd->DADDR = config->destAddr;
+    stcd->DOFF = config->destOffset;
+    stcd->CITER = (uint16_t)config->loopTransferConfig->majorLoopIterationCount;
+    stcd->DLAST_SGA = config->scatterGatherEnable ? (int32_t)config->scatterGatherNextDescAddr
+                                                  : config->destLastAddrAdjust;
+    stcd->CSR = (uint16_t)((config->interruptEnable ? DMA_TCD_CSR_INTMAJOR_MASK : 0U) |
+                           (config->scatterGatherEnable ? DMA_TCD_CSR_ESG_MASK : 0U));
+    stcd->BITER = (uint16_t)config->loopTransferConfig->majorLoopIterationCount;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_ConfigLoopTransfer
+ * Description   : Writes the descriptor to the channel registers.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_ConfigLoopTransfer(uint8_t virtualChannel,
+                                     const edma_transfer_config_t *transferConfig)
+{
+    host_edma_channel_t * channel = HOST_EDMA_Channel(virtualChannel);
+    edma_software_tcd_t stcd;
+
+    DEV_ASSERT((transferConfig->srcModulo == EDMA_MODULO_OFF) ||
+               ((transferConfig->srcAddr % (1UL << (uint32_t)transferConfig->srcModulo)) == 0U));
+    DEV_ASSERT((transferConfig->srcTransferSize == EDMA_TRANSFER_SIZE_4B) &&
+               (transferConfig->destTransferSize == EDMA_TRANSFER_SIZE_4B));
+
+    EDMA_DRV_PushConfigToSTCD(transferConfig, &stcd);
+    channel->saddr = stcd.SADDR;
+    channel->soff = stcd.SOFF;
+    channel->attr = stcd.ATTR;
+    channel->nbytes = stcd.NBYTES;
+    channel->slast = stcd.SLAST;
+    channel->daddr = stcd.DADDR;
+    channel->doff = stcd.DOFF;
+    channel->citer = stcd.CITER;
+    channel->dlastSga = stcd.DLAST_SGA;
+    channel->biter = stcd.BITER;
+    channel->csr = stcd.CSR;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_ConfigureInterrupt
+ * Description   : Sets the half or major loop interrupt enable of the channel.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_ConfigureInterrupt(uint8_t virtualChannel,
+                                 edma_channel_interrupt_t intSrc,
+                                 bool enable)
+{
+    host_edma_channel_t * channel = HOST_EDMA_Channel(virtualChannel);
+    uint16_t mask = 0U;
+
+    if (intSrc == EDMA_CHN_HALF_MAJOR_LOOP_INT)
+    {
+        mask = (uint16_t)DMA_TCD_CSR_INTHALF_MASK;
+    }
+    else if (intSrc == EDMA_CHN_MAJOR_LOOP_INT)
+    {
+        mask = (uint16_t)DMA_TCD_CSR_INTMAJOR_MASK;
+    }
+    else
+    {
+        /* Error interrupts are not simulated */
+    }
+    channel->csr = enable ? (uint16_t)(channel->csr | mask) : (uint16_t)(channel->csr & ~mask);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_DisableRequestsOnTransferComplete
+ * Description   : Sets the DREQ bit of the channel.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_DisableRequestsOnTransferComplete(uint8_t virtualChannel,
+                                                bool disable)
+{
+    host_edma_channel_t * channel = HOST_EDMA_Channel(virtualChannel);
+
+    channel->csr = disable ? (uint16_t)(channel->csr | DMA_TCD_CSR_DREQ_MASK)
+                           : (uint16_t)(channel->csr & ~DMA_TCD_CSR_DREQ_MASK);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_SetScatterGatherLink
+ * Description   : Writes the address of the next descriptor, unless the hook
+ * of the test drops the write.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_SetScatterGatherLink(uint8_t virtualChannel,
+                                   uint32_t nextTCDAddr)
+{
+    if ((g_hostEdmaLinkHook == NULL) || !g_hostEdmaLinkHook(virtualChannel))
+    {
+        HOST_EDMA_Channel(virtualChannel)->dlastSga = (int32_t)nextTCDAddr;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_SetDestAddr
+ * Description   : Sets the destination address of the channel.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_SetDestAddr(uint8_t virtualChannel,
+                          uint32_t address)
+{
+    HOST_EDMA_Channel(virtualChannel)->daddr = address;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_SetMajorLoopIterationCount
+ * Description   : Sets the current and beginning major loop counts.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_SetMajorLoopIterationCount(uint8_t virtualChannel,
+                                         uint32_t majorLoopCount)
+{
+    host_edma_channel_t * channel = HOST_EDMA_Channel(virtualChannel);
+
+    channel->citer = (uint16_t)majorLoopCount;
+    channel->biter = (uint16_t)majorLoopCount;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_GetRemainingMajorIterationsCount
+ * Description   : Returns the current major loop count.
+ *
+ *END**************************************************************************/
+uint32_t EDMA_DRV_GetRemainingMajorIterationsCount(uint8_t virtualChannel)
+{
+    return HOST_EDMA_Channel(virtualChannel)->citer;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_InstallCallback
+ * Description   : Records the channel callback.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_InstallCallback(uint8_t virtualChannel,
+                                  edma_callback_t callback,
+                                  void *parameter)
+{
+    host_edma_channel_t * channel = HOST_EDMA_Channel(virtualChannel);
+
+    channel->callback = callback;
+    channel->callbackParam = parameter;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_StartChannel
+ * Description   : Enables the requests.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_StartChannel(uint8_t virtualChannel)
+{
+    HOST_EDMA_Channel(virtualChannel)->requests = true;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_StopChannel
+ * Description   : Disables the requests.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_StopChannel(uint8_t virtualChannel)
+{
+    HOST_EDMA_Channel(virtualChannel)->requests = false;
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "edma_driver.h"
+#include "emios_common.h"
+
+/*!
+ * @file host_platform.h
+ *
+ * eMIOS registers and eDMA channels simulated on the host, under the drivers
+ * of testPWM_Z4_0 compiled unchanged.
+ *
+ * The eMIOS groups are plain register blocks: the tests write the captures and
+ * counters a channel would hold and raise its FLAG. A FLAG routed to the eDMA
+ * (DMA and FEN set) is served at once by the eDMA model, which clears it.
+ *
+ * The eDMA model runs the transfer control descriptor of each virtual channel as
+ * the hardware does: minor loops with offsets and modulo, major loop completion
+ * with the last adjustments or the scatter/gather reload of the next descriptor
+ * from memory, half and major loop interrupt flags and DREQ. Interrupts are only
+ * delivered by HOST_EDMA_ServiceInterrupt(), so a test chooses their latency;
+ * a completion while the flag is set is merged with it, as on the target.
+ *
+ * The drivers hand 32-bit addresses to the eDMA. The tests are linked as position
+ * dependent executables, so their static data is below 4 GB and the addresses
+ * are those of the host.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of simulated eDMA virtual channels */
+#define HOST_EDMA_CHANNELS    4U
+
+/*!
+ * @brief Hook called on entry of EDMA_DRV_SetScatterGatherLink(), before the link
+ * is written to the channel; lets a test serve requests at that point. Returning
+ * true drops the write, as when it lands while the channel reloads a descriptor
+ * at the end of a major loop. NULL by default.
+ */
+extern bool (*g_hostEdmaLinkHook)(uint8_t virtualChannel);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*!
+ * @brief Raises the FLAG of a unified channel
+ *
+ * If the FLAG is routed to the eDMA, one request of the eDMA virtual channel is served
+ * and the FLAG is cleared. Otherwise a FLAG still set is reported as an overrun.
+ *
+ * @param[in] emiosGroup        eMIOS group.
+ * @param[in] channel           Unified channel.
+ * @param[in] dmaVirtualChannel eDMA virtual channel serving the channel requests.
+ *
+ * @return True if a request was served.
+ */
+bool HOST_EMIOS_SetFlag(uint8_t emiosGroup, uint8_t channel, uint8_t dmaVirtualChannel);
+
+/*!
+ * @brief Delivers the interrupt of an eDMA virtual channel, if its flag is set
+ *
+ * @param[in] virtualChannel eDMA virtual channel.
+ *
+ * @return True if the channel callback was invoked.
+ */
+bool HOST_EDMA_ServiceInterrupt(uint8_t virtualChannel);
+
+/*!
+ * @brief Tells whether the requests of an eDMA virtual channel are enabled
+ *
+ * @param[in] virtualChannel eDMA virtual channel.
+ *
+ * @return True if the requests are enabled.
+ */
+bool HOST_EDMA_RequestsEnabled(uint8_t virtualChannel);
+
+#endif /* HOST_PLATFORM_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
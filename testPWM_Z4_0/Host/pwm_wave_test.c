@@ -0,0 +1,561 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file pwm_wave_test.c
+ *
+ * Host unit tests of the PWM waveform player.
+ *
+ *   make test     plays tables on a channel in OPWMB mode through the eDMA model
+ *                 of host_platform.c, one request per PWM period, and compares
+ *                 each value written to the B register with a reference player:
+ *                 - loop mode, with tables swapped at random periods; the swap
+ *                   call is made to end a pass between its write of the link in
+ *                   memory and its write to the channel, at random, and that
+ *                   write to be overwritten by the descriptor reload. The played
+ *                   sequence must be whole passes of the old table then of the
+ *                   new one, switching at the first pass end after the call
+ *                   returns, with one PWM_WAVE_EVENT_SWAPPED per swap, reported
+ *                   after the first pass over the new table, and STATUS_BUSY
+ *                   while a swap is pending;
+ *                 - one-shot mode: the table played once, then the requests
+ *                   disabled, the last duty cycle kept and one DONE event;
+ *                 - ping-pong mode: each half refilled by the callback when
+ *                   reported, and played with its new values on the next lap;
+ *                 - PWM_WAVE_BuildTable() clamping and
+ *                   PWM_WAVE_BuildDitherTable(): a mean within 0.5 / count tick
+ *                   of the target, and increasing with the target.
+ *                 The eDMA interrupt is served from 0 to one pass (ping-pong:
+ *                 one half) minus one period late.
+ *   make bench    same as make test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pwm_wave.h"
+#include "emios_mc_driver.h"
+#include "emios_pwm_driver.h"
+#include "emios_hw_access.h"
+#include "host_platform.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_GROUP          0U
+#define TEST_CHANNEL        0U
+#define TEST_TIMEBASE       23U
+#define TEST_DMA_CHANNEL    1U
+
+/* Timebase period, in ticks */
+#define TEST_PERIOD         1000U
+
+/* Loop mode tables: count and largest length */
+#define TEST_TABLES         4U
+#define TEST_MAX_LENGTH     40U
+
+#define TEST_LOOP_PERIODS   200000U
+#define TEST_PONG_PERIODS   50000U
+#define TEST_PONG_LENGTH    1000U
+
+#define CHECK(cond)    TEST_Check((cond), #cond, __LINE__)
+
+/*! @brief Reference of the loop mode playback */
+typedef struct
+{
+    const uint32_t * table;        /* Table being played */
+    uint32_t length;
+    uint32_t position;             /* Next entry */
+    const uint32_t * queued;       /* Swapped table, played from the next pass end */
+    uint32_t queuedLength;
+    bool swapPending;              /* Until PWM_WAVE_EVENT_SWAPPED */
+    uint32_t irqCountdown;         /* Periods until the eDMA interrupt is served, when irqDue */
+    bool irqDue;
+    uint32_t swaps;
+    uint32_t swapEvents;
+    uint32_t lateSwaps;            /* Swaps with a pass ended during the call */
+} test_loop_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_failures = 0U;
+static uint32_t s_checks = 0U;
+static uint32_t s_seed = 2019U;
+
+static pwm_wave_state_t s_state;
+static uint32_t s_tables[TEST_TABLES][TEST_MAX_LENGTH];
+static uint32_t s_lengths[TEST_TABLES];
+static test_loop_t s_loop;
+static uint32_t s_pongTable[TEST_PONG_LENGTH];
+
+/* Events reported by the callback */
+static uint32_t s_eventCount;
+static pwm_wave_event_t s_event;
+static uint32_t s_eventFirst;
+static uint32_t s_eventLength;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char * text, int line)
+{
+    s_checks++;
+    if (!cond)
+    {
+        s_failures++;
+        printf("FAIL line %d: %s\n", line, text);
+    }
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* Channel in OPWMB mode on counter bus A, driven by the timebase in MC up mode */
+static void TEST_InitChannels(uint32_t period)
+{
+    (void)memset(eMIOS[TEST_GROUP], 0, sizeof(eMIOS_Type));
+    eMIOS[TEST_GROUP]->UC[TEST_TIMEBASE].C = eMIOS_C_MODE(EMIOS_MODE_MC_UP_CNT_CLR_START_INT_CLK);
+    eMIOS[TEST_GROUP]->UC[TEST_TIMEBASE].A = period;
+    eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].C = eMIOS_C_MODE(EMIOS_MODE_OPWMB_FLAGX1) | eMIOS_C_BSL(EMIOS_BUS_SEL_A);
+}
+
+static void TEST_Callback(uint32_t first, uint32_t count, pwm_wave_event_t event, void * userData)
+{
+    CHECK(userData == &s_state);
+    s_eventCount++;
+    s_event = event;
+    s_eventFirst = first;
+    s_eventLength = count;
+}
+
+static void TEST_InitPlayer(pwm_wave_mode_t mode, const uint32_t * table, uint32_t length)
+{
+    pwm_wave_user_config_t config;
+
+    config.emiosGroup = TEST_GROUP;
+    config.channel = TEST_CHANNEL;
+    config.dmaVirtualChannel = TEST_DMA_CHANNEL;
+    config.mode = mode;
+    config.table = table;
+    config.tableLength = length;
+    config.callback = TEST_Callback;
+    config.callbackParam = &s_state;
+
+    s_eventCount = 0U;
+    CHECK(PWM_WAVE_Init(&s_state, &config) == STATUS_SUCCESS);
+}
+
+/* One PWM period: the trailing edge match raises the FLAG; returns the B register */
+static uint32_t TEST_Period(void)
+{
+    eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B = 0U;
+    (void)HOST_EMIOS_SetFlag(TEST_GROUP, TEST_CHANNEL, TEST_DMA_CHANNEL);
+
+    return eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B;
+}
+
+/*******************************************************************************
+ * Loop mode
+ ******************************************************************************/
+
+static void TEST_FillTable(uint32_t idx)
+{
+    uint32_t entry;
+
+    s_lengths[idx] = 1U + (TEST_Random() % TEST_MAX_LENGTH);
+    for (entry = 0U; entry < s_lengths[idx]; entry++)
+    {
+        s_tables[idx][entry] = 1U + (TEST_Random() % (TEST_PERIOD - 1U));
+    }
+}
+
+/* One period in loop mode, checked against the reference */
+static void TEST_LoopPeriod(void)
+{
+    test_loop_t * ref = &s_loop;
+    uint32_t value = TEST_Period();
+
+    CHECK(value == ref->table[ref->position]);
+    ref->position++;
+    if (ref->position == ref->length)
+    {
+        ref->position = 0U;
+        if (ref->queued != NULL)
+        {
+            ref->table = ref->queued;
+            ref->length = ref->queuedLength;
+            ref->queued = NULL;
+        }
+        else if (ref->swapPending && !ref->irqDue)
+        {
+            /* First pass over the new table: served before the next pass ends */
+            ref->irqDue = true;
+            ref->irqCountdown = TEST_Random() % ref->length;
+        }
+        else
+        {
+            /* Nothing to report */
+        }
+    }
+}
+
+/* Called by the swap between its two writes of the link: ends the pass, and
+ * drops the write to the channel half of the time, as the reload of the
+ * descriptor can overwrite it */
+static bool TEST_LinkHook(uint8_t virtualChannel)
+{
+    CHECK(virtualChannel == TEST_DMA_CHANNEL);
+    s_loop.lateSwaps++;
+    do
+    {
+        TEST_LoopPeriod();
+    } while (s_loop.position != 0U);
+
+    return ((TEST_Random() % 2U) == 0U);
+}
+
+static void TEST_ServeInterrupt(void)
+{
+    test_loop_t * ref = &s_loop;
+    uint32_t events = s_eventCount;
+
+    if (ref->irqDue && (ref->irqCountdown == 0U))
+    {
+        ref->irqDue = false;
+        ref->swapPending = false;
+        CHECK(HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+        CHECK(s_eventCount == (events + 1U));
+        CHECK(s_event == PWM_WAVE_EVENT_SWAPPED);
+        CHECK((s_eventFirst == 0U) && (s_eventLength == ref->length));
+        ref->swapEvents++;
+    }
+    else if (ref->irqDue)
+    {
+        ref->irqCountdown--;
+    }
+    else
+    {
+        /* No interrupt other than the one of the first pass over a swapped table */
+        CHECK(!HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+        CHECK(s_eventCount == events);
+    }
+}
+
+static void TEST_Loop(void)
+{
+    test_loop_t * ref = &s_loop;
+    uint32_t period;
+    uint32_t idx;
+    status_t status;
+
+    for (idx = 0U; idx < TEST_TABLES; idx++)
+    {
+        TEST_FillTable(idx);
+    }
+
+    TEST_InitChannels(TEST_PERIOD);
+    TEST_InitPlayer(PWM_WAVE_MODE_LOOP, s_tables[0], s_lengths[0]);
+    (void)memset(ref, 0, sizeof(*ref));
+    ref->table = s_tables[0];
+    ref->length = s_lengths[0];
+    CHECK(PWM_WAVE_Start(&s_state) == STATUS_SUCCESS);
+    CHECK(PWM_WAVE_Start(&s_state) == STATUS_BUSY);
+    CHECK(PWM_WAVE_SwapTable(&s_state, s_tables[0], s_lengths[0]) == STATUS_SUCCESS);
+    ref->queued = s_tables[0];
+    ref->queuedLength = s_lengths[0];
+    ref->swapPending = true;
+    ref->swaps++;
+
+    for (period = 0U; period < TEST_LOOP_PERIODS; period++)
+    {
+        TEST_LoopPeriod();
+        TEST_ServeInterrupt();
+
+        if ((TEST_Random() % 16U) != 0U)
+        {
+            continue;
+        }
+
+        /* Swap to a table which is not played, refilled; the played one stays valid */
+        idx = TEST_Random() % TEST_TABLES;
+        if ((s_tables[idx] != ref->table) && (s_tables[idx] != ref->queued))
+        {
+            TEST_FillTable(idx);
+        }
+        g_hostEdmaLinkHook = ((TEST_Random() % 4U) == 0U) ? TEST_LinkHook : NULL;
+        status = PWM_WAVE_SwapTable(&s_state, s_tables[idx], s_lengths[idx]);
+        g_hostEdmaLinkHook = NULL;
+        if (ref->swapPending)
+        {
+            CHECK(status == STATUS_BUSY);
+        }
+        else
+        {
+            CHECK(status == STATUS_SUCCESS);
+            ref->queued = s_tables[idx];
+            ref->queuedLength = s_lengths[idx];
+            ref->swapPending = true;
+            ref->swaps++;
+        }
+    }
+
+    /* Last swap reported */
+    while (ref->swapPending)
+    {
+        TEST_LoopPeriod();
+        TEST_ServeInterrupt();
+    }
+    CHECK(ref->swapEvents == ref->swaps);
+
+    /* Stop drops a pending swap; Start plays the last table given from its start */
+    CHECK(PWM_WAVE_SwapTable(&s_state, s_tables[0], s_lengths[0]) == STATUS_SUCCESS);
+    CHECK(PWM_WAVE_Stop(&s_state) == STATUS_SUCCESS);
+    CHECK(!HOST_EDMA_RequestsEnabled(TEST_DMA_CHANNEL));
+    CHECK(PWM_WAVE_SwapTable(&s_state, s_tables[1], s_lengths[1]) == STATUS_SUCCESS);
+    CHECK(PWM_WAVE_Start(&s_state) == STATUS_SUCCESS);
+    for (idx = 0U; idx < (2U * s_lengths[1]); idx++)
+    {
+        CHECK(TEST_Period() == s_tables[1][idx % s_lengths[1]]);
+        CHECK(!HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+    }
+    CHECK(PWM_WAVE_Deinit(&s_state) == STATUS_SUCCESS);
+    CHECK(!HOST_EMIOS_SetFlag(TEST_GROUP, TEST_CHANNEL, TEST_DMA_CHANNEL));
+
+    CHECK(ref->lateSwaps > 0U);
+    printf("  loop     : %u periods, %u swaps, %u with a pass ended during the call\n",
+           TEST_LOOP_PERIODS, ref->swaps, ref->lateSwaps);
+}
+
+/*******************************************************************************
+ * One-shot mode
+ ******************************************************************************/
+
+static void TEST_OneShot(void)
+{
+    uint32_t pass;
+    uint32_t idx;
+
+    TEST_FillTable(0U);
+    TEST_FillTable(1U);
+    TEST_InitChannels(TEST_PERIOD);
+    TEST_InitPlayer(PWM_WAVE_MODE_ONE_SHOT, s_tables[0], s_lengths[0]);
+
+    for (pass = 0U; pass < 2U; pass++)
+    {
+        CHECK(PWM_WAVE_Start(&s_state) == STATUS_SUCCESS);
+        CHECK(PWM_WAVE_SwapTable(&s_state, s_tables[1], s_lengths[1]) == STATUS_BUSY);
+        for (idx = 0U; idx < s_lengths[pass]; idx++)
+        {
+            CHECK(TEST_Period() == s_tables[pass][idx]);
+        }
+        CHECK(!HOST_EDMA_RequestsEnabled(TEST_DMA_CHANNEL));
+        CHECK(HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+        CHECK((s_eventCount == (pass + 1U)) && (s_event == PWM_WAVE_EVENT_DONE));
+        CHECK((s_eventFirst == 0U) && (s_eventLength == s_lengths[pass]));
+
+        /* The last duty cycle is kept: no further request */
+        eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B = s_tables[pass][s_lengths[pass] - 1U];
+        CHECK(!HOST_EMIOS_SetFlag(TEST_GROUP, TEST_CHANNEL, TEST_DMA_CHANNEL));
+        CHECK(eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].B == s_tables[pass][s_lengths[pass] - 1U]);
+        CHECK(!HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+
+        /* Stopped: the table can be replaced */
+        CHECK(PWM_WAVE_SwapTable(&s_state, s_tables[1], s_lengths[1]) == STATUS_SUCCESS);
+    }
+    CHECK(PWM_WAVE_Deinit(&s_state) == STATUS_SUCCESS);
+    printf("  one-shot : tables of %u and %u entries\n", s_lengths[0], s_lengths[1]);
+}
+
+/*******************************************************************************
+ * Ping-pong mode
+ ******************************************************************************/
+
+/* Entry idx of the table for its lap-th playback */
+static uint32_t TEST_PongValue(uint32_t lap, uint32_t idx, uint32_t length)
+{
+    return 1U + (((lap * length) + idx) % (TEST_PERIOD - 1U));
+}
+
+static void TEST_PingPong(uint32_t length)
+{
+    uint32_t * table = s_pongTable;
+    uint32_t half = length / 2U;
+    uint32_t period;
+    uint32_t idx;
+    uint32_t irqCountdown = 0U;
+    bool irqDue = false;
+    uint32_t dueFirst = 0U;
+    uint32_t dueLap = 0U;
+    uint32_t events;
+
+    DEV_ASSERT(length <= TEST_PONG_LENGTH);
+
+    for (idx = 0U; idx < length; idx++)
+    {
+        table[idx] = TEST_PongValue(0U, idx, length);
+    }
+    TEST_InitChannels(TEST_PERIOD);
+    TEST_InitPlayer(PWM_WAVE_MODE_PING_PONG, table, length);
+    CHECK(PWM_WAVE_SwapTable(&s_state, table, length) == STATUS_UNSUPPORTED);
+    CHECK(PWM_WAVE_Start(&s_state) == STATUS_SUCCESS);
+
+    for (period = 0U; period < TEST_PONG_PERIODS; period++)
+    {
+        CHECK(TEST_Period() == TEST_PongValue(period / length, period % length, length));
+        if (((period + 1U) % half) == 0U)
+        {
+            /* A half played: served before the other one is */
+            irqDue = true;
+            irqCountdown = TEST_Random() % half;
+            dueFirst = (((period + 1U) % length) == half) ? 0U : half;
+            dueLap = period / length;
+        }
+
+        events = s_eventCount;
+        if (irqDue && (irqCountdown == 0U))
+        {
+            irqDue = false;
+            CHECK(HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+            CHECK(s_eventCount == (events + 1U));
+            /* The half just played is refilled for the next lap */
+            CHECK((s_eventFirst == dueFirst) && (s_eventLength == half));
+            CHECK(s_event == ((dueFirst == 0U) ? PWM_WAVE_EVENT_HALF : PWM_WAVE_EVENT_FULL));
+            for (idx = dueFirst; idx < (dueFirst + half); idx++)
+            {
+                table[idx] = TEST_PongValue(dueLap + 1U, idx, length);
+            }
+        }
+        else if (irqDue)
+        {
+            irqCountdown--;
+        }
+        else
+        {
+            CHECK(!HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL));
+            CHECK(s_eventCount == events);
+        }
+    }
+    CHECK(PWM_WAVE_Stop(&s_state) == STATUS_SUCCESS);
+    CHECK(HOST_EDMA_ServiceInterrupt(TEST_DMA_CHANNEL) == irqDue);
+    CHECK(PWM_WAVE_Deinit(&s_state) == STATUS_SUCCESS);
+    printf("  ping-pong: %u periods, table of %u entries\n", TEST_PONG_PERIODS, length);
+}
+
+/*******************************************************************************
+ * Tables
+ ******************************************************************************/
+
+static void TEST_BuildTables(void)
+{
+    static const uint32_t periods[] = { 2U, 200U, 1000U, 65535U };
+    static const uint32_t counts[] = { 1U, 2U, 3U, 16U, 255U, 256U, 1000U };
+    static uint32_t duties[1000U];
+    static uint32_t table[1000U];
+    uint32_t periodIdx;
+    uint32_t countIdx;
+    uint32_t period;
+    uint32_t count;
+    uint32_t idx;
+    uint32_t duty;
+    uint64_t sum;
+    uint64_t previousSum;
+    double target;
+    double mean;
+
+    /* Not in OPWMB mode */
+    TEST_InitChannels(TEST_PERIOD);
+    eMIOS[TEST_GROUP]->UC[TEST_CHANNEL].C = eMIOS_C_MODE(EMIOS_MODE_MC_UP_CNT_CLR_START_INT_CLK);
+    CHECK(PWM_WAVE_BuildTable(TEST_GROUP, TEST_CHANNEL, duties, table, 1U) == STATUS_ERROR);
+    CHECK(PWM_WAVE_BuildDitherTable(TEST_GROUP, TEST_CHANNEL, 0x8000U, table, 1U) == STATUS_ERROR);
+
+    for (periodIdx = 0U; periodIdx < (sizeof(periods) / sizeof(periods[0])); periodIdx++)
+    {
+        period = periods[periodIdx];
+        TEST_InitChannels(period);
+
+        /* Duty cycles in ticks, clamped to the period minus one */
+        for (idx = 0U; idx < 1000U; idx++)
+        {
+            duties[idx] = TEST_Random() % (period + 10U);
+        }
+        CHECK(PWM_WAVE_BuildTable(TEST_GROUP, TEST_CHANNEL, duties, table, 1000U) == STATUS_SUCCESS);
+        for (idx = 0U; idx < 1000U; idx++)
+        {
+            CHECK(table[idx] == (((duties[idx] < period) ? duties[idx] : (period - 1U)) + 1U));
+        }
+
+        for (countIdx = 0U; countIdx < (sizeof(counts) / sizeof(counts[0])); countIdx++)
+        {
+            count = counts[countIdx];
+            previousSum = 0U;
+            for (duty = 0U; duty <= 0xFFFFU; duty += 1U + (TEST_Random() % 97U))
+            {
+                CHECK(PWM_WAVE_BuildDitherTable(TEST_GROUP, TEST_CHANNEL, (uint16_t)duty, table, count) ==
+                      STATUS_SUCCESS);
+                target = ((double)duty * (double)period) / 65536.0;
+                sum = 0U;
+                for (idx = 0U; idx < count; idx++)
+                {
+                    /* Whole ticks around the target, clamped */
+                    CHECK((table[idx] >= 1U) && (table[idx] <= period));
+                    CHECK(((table[idx] - 1U) == (uint32_t)target) || ((table[idx] - 1U) == ((uint32_t)target + 1U)) ||
+                          (table[idx] == period));
+                    sum += table[idx] - 1U;
+                }
+                mean = (double)sum / (double)count;
+                if ((uint32_t)target < (period - 1U))
+                {
+                    CHECK((mean - target) <= (0.5 / (double)count) + 1e-9);
+                    CHECK((target - mean) <= (0.5 / (double)count) + 1e-9);
+                }
+                CHECK(sum >= previousSum);
+                previousSum = sum;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(void)
+{
+    printf("Waveform player, timebase period %u ticks:\n", TEST_PERIOD);
+    TEST_Loop();
+    TEST_OneShot();
+    TEST_PingPong(2U);
+    TEST_PingPong(64U);
+    TEST_PingPong(TEST_PONG_LENGTH);
+    TEST_BuildTables();
+
+    printf("pwm_wave: %u checks, %u failures\n", s_checks, s_failures);
+
+    return (s_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
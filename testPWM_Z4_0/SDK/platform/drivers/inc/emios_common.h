@@ -383,6 +383,30 @@ void EMIOS_DRV_DisableOutputUpdate(uint8_t emiosGroup,
 void EMIOS_DRV_EnableAChOutputUpdate(uint8_t emiosGroup,
                                      uint8_t channel);
 
+/*!
+ * @brief Disable the output update of several channels at once
+ *
+ * The A and B registers of the channels can then be written without the new values
+ * reaching the output; they are all transferred on the next period boundary after
+ * EMIOS_DRV_EnableOutputUpdateMask().
+ *
+ * @param[in] emiosGroup The eMIOS group id
+ * @param[in] channelMask Bit n set selects channel n of this eMIOS group
+ * @return void
+ */
+void EMIOS_DRV_DisableOutputUpdateMask(uint8_t emiosGroup,
+                                       uint32_t channelMask);
+
+/*!
+ * @brief Enable the output update of several channels at once
+ *
+ * @param[in] emiosGroup The eMIOS group id
+ * @param[in] channelMask Bit n set selects channel n of this eMIOS group
+ * @return void
+ */
+void EMIOS_DRV_EnableOutputUpdateMask(uint8_t emiosGroup,
+                                      uint32_t channelMask);
+
 /*!
  * @brief Enable all channels output update
  *
@@ -0,0 +1,364 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+* @file emios_ic_driver.h
+*/
+
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 5.1, identifier clash
+ * The supported compilers use more than 31 significant characters for identifiers.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 5.2, identifier clash
+ * The supported compilers use more than 31 significant characters for identifiers.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 5.4, identifier clash
+ * The supported compilers use more than 31 significant characters for identifiers.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 5.5, identifier clash
+ * The supported compilers use more than 31 significant characters for identifiers.
+ *
+ */
+
+#ifndef IC_EMIOS_DRIVER_H
+#define IC_EMIOS_DRIVER_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "emios_common.h"
+#include "edma_driver.h"
+
+/*!
+ * @defgroup ic_emios_driver Input Capture (eMIOS)
+ * @ingroup emios
+ * @brief Input capture, pulse width and period measurement modes.
+ *
+ * The channel captures the counter bus selected by timebase on its input edges:
+ * - SAIC: every selected edge is captured into A;
+ * - IPM: every selected edge is captured into A and the previous one is kept in B,
+ *   so A - B is the period;
+ * - IPWM: the leading edge (selected by inputCaptureMode) is captured into B and the
+ *   trailing edge into A, so A - B is the pulse width. FLAG is set on the trailing edge.
+ *
+ * The timebase must be a channel in MC or MCB up counting mode. Capture values are taken
+ * modulo its period: an interval is only exact if it is shorter than one period of the
+ * timebase, as a wrap of the counter between two edges cannot be seen in the captures.
+ * A capture ring can count the wraps instead (countTimebaseWraps): the application then
+ * enables the interrupt of the timebase channel FLAG, set at each wrap, and calls
+ * EMIOS_DRV_IC_TimebaseWrapHandler() from its handler. The wraps are added to the
+ * intervals between edges, which can then span any number of timebase periods; a pulse
+ * width in IPWM mode must still be shorter than one period.
+ *
+ * For high edge rates the channel FLAG can be routed to an eDMA channel which copies each
+ * capture (A, or A then B) into a ring buffer, without CPU involvement per edge. The ring
+ * is then evaluated by EMIOS_DRV_IC_Measure() over a given number of edges; consecutive
+ * intervals are accumulated into a 32-bit timeline, extending the 16/24-bit captures.
+ *
+ * CPU load estimate, for a 100 kHz edge rate on a 160 MHz e200z4 (cycle counts estimated
+ * from the code paths, not measured on target):
+ * - one interrupt per edge, with the SDK interrupt dispatch and a handler reading A/B and
+ *   clearing FLAG, costs in the order of 150-250 cycles, i.e. 15-25 Mcycles/s, 10-15 % of
+ *   the core, and misses edges as soon as another interrupt delays it by one edge period;
+ * - with the DMA ring, the eDMA takes one request per edge (two 32-bit reads and writes
+ *   for IPWM/IPM) and interrupts once per pass over the ring: 391 interrupts/s with
+ *   256 records. EMIOS_DRV_IC_Measure() costs about 15-20 cycles per record, i.e. 1-2 % of
+ *   the core if every edge is evaluated. Edges only need to be serviced within one ring
+ *   length (2.56 ms for 256 records) instead of one edge period (10 us).
+ * @{
+ */
+
+/*******************************************************************************
+* Definitions
+******************************************************************************/
+#ifndef EMIOS_IC_WRAP_LOG_LENGTH
+/*! @brief Number of timebase wraps at distinct ring positions kept between two
+ * calls to EMIOS_DRV_IC_Measure(); wraps with no edge in between share a position */
+#define EMIOS_IC_WRAP_LOG_LENGTH    16U
+#endif
+
+/*******************************************************************************
+* Variables
+******************************************************************************/
+/*!
+ * @brief Input capture modes
+ * Implements : emios_input_capture_mode_t_Class
+ */
+typedef enum
+{
+    EMIOS_MODE_IC                                = 0x02U,     /*!< Single Action Input Capture */
+    EMIOS_MODE_IPWM                              = 0x04U,     /*!< Input Pulse Width Measurement */
+    EMIOS_MODE_IPM                               = 0x05U      /*!< Input Period Measurement */
+} emios_input_capture_mode_t;
+
+/*!
+ * @brief Input capture configuration parameters structure
+ * Implements : emios_input_capture_param_t_Class
+ */
+typedef struct
+{
+    emios_input_capture_mode_t      mode;                     /*!< Sub-mode selected */
+    emios_bus_select_t              timebase;                 /*!< Counter bus captured; not the internal counter */
+    emios_input_filter_t            filterInput;              /*!< Filter Value */
+    bool                            filterEn;                 /*!< Input capture filter state */
+    emios_edge_trigger_mode_t       inputCaptureMode;         /*!< Edge captured; leading edge in IPWM mode, where
+                                                                   EMIOS_TRIGGER_EDGE_ANY is not allowed */
+} emios_input_capture_param_t;
+
+/*!
+ * @brief Capture ring configuration structure
+ *
+ * Each record holds the A register value, followed in IPWM and IPM modes by the
+ * B register value.
+ *
+ * Implements : emios_ic_ring_config_t_Class
+ */
+typedef struct
+{
+    uint8_t                         dmaVirtualChannel;        /*!< eDMA virtual channel, requested by the channel
+                                                                   (EDMA_REQ_eMIOS_x_CH_y) */
+    uint32_t                        *buffer;                  /*!< Ring of bufferLength records */
+    uint32_t                        bufferLength;             /*!< Number of records, at most 0x7FFF */
+    uint32_t                        counterClockHz;           /*!< Frequency of the timebase counter clock, for
+                                                                   EMIOS_DRV_IC_Measure(); can be 0 */
+    bool                            countTimebaseWraps;       /*!< The wraps of the timebase are reported by
+                                                                   EMIOS_DRV_IC_TimebaseWrapHandler() */
+} emios_ic_ring_config_t;
+
+/*!
+ * @brief Result of a measurement over a number of edges
+ *
+ * Tick values are in timebase counter ticks.
+ *
+ * Implements : emios_ic_measurement_t_Class
+ */
+typedef struct
+{
+    uint32_t                        periods;                  /*!< Number of periods measured */
+    uint32_t                        periodTicks;              /*!< Mean period; between two captured edges in
+                                                                   SAIC mode, two leading edges in IPWM mode */
+    uint32_t                        pulseTicks;               /*!< Mean pulse width, IPWM mode only */
+    uint32_t                        dutyQ16;                  /*!< Pulse width over period, 0x10000 for 100 %,
+                                                                   IPWM mode only */
+    uint32_t                        frequencyMilliHz;         /*!< Frequency in mHz; 0 if counterClockHz is 0 */
+    uint32_t                        timestamp;                /*!< 32-bit extended time of the last edge */
+    uint32_t                        lostRecords;              /*!< Records overwritten before they were measured,
+                                                                   since the previous call */
+    bool                            overrun;                  /*!< An edge was captured before the eDMA read the
+                                                                   previous one, since the previous call */
+} emios_ic_measurement_t;
+
+/*!
+ * @brief Runtime state of a capture ring
+ *
+ * The fields are internal to the driver and must not be accessed by the application.
+ *
+ * Implements : emios_ic_ring_state_t_Class
+ */
+typedef struct
+{
+    emios_ic_ring_config_t          config;                   /*!< Ring configuration */
+    uint8_t                         emiosGroup;               /*!< eMIOS group of the channel */
+    uint8_t                         unifiedChannel;           /*!< Unified channel index of the channel */
+    uint8_t                         recordWords;              /*!< 32-bit words per record */
+    bool                            pulseWidth;               /*!< True in IPWM mode */
+    uint8_t                         busChannel;               /*!< Unified channel index of the timebase */
+    uint32_t                        counterPeriod;            /*!< Period of the timebase, in ticks */
+    volatile uint32_t               ringWraps;                /*!< Passes of the eDMA over the ring */
+    uint32_t                        consumed;                 /*!< Records measured or skipped since the start */
+    uint32_t                        readIndex;                /*!< Ring index of the next record to measure */
+    uint32_t                        lastCapture;              /*!< Capture of the last edge measured */
+    uint32_t                        timeline;                 /*!< 32-bit extended time of the last edge measured */
+    bool                            timelineValid;            /*!< An edge has been measured since the start */
+    uint32_t                        lastWraps;                /*!< Timebase wraps before the reference edge of the
+                                                                   last edge measured */
+    uint32_t                        wrapBase;                 /*!< Timebase wraps before the oldest wrap log entry */
+    volatile uint32_t               wrapRecord[EMIOS_IC_WRAP_LOG_LENGTH]; /*!< Wrap log: records written before
+                                                                   the wraps of each entry */
+    volatile uint32_t               wrapCount[EMIOS_IC_WRAP_LOG_LENGTH];  /*!< Wrap log: wraps since the start,
+                                                                   up to each entry */
+    volatile uint32_t               wrapHead;                 /*!< Wrap log entries written */
+    uint32_t                        wrapTail;                 /*!< Wrap log entries dropped */
+    uint32_t                        wraps;                    /*!< Wraps since the start */
+    uint32_t                        wrapFloor;                /*!< Records written at the previous wrap */
+    volatile bool                   wrapLost;                 /*!< A wrap did not fit in the wrap log */
+    volatile bool                   running;                  /*!< True between EMIOS_DRV_IC_StartRing() and
+                                                                   EMIOS_DRV_IC_StopRing() */
+} emios_ic_ring_state_t;
+
+/*******************************************************************************
+* API
+******************************************************************************/
+/*!
+ * @name eMIOS DRIVER API
+ * @{
+ */
+
+/*!
+ * @brief Initialize eMIOS input capture mode
+ *
+ * @param[in] emiosGroup The eMIOS group id
+ * @param[in] channel The channel in this eMIOS group
+ * @param[in] icParam A pointer to the input capture configuration structure
+ * @return operation status
+ *        - STATUS_SUCCESS             :  Operation was successful.
+ *        - STATUS_ERROR               :  Operation failed, invalid input value.
+ *        - STATUS_EMIOS_WRONG_CNT_BUS :  The timebase is not a counter bus in MC or MCB up mode.
+ */
+status_t EMIOS_DRV_IC_InitInputCaptureMode(uint8_t emiosGroup,
+                                           uint8_t channel,
+                                           const emios_input_capture_param_t *icParam);
+
+/*!
+ * @brief Get the last measurement
+ *
+ * Returns A - B modulo the timebase period in IPWM and IPM modes (pulse width or period),
+ * the capture of the last edge in SAIC mode. The channel FLAG is cleared. The value is
+ * wrong if the edges are one timebase period or more apart; longer intervals are
+ * measured with a capture ring counting the timebase wraps.
+ *
+ * @param[in] emiosGroup The eMIOS group id
+ * @param[in] channel The channel in this eMIOS group
+ * @param[out] retValue The measured value, in timebase ticks
+ * @return operation status
+ *        - STATUS_SUCCESS          :  Operation was successful.
+ *        - STATUS_EMIOS_WRONG_MODE :  The channel is not in an input capture mode.
+ */
+status_t EMIOS_DRV_IC_GetLastMeasurement(uint8_t emiosGroup,
+                                         uint8_t channel,
+                                         uint32_t *retValue);
+
+/*!
+ * @brief Initialize the capture ring of an input capture channel
+ *
+ * Configures the eDMA channel as a circular transfer of the captures into the ring and
+ * assigns the channel FLAG to the DMA request. The channel, initialized with
+ * EMIOS_DRV_IC_InitInputCaptureMode(), and the eDMA channel must be initialized before.
+ *
+ * @param[in] emiosGroup The eMIOS group id
+ * @param[in] channel The channel in this eMIOS group
+ * @param[in] config A pointer to the ring configuration structure
+ * @param[out] state A pointer to the ring state structure
+ * @return operation status
+ *        - STATUS_SUCCESS          :  Operation was successful.
+ *        - STATUS_EMIOS_WRONG_MODE :  The channel is not in an input capture mode.
+ *        - STATUS_ERROR            :  The eDMA transfer cannot be configured.
+ */
+status_t EMIOS_DRV_IC_InitRing(uint8_t emiosGroup,
+                               uint8_t channel,
+                               const emios_ic_ring_config_t *config,
+                               emios_ic_ring_state_t *state);
+
+/*!
+ * @brief Start filling the capture ring from its first record
+ *
+ * @param[in] state A pointer to the ring state structure
+ * @return operation status
+ *        - STATUS_SUCCESS :  Operation was successful.
+ *        - STATUS_BUSY    :  The ring is already running.
+ */
+status_t EMIOS_DRV_IC_StartRing(emios_ic_ring_state_t *state);
+
+/*!
+ * @brief Stop filling the capture ring
+ *
+ * @param[in] state A pointer to the ring state structure
+ * @return STATUS_SUCCESS
+ */
+status_t EMIOS_DRV_IC_StopRing(emios_ic_ring_state_t *state);
+
+/*!
+ * @brief De-initialize the capture ring
+ *
+ * Stops the ring and assigns the channel FLAG back to the interrupt request.
+ *
+ * @param[in] state A pointer to the ring state structure
+ * @return STATUS_SUCCESS
+ */
+status_t EMIOS_DRV_IC_DeinitRing(emios_ic_ring_state_t *state);
+
+/*!
+ * @brief Get the number of records written to the ring and not measured yet
+ *
+ * The value can exceed the ring length when records have been overwritten.
+ *
+ * @param[in] state A pointer to the ring state structure
+ * @return Number of records pending
+ */
+uint32_t EMIOS_DRV_IC_GetPendingRecords(const emios_ic_ring_state_t *state);
+
+/*!
+ * @brief Count a wrap of the timebase of a capture ring
+ *
+ * To be called from the interrupt handler of the timebase channel FLAG, which clears the
+ * FLAG, once for each running ring configured with countTimebaseWraps on this timebase.
+ * Records completed between the wrap and the call are recognized by captures not above
+ * the counter, so the handler must run within a small part of a timebase period after
+ * the wrap. An edge captured just after the previous call, within the increase of the
+ * handler latency since that call, is also taken for one after the wrap: the latency
+ * must vary by much less than the time between edges for every wrap to be assigned to
+ * the right interval.
+ *
+ * @param[in] state A pointer to the ring state structure
+ */
+void EMIOS_DRV_IC_TimebaseWrapHandler(emios_ic_ring_state_t *state);
+
+/*!
+ * @brief Measure period, pulse width and frequency over a number of edges
+ *
+ * Consumes the oldest edges records pending in the ring, or returns STATUS_BUSY without
+ * consuming any if fewer are pending. Records overwritten before the call are skipped:
+ * the measurement resumes from the oldest record still in the ring, which only gives a
+ * reference edge, and the timeline continues from it without the time of the lost edges.
+ * The timeline is exact as long as no record is lost and, unless the ring counts the
+ * timebase wraps, consecutive edges are less than one timebase period apart.
+ *
+ * When the ring counts the wraps, the function must be called before
+ * EMIOS_IC_WRAP_LOG_LENGTH wraps have occurred at distinct ring positions. Otherwise the
+ * wraps can no longer be assigned to the edges: the records pending are skipped, the
+ * timeline restarts from the next record and STATUS_ERROR is returned.
+ *
+ * @param[in] state A pointer to the ring state structure
+ * @param[in] edges Number of records to measure, at least 1
+ * @param[out] result A pointer to the measurement result
+ * @return operation status
+ *        - STATUS_SUCCESS :  Operation was successful.
+ *        - STATUS_BUSY    :  Fewer than edges records are pending.
+ *        - STATUS_ERROR   :  Timebase wraps were lost; no measurement.
+ */
+status_t EMIOS_DRV_IC_Measure(emios_ic_ring_state_t *state,
+                              uint32_t edges,
+                              emios_ic_measurement_t *result);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* IC_EMIOS_DRIVER_H */
+/*******************************************************************************
+* EOF
+******************************************************************************/
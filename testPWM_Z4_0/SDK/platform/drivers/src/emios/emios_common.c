@@ -286,6 +286,36 @@ void EMIOS_DRV_InitGlobal(uint8_t emiosGroup,
     eMIOS[emiosGroup]->OUDIS =eMIOS[emiosGroup]->OUDIS & ((uint32_t)( 1UL << channel) ^ 0xFFFFFFFFUL);
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_DisableOutputUpdateMask
+ * Description   : Set Output Update Disable for the channels of the mask in OUDIS
+ * register, with a single write.
+ * Implements    : EMIOS_DRV_DisableOutputUpdateMask_Activity
+ *END**************************************************************************/
+ void EMIOS_DRV_DisableOutputUpdateMask(uint8_t emiosGroup,
+                                        uint32_t channelMask)
+{
+    DEV_ASSERT(emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+
+    eMIOS[emiosGroup]->OUDIS = eMIOS[emiosGroup]->OUDIS | channelMask;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_EnableOutputUpdateMask
+ * Description   : Set Output Update Enable for the channels of the mask in OUDIS
+ * register, with a single write.
+ * Implements    : EMIOS_DRV_EnableOutputUpdateMask_Activity
+ *END**************************************************************************/
+ void EMIOS_DRV_EnableOutputUpdateMask(uint8_t emiosGroup,
+                                       uint32_t channelMask)
+{
+    DEV_ASSERT(emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+
+    eMIOS[emiosGroup]->OUDIS = eMIOS[emiosGroup]->OUDIS & (channelMask ^ 0xFFFFFFFFUL);
+}
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : EMIOS_DRV_EnableAllChOutputUpdate
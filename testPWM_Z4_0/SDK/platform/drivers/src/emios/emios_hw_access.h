@@ -545,6 +545,30 @@ static inline void EMIOS_SetUCRegSFlag(uint8_t emiosGroup,
     REG_RMW32(&eMIOS[emiosGroup]->UC[channel].S, (eMIOS_S_FLAG_MASK & eMIOS_S_OVFL_MASK) & eMIOS_S_OVR_MASK, eMIOS_S_FLAG(1UL));
 }
 
+/*!
+ * brief Get Unified Channel Overrun bit
+ * param[in] emiosGroup The eMIOS group id
+ * param[in] channel The channel in group
+ * return True if Overrun has occurred else overrun has not occurred
+ */
+static inline bool EMIOS_GetUCRegSOverrun(uint8_t emiosGroup,
+                                              uint8_t channel)
+{
+    return ((eMIOS[emiosGroup]->UC[channel].S & eMIOS_S_OVR_MASK) >> eMIOS_S_OVR_SHIFT) != 0U;
+}
+
+/*!
+ * brief Write 1 to clear the OVR bit only
+ * param[in] emiosGroup The eMIOS group id
+ * param[in] channel The channel in group
+ */
+static inline void EMIOS_ClrUCRegSOverrun(uint8_t emiosGroup,
+                                          uint8_t channel)
+{
+    /* The other bits are read-only or cleared by writing 1 */
+    eMIOS[emiosGroup]->UC[channel].S = eMIOS_S_OVR_MASK;
+}
+
 /*!
  * brief Get Unified Channel Output pin bit
  * param[in] emiosGroup The eMIOS group id
@@ -570,18 +594,6 @@ static inline uint32_t EMIOS_GetUCRegSUcin(uint8_t emiosGroup,
 }
 
 #if defined(FEATURE_EMIOS_QD_MODE_SUPPORT)
-/*!
- * brief Get Unified Channel Overrun bit
- * param[in] emiosGroup The eMIOS group id
- * param[in] channel The channel in group
- * return True if Overrun has occurred else overrun has not occurred
- */
-static inline bool EMIOS_GetUCRegSOverrun(uint8_t emiosGroup,
-                                              uint8_t channel)
-{
-    return ((eMIOS[emiosGroup]->UC[channel].S & eMIOS_S_OVR_MASK) >> eMIOS_S_OVR_SHIFT) != 0U;
-}
-
 /*!
  * brief Get Unified Channel Overflow bit
  * param[in] emiosGroup The eMIOS group id
@@ -0,0 +1,817 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.4, Conversion between a pointer and integer type.
+ * The cast is required to pass the register and ring addresses to the eDMA.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.5, Conversion from pointer to void to pointer to other type.
+ * The eDMA callback parameter is the ring state passed at installation.
+ */
+
+#include <stddef.h>
+#include "emios_ic_driver.h"
+#include "emios_mc_driver.h"
+#include "emios_hw_access.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Size of a capture register in a record */
+#define EMIOS_IC_WORD_SIZE          4U
+
+/* Largest ring length (15-bit major loop count) */
+#define EMIOS_IC_MAX_RING_LENGTH    0x7FFFU
+
+/*******************************************************************************
+ * Private API declaration
+ ******************************************************************************/
+/*!
+ * brief Get the channel driving the counter bus captured by an input capture channel
+ *
+ * param[in] emiosGroup The eMIOS group id
+ * param[in] restChannel The unified channel index
+ * param[out] busChannel The unified channel index of the timebase
+ * return True if the timebase is in MC or MCB up mode
+ */
+static bool EMIOS_DRV_IC_GetTimebaseChannel(uint8_t emiosGroup,
+                                            uint8_t restChannel,
+                                            uint8_t *busChannel);
+
+/*!
+ * brief Get the period of the counter bus captured by an input capture channel
+ *
+ * param[in] emiosGroup The eMIOS group id
+ * param[in] restChannel The unified channel index
+ * return Period of the timebase, 0 if it is not in MC or MCB up mode
+ */
+static uint32_t EMIOS_DRV_IC_GetTimebasePeriod(uint8_t emiosGroup,
+                                               uint8_t restChannel);
+
+/*!
+ * brief Check that a unified channel is in one of the input capture modes
+ *
+ * param[in] emiosGroup The eMIOS group id
+ * param[in] restChannel The unified channel index
+ * return True if the channel is in SAIC, IPWM or IPM mode
+ */
+static bool EMIOS_DRV_IC_IsCaptureMode(uint8_t emiosGroup,
+                                       uint8_t restChannel);
+
+/*!
+ * brief Interval from an earlier capture to a later one
+ *
+ * param[in] period Period of the timebase
+ * param[in] later Later capture
+ * param[in] earlier Earlier capture
+ * param[in] wraps Wraps of the timebase between the captures, 0 if not counted
+ * return Interval in ticks
+ */
+static inline uint64_t EMIOS_DRV_IC_Interval(uint32_t period,
+                                             uint32_t later,
+                                             uint32_t earlier,
+                                             uint32_t wraps);
+
+/*!
+ * brief Get the number of records written to the ring since the start
+ *
+ * param[in] state The ring state
+ * return Number of records written, possibly one ring length short while the
+ *        interrupt of a completed pass is pending
+ */
+static uint32_t EMIOS_DRV_IC_GetWrittenRecords(const emios_ic_ring_state_t *state);
+
+/*!
+ * brief Get the number of timebase wraps before a record was written
+ *
+ * param[in] state The ring state
+ * param[in] record Record number since the start
+ * return Wraps since the start
+ */
+static uint32_t EMIOS_DRV_IC_GetWraps(emios_ic_ring_state_t *state,
+                                      uint32_t record);
+
+/*!
+ * brief eDMA callback, invoked at each pass over the ring
+ *
+ * param[in] parameter The ring state
+ * param[in] status The eDMA channel status
+ */
+static void EMIOS_DRV_IC_DmaCallback(void *parameter,
+                                     edma_chn_status_t status);
+
+/*******************************************************************************
+ * Private API
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_GetTimebaseChannel
+ * Description   : Resolves the channel driving the selected counter bus. A down
+ * counting timebase would make the capture intervals ambiguous, so only the MC
+ * and MCB up modes are accepted.
+ *
+ *END**************************************************************************/
+static bool EMIOS_DRV_IC_GetTimebaseChannel(uint8_t emiosGroup,
+                                            uint8_t restChannel,
+                                            uint8_t *busChannel)
+{
+    uint32_t busSel    = EMIOS_GetUCRegCBsl(emiosGroup, restChannel);
+    uint8_t tempMode   = 0U;
+    bool validBus      = true;
+
+    if (busSel == (uint32_t)EMIOS_BUS_SEL_A)
+    {
+        *busChannel = (uint8_t)EMIOS_CNT_BUSA_DRIVEN;
+    }
+#if FEATURE_EMIOS_BUS_F_SELECT
+    else if (busSel == (uint32_t)EMIOS_BUS_SEL_F)
+    {
+        *busChannel = (uint8_t)EMIOS_CNT_BUSF_DRIVEN;
+    }
+#endif
+    else if (busSel == (uint32_t)EMIOS_BUS_SEL_BCDE)
+    {
+        *busChannel = (uint8_t)(restChannel & 0xF8U);
+    }
+    else
+    {
+        validBus = false;
+    }
+
+    if (validBus)
+    {
+        tempMode = (uint8_t)EMIOS_GetUCRegCMode(emiosGroup, *busChannel);
+        validBus = (((tempMode & EMIOS_FILTER_MC) == EMIOS_MASK_MC_UP) ||
+                    ((tempMode & EMIOS_FILTER_MCB) == EMIOS_MASK_MCB_UP));
+    }
+
+    return validBus;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_GetTimebasePeriod
+ * Description   : Reads the period of the channel driving the selected counter bus.
+ *
+ *END**************************************************************************/
+static uint32_t EMIOS_DRV_IC_GetTimebasePeriod(uint8_t emiosGroup,
+                                               uint8_t restChannel)
+{
+    uint32_t ret       = 0UL;
+    uint8_t busChannel = 0U;
+
+    if (EMIOS_DRV_IC_GetTimebaseChannel(emiosGroup, restChannel, &busChannel))
+    {
+        ret = EMIOS_DRV_MC_GetCounterPeriod(emiosGroup, busChannel);
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_IsCaptureMode
+ * Description   : Check that a unified channel is in one of the input capture modes.
+ *
+ *END**************************************************************************/
+static bool EMIOS_DRV_IC_IsCaptureMode(uint8_t emiosGroup,
+                                       uint8_t restChannel)
+{
+    uint32_t tempMode = EMIOS_GetUCRegCMode(emiosGroup, restChannel);
+
+    return ((tempMode == (uint32_t)EMIOS_MODE_IC) ||
+            (tempMode == (uint32_t)EMIOS_MODE_IPWM) ||
+            (tempMode == (uint32_t)EMIOS_MODE_IPM));
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_Interval
+ * Description   : Interval from an earlier capture to a later one. The later
+ * capture is below the earlier one when the counter wrapped in between; when the
+ * wraps are not counted, one is assumed, which gives the interval modulo the
+ * timebase period.
+ *
+ *END**************************************************************************/
+static inline uint64_t EMIOS_DRV_IC_Interval(uint32_t period,
+                                             uint32_t later,
+                                             uint32_t earlier,
+                                             uint32_t wraps)
+{
+    uint32_t periods = wraps;
+
+    if ((later < earlier) && (periods == 0UL))
+    {
+        periods = 1UL;
+    }
+
+    return (((uint64_t)periods * period) + later) - earlier;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_GetWrittenRecords
+ * Description   : The records written are the completed passes plus the
+ * position in the current one. The pass count is read on both sides of the
+ * position so that both belong to the same pass.
+ *
+ *END**************************************************************************/
+static uint32_t EMIOS_DRV_IC_GetWrittenRecords(const emios_ic_ring_state_t *state)
+{
+    uint32_t wraps     = 0UL;
+    uint32_t remaining = 0UL;
+    uint32_t length    = state->config.bufferLength;
+
+    do
+    {
+        wraps = state->ringWraps;
+        remaining = EDMA_DRV_GetRemainingMajorIterationsCount(state->config.dmaVirtualChannel);
+    } while (wraps != state->ringWraps);
+
+    return (wraps * length) + (length - remaining);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_GetWraps
+ * Description   : The wraps before a record are those of the last log entry at
+ * or before it. Entries superseded by a later one at or before the record are
+ * dropped; the last entry is kept, as the handler can still add wraps to it.
+ * Record numbers are compared by difference, as they wrap around.
+ *
+ *END**************************************************************************/
+static uint32_t EMIOS_DRV_IC_GetWraps(emios_ic_ring_state_t *state,
+                                      uint32_t record)
+{
+    uint32_t head = state->wrapHead;
+    uint32_t tail = state->wrapTail;
+    uint32_t ret;
+
+    while (((head - tail) > 1UL) &&
+           ((record - state->wrapRecord[(tail + 1UL) % EMIOS_IC_WRAP_LOG_LENGTH]) < 0x80000000UL))
+    {
+        state->wrapBase = state->wrapCount[tail % EMIOS_IC_WRAP_LOG_LENGTH];
+        tail++;
+    }
+    state->wrapTail = tail;
+
+    if ((head != tail) && ((record - state->wrapRecord[tail % EMIOS_IC_WRAP_LOG_LENGTH]) < 0x80000000UL))
+    {
+        ret = state->wrapCount[tail % EMIOS_IC_WRAP_LOG_LENGTH];
+    }
+    else
+    {
+        ret = state->wrapBase;
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_DmaCallback
+ * Description   : Counts the passes of the eDMA over the ring, from which the
+ * number of records written is derived; stops the ring on an eDMA error.
+ *
+ *END**************************************************************************/
+static void EMIOS_DRV_IC_DmaCallback(void *parameter,
+                                     edma_chn_status_t status)
+{
+    emios_ic_ring_state_t *state = (emios_ic_ring_state_t *)parameter;
+
+    if (status == EDMA_CHN_ERROR)
+    {
+        (void)EMIOS_DRV_IC_StopRing(state);
+    }
+    else
+    {
+        state->ringWraps++;
+    }
+}
+
+/*******************************************************************************
+ * Public API
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_InitInputCaptureMode
+ * Description   : Initialize Single Action Input Capture (SAIC), Input Pulse
+ * Width Measurement (IPWM) or Input Period Measurement (IPM) mode.
+ * The channel goes through GPIO mode first, as required when changing MODE[0:6].
+ * Implements    : EMIOS_DRV_IC_InitInputCaptureMode_Activity
+ *END**************************************************************************/
+status_t EMIOS_DRV_IC_InitInputCaptureMode(uint8_t emiosGroup,
+                                           uint8_t channel,
+                                           const emios_input_capture_param_t *icParam)
+{
+    status_t ret        = STATUS_SUCCESS;
+    uint8_t restChannel = 0U;
+    bool restValidate   = EMIOS_ValidateChannel(channel, &restChannel);
+    DEV_ASSERT(emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+    DEV_ASSERT(icParam != NULL);
+#ifdef DEV_ERROR_DETECT
+    DEV_ASSERT(restValidate == true);
+#else
+    (void)restValidate;
+#endif
+
+    if (((icParam->mode != EMIOS_MODE_IC) && (icParam->mode != EMIOS_MODE_IPWM) && (icParam->mode != EMIOS_MODE_IPM)) ||
+        ((icParam->mode == EMIOS_MODE_IPWM) && (icParam->inputCaptureMode == EMIOS_TRIGGER_EDGE_ANY)) ||
+        (icParam->timebase == EMIOS_BUS_SEL_INTERNAL))
+    {
+        ret = STATUS_ERROR;
+    }
+    else
+    {
+        EMIOS_SetUCRegCMode(emiosGroup, restChannel, (uint32_t)EMIOS_MODE_GPIO_INPUT);
+        EMIOS_SetUCRegCBsl(emiosGroup, restChannel, (uint32_t)icParam->timebase);
+
+        if (EMIOS_DRV_IC_GetTimebasePeriod(emiosGroup, restChannel) == 0UL)
+        {
+            ret = STATUS_EMIOS_WRONG_CNT_BUS;
+        }
+        else
+        {
+            EMIOS_SetUCRegCEdsel(emiosGroup, restChannel, ((((uint8_t)(icParam->inputCaptureMode) & 0x02U) == 0U) ? 0UL : 1UL));
+            EMIOS_SetUCRegCEdpol(emiosGroup, restChannel, ((((uint8_t)(icParam->inputCaptureMode) & 0x01U) == 0U) ? 0UL : 1UL));
+            EMIOS_SetUCRegCIf(emiosGroup, restChannel, (uint32_t)icParam->filterInput);
+            EMIOS_SetUCRegCFck(emiosGroup, restChannel, icParam->filterEn ? 0UL : 1UL);
+            EMIOS_SetUCRegCMode(emiosGroup, restChannel, (uint32_t)icParam->mode);
+            EMIOS_SetUCRegSFlag(emiosGroup, restChannel);
+        }
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_GetLastMeasurement
+ * Description   : Get the last measurement of an input capture channel.
+ * A is read before B, which keeps the pair coherent in IPWM and IPM modes.
+ * Implements    : EMIOS_DRV_IC_GetLastMeasurement_Activity
+ *END**************************************************************************/
+status_t EMIOS_DRV_IC_GetLastMeasurement(uint8_t emiosGroup,
+                                         uint8_t channel,
+                                         uint32_t *retValue)
+{
+    status_t ret        = STATUS_SUCCESS;
+    uint32_t regA       = 0UL;
+    uint32_t regB       = 0UL;
+    uint8_t restChannel = 0U;
+    bool restValidate   = EMIOS_ValidateChannel(channel, &restChannel);
+    DEV_ASSERT(emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+    DEV_ASSERT(retValue != NULL);
+#ifdef DEV_ERROR_DETECT
+    DEV_ASSERT(restValidate == true);
+#else
+    (void)restValidate;
+#endif
+
+    if (EMIOS_DRV_IC_IsCaptureMode(emiosGroup, restChannel) == false)
+    {
+        ret = STATUS_EMIOS_WRONG_MODE;
+    }
+    else
+    {
+        regA = EMIOS_GetUCRegA(emiosGroup, restChannel);
+        if (EMIOS_GetUCRegCMode(emiosGroup, restChannel) == (uint32_t)EMIOS_MODE_IC)
+        {
+            *retValue = regA;
+        }
+        else
+        {
+            regB = EMIOS_GetUCRegB(emiosGroup, restChannel);
+            *retValue = (uint32_t)EMIOS_DRV_IC_Interval(EMIOS_DRV_IC_GetTimebasePeriod(emiosGroup, restChannel), regA, regB, 0UL);
+        }
+        EMIOS_SetUCRegSFlag(emiosGroup, restChannel);
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_InitRing
+ * Description   : Configures the eDMA channel to copy each capture into the
+ * ring. In IPWM and IPM modes a request copies A then B, which are adjacent:
+ * the source wraps on an 8-byte modulo, so it stays on the channel. The ring is
+ * circular and the major loop interrupt counts its passes.
+ * Implements    : EMIOS_DRV_IC_InitRing_Activity
+ *END**************************************************************************/
+status_t EMIOS_DRV_IC_InitRing(uint8_t emiosGroup,
+                               uint8_t channel,
+                               const emios_ic_ring_config_t *config,
+                               emios_ic_ring_state_t *state)
+{
+    status_t ret        = STATUS_SUCCESS;
+    uint8_t restChannel = 0U;
+    uint32_t recordSize = 0UL;
+    edma_loop_transfer_config_t loopConfig;
+    edma_transfer_config_t transferConfig;
+    bool restValidate   = EMIOS_ValidateChannel(channel, &restChannel);
+    DEV_ASSERT(emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config->buffer != NULL);
+    DEV_ASSERT((config->bufferLength > 0U) && (config->bufferLength <= EMIOS_IC_MAX_RING_LENGTH));
+#ifdef DEV_ERROR_DETECT
+    DEV_ASSERT(restValidate == true);
+#else
+    (void)restValidate;
+#endif
+
+    if (EMIOS_DRV_IC_IsCaptureMode(emiosGroup, restChannel) == false)
+    {
+        return STATUS_EMIOS_WRONG_MODE;
+    }
+
+    state->config = *config;
+    state->emiosGroup = emiosGroup;
+    state->unifiedChannel = restChannel;
+    state->pulseWidth = (EMIOS_GetUCRegCMode(emiosGroup, restChannel) == (uint32_t)EMIOS_MODE_IPWM);
+    state->recordWords = (EMIOS_GetUCRegCMode(emiosGroup, restChannel) == (uint32_t)EMIOS_MODE_IC) ? 1U : 2U;
+    state->counterPeriod = EMIOS_DRV_IC_GetTimebasePeriod(emiosGroup, restChannel);
+    (void)EMIOS_DRV_IC_GetTimebaseChannel(emiosGroup, restChannel, &state->busChannel);
+    state->ringWraps = 0UL;
+    state->consumed = 0UL;
+    state->readIndex = 0UL;
+    state->lastCapture = 0UL;
+    state->timeline = 0UL;
+    state->timelineValid = false;
+    state->lastWraps = 0UL;
+    state->wrapBase = 0UL;
+    state->wrapHead = 0UL;
+    state->wrapTail = 0UL;
+    state->wraps = 0UL;
+    state->wrapFloor = 0UL;
+    state->wrapLost = false;
+    state->running = false;
+    recordSize = (uint32_t)state->recordWords * EMIOS_IC_WORD_SIZE;
+
+    loopConfig.majorLoopIterationCount = config->bufferLength;
+    loopConfig.srcOffsetEnable = false;
+    loopConfig.dstOffsetEnable = false;
+    loopConfig.minorLoopOffset = 0;
+    loopConfig.minorLoopChnLinkEnable = false;
+    loopConfig.minorLoopChnLinkNumber = 0U;
+    loopConfig.majorLoopChnLinkEnable = false;
+    loopConfig.majorLoopChnLinkNumber = 0U;
+
+    transferConfig.srcAddr = (uint32_t)&eMIOS[emiosGroup]->UC[restChannel].A;
+    transferConfig.destAddr = (uint32_t)config->buffer;
+    transferConfig.srcTransferSize = EDMA_TRANSFER_SIZE_4B;
+    transferConfig.destTransferSize = EDMA_TRANSFER_SIZE_4B;
+    transferConfig.srcOffset = (state->recordWords == 1U) ? 0 : (int16_t)EMIOS_IC_WORD_SIZE;
+    transferConfig.destOffset = (int16_t)EMIOS_IC_WORD_SIZE;
+    transferConfig.srcLastAddrAdjust = 0;
+    transferConfig.destLastAddrAdjust = -(int32_t)(config->bufferLength * recordSize);
+    transferConfig.srcModulo = (state->recordWords == 1U) ? EDMA_MODULO_OFF : EDMA_MODULO_8B;
+    transferConfig.destModulo = EDMA_MODULO_OFF;
+    transferConfig.minorByteTransferCount = recordSize;
+    transferConfig.scatterGatherEnable = false;
+    transferConfig.scatterGatherNextDescAddr = 0U;
+    transferConfig.interruptEnable = true;
+    transferConfig.loopTransferConfig = &loopConfig;
+
+    ret = EDMA_DRV_ConfigLoopTransfer(config->dmaVirtualChannel, &transferConfig);
+    if (ret == STATUS_SUCCESS)
+    {
+        ret = EDMA_DRV_InstallCallback(config->dmaVirtualChannel, EMIOS_DRV_IC_DmaCallback, state);
+    }
+
+    if (ret == STATUS_SUCCESS)
+    {
+        EMIOS_SetUCRegCFen(emiosGroup, restChannel, 0UL);
+        EMIOS_SetUCRegCDma(emiosGroup, restChannel, 1UL);
+    }
+    else
+    {
+        ret = STATUS_ERROR;
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_StartRing
+ * Description   : Rewinds the ring, drops a capture pending from before the
+ * start and enables the requests.
+ * Implements    : EMIOS_DRV_IC_StartRing_Activity
+ *END**************************************************************************/
+status_t EMIOS_DRV_IC_StartRing(emios_ic_ring_state_t *state)
+{
+    DEV_ASSERT(state != NULL);
+
+    if (state->running)
+    {
+        return STATUS_BUSY;
+    }
+
+    EDMA_DRV_SetDestAddr(state->config.dmaVirtualChannel, (uint32_t)state->config.buffer);
+    EDMA_DRV_SetMajorLoopIterationCount(state->config.dmaVirtualChannel, state->config.bufferLength);
+    state->ringWraps = 0UL;
+    state->consumed = 0UL;
+    state->readIndex = 0UL;
+    state->timelineValid = false;
+    state->wrapBase = 0UL;
+    state->wrapHead = 0UL;
+    state->wrapTail = 0UL;
+    state->wraps = 0UL;
+    state->wrapFloor = 0UL;
+    state->wrapLost = false;
+    state->running = true;
+
+    EMIOS_SetUCRegSFlag(state->emiosGroup, state->unifiedChannel);
+    (void)EDMA_DRV_StartChannel(state->config.dmaVirtualChannel);
+    EMIOS_SetUCRegCFen(state->emiosGroup, state->unifiedChannel, 1UL);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_StopRing
+ * Description   : Disables the requests of the channel and of the eDMA; the
+ * records already written can still be measured.
+ * Implements    : EMIOS_DRV_IC_StopRing_Activity
+ *END**************************************************************************/
+status_t EMIOS_DRV_IC_StopRing(emios_ic_ring_state_t *state)
+{
+    DEV_ASSERT(state != NULL);
+
+    EMIOS_SetUCRegCFen(state->emiosGroup, state->unifiedChannel, 0UL);
+    (void)EDMA_DRV_StopChannel(state->config.dmaVirtualChannel);
+    state->running = false;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_DeinitRing
+ * Description   : Stops the ring and assigns the channel FLAG back to the
+ * interrupt request.
+ * Implements    : EMIOS_DRV_IC_DeinitRing_Activity
+ *END**************************************************************************/
+status_t EMIOS_DRV_IC_DeinitRing(emios_ic_ring_state_t *state)
+{
+    DEV_ASSERT(state != NULL);
+
+    (void)EMIOS_DRV_IC_StopRing(state);
+    EMIOS_SetUCRegCDma(state->emiosGroup, state->unifiedChannel, 0UL);
+    (void)EDMA_DRV_InstallCallback(state->config.dmaVirtualChannel, NULL, NULL);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_GetPendingRecords
+ * Description   : Records written minus records consumed; a pass completed
+ * while its interrupt is still pending makes the total look older than the
+ * records consumed, and is added back.
+ * Implements    : EMIOS_DRV_IC_GetPendingRecords_Activity
+ *END**************************************************************************/
+uint32_t EMIOS_DRV_IC_GetPendingRecords(const emios_ic_ring_state_t *state)
+{
+    uint32_t pending = 0UL;
+
+    DEV_ASSERT(state != NULL);
+
+    pending = EMIOS_DRV_IC_GetWrittenRecords(state) - state->consumed;
+    if (pending >= 0x80000000UL)
+    {
+        pending += state->config.bufferLength;
+    }
+
+    return pending;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_TimebaseWrapHandler
+ * Description   : Logs the wrap against the number of records written. The
+ * last records completed since the previous wrap whose captures increase up to
+ * the counter were captured after this wrap, and are moved after it. A wrap at the
+ * same position as the last entry updates it; when the log is full, the wrap is
+ * added to the last entry and reported as lost.
+ * Implements    : EMIOS_DRV_IC_TimebaseWrapHandler_Activity
+ *END**************************************************************************/
+void EMIOS_DRV_IC_TimebaseWrapHandler(emios_ic_ring_state_t *state)
+{
+    uint32_t counter;
+    uint32_t capture;
+    uint32_t written;
+    uint32_t floor;
+    uint32_t head;
+    uint32_t last;
+    uint32_t length;
+    bool afterWrap;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(state->config.countTimebaseWraps);
+
+    if (state->running)
+    {
+        length = state->config.bufferLength;
+        /* No record completes between the two reads, so those written are captured up to the counter */
+        do
+        {
+            written = EMIOS_DRV_IC_GetWrittenRecords(state);
+            counter = EMIOS_GetUCRegCNT(state->emiosGroup, state->busChannel);
+        } while (written != EMIOS_DRV_IC_GetWrittenRecords(state));
+        floor = state->wrapFloor;
+        if ((written - floor) >= 0x80000000UL)
+        {
+            written += length;
+        }
+        state->wrapFloor = written;
+        state->wraps++;
+
+        /* Records completed since the wrap hold increasing captures up to the counter */
+        afterWrap = true;
+        while (afterWrap && (written != floor) && ((state->wrapFloor - written) < length))
+        {
+            capture = state->config.buffer[((written - 1UL) % length) * state->recordWords];
+            afterWrap = (capture <= counter);
+            if (afterWrap)
+            {
+                counter = capture;
+                written--;
+            }
+        }
+
+        head = state->wrapHead;
+        last = (head - 1UL) % EMIOS_IC_WRAP_LOG_LENGTH;
+        if ((head != state->wrapTail) && (state->wrapRecord[last] == written))
+        {
+            state->wrapCount[last] = state->wraps;
+        }
+        else if ((head - state->wrapTail) < EMIOS_IC_WRAP_LOG_LENGTH)
+        {
+            state->wrapRecord[head % EMIOS_IC_WRAP_LOG_LENGTH] = written;
+            state->wrapCount[head % EMIOS_IC_WRAP_LOG_LENGTH] = state->wraps;
+            state->wrapHead = head + 1UL;
+        }
+        else
+        {
+            state->wrapCount[last] = state->wraps;
+            state->wrapLost = true;
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EMIOS_DRV_IC_Measure
+ * Description   : Walks the records oldest first. The reference edge of a
+ * record is the captured edge in SAIC and IPM modes and the leading edge (B)
+ * in IPWM mode; its interval from the previous reference edge is a period and
+ * extends the timeline. The wraps logged before a record are those before its
+ * last capture (A): in IPWM mode, a wrap during the pulse (A below B) comes
+ * after the reference edge. The period sum is kept in 64 bits, as counted wraps
+ * let it exceed 32 bits.
+ * Implements    : EMIOS_DRV_IC_Measure_Activity
+ *END**************************************************************************/
+status_t EMIOS_DRV_IC_Measure(emios_ic_ring_state_t *state,
+                              uint32_t edges,
+                              emios_ic_measurement_t *result)
+{
+    const uint32_t *record;
+    uint32_t pending;
+    uint32_t lost       = 0UL;
+    uint64_t periodSum  = 0ULL;
+    uint32_t pulseSum   = 0UL;
+    uint32_t periods    = 0UL;
+    uint32_t reference  = 0UL;
+    uint32_t wraps      = 0UL;
+    uint32_t wrapDelta  = 0UL;
+    uint64_t interval   = 0ULL;
+    uint32_t position;
+    uint32_t idx;
+    uint64_t frequency;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(result != NULL);
+    DEV_ASSERT((edges > 0U) && (edges <= state->config.bufferLength));
+
+    if (state->wrapLost)
+    {
+        /* The wraps can no longer be assigned to the records written so far */
+        state->wrapLost = false;
+        pending = EMIOS_DRV_IC_GetPendingRecords(state);
+        state->consumed += pending;
+        state->readIndex = (state->readIndex + pending) % state->config.bufferLength;
+        state->timelineValid = false;
+        (void)EMIOS_DRV_IC_GetWraps(state, state->consumed);
+        return STATUS_ERROR;
+    }
+
+    pending = EMIOS_DRV_IC_GetPendingRecords(state);
+    if (pending < edges)
+    {
+        return STATUS_BUSY;
+    }
+    if (pending > state->config.bufferLength)
+    {
+        lost = pending - state->config.bufferLength;
+        state->consumed += lost;
+        state->readIndex = (state->readIndex + lost) % state->config.bufferLength;
+        state->timelineValid = false;
+    }
+
+    position = state->readIndex;
+    for (idx = 0U; idx < edges; idx++)
+    {
+        record = &state->config.buffer[position * state->recordWords];
+        reference = state->pulseWidth ? record[1U] : record[0U];
+        position++;
+        if (position == state->config.bufferLength)
+        {
+            position = 0UL;
+        }
+
+        if (state->config.countTimebaseWraps)
+        {
+            wraps = EMIOS_DRV_IC_GetWraps(state, state->consumed + idx);
+            if (state->pulseWidth && (record[0U] < record[1U]))
+            {
+                wraps--;
+            }
+        }
+
+        if (state->timelineValid)
+        {
+            wrapDelta = wraps - state->lastWraps;
+            interval = EMIOS_DRV_IC_Interval(state->counterPeriod, reference, state->lastCapture,
+                                             (wrapDelta < 0x80000000UL) ? wrapDelta : 0UL);
+            state->timeline += (uint32_t)interval;
+            periodSum += interval;
+            periods++;
+        }
+        state->timelineValid = true;
+        state->lastCapture = reference;
+        state->lastWraps = wraps;
+
+        if (state->pulseWidth)
+        {
+            pulseSum += (uint32_t)EMIOS_DRV_IC_Interval(state->counterPeriod, record[0U], record[1U], 0UL);
+        }
+    }
+    state->consumed += edges;
+    state->readIndex = position;
+
+    result->periods = periods;
+    interval = (periods > 0UL) ? (periodSum / periods) : 0ULL;
+    result->periodTicks = (interval > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)interval;
+    result->pulseTicks = pulseSum / edges;
+    result->dutyQ16 = 0UL;
+    result->frequencyMilliHz = 0UL;
+    if (result->periodTicks > 0UL)
+    {
+        /* The pulse is averaged over all records, the period over the intervals between them */
+        result->dutyQ16 = (uint32_t)(((uint64_t)result->pulseTicks << 16U) / result->periodTicks);
+        frequency = (((uint64_t)state->config.counterClockHz * 1000ULL) * periods) / periodSum;
+        result->frequencyMilliHz = (frequency > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)frequency;
+    }
+    result->timestamp = state->timeline;
+    result->lostRecords = lost;
+    result->overrun = EMIOS_GetUCRegSOverrun(state->emiosGroup, state->unifiedChannel);
+    if (result->overrun)
+    {
+        EMIOS_ClrUCRegSOverrun(state->emiosGroup, state->unifiedChannel);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+* EOF
+******************************************************************************/
@@ -205,6 +205,33 @@ typedef struct
     uint8_t         numberOfPwmChannels;  /*!< Number of channels which are configured */
 } pwm_global_config_t;
 
+/*!
+ * @brief Defines how a prepared channel writes its duty cycle
+ * Implements : pwm_duty_write_t_Class
+ */
+typedef enum
+{
+    PWM_DUTY_WRITE_GENERIC      = 0,    /*!< Through PWM_UpdateDuty() */
+    PWM_DUTY_WRITE_EMIOS_EDGE   = 1,    /*!< eMIOS OPWMB: trailing edge placement in the B register */
+    PWM_DUTY_WRITE_EMIOS_CENTER = 2     /*!< eMIOS OPWMCB: ideal duty cycle in the A register */
+} pwm_duty_write_t;
+
+/*!
+ * @brief Channel descriptor returned by PWM_PrepareChannel() for PWM_UpdateDutyFast()
+ * Implements : pwm_channel_desc_t_Class
+ */
+typedef struct
+{
+    volatile uint32_t *     reg;            /*!< Register receiving the duty cycle */
+    pwm_duty_write_t        strategy;       /*!< Write strategy of the channel mode */
+    uint32_t                period;         /*!< Period of the channel timebase in ticks, cached */
+    uint32_t                zeroDutyValue;  /*!< Register value for a 0% duty cycle */
+    const pwm_instance_t *  instance;       /*!< Instance, used by the generic strategy */
+    uint8_t                 channel;        /*!< Channel, used by the generic strategy */
+    uint8_t                 hwChannel;      /*!< eMIOS hardware channel, for the output update mask */
+    uint8_t                 counterBus;     /*!< eMIOS channel driving the counter bus of the timebase */
+} pwm_channel_desc_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -234,6 +261,92 @@ extern "C" {
  */
  status_t PWM_UpdateDuty(const pwm_instance_t * const instance, uint8_t channel, uint32_t duty);
 
+ /*!
+ * @brief Update the duty cycle of several channels on the same period boundary.
+ * The measurement unit for duty is clock ticks.
+ *
+ * Over eMIOS, all the channels are validated and their register values computed
+ * first; nothing is written if one of them is not valid or if the batch holds
+ * more than FEATURE_EMIOS_CH_COUNT channels. The registers are then
+ * written with the output update of the channels disabled (OUDIS) and released
+ * by a single write, so all channels sharing a timebase switch on the same period.
+ * Channels on different timebases switch on the next period of their own timebase.
+ * Over the other modules, the channels are updated one after the other with
+ * PWM_UpdateDuty().
+ * @note The period should always remain grater than or equal to the duty.
+ *
+ * @param[in] instance The name of the instance
+ * @param[in] channels The channels which are updated
+ * @param[in] duties The duty cycle of each channel, measured in ticks
+ * @param[in] numberOfChannels Number of channels in the batch
+ * @return    Error or success status returned by API
+ */
+ status_t PWM_UpdateDutyMulti(const pwm_instance_t * const instance,
+                              const uint8_t * channels,
+                              const uint32_t * duties,
+                              uint8_t numberOfChannels);
+
+ /*!
+ * @brief Resolve a channel once for PWM_UpdateDutyFast().
+ *
+ * Over eMIOS, maps and validates the channel, reads its mode, counter bus and the period of its
+ * timebase, and stores the address of the register holding the duty cycle with the
+ * computation matching the mode. For OPWMB channels, the leading edge is placed at
+ * the period start. Over the other modules, the descriptor falls back to
+ * PWM_UpdateDuty().
+ * @note The descriptor caches the period: prepare it again after PWM_UpdatePeriod().
+ *
+ * @param[in] instance The name of the instance
+ * @param[in] channel The channel which is prepared
+ * @param[out] desc The channel descriptor
+ * @return    Error or success status returned by API
+ */
+ status_t PWM_PrepareChannel(const pwm_instance_t * const instance,
+                             uint8_t channel,
+                             pwm_channel_desc_t * desc);
+
+ /*!
+ * @brief Update duty cycle of a prepared channel. The measurement unit for duty is clock ticks.
+ *
+ * Writes the same register value as PWM_UpdateDuty(), computed from the cached
+ * period, without any mapping, validation or mode lookup.
+ *
+ * @param[in] desc The channel descriptor filled by PWM_PrepareChannel()
+ * @param[in] duty The duty cycle measured in ticks
+ * @return    Error or success status returned by API
+ */
+static inline status_t PWM_UpdateDutyFast(const pwm_channel_desc_t * desc, uint32_t duty)
+{
+    status_t status = STATUS_SUCCESS;
+    uint32_t period = desc->period;
+
+    if (desc->strategy == PWM_DUTY_WRITE_EMIOS_EDGE)
+    {
+        *desc->reg = ((duty < period) ? duty : period) + 1UL;
+    }
+    else if (desc->strategy == PWM_DUTY_WRITE_EMIOS_CENTER)
+    {
+        if (duty >= period)
+        {
+            *desc->reg = 1UL;
+        }
+        else if (duty == 0UL)
+        {
+            *desc->reg = desc->zeroDutyValue;
+        }
+        else
+        {
+            *desc->reg = ((period - duty) >> 1U) + 1UL;
+        }
+    }
+    else
+    {
+        status = PWM_UpdateDuty(desc->instance, desc->channel, duty);
+    }
+
+    return status;
+}
+
 /*!
  * @brief  Update period for specific a specific channel. This function changes period for
  * all channels which shares the timebase with targeted channel.
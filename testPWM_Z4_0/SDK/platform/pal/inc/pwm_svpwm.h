@@ -0,0 +1,180 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PWM_SVPWM_H
+#define PWM_SVPWM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pwm_pal.h"
+
+#if (defined(PWM_OVER_EMIOS))
+
+/*!
+ * @defgroup pwm_svpwm Space Vector Modulation
+ * @brief Fixed-point space vector modulation on three eMIOS center-aligned channels
+ *
+ * The modulator takes the voltage vector in the rotating (d, q) or stationary (alpha,
+ * beta) frame and produces the A register values of three OPWMCB channels, in the format
+ * written by PWM_UpdateDuty(). It uses the min-max zero sequence injection, which gives
+ * the same phase duty cycles as the sector-based space vector modulation without the
+ * sector search.
+ *
+ * Values are signed Q15: voltages are fractions of the DC link voltage, sin and cos of
+ * the rotor angle are in [-1, 1). The linear range ends at a vector length of 1/sqrt(3)
+ * (0x49E7); longer vectors are clipped phase by phase.
+ *
+ * The dead time programmed with EMIOS_DRV_PWM_SetCenterAlignDeadTime() is read at
+ * initialization: a pulse shorter than the dead time would be swallowed by the dead time
+ * insertion or give a runt pulse, so it is dropped (0 %), and a gap shorter than the dead
+ * time is closed (100 %). The dead time itself is not compensated, as that needs the
+ * sign of the phase currents.
+ *
+ * The three registers are written with their output update disabled and released by
+ * a single write of OUDIS, so the phases always change on the same period.
+ *
+ * Cost estimate for PWM_SVPWM_UpdateDQ() on the e200z4 (counted from the code, not
+ * measured on target): 8 multiplications, about 30 additions, shifts and comparisons,
+ * no division, and 5 peripheral register writes; in the order of 100-150 core cycles
+ * plus the bus accesses, well within 2 us at 160 MHz.
+ *
+ * @addtogroup pwm_svpwm
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of phases */
+#define PWM_SVPWM_PHASES    3U
+
+/*!
+ * @brief Runtime state of the modulator
+ *
+ * The fields are internal to the modulator and must not be accessed by the application.
+ *
+ * Implements : pwm_svpwm_state_t_Class
+ */
+typedef struct
+{
+    volatile uint32_t * regA[PWM_SVPWM_PHASES];     /*!< A registers of the phase channels */
+    uint8_t emiosGroup;                             /*!< eMIOS group of the channels */
+    uint32_t channelMask;                           /*!< Output update mask of the channels */
+    uint32_t period;                                /*!< Period of the common timebase, in ticks */
+    uint32_t deadTime;                              /*!< Largest dead time of the channels, in ticks */
+} pwm_svpwm_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the modulator
+ *
+ * The channels must be initialized by PWM_Init() in OPWMCB mode, on the same counter bus,
+ * with their dead time programmed.
+ *
+ * @param[out] state    Pointer to the modulator state structure.
+ * @param[in]  instance PWM instance of the channels; must be an eMIOS instance.
+ * @param[in]  channels Channels of phases a, b and c.
+ *
+ * @return    STATUS_SUCCESS    : if successful;
+ *            STATUS_ERROR      : if a channel is not in OPWMCB mode, or the channels are not
+ *                                on the same counter bus or period;
+ *            STATUS_UNSUPPORTED: if the instance is not an eMIOS instance.
+ */
+status_t PWM_SVPWM_Init(pwm_svpwm_state_t * state,
+                        const pwm_instance_t * const instance,
+                        const uint8_t channels[PWM_SVPWM_PHASES]);
+
+/*!
+ * @brief Inverse Park transform
+ *
+ * @param[in]  d        Direct component, Q15.
+ * @param[in]  q        Quadrature component, Q15.
+ * @param[in]  sinTheta Sine of the rotor angle, Q15.
+ * @param[in]  cosTheta Cosine of the rotor angle, Q15.
+ * @param[out] alpha    Alpha component, Q15, saturated.
+ * @param[out] beta     Beta component, Q15, saturated.
+ */
+void PWM_SVPWM_InvPark(int16_t d,
+                       int16_t q,
+                       int16_t sinTheta,
+                       int16_t cosTheta,
+                       int16_t * alpha,
+                       int16_t * beta);
+
+/*!
+ * @brief Computes the A register values of the three phases
+ *
+ * Inverse Clarke transform, min-max injection, conversion to ticks with the dead time
+ * limits, and conversion to the OPWMCB A register format. Nothing is written.
+ *
+ * @param[in]  state Pointer to the modulator state structure.
+ * @param[in]  alpha Alpha component, Q15.
+ * @param[in]  beta  Beta component, Q15.
+ * @param[out] regA  A register values of phases a, b and c.
+ */
+void PWM_SVPWM_Modulate(const pwm_svpwm_state_t * state,
+                        int16_t alpha,
+                        int16_t beta,
+                        uint32_t regA[PWM_SVPWM_PHASES]);
+
+/*!
+ * @brief Writes the A register values of the three phases
+ *
+ * The new values are taken together at the next period of the timebase.
+ *
+ * @param[in] state Pointer to the modulator state structure.
+ * @param[in] regA  A register values of phases a, b and c.
+ */
+void PWM_SVPWM_Apply(const pwm_svpwm_state_t * state,
+                     const uint32_t regA[PWM_SVPWM_PHASES]);
+
+/*!
+ * @brief Modulates a (d, q) voltage vector and writes the three phases
+ *
+ * @param[in] state    Pointer to the modulator state structure.
+ * @param[in] d        Direct component, Q15.
+ * @param[in] q        Quadrature component, Q15.
+ * @param[in] sinTheta Sine of the rotor angle, Q15.
+ * @param[in] cosTheta Cosine of the rotor angle, Q15.
+ */
+void PWM_SVPWM_UpdateDQ(const pwm_svpwm_state_t * state,
+                        int16_t d,
+                        int16_t q,
+                        int16_t sinTheta,
+                        int16_t cosTheta);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* PWM_OVER_EMIOS */
+
+#endif /* PWM_SVPWM_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,269 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PWM_WAVE_H
+#define PWM_WAVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+#include "emios_common.h"
+#include "edma_driver.h"
+
+/*!
+ * @defgroup pwm_wave PWM Waveform Player
+ * @brief Playback of duty cycle tables on an eMIOS channel by eDMA
+ *
+ * The channel runs in OPWMB mode (edge aligned, leading edge at the period start).
+ * Its FLAG, set once per period on the trailing edge match, is routed to an eDMA
+ * request instead of an interrupt. Each request copies the next table entry into the
+ * B register; the new trailing edge is taken at the next period boundary, as the B
+ * register is buffered. The CPU is not involved per period.
+ *
+ * Table entries are B register values, prepared off-line or with PWM_WAVE_BuildTable()
+ * from duty cycles in ticks. A duty cycle of the full period has no trailing edge
+ * match, so it would also stop the requests; PWM_WAVE_BuildTable() clamps to the
+ * period minus one tick.
+ *
+ * The eDMA virtual channel must be initialized with the eMIOS request serving the
+ * channel (EDMA_REQ_eMIOS_x_CH_y, see the DMAMUX source table of the reference manual).
+ *
+ * Dithering: PWM_WAVE_BuildDitherTable() spreads a 16-bit duty cycle over the periods of
+ * a table with a first-order sigma-delta modulator, each entry being the duty cycle in
+ * whole ticks just below or above the target. Played in loop mode, the mean duty cycle
+ * over the table is within 0.5 / tableLength tick of the target, so the effective
+ * resolution is log2(period * tableLength) bits, up to the 16 bits of the target; e.g.
+ * 15.6 bits for a 200-tick period and 256 entries instead of 7.6 bits. The ripple is one
+ * tick peak-to-peak, at a frequency which falls to the PWM frequency / tableLength when
+ * the target is close to a whole number of ticks; the load, or the filter of a DAC
+ * output, must average over the table. PWM_WAVE_SwapTable() changes the target at a
+ * table boundary, which keeps the mean exact over each table.
+ *
+ * @addtogroup pwm_wave
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Largest table length (15-bit major loop count) */
+#define PWM_WAVE_MAX_TABLE_LENGTH    0x7FFFU
+
+/*!
+ * @brief Playback modes
+ *
+ * Implements : pwm_wave_mode_t_Class
+ */
+typedef enum
+{
+    PWM_WAVE_MODE_LOOP      = 0x00U,    /*!< The table is played repeatedly; PWM_WAVE_SwapTable() switches tables at a table boundary */
+    PWM_WAVE_MODE_ONE_SHOT  = 0x01U,    /*!< The table is played once; the last duty cycle is kept */
+    PWM_WAVE_MODE_PING_PONG = 0x02U     /*!< The table is played repeatedly and each half is reported when played, to be refilled */
+} pwm_wave_mode_t;
+
+/*!
+ * @brief Playback events
+ *
+ * Implements : pwm_wave_event_t_Class
+ */
+typedef enum
+{
+    PWM_WAVE_EVENT_DONE      = 0x00U,   /*!< One-shot mode: the whole table was played */
+    PWM_WAVE_EVENT_HALF      = 0x01U,   /*!< Ping-pong mode: the first half was played */
+    PWM_WAVE_EVENT_FULL      = 0x02U,   /*!< Ping-pong mode: the second half was played */
+    PWM_WAVE_EVENT_SWAPPED   = 0x03U,   /*!< Loop mode: the table given to PWM_WAVE_SwapTable() has been played once */
+    PWM_WAVE_EVENT_DMA_ERROR = 0x04U    /*!< The eDMA reported an error; the playback is stopped */
+} pwm_wave_event_t;
+
+/*!
+ * @brief Callback invoked on playback events
+ *
+ * first and count give the part of the table concerned by the event: the half to
+ * refill in ping-pong mode, the whole table otherwise.
+ *
+ * Implements : pwm_wave_callback_t_Class
+ */
+typedef void (*pwm_wave_callback_t)(uint32_t first,
+                                    uint32_t count,
+                                    pwm_wave_event_t event,
+                                    void * userData);
+
+/*!
+ * @brief Defines the waveform player configuration structure
+ *
+ * Implements : pwm_wave_user_config_t_Class
+ */
+typedef struct
+{
+    uint8_t emiosGroup;                  /*!< eMIOS group of the channel */
+    uint8_t channel;                     /*!< Channel, initialized in OPWMB mode */
+    uint8_t dmaVirtualChannel;           /*!< eDMA virtual channel, requested by the channel */
+    pwm_wave_mode_t mode;                /*!< Playback mode */
+    const uint32_t * table;              /*!< B register values, one per period */
+    uint32_t tableLength;                /*!< Number of entries, even in ping-pong mode */
+    pwm_wave_callback_t callback;        /*!< Callback to invoke on playback events; can be NULL */
+    void * callbackParam;                /*!< Callback parameter */
+} pwm_wave_user_config_t;
+
+/*!
+ * @brief Runtime state of the waveform player
+ *
+ * The fields are internal to the player and must not be accessed by the application.
+ *
+ * Implements : pwm_wave_state_t_Class
+ */
+typedef struct
+{
+    pwm_wave_user_config_t config;              /*!< Player configuration */
+    uint8_t unifiedChannel;                     /*!< Unified channel index of the channel */
+    edma_software_tcd_t tcdMemory[3U];          /*!< Two loop mode descriptors, plus room for their 32-byte alignment */
+    edma_software_tcd_t * tcd;                  /*!< Aligned descriptors in tcdMemory */
+    uint8_t activeTcd;                          /*!< Descriptor of the table being played, in loop mode */
+    volatile bool swapPending;                  /*!< A table swap is waiting for the new table to be played */
+    volatile bool running;                      /*!< True between PWM_WAVE_Start() and PWM_WAVE_Stop() */
+} pwm_wave_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Converts duty cycles to table entries
+ *
+ * Reads the period of the channel timebase. Duty cycles are in ticks and clamped to
+ * the period minus one tick. duties and table may be the same array.
+ *
+ * @param[in]  emiosGroup eMIOS group of the channel.
+ * @param[in]  channel    Channel, initialized in OPWMB mode.
+ * @param[in]  duties     Duty cycles, in ticks.
+ * @param[out] table      Table entries.
+ * @param[in]  count      Number of entries.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the channel is not in OPWMB mode.
+ */
+status_t PWM_WAVE_BuildTable(uint8_t emiosGroup,
+                             uint8_t channel,
+                             const uint32_t * duties,
+                             uint32_t * table,
+                             uint32_t count);
+
+/*!
+ * @brief Builds a sigma-delta dithering table
+ *
+ * Reads the period of the channel timebase. The entries alternate between the two whole
+ * tick duty cycles around duty * period / 65536, so that their mean over the table is the
+ * target rounded to 1 / count tick. Duty cycles are clamped to the period minus one tick.
+ *
+ * @param[in]  emiosGroup eMIOS group of the channel.
+ * @param[in]  channel    Channel, initialized in OPWMB mode.
+ * @param[in]  duty       Duty cycle, as a fraction of the period in 1/65536 units.
+ * @param[out] table      Table entries.
+ * @param[in]  count      Number of entries.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the channel is not in OPWMB mode.
+ */
+status_t PWM_WAVE_BuildDitherTable(uint8_t emiosGroup,
+                                   uint8_t channel,
+                                   uint16_t duty,
+                                   uint32_t * table,
+                                   uint32_t count);
+
+/*!
+ * @brief Initializes the waveform player
+ *
+ * Configures the eDMA channel to copy the table into the B register of the channel,
+ * one entry per request, and assigns the channel FLAG to the DMA request. The eMIOS
+ * channel and the eDMA channel must be initialized before.
+ *
+ * @param[out] state  Pointer to the player state structure.
+ * @param[in]  config Pointer to the player configuration structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the channel is not in OPWMB mode or the eDMA transfer cannot be configured.
+ */
+status_t PWM_WAVE_Init(pwm_wave_state_t * state, const pwm_wave_user_config_t * config);
+
+/*!
+ * @brief Starts the playback from the first entry of the table
+ *
+ * @param[in] state Pointer to the player state structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if the playback is already running.
+ */
+status_t PWM_WAVE_Start(pwm_wave_state_t * state);
+
+/*!
+ * @brief Stops the playback
+ *
+ * The last duty cycle written stays on the output.
+ *
+ * @param[in] state Pointer to the player state structure.
+ *
+ * @return    STATUS_SUCCESS
+ */
+status_t PWM_WAVE_Stop(pwm_wave_state_t * state);
+
+/*!
+ * @brief Replaces the table
+ *
+ * In loop mode, the new table is queued while the playback runs and starts at the
+ * end of the current pass over the old table, or of the next one if that pass ends
+ * during the call; PWM_WAVE_EVENT_SWAPPED is reported after the first pass over the
+ * new table. The old table must stay valid until then. In one-shot mode, the table
+ * can be replaced while the playback is stopped. In ping-pong mode, the table halves
+ * are refilled instead.
+ *
+ * @param[in] state       Pointer to the player state structure.
+ * @param[in] table       New table.
+ * @param[in] tableLength Number of entries of the new table.
+ *
+ * @return    STATUS_SUCCESS    : if successful;
+ *            STATUS_BUSY       : if a swap is pending, or a one-shot playback is running;
+ *            STATUS_UNSUPPORTED: in ping-pong mode.
+ */
+status_t PWM_WAVE_SwapTable(pwm_wave_state_t * state, const uint32_t * table, uint32_t tableLength);
+
+/*!
+ * @brief De-initializes the waveform player
+ *
+ * Stops the playback and assigns the channel FLAG back to the interrupt request.
+ *
+ * @param[in] state Pointer to the player state structure.
+ *
+ * @return    STATUS_SUCCESS
+ */
+status_t PWM_WAVE_Deinit(pwm_wave_state_t * state);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* PWM_WAVE_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -84,6 +84,23 @@
 #endif
     static status_t PWM_EMIOS_VrChannelMapping(uint8_t vrChannel, uint8_t * hwChannel);
     static bool PWM_EMIOS_ValidateChannel(uint8_t inChVal, uint8_t * outChVal);
+
+    /*! @brief A and B register values computed for a duty cycle update */
+    typedef struct
+    {
+        uint8_t hwChannel;      /*!< Hardware channel */
+        uint8_t restChannel;    /*!< Unified channel index */
+        bool writeB;            /*!< The B register is written too (edge aligned) */
+        uint32_t regA;          /*!< A register value */
+        uint32_t regB;          /*!< B register value */
+    } pwm_emios_duty_regs_t;
+
+    static status_t PWM_EMIOS_ComputeDutyRegs(uint8_t emiosGroup,
+                                              uint8_t channel,
+                                              uint32_t duty,
+                                              uint32_t * lastBus,
+                                              uint32_t * lastPeriod,
+                                              pwm_emios_duty_regs_t * regs);
 #endif
 
 /* Define state structures for FTM */
@@ -900,6 +917,139 @@ status_t PWM_UpdateDuty(const pwm_instance_t * const instance, uint8_t channel,
     return status;
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_UpdateDutyMulti
+ * Description   : Update the duty cycle of several channels so that they all change
+ * on the same period boundary. Over eMIOS, the register values of the whole batch
+ * are computed first, then written with the output update of the channels disabled,
+ * and released together by a single write of OUDIS.
+ * Implements    : PWM_UpdateDutyMulti_Activity
+ *
+ *END**************************************************************************/
+status_t PWM_UpdateDutyMulti(const pwm_instance_t * const instance,
+                             const uint8_t * channels,
+                             const uint32_t * duties,
+                             uint8_t numberOfChannels)
+{
+    DEV_ASSERT(instance != NULL);
+    DEV_ASSERT((channels != NULL) || (numberOfChannels == 0U));
+    DEV_ASSERT((duties != NULL) || (numberOfChannels == 0U));
+    status_t status = STATUS_SUCCESS;
+    uint8_t index;
+
+    #if (defined(PWM_OVER_EMIOS))
+    if (instance->instType == PWM_INST_TYPE_EMIOS)
+    {
+        pwm_emios_duty_regs_t regs[FEATURE_EMIOS_CH_COUNT];
+        uint32_t channelMask = 0UL;
+        uint32_t lastBus     = 0xFFFFFFFFUL;
+        uint32_t lastPeriod  = 0UL;
+        uint8_t emiosGroup   = (uint8_t)instance->instIdx;
+
+        /* The batch is staged in regs */
+        if (numberOfChannels > FEATURE_EMIOS_CH_COUNT)
+        {
+            status = STATUS_ERROR;
+        }
+
+        /* Validation pass: nothing is written if one channel is not valid */
+        for (index = 0U; (index < numberOfChannels) && (status == STATUS_SUCCESS); index++)
+        {
+            status = PWM_EMIOS_ComputeDutyRegs(emiosGroup, channels[index], duties[index], &lastBus, &lastPeriod, &regs[index]);
+            channelMask |= (1UL << regs[index].hwChannel);
+        }
+
+        if (status == STATUS_SUCCESS)
+        {
+            /* Stage the new values: the outputs keep the current ones */
+            EMIOS_DRV_DisableOutputUpdateMask(emiosGroup, channelMask);
+
+            for (index = 0U; index < numberOfChannels; index++)
+            {
+                EMIOS_SetUCRegA(emiosGroup, regs[index].restChannel, regs[index].regA);
+                if (regs[index].writeB)
+                {
+                    EMIOS_SetUCRegB(emiosGroup, regs[index].restChannel, regs[index].regB);
+                }
+            }
+
+            /* Release the batch: every channel takes its new value at the next period of its timebase */
+            EMIOS_DRV_EnableOutputUpdateMask(emiosGroup, channelMask);
+        }
+    }
+    else
+    #endif
+    {
+        /* No staging mechanism used: the channels are updated one after the other */
+        for (index = 0U; (index < numberOfChannels) && (status == STATUS_SUCCESS); index++)
+        {
+            status = PWM_UpdateDuty(instance, channels[index], duties[index]);
+        }
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_PrepareChannel
+ * Description   : Resolve a channel once for PWM_UpdateDutyFast(): register
+ * address, write strategy, counter bus and period of the timebase.
+ * Implements    : PWM_PrepareChannel_Activity
+ *
+ *END**************************************************************************/
+status_t PWM_PrepareChannel(const pwm_instance_t * const instance,
+                            uint8_t channel,
+                            pwm_channel_desc_t * desc)
+{
+    DEV_ASSERT(instance != NULL);
+    DEV_ASSERT(desc != NULL);
+    status_t status = STATUS_SUCCESS;
+
+    desc->reg           = NULL;
+    desc->strategy      = PWM_DUTY_WRITE_GENERIC;
+    desc->period        = 0UL;
+    desc->zeroDutyValue = 0UL;
+    desc->instance      = instance;
+    desc->channel       = channel;
+    desc->hwChannel     = channel;
+    desc->counterBus    = 0U;
+
+    #if (defined(PWM_OVER_EMIOS))
+    if (instance->instType == PWM_INST_TYPE_EMIOS)
+    {
+        pwm_emios_duty_regs_t regs;
+        uint32_t lastBus   = 0xFFFFFFFFUL;
+        uint32_t period    = 0UL;
+        uint8_t emiosGroup = (uint8_t)instance->instIdx;
+
+        status = PWM_EMIOS_ComputeDutyRegs(emiosGroup, channel, 0UL, &lastBus, &period, &regs);
+        if (status == STATUS_SUCCESS)
+        {
+            desc->period     = period;
+            desc->hwChannel  = regs.hwChannel;
+            desc->counterBus = (uint8_t)lastBus;
+            if (regs.writeB)
+            {
+                /* The leading edge stays at the period start */
+                EMIOS_SetUCRegA(emiosGroup, regs.restChannel, regs.regA);
+                desc->reg      = &eMIOS[emiosGroup]->UC[regs.restChannel].B;
+                desc->strategy = PWM_DUTY_WRITE_EMIOS_EDGE;
+            }
+            else
+            {
+                desc->reg           = &eMIOS[emiosGroup]->UC[regs.restChannel].A;
+                desc->strategy      = PWM_DUTY_WRITE_EMIOS_CENTER;
+                desc->zeroDutyValue = regs.regA;
+            }
+        }
+    }
+    #endif
+
+    return status;
+}
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : PWM_UpdatePeriod
@@ -1210,4 +1360,96 @@ static bool PWM_EMIOS_ValidateChannel(uint8_t inChVal, uint8_t * outChVal)
 
     return tmp;
 }
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_EMIOS_ComputeDutyRegs
+ * Description   : Computes the A and B register values that PWM_UpdateDuty would
+ * write for this duty cycle, without writing them. The period of the last timebase
+ * read is kept in lastBus/lastPeriod, so channels sharing a timebase read it once.
+ *END**************************************************************************/
+static status_t PWM_EMIOS_ComputeDutyRegs(uint8_t emiosGroup,
+                                          uint8_t channel,
+                                          uint32_t duty,
+                                          uint32_t * lastBus,
+                                          uint32_t * lastPeriod,
+                                          pwm_emios_duty_regs_t * regs)
+{
+    status_t status;
+    uint32_t control;
+    uint32_t busSel;
+    uint32_t busSelect = 0UL;
+    uint32_t period;
+
+    regs->hwChannel   = 0U;
+    regs->restChannel = 0U;
+
+    /* Get hardware Channel from virtual Channel */
+    status = PWM_EMIOS_VrChannelMapping(channel, &regs->hwChannel);
+    /* Validate channel support */
+    if ((status != STATUS_SUCCESS) || (PWM_EMIOS_ValidateChannel(regs->hwChannel, &regs->restChannel) == false))
+    {
+        return STATUS_ERROR;
+    }
+
+    control = eMIOS[emiosGroup]->UC[regs->restChannel].C;
+    busSel  = (control & eMIOS_C_BSL_MASK) >> eMIOS_C_BSL_SHIFT;
+    if (busSel == (uint32_t)EMIOS_BUS_SEL_A)
+    {
+        busSelect = (uint32_t)EMIOS_CNT_BUSA_DRIVEN;
+    }
+#if FEATURE_EMIOS_BUS_F_SELECT
+    else if (busSel == (uint32_t)EMIOS_BUS_SEL_F)
+    {
+        busSelect = (uint32_t)EMIOS_CNT_BUSF_DRIVEN;
+    }
+#endif
+    else if (busSel == (uint32_t)EMIOS_BUS_SEL_BCDE)
+    {
+        busSelect = (uint32_t)regs->hwChannel & 0xF8UL;
+    }
+    else
+    {
+        return STATUS_ERROR;
+    }
+
+    if (busSelect != *lastBus)
+    {
+        *lastPeriod = EMIOS_DRV_MC_GetCounterPeriod(emiosGroup, (uint8_t)busSelect);
+        *lastBus    = busSelect;
+    }
+    period = *lastPeriod;
+
+    if ((control & eMIOS_C_MODE_MASK) == (uint32_t)EMIOS_MODE_OPWMB_FLAGX1)
+    {
+        /* Leading edge at the period start, trailing edge after duty ticks */
+        regs->writeB = true;
+        regs->regA   = 1UL;
+        regs->regB   = ((duty < period) ? duty : period) + 1UL;
+    }
+    else if (((uint8_t)(control & eMIOS_C_MODE_MASK) & EMIOS_FILTER_OPWMCB) == EMIOS_MASK_OPWMCB)
+    {
+        /* Ideal duty cycle centered on the period */
+        regs->writeB = false;
+        regs->regB   = 0UL;
+        if (duty >= period)
+        {
+            regs->regA = 1UL;                           /* 100% duty cycle */
+        }
+        else if (duty == 0UL)
+        {
+            regs->regA = (period / 2UL) + 2UL;          /* 0% duty cycle */
+        }
+        else
+        {
+            regs->regA = ((period - duty) / 2UL) + 1UL;
+        }
+    }
+    else
+    {
+        status = STATUS_ERROR;
+    }
+
+    return status;
+}
 #endif
@@ -0,0 +1,309 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file pwm_svpwm.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 10.1, Unpermitted operand to operator.
+ * The Q15 products are scaled back with an arithmetic right shift of signed values.
+ */
+
+#include "pwm_svpwm.h"
+
+#if (defined(PWM_OVER_EMIOS))
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* sqrt(3) / 2 in Q15 */
+#define PWM_SVPWM_SQRT3_BY_2    28378
+
+/* 100 % duty cycle in Q15 */
+#define PWM_SVPWM_DUTY_FULL     32768
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_SVPWM_Sat16
+ * Description   : Saturates to the Q15 range.
+ *
+ *END**************************************************************************/
+static inline int16_t PWM_SVPWM_Sat16(int32_t value)
+{
+    int32_t ret = value;
+
+    if (ret > 32767)
+    {
+        ret = 32767;
+    }
+    else if (ret < -32768)
+    {
+        ret = -32768;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return (int16_t)ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_SVPWM_ToRegA
+ * Description   : Converts a Q15 duty cycle to the OPWMCB A register, as
+ * PWM_UpdateDuty() does: the pulse is centered on the period, so the
+ * register holds half of the off time. Pulses or gaps shorter than the dead
+ * time are removed.
+ *
+ *END**************************************************************************/
+static inline uint32_t PWM_SVPWM_ToRegA(const pwm_svpwm_state_t * state, int32_t duty)
+{
+    uint32_t period = state->period;
+    uint32_t ticks;
+    uint32_t ret;
+
+    if (duty <= 0)
+    {
+        ticks = 0UL;
+    }
+    else if (duty >= PWM_SVPWM_DUTY_FULL)
+    {
+        ticks = period;
+    }
+    else
+    {
+        /* Period is at most 16 bits, the product fits in 32 bits */
+        ticks = ((uint32_t)duty * period) >> 15U;
+    }
+
+    if (ticks < state->deadTime)
+    {
+        ticks = 0UL;
+    }
+    else if ((period - ticks) < state->deadTime)
+    {
+        ticks = period;
+    }
+    else
+    {
+        /* Longer than the dead time */
+    }
+
+    if (ticks >= period)
+    {
+        ret = 1UL;                              /* 100% duty cycle */
+    }
+    else if (ticks == 0UL)
+    {
+        ret = (period >> 1U) + 2UL;             /* 0% duty cycle */
+    }
+    else
+    {
+        ret = ((period - ticks) >> 1U) + 1UL;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_SVPWM_Init
+ * Description   : Resolves the three channels with PWM_PrepareChannel() and
+ * reads the dead times; the channels must share the counter bus so that their
+ * updates are taken on the same period.
+ *
+ * Implements    : PWM_SVPWM_Init_Activity
+ *END**************************************************************************/
+status_t PWM_SVPWM_Init(pwm_svpwm_state_t * state,
+                        const pwm_instance_t * const instance,
+                        const uint8_t channels[PWM_SVPWM_PHASES])
+{
+    pwm_channel_desc_t desc;
+    status_t status = STATUS_SUCCESS;
+    uint32_t deadTime;
+    uint8_t counterBus = 0U;
+    uint8_t phase;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(instance != NULL);
+    DEV_ASSERT(channels != NULL);
+
+    if (instance->instType != PWM_INST_TYPE_EMIOS)
+    {
+        return STATUS_UNSUPPORTED;
+    }
+
+    state->emiosGroup  = (uint8_t)instance->instIdx;
+    state->channelMask = 0UL;
+    state->period      = 0UL;
+    state->deadTime    = 0UL;
+
+    for (phase = 0U; (phase < PWM_SVPWM_PHASES) && (status == STATUS_SUCCESS); phase++)
+    {
+        status = PWM_PrepareChannel(instance, channels[phase], &desc);
+        if ((status != STATUS_SUCCESS) || (desc.strategy != PWM_DUTY_WRITE_EMIOS_CENTER) ||
+            ((phase > 0U) && ((desc.counterBus != counterBus) || (desc.period != state->period))))
+        {
+            status = STATUS_ERROR;
+        }
+        else
+        {
+            state->regA[phase]  = desc.reg;
+            state->period       = desc.period;
+            counterBus          = desc.counterBus;
+            state->channelMask |= (1UL << desc.hwChannel);
+            deadTime = EMIOS_DRV_PWM_GetCenterAlignDeadTime(state->emiosGroup, desc.hwChannel);
+            if (deadTime > state->deadTime)
+            {
+                state->deadTime = deadTime;
+            }
+        }
+    }
+
+    DEV_ASSERT((status != STATUS_SUCCESS) || (state->period <= 0xFFFFUL));
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_SVPWM_InvPark
+ * Description   : alpha = d.cos - q.sin, beta = d.sin + q.cos.
+ *
+ * Implements    : PWM_SVPWM_InvPark_Activity
+ *END**************************************************************************/
+void PWM_SVPWM_InvPark(int16_t d,
+                       int16_t q,
+                       int16_t sinTheta,
+                       int16_t cosTheta,
+                       int16_t * alpha,
+                       int16_t * beta)
+{
+    DEV_ASSERT(alpha != NULL);
+    DEV_ASSERT(beta != NULL);
+
+    *alpha = PWM_SVPWM_Sat16((((int32_t)d * cosTheta) - ((int32_t)q * sinTheta)) >> 15);
+    *beta  = PWM_SVPWM_Sat16((((int32_t)d * sinTheta) + ((int32_t)q * cosTheta)) >> 15);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_SVPWM_Modulate
+ * Description   : The inverse Clarke transform gives the phase voltages; half
+ * of the sum of the largest and smallest is subtracted from each, which
+ * centers the active vectors in the period as the space vector modulation
+ * does, and the result is offset by 50 %.
+ *
+ * Implements    : PWM_SVPWM_Modulate_Activity
+ *END**************************************************************************/
+void PWM_SVPWM_Modulate(const pwm_svpwm_state_t * state,
+                        int16_t alpha,
+                        int16_t beta,
+                        uint32_t regA[PWM_SVPWM_PHASES])
+{
+    int32_t phaseA;
+    int32_t phaseB;
+    int32_t phaseC;
+    int32_t betaPart;
+    int32_t maxValue;
+    int32_t minValue;
+    int32_t offset;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(regA != NULL);
+
+    betaPart = ((int32_t)beta * PWM_SVPWM_SQRT3_BY_2) >> 15;
+    phaseA = alpha;
+    phaseB = betaPart - ((int32_t)alpha >> 1);
+    phaseC = -betaPart - ((int32_t)alpha >> 1);
+
+    maxValue = (phaseA > phaseB) ? phaseA : phaseB;
+    maxValue = (maxValue > phaseC) ? maxValue : phaseC;
+    minValue = (phaseA < phaseB) ? phaseA : phaseB;
+    minValue = (minValue < phaseC) ? minValue : phaseC;
+    offset = (PWM_SVPWM_DUTY_FULL / 2) - ((maxValue + minValue) >> 1);
+
+    regA[0U] = PWM_SVPWM_ToRegA(state, phaseA + offset);
+    regA[1U] = PWM_SVPWM_ToRegA(state, phaseB + offset);
+    regA[2U] = PWM_SVPWM_ToRegA(state, phaseC + offset);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_SVPWM_Apply
+ * Description   : Stages the three A registers with the output update of the
+ * channels disabled and releases them with one write of OUDIS, as
+ * PWM_UpdateDutyMulti() does.
+ *
+ * Implements    : PWM_SVPWM_Apply_Activity
+ *END**************************************************************************/
+void PWM_SVPWM_Apply(const pwm_svpwm_state_t * state,
+                     const uint32_t regA[PWM_SVPWM_PHASES])
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(regA != NULL);
+
+    EMIOS_DRV_DisableOutputUpdateMask(state->emiosGroup, state->channelMask);
+    *state->regA[0U] = regA[0U];
+    *state->regA[1U] = regA[1U];
+    *state->regA[2U] = regA[2U];
+    EMIOS_DRV_EnableOutputUpdateMask(state->emiosGroup, state->channelMask);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_SVPWM_UpdateDQ
+ * Description   : Inverse Park, modulation and atomic write of the phases.
+ *
+ * Implements    : PWM_SVPWM_UpdateDQ_Activity
+ *END**************************************************************************/
+void PWM_SVPWM_UpdateDQ(const pwm_svpwm_state_t * state,
+                        int16_t d,
+                        int16_t q,
+                        int16_t sinTheta,
+                        int16_t cosTheta)
+{
+    uint32_t regA[PWM_SVPWM_PHASES];
+    int16_t alpha;
+    int16_t beta;
+
+    PWM_SVPWM_InvPark(d, q, sinTheta, cosTheta, &alpha, &beta);
+    PWM_SVPWM_Modulate(state, alpha, beta, regA);
+    PWM_SVPWM_Apply(state, regA);
+}
+
+#endif /* PWM_OVER_EMIOS */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,515 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file pwm_wave.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.4, Conversion between a pointer and integer type.
+ * The cast is required to pass the register, table and descriptor addresses to the eDMA.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.5, Conversion from pointer to void to pointer to other type.
+ * The eDMA callback parameter is the player state passed at installation.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.6, Cast from unsigned int to pointer.
+ * The aligned descriptor address is computed as an integer.
+ */
+
+#include <stddef.h>
+#include "pwm_wave.h"
+#include "emios_mc_driver.h"
+#include "emios_pwm_driver.h"
+#include "emios_hw_access.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Size of a table entry and of the B register */
+#define PWM_WAVE_ENTRY_SIZE    4U
+
+/* One tick in the dithering accumulator */
+#define PWM_WAVE_DITHER_ONE    0x10000U
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void PWM_WAVE_DmaCallback(void * parameter, edma_chn_status_t status);
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_GetPeriod
+ * Description   : Reads the period of the timebase of an OPWMB channel, or
+ * returns 0 if the channel is not in OPWMB mode.
+ *
+ *END**************************************************************************/
+static uint32_t PWM_WAVE_GetPeriod(uint8_t emiosGroup, uint8_t channel)
+{
+    uint8_t restChannel = 0U;
+    uint32_t busSel;
+    uint8_t busSelect;
+
+    if ((EMIOS_ValidateChannel(channel, &restChannel) == false) ||
+        (EMIOS_GetUCRegCMode(emiosGroup, restChannel) != (uint32_t)EMIOS_MODE_OPWMB_FLAGX1))
+    {
+        return 0U;
+    }
+
+    busSel = EMIOS_GetUCRegCBsl(emiosGroup, restChannel);
+    if (busSel == (uint32_t)EMIOS_BUS_SEL_A)
+    {
+        busSelect = (uint8_t)EMIOS_CNT_BUSA_DRIVEN;
+    }
+#if FEATURE_EMIOS_BUS_F_SELECT
+    else if (busSel == (uint32_t)EMIOS_BUS_SEL_F)
+    {
+        busSelect = (uint8_t)EMIOS_CNT_BUSF_DRIVEN;
+    }
+#endif
+    else if (busSel == (uint32_t)EMIOS_BUS_SEL_BCDE)
+    {
+        busSelect = (uint8_t)(channel & 0xF8U);
+    }
+    else
+    {
+        return 0U;
+    }
+
+    return EMIOS_DRV_MC_GetCounterPeriod(emiosGroup, busSelect);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_FillTransfer
+ * Description   : Describes one pass over a table: one entry per request into
+ * the B register, the source rewound at the end of the pass.
+ *
+ *END**************************************************************************/
+static void PWM_WAVE_FillTransfer(const pwm_wave_state_t * state,
+                                  const uint32_t * table,
+                                  uint32_t tableLength,
+                                  edma_loop_transfer_config_t * loopConfig,
+                                  edma_transfer_config_t * transferConfig)
+{
+    loopConfig->majorLoopIterationCount = tableLength;
+    loopConfig->srcOffsetEnable = false;
+    loopConfig->dstOffsetEnable = false;
+    loopConfig->minorLoopOffset = 0;
+    loopConfig->minorLoopChnLinkEnable = false;
+    loopConfig->minorLoopChnLinkNumber = 0U;
+    loopConfig->majorLoopChnLinkEnable = false;
+    loopConfig->majorLoopChnLinkNumber = 0U;
+
+    transferConfig->srcAddr = (uint32_t)table;
+    transferConfig->destAddr = (uint32_t)&eMIOS[state->config.emiosGroup]->UC[state->unifiedChannel].B;
+    transferConfig->srcTransferSize = EDMA_TRANSFER_SIZE_4B;
+    transferConfig->destTransferSize = EDMA_TRANSFER_SIZE_4B;
+    transferConfig->srcOffset = (int16_t)PWM_WAVE_ENTRY_SIZE;
+    transferConfig->destOffset = 0;
+    transferConfig->srcLastAddrAdjust = -(int32_t)(tableLength * PWM_WAVE_ENTRY_SIZE);
+    transferConfig->destLastAddrAdjust = 0;
+    transferConfig->srcModulo = EDMA_MODULO_OFF;
+    transferConfig->destModulo = EDMA_MODULO_OFF;
+    transferConfig->minorByteTransferCount = PWM_WAVE_ENTRY_SIZE;
+    transferConfig->scatterGatherEnable = false;
+    transferConfig->scatterGatherNextDescAddr = 0U;
+    transferConfig->interruptEnable = (state->config.mode != PWM_WAVE_MODE_LOOP);
+    transferConfig->loopTransferConfig = loopConfig;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_LoadTransfer
+ * Description   : Writes the transfer of the current table to the eDMA channel.
+ * In loop mode the channel reloads the descriptor of the table from memory at
+ * the end of each pass (scatter/gather), so the link can be redirected to the
+ * descriptor of another table.
+ *
+ *END**************************************************************************/
+static status_t PWM_WAVE_LoadTransfer(pwm_wave_state_t * state)
+{
+    const pwm_wave_user_config_t * config = &state->config;
+    edma_loop_transfer_config_t loopConfig;
+    edma_transfer_config_t transferConfig;
+    status_t status;
+
+    PWM_WAVE_FillTransfer(state, config->table, config->tableLength, &loopConfig, &transferConfig);
+
+    if (config->mode == PWM_WAVE_MODE_LOOP)
+    {
+        transferConfig.scatterGatherEnable = true;
+        transferConfig.scatterGatherNextDescAddr = (uint32_t)&state->tcd[state->activeTcd];
+        EDMA_DRV_PushConfigToSTCD(&transferConfig, &state->tcd[state->activeTcd]);
+    }
+
+    status = EDMA_DRV_ConfigLoopTransfer(config->dmaVirtualChannel, &transferConfig);
+    if (status == STATUS_SUCCESS)
+    {
+        EDMA_DRV_ConfigureInterrupt(config->dmaVirtualChannel, EDMA_CHN_HALF_MAJOR_LOOP_INT,
+                                    (config->mode == PWM_WAVE_MODE_PING_PONG));
+        EDMA_DRV_DisableRequestsOnTransferComplete(config->dmaVirtualChannel,
+                                                   (config->mode == PWM_WAVE_MODE_ONE_SHOT));
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_DmaCallback
+ * Description   : eDMA interrupt handler. In ping-pong mode the half just played
+ * is deduced from the remaining major loop count, as in the ADC stream: more
+ * than half of the table left means the counter was reloaded, so the second
+ * half was played. In loop mode the interrupt is only enabled on the first pass
+ * over a swapped table.
+ *
+ *END**************************************************************************/
+static void PWM_WAVE_DmaCallback(void * parameter, edma_chn_status_t status)
+{
+    pwm_wave_state_t * state = (pwm_wave_state_t *)parameter;
+    const pwm_wave_user_config_t * config = &state->config;
+    uint32_t half = config->tableLength / 2U;
+    uint32_t first = 0U;
+    uint32_t count = config->tableLength;
+    pwm_wave_event_t event;
+
+    if (status == EDMA_CHN_ERROR)
+    {
+        (void)PWM_WAVE_Stop(state);
+        if (config->callback != NULL)
+        {
+            config->callback(0U, 0U, PWM_WAVE_EVENT_DMA_ERROR, config->callbackParam);
+        }
+        return;
+    }
+
+    switch (config->mode)
+    {
+        case PWM_WAVE_MODE_ONE_SHOT:
+            state->running = false;
+            EMIOS_SetUCRegCFen(config->emiosGroup, state->unifiedChannel, 0UL);
+            event = PWM_WAVE_EVENT_DONE;
+            break;
+        case PWM_WAVE_MODE_PING_PONG:
+            if (EDMA_DRV_GetRemainingMajorIterationsCount(config->dmaVirtualChannel) > half)
+            {
+                event = PWM_WAVE_EVENT_FULL;
+                first = half;
+            }
+            else
+            {
+                event = PWM_WAVE_EVENT_HALF;
+            }
+            count = half;
+            break;
+        default:
+            /* The next reloads of the descriptor must not interrupt any more */
+            state->tcd[state->activeTcd].CSR &= (uint16_t)~DMA_TCD_CSR_INTMAJOR_MASK;
+            EDMA_DRV_ConfigureInterrupt(config->dmaVirtualChannel, EDMA_CHN_MAJOR_LOOP_INT, false);
+            state->swapPending = false;
+            event = PWM_WAVE_EVENT_SWAPPED;
+            break;
+    }
+
+    if (config->callback != NULL)
+    {
+        config->callback(first, count, event, config->callbackParam);
+    }
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_BuildTable
+ * Description   : Converts duty cycles to B register values; the leading edge
+ * is at count 1, so the trailing edge is at duty + 1.
+ *
+ * Implements    : PWM_WAVE_BuildTable_Activity
+ *END**************************************************************************/
+status_t PWM_WAVE_BuildTable(uint8_t emiosGroup,
+                             uint8_t channel,
+                             const uint32_t * duties,
+                             uint32_t * table,
+                             uint32_t count)
+{
+    uint32_t period;
+    uint32_t duty;
+    uint32_t idx;
+
+    DEV_ASSERT(emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+    DEV_ASSERT((duties != NULL) || (count == 0U));
+    DEV_ASSERT((table != NULL) || (count == 0U));
+
+    period = PWM_WAVE_GetPeriod(emiosGroup, channel);
+    if (period == 0U)
+    {
+        return STATUS_ERROR;
+    }
+
+    for (idx = 0U; idx < count; idx++)
+    {
+        duty = duties[idx];
+        table[idx] = ((duty < period) ? duty : (period - 1U)) + 1U;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_BuildDitherTable
+ * Description   : First-order sigma-delta: the fractional part of the target,
+ * in 1/65536 tick, is accumulated and each carry adds one tick to the entry.
+ * The accumulator starts at one half, so the number of carries over the table
+ * is the fractional part times count, rounded.
+ *
+ * Implements    : PWM_WAVE_BuildDitherTable_Activity
+ *END**************************************************************************/
+status_t PWM_WAVE_BuildDitherTable(uint8_t emiosGroup,
+                                   uint8_t channel,
+                                   uint16_t duty,
+                                   uint32_t * table,
+                                   uint32_t count)
+{
+    uint64_t target;
+    uint32_t period;
+    uint32_t whole;
+    uint32_t fraction;
+    uint32_t accumulator = PWM_WAVE_DITHER_ONE / 2U;
+    uint32_t ticks;
+    uint32_t idx;
+
+    DEV_ASSERT(emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+    DEV_ASSERT((table != NULL) || (count == 0U));
+
+    period = PWM_WAVE_GetPeriod(emiosGroup, channel);
+    if (period == 0U)
+    {
+        return STATUS_ERROR;
+    }
+
+    target = (uint64_t)duty * period;
+    whole = (uint32_t)(target >> 16U);
+    fraction = (uint32_t)target & (PWM_WAVE_DITHER_ONE - 1U);
+
+    for (idx = 0U; idx < count; idx++)
+    {
+        accumulator += fraction;
+        ticks = whole;
+        if (accumulator >= PWM_WAVE_DITHER_ONE)
+        {
+            accumulator -= PWM_WAVE_DITHER_ONE;
+            ticks++;
+        }
+        table[idx] = ((ticks < period) ? ticks : (period - 1U)) + 1U;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_Init
+ * Description   : Loads the transfer of the table and assigns the channel FLAG
+ * to the DMA request; the requests are enabled by PWM_WAVE_Start().
+ *
+ * Implements    : PWM_WAVE_Init_Activity
+ *END**************************************************************************/
+status_t PWM_WAVE_Init(pwm_wave_state_t * state, const pwm_wave_user_config_t * config)
+{
+    status_t status;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->emiosGroup < EMIOS_NUMBER_GROUP_MAX);
+    DEV_ASSERT(config->table != NULL);
+    DEV_ASSERT((config->tableLength > 0U) && (config->tableLength <= PWM_WAVE_MAX_TABLE_LENGTH));
+    DEV_ASSERT((config->mode != PWM_WAVE_MODE_PING_PONG) || ((config->tableLength % 2U) == 0U));
+
+    if (PWM_WAVE_GetPeriod(config->emiosGroup, config->channel) == 0U)
+    {
+        return STATUS_ERROR;
+    }
+
+    state->config = *config;
+    (void)EMIOS_ValidateChannel(config->channel, &state->unifiedChannel);
+    state->tcd = (edma_software_tcd_t *)STCD_ADDR(state->tcdMemory);
+    state->activeTcd = 0U;
+    state->swapPending = false;
+    state->running = false;
+
+    status = PWM_WAVE_LoadTransfer(state);
+    if (status == STATUS_SUCCESS)
+    {
+        status = EDMA_DRV_InstallCallback(config->dmaVirtualChannel, PWM_WAVE_DmaCallback, state);
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        EMIOS_SetUCRegCFen(config->emiosGroup, state->unifiedChannel, 0UL);
+        EMIOS_SetUCRegCDma(config->emiosGroup, state->unifiedChannel, 1UL);
+    }
+    else
+    {
+        status = STATUS_ERROR;
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_Start
+ * Description   : Rewinds the transfer, clears the pending FLAG and enables the
+ * requests; the first entry is written on the next trailing edge match.
+ *
+ * Implements    : PWM_WAVE_Start_Activity
+ *END**************************************************************************/
+status_t PWM_WAVE_Start(pwm_wave_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    const pwm_wave_user_config_t * config = &state->config;
+
+    if (state->running)
+    {
+        return STATUS_BUSY;
+    }
+
+    (void)PWM_WAVE_LoadTransfer(state);
+    state->running = true;
+
+    EMIOS_DRV_ClrFlagState(config->emiosGroup, config->channel);
+    (void)EDMA_DRV_StartChannel(config->dmaVirtualChannel);
+    EMIOS_SetUCRegCFen(config->emiosGroup, state->unifiedChannel, 1UL);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_Stop
+ * Description   : Disables the requests of the channel and of the eDMA; a
+ * pending table swap is dropped with them.
+ *
+ * Implements    : PWM_WAVE_Stop_Activity
+ *END**************************************************************************/
+status_t PWM_WAVE_Stop(pwm_wave_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    EMIOS_SetUCRegCFen(state->config.emiosGroup, state->unifiedChannel, 0UL);
+    (void)EDMA_DRV_StopChannel(state->config.dmaVirtualChannel);
+    state->swapPending = false;
+    state->running = false;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_SwapTable
+ * Description   : In loop mode, writes the descriptor of the new table to the
+ * free slot and links the running descriptor to it, both in the channel and in
+ * memory: if the pass ends between the two writes, the channel reloads the
+ * old descriptor, already linked to the new one, and switches one pass later.
+ *
+ * Implements    : PWM_WAVE_SwapTable_Activity
+ *END**************************************************************************/
+status_t PWM_WAVE_SwapTable(pwm_wave_state_t * state, const uint32_t * table, uint32_t tableLength)
+{
+    edma_loop_transfer_config_t loopConfig;
+    edma_transfer_config_t transferConfig;
+    volatile edma_software_tcd_t * active;
+    uint8_t next;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(table != NULL);
+    DEV_ASSERT((tableLength > 0U) && (tableLength <= PWM_WAVE_MAX_TABLE_LENGTH));
+
+    if (state->config.mode == PWM_WAVE_MODE_PING_PONG)
+    {
+        return STATUS_UNSUPPORTED;
+    }
+
+    if (!state->running)
+    {
+        state->config.table = table;
+        state->config.tableLength = tableLength;
+        return PWM_WAVE_LoadTransfer(state);
+    }
+
+    if ((state->config.mode == PWM_WAVE_MODE_ONE_SHOT) || state->swapPending)
+    {
+        return STATUS_BUSY;
+    }
+
+    next = state->activeTcd ^ 1U;
+    PWM_WAVE_FillTransfer(state, table, tableLength, &loopConfig, &transferConfig);
+    transferConfig.scatterGatherEnable = true;
+    transferConfig.scatterGatherNextDescAddr = (uint32_t)&state->tcd[next];
+    /* Report the end of the first pass over the new table */
+    transferConfig.interruptEnable = true;
+    EDMA_DRV_PushConfigToSTCD(&transferConfig, &state->tcd[next]);
+
+    active = &state->tcd[state->activeTcd];
+    state->swapPending = true;
+    state->activeTcd = next;
+    state->config.table = table;
+    state->config.tableLength = tableLength;
+
+    active->DLAST_SGA = (int32_t)transferConfig.scatterGatherNextDescAddr;
+    EDMA_DRV_SetScatterGatherLink(state->config.dmaVirtualChannel, transferConfig.scatterGatherNextDescAddr);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PWM_WAVE_Deinit
+ * Description   : Stops the playback and assigns the FLAG back to the
+ * interrupt request.
+ *
+ * Implements    : PWM_WAVE_Deinit_Activity
+ *END**************************************************************************/
+status_t PWM_WAVE_Deinit(pwm_wave_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    (void)PWM_WAVE_Stop(state);
+    (void)EDMA_DRV_InstallCallback(state->config.dmaVirtualChannel, NULL, NULL);
+    EMIOS_SetUCRegCDma(state->config.emiosGroup, state->unifiedChannel, 0UL);
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,416 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file stm_wheel_test.c
+ *
+ * Host unit tests of the STM timer wheel driver.
+ *
+ * The STM counter is a 64-bit simulated time truncated to 32 bits, and the
+ * compare channel raises the interrupt when the counter reaches the programmed
+ * value. STM_DRV_WHEEL_Process() is called as soon as the wheel is due, so each
+ * timer must expire exactly on the first wheel tick at or after its deadline;
+ * the test checks this against a 64-bit model of every timer.
+ *
+ *   make test     runs TEST_TIMERS timers with random delays and periods,
+ *                 random stops and restarts, and idle gaps with an empty wheel,
+ *                 across several wraps of the counter, for tick shifts of 0, 4,
+ *                 10 and 16, and the idle gap regression of an empty wheel
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm_wheel_driver.h"
+#include "interrupt_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_TIMERS         6000U
+#define TEST_STEPS          60000U
+#define TEST_IDLE_EVERY     4000U
+#define TEST_MIN_PERIOD     0x00400000UL
+
+#define CHECK(cond)    TEST_Check((cond), #cond, __LINE__)
+
+/* Model of a timer */
+typedef struct
+{
+    stm_wheel_timer_t timer;
+    bool running;
+    uint64_t expiry;                    /* Expiry, in wheel ticks since the start */
+    uint64_t period;                    /* Period in wheel ticks, 0 for a one-shot timer */
+} test_timer_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_failures = 0U;
+static uint32_t s_checks = 0U;
+static uint32_t s_seed = 2019U;
+
+/* Simulated STM: time in STM ticks, of which the counter is the low 32 bits */
+static uint64_t s_time;
+static uint32_t s_compare;
+static bool s_armed;
+
+/* Time and tick shift of the wheel start */
+static uint64_t s_start;
+static uint8_t s_tickShift;
+
+static test_timer_t s_timers[TEST_TIMERS];
+static uint32_t s_expired;
+
+/*******************************************************************************
+ * Simulated STM and interrupt controller
+ ******************************************************************************/
+
+uint32_t STM_DRV_GetCounterValue(const uint32_t instance)
+{
+    (void)instance;
+
+    return (uint32_t)s_time;
+}
+
+void STM_DRV_ConfigChannel(const uint32_t instance,
+                           const uint8_t channel,
+                           const uint32_t compareValue)
+{
+    (void)instance;
+    (void)channel;
+
+    s_compare = compareValue;
+    s_armed = true;
+}
+
+void STM_DRV_DisableChannel(const uint32_t instance,
+                            const uint8_t channel)
+{
+    (void)instance;
+    (void)channel;
+
+    s_armed = false;
+}
+
+void STM_DRV_ClearStatusFlags(const uint32_t instance,
+                              const uint8_t channel)
+{
+    (void)instance;
+    (void)channel;
+}
+
+void INT_SYS_InstallHandler(IRQn_Type irqNumber,
+                            const isr_t newHandler,
+                            isr_t * const oldHandler)
+{
+    (void)irqNumber;
+    (void)newHandler;
+    (void)oldHandler;
+}
+
+void INT_SYS_SetPriority(IRQn_Type irqNumber, uint8_t priority)
+{
+    (void)irqNumber;
+    (void)priority;
+}
+
+void INT_SYS_EnableIRQ(IRQn_Type irqNumber)
+{
+    (void)irqNumber;
+}
+
+void INT_SYS_DisableIRQ(IRQn_Type irqNumber)
+{
+    (void)irqNumber;
+}
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char * text, int line)
+{
+    s_checks++;
+    if (!cond)
+    {
+        s_failures++;
+        printf("FAIL line %d: %s\n", line, text);
+    }
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+static uint32_t TEST_Random32(void)
+{
+    uint32_t high = TEST_Random() << 16U;
+
+    return high ^ TEST_Random();
+}
+
+/* Random value up to the given maximum, spread over all the magnitudes */
+static uint32_t TEST_RandomSpread(uint32_t max)
+{
+    uint32_t value = TEST_Random32();
+
+    value >>= TEST_Random() % 32U;
+
+    return (value > max) ? max : value;
+}
+
+/* Current wheel tick of the model */
+static uint64_t TEST_Tick(void)
+{
+    return (s_time - s_start) >> s_tickShift;
+}
+
+static void TEST_Callback(stm_wheel_timer_t * timer, void * userData)
+{
+    test_timer_t * model = (test_timer_t *)userData;
+    uint64_t tick = TEST_Tick();
+
+    CHECK(&model->timer == timer);
+    CHECK(model->running);
+    /* Neither early nor late */
+    CHECK(model->expiry == tick);
+
+    if (model->period != 0U)
+    {
+        model->expiry += model->period;
+        CHECK(STM_DRV_WHEEL_IsTimerRunning(timer));
+    }
+    else
+    {
+        model->running = false;
+        CHECK(!STM_DRV_WHEEL_IsTimerRunning(timer));
+    }
+    s_expired++;
+}
+
+/* Calls the wheel as long as it is due, as the main loop of an application does */
+static void TEST_Process(void)
+{
+    while (STM_DRV_WHEEL_IsPending())
+    {
+        (void)STM_DRV_WHEEL_Process();
+    }
+}
+
+/* Runs the simulated STM up to the given time, taking the compare interrupts */
+static void TEST_RunTo(uint64_t time)
+{
+    uint64_t match;
+    uint32_t distance;
+
+    TEST_Process();
+    for (;;)
+    {
+        distance = s_compare - (uint32_t)s_time;
+        /* A match at the current time has been taken or reported by the driver */
+        match = s_time + ((distance == 0U) ? 0x100000000ULL : (uint64_t)distance);
+        if ((!s_armed) || (match > time))
+        {
+            break;
+        }
+        s_time = match;
+        STM_DRV_WHEEL_IRQHandler();
+        TEST_Process();
+    }
+    s_time = time;
+}
+
+static void TEST_Start(test_timer_t * model, uint32_t delay, uint32_t period)
+{
+    uint64_t mask = (1ULL << s_tickShift) - 1U;
+
+    STM_DRV_WHEEL_StartTimer(&model->timer, delay, period);
+    model->running = true;
+    /* First wheel tick at or after the deadline */
+    model->expiry = ((s_time - s_start) + delay + mask) >> s_tickShift;
+    model->period = ((uint64_t)period + mask) >> s_tickShift;
+    TEST_Process();
+}
+
+static void TEST_Stop(test_timer_t * model)
+{
+    STM_DRV_WHEEL_StopTimer(&model->timer);
+    model->running = false;
+}
+
+static void TEST_InitWheel(uint8_t tickShift, uint32_t counter)
+{
+    stm_wheel_config_t config;
+    static stm_wheel_state_t state;
+
+    memset(&config, 0, sizeof(config));
+    config.tickShift = tickShift;
+
+    s_time = counter;
+    s_armed = false;
+    s_start = s_time;
+    s_tickShift = tickShift;
+    CHECK(STM_DRV_WHEEL_Init(&state, &config) == STATUS_SUCCESS);
+}
+
+/*******************************************************************************
+ * Tests
+ ******************************************************************************/
+
+/* Random timers against the model */
+static void TEST_RandomTimers(uint8_t tickShift)
+{
+    test_timer_t * model;
+    uint64_t tick;
+    uint32_t step;
+    uint32_t action;
+    uint32_t i;
+
+    /* The counter wraps early in the run, and several times afterwards */
+    TEST_InitWheel(tickShift, 0xFFFFFFFFUL - (TEST_Random32() >> 8U));
+    s_expired = 0U;
+    for (i = 0U; i < TEST_TIMERS; i++)
+    {
+        s_timers[i].running = false;
+        STM_DRV_WHEEL_InitTimer(&s_timers[i].timer, TEST_Callback, &s_timers[i]);
+    }
+
+    for (step = 0U; step < TEST_STEPS; step++)
+    {
+        TEST_RunTo(s_time + TEST_RandomSpread(0x01000000UL));
+
+        model = &s_timers[TEST_Random() % TEST_TIMERS];
+        action = TEST_Random() % 16U;
+        if (action < 9U)
+        {
+            /* Start or restart */
+            TEST_Start(model, TEST_RandomSpread(STM_WHEEL_MAX_TICKS), 0U);
+        }
+        else if (action < 10U)
+        {
+            TEST_Start(model, TEST_RandomSpread(STM_WHEEL_MAX_TICKS),
+                       TEST_MIN_PERIOD + TEST_RandomSpread(STM_WHEEL_MAX_TICKS - TEST_MIN_PERIOD));
+        }
+        else if (action < 15U)
+        {
+            TEST_Stop(model);
+        }
+        else
+        {
+            /* Call from another wake-up of the application */
+            (void)STM_DRV_WHEEL_Process();
+            TEST_Process();
+        }
+
+        if ((step % TEST_IDLE_EVERY) == (TEST_IDLE_EVERY - 1U))
+        {
+            /* Empty wheel, idle for up to a whole wrap of the counter */
+            for (i = 0U; i < TEST_TIMERS; i++)
+            {
+                TEST_Stop(&s_timers[i]);
+            }
+            TEST_RunTo(s_time + TEST_RandomSpread(0xFFFFFFFFUL));
+        }
+    }
+
+    /* No timer left behind */
+    TEST_RunTo(s_time + 0x80000000ULL + (1ULL << tickShift));
+    tick = TEST_Tick();
+    for (i = 0U; i < TEST_TIMERS; i++)
+    {
+        if (s_timers[i].running)
+        {
+            CHECK(s_timers[i].expiry > tick);
+            TEST_Stop(&s_timers[i]);
+        }
+    }
+
+    printf("  tick shift %2u: %u expiries over %.1f counter wraps\n", tickShift, s_expired,
+           (double)(s_time - s_start) / 4294967296.0);
+
+    STM_DRV_WHEEL_Deinit();
+}
+
+/* A timer started after an idle gap of more than half the wheel clock range, from
+ * an empty wheel whose channel is disabled, expires after its delay */
+static void TEST_IdleGap(void)
+{
+    test_timer_t * model = &s_timers[0];
+
+    TEST_InitWheel(0U, 0x12345678UL);
+    STM_DRV_WHEEL_InitTimer(&model->timer, TEST_Callback, model);
+    s_expired = 0U;
+
+    TEST_Start(model, 1000U, 0U);
+    TEST_RunTo(s_time + 1000U);
+    CHECK(s_expired == 1U);
+    CHECK(!s_armed);
+
+    /* Idle for 0xC0000000 ticks, then started with a short delay */
+    TEST_RunTo(s_time + 0xC0000000ULL);
+    TEST_Start(model, 1000U, 0U);
+    CHECK(s_expired == 1U);
+    TEST_RunTo(s_time + 999U);
+    CHECK(s_expired == 1U);
+    TEST_RunTo(s_time + 1U);
+    CHECK(s_expired == 2U);
+
+    /* Same with a periodic timer restarted after the gap */
+    TEST_Start(model, 500U, 2000U);
+    TEST_RunTo(s_time + 500U);
+    CHECK(s_expired == 3U);
+    TEST_Stop(model);
+    TEST_RunTo(s_time + 0xF0000000ULL);
+    TEST_Start(model, 2000U, 2000U);
+    TEST_RunTo(s_time + 1999U);
+    CHECK(s_expired == 3U);
+    TEST_RunTo(s_time + 1U + 2000U);
+    CHECK(s_expired == 5U);
+    TEST_Stop(model);
+
+    STM_DRV_WHEEL_Deinit();
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(void)
+{
+    static const uint8_t tickShifts[] = { 0U, 4U, 10U, 16U };
+    uint32_t i;
+
+    TEST_IdleGap();
+    for (i = 0U; i < (sizeof(tickShifts) / sizeof(tickShifts[0])); i++)
+    {
+        TEST_RandomTimers(tickShifts[i]);
+    }
+
+    printf("stm_wheel: %u checks, %u failures\n", s_checks, s_failures);
+
+    return (s_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
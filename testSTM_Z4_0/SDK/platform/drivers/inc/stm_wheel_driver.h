@@ -0,0 +1,266 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef STM_WHEEL_DRIVER_H
+#define STM_WHEEL_DRIVER_H
+
+#include <stddef.h>
+#include "stm_driver.h"
+
+/*!
+ * @defgroup stm_wheel_driver STM Timer Wheel Driver
+ * @ingroup stm
+ * @brief Software timers multiplexed on one STM compare channel
+ *
+ * Any number of one-shot and periodic software timers run from a single STM channel.
+ * The timers are held in a hierarchical timing wheel of STM_WHEEL_LEVEL_COUNT levels
+ * of STM_WHEEL_SLOT_COUNT slots: a timer is stored in the level of the highest digit
+ * (STM_WHEEL_SLOT_BITS bits) in which its expiry differs from the wheel time, and is
+ * moved down a level each time the wheel reaches its slot, until it reaches the lowest
+ * level and expires. Starting and stopping a timer link or unlink it from one slot
+ * list, in constant time whatever the number of timers.
+ *
+ * The wheel does not tick. The STM channel is programmed with the next time the wheel
+ * has work to do, found from a bitmap of the occupied slots of each level, and the
+ * wheel jumps to it: either the expiry of a timer of the lowest level, or the time a
+ * slot of a higher level is reached and its timers are moved down. The interrupt
+ * handler only records that the wheel is due and calls the optional notification, so
+ * its duration does not depend on the number of timers.
+ * The timers are moved and their callbacks called by STM_DRV_WHEEL_Process(), from the
+ * context chosen by the application, typically its main loop or a low priority
+ * software interrupt raised by the notification.
+ *
+ * The wheel counts in ticks of 2^tickShift STM ticks. A timer expires on the first
+ * wheel tick at or after its deadline, so it never expires early and expires at most
+ * one wheel tick, plus the latency of STM_DRV_WHEEL_Process(), late.
+ *
+ * Only STM_DRV_WHEEL_IRQHandler() runs in the STM interrupt; all the other functions,
+ * including the timer callbacks, must be called from the same context. The STM
+ * instance must be initialized and started by the application.
+ *
+ * @addtogroup stm_wheel_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of bits of the wheel time selecting a slot in a level */
+#define STM_WHEEL_SLOT_BITS     5U
+
+/*! @brief Number of slots in a level */
+#define STM_WHEEL_SLOT_COUNT    (1UL << STM_WHEEL_SLOT_BITS)
+
+/*! @brief Number of levels of the wheel */
+#define STM_WHEEL_LEVEL_COUNT   5U
+
+/*! @brief Number of timer lists: the slots of all the levels, the expired timers and the
+ *         timers whose callbacks are being called */
+#define STM_WHEEL_LIST_COUNT    ((STM_WHEEL_LEVEL_COUNT * STM_WHEEL_SLOT_COUNT) + 2U)
+
+/*! @brief Largest timer delay and period, in STM ticks */
+#define STM_WHEEL_MAX_TICKS     0x7FFFFFFFUL
+
+typedef struct stm_wheel_timer stm_wheel_timer_t;
+
+/*!
+ * @brief Timer callback
+ *
+ * Called from STM_DRV_WHEEL_Process(). The callback may start and stop any timer,
+ * including the one it is called for.
+ *
+ * Implements : stm_wheel_callback_t_Class
+ */
+typedef void (* stm_wheel_callback_t)(stm_wheel_timer_t * timer, void * userData);
+
+/*!
+ * @brief Notification of a due wheel
+ *
+ * Called from the STM interrupt when STM_DRV_WHEEL_Process() has work to do.
+ *
+ * Implements : stm_wheel_notify_t_Class
+ */
+typedef void (* stm_wheel_notify_t)(void);
+
+/*!
+ * @brief Software timer
+ *
+ * Allocated by the application, which must not access the fields.
+ *
+ * Implements : stm_wheel_timer_t_Class
+ */
+struct stm_wheel_timer
+{
+    stm_wheel_timer_t * next;           /*!< Next timer in the list */
+    stm_wheel_timer_t ** link;          /*!< Pointer to this timer in the list */
+    uint32_t expiry;                    /*!< Expiry, in wheel ticks */
+    uint32_t period;                    /*!< Period in wheel ticks, 0 for a one-shot timer */
+    stm_wheel_callback_t callback;      /*!< Callback */
+    void * userData;                    /*!< Parameter of the callback */
+    uint8_t list;                       /*!< List holding the timer, 0xFF if stopped */
+};
+
+/*!
+ * @brief Configuration of the timer wheel
+ *
+ * Implements : stm_wheel_config_t_Class
+ */
+typedef struct
+{
+    uint32_t stmInstance;               /*!< STM instance */
+    uint8_t stmChannel;                 /*!< STM channel programmed with the next event */
+    uint8_t priority;                   /*!< Priority of the STM channel interrupt */
+    uint8_t tickShift;                  /*!< Wheel tick of 2^tickShift STM ticks, 0 to 16 */
+    stm_wheel_notify_t notify;          /*!< Notification from the interrupt, or NULL */
+} stm_wheel_config_t;
+
+/*!
+ * @brief Runtime state of the timer wheel
+ *
+ * The fields are internal to the driver and must not be accessed by the application.
+ *
+ * Implements : stm_wheel_state_t_Class
+ */
+typedef struct
+{
+    stm_wheel_timer_t * lists[STM_WHEEL_LIST_COUNT];    /*!< Timer lists */
+    uint32_t occupied[STM_WHEEL_LEVEL_COUNT];           /*!< Non-empty slots of each level */
+    uint32_t wheelTime;                                 /*!< Time reached by the wheel */
+    uint32_t clockTicks;                                /*!< Last wheel tick read from the STM */
+    uint32_t clockStm;                                  /*!< STM counter at clockTicks */
+    volatile bool pending;                              /*!< The wheel is due */
+    stm_wheel_notify_t notify;                          /*!< Notification */
+    uint32_t stmInstance;                               /*!< STM instance */
+    uint8_t stmChannel;                                 /*!< STM channel */
+    uint8_t tickShift;                                  /*!< Wheel tick in STM ticks, log2 */
+} stm_wheel_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the timer wheel
+ *
+ * Installs the handler of the STM channel and enables its interrupt. No timer is
+ * running.
+ *
+ * @param[out] state  Pointer to the driver state structure; must stay valid until
+ *                    STM_DRV_WHEEL_Deinit().
+ * @param[in]  config Pointer to the driver configuration.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if the driver is already initialized.
+ */
+status_t STM_DRV_WHEEL_Init(stm_wheel_state_t * state,
+                            const stm_wheel_config_t * config);
+
+/*!
+ * @brief Stops the timer wheel
+ *
+ * Disables the STM channel and its interrupt. The running timers are abandoned and
+ * must be initialized again before being reused.
+ */
+void STM_DRV_WHEEL_Deinit(void);
+
+/*!
+ * @brief Initializes a timer
+ *
+ * @param[out] timer    The timer.
+ * @param[in]  callback Function called when the timer expires.
+ * @param[in]  userData Parameter of the callback.
+ */
+void STM_DRV_WHEEL_InitTimer(stm_wheel_timer_t * timer,
+                             stm_wheel_callback_t callback,
+                             void * userData);
+
+/*!
+ * @brief Starts a timer
+ *
+ * A running timer is restarted. The period is rounded up to a whole number of wheel
+ * ticks; a periodic timer which falls more than one period behind skips the periods
+ * it missed instead of expiring in a burst.
+ *
+ * @param[in] timer       The timer.
+ * @param[in] delayTicks  Delay before the first expiry, in STM ticks, up to
+ *                        STM_WHEEL_MAX_TICKS.
+ * @param[in] periodTicks Period in STM ticks, up to STM_WHEEL_MAX_TICKS, or 0 for a
+ *                        one-shot timer.
+ */
+void STM_DRV_WHEEL_StartTimer(stm_wheel_timer_t * timer,
+                              uint32_t delayTicks,
+                              uint32_t periodTicks);
+
+/*!
+ * @brief Stops a timer
+ *
+ * Does nothing if the timer is not running.
+ *
+ * @param[in] timer The timer.
+ */
+void STM_DRV_WHEEL_StopTimer(stm_wheel_timer_t * timer);
+
+/*!
+ * @brief Returns whether a timer is running
+ *
+ * @param[in] timer The timer.
+ * @return    true if the timer is running, including an expired timer whose callback
+ *            has not been called yet.
+ */
+bool STM_DRV_WHEEL_IsTimerRunning(const stm_wheel_timer_t * timer);
+
+/*!
+ * @brief Returns whether the wheel is due
+ *
+ * @return    true if STM_DRV_WHEEL_Process() has work to do.
+ */
+bool STM_DRV_WHEEL_IsPending(void);
+
+/*!
+ * @brief Advances the wheel to the current time
+ *
+ * Moves down the timers of the slots reached, calls the callbacks of the expired
+ * timers and programs the STM channel with the next event.
+ *
+ * @return    The number of callbacks called.
+ */
+uint32_t STM_DRV_WHEEL_Process(void);
+
+/*!
+ * @brief Interrupt handler of the STM channel
+ *
+ * Installed by STM_DRV_WHEEL_Init().
+ */
+void STM_DRV_WHEEL_IRQHandler(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* STM_WHEEL_DRIVER_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
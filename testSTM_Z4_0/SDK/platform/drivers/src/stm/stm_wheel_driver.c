@@ -0,0 +1,623 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*!
+ * @file stm_wheel_driver.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.9, An object should be defined at block scope
+ * if its identifier only appears in a single function.
+ * The driver state is shared by the interrupt handler and the application functions.
+ */
+
+#include "stm_wheel_driver.h"
+#include "interrupt_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Mask of a slot index */
+#define STM_WHEEL_SLOT_MASK     (STM_WHEEL_SLOT_COUNT - 1UL)
+
+/* Number of slots of all the levels */
+#define STM_WHEEL_SLOT_LISTS    (STM_WHEEL_LEVEL_COUNT * STM_WHEEL_SLOT_COUNT)
+
+/* List of the expired timers, and of the timers whose callbacks are being called */
+#define STM_WHEEL_LIST_EXPIRED  STM_WHEEL_SLOT_LISTS
+#define STM_WHEEL_LIST_READY    (STM_WHEEL_SLOT_LISTS + 1U)
+
+/* List index of a stopped timer */
+#define STM_WHEEL_LIST_NONE     0xFFU
+
+/* Largest distance, in wheel ticks, of a slot of the highest level from the wheel
+ * time. A later timer is stored at this distance and moved again when reached. */
+#define STM_WHEEL_MAX_DELTA     (STM_WHEEL_SLOT_MASK << ((STM_WHEEL_LEVEL_COUNT - 1U) * STM_WHEEL_SLOT_BITS))
+
+/* Largest time the STM channel is programmed ahead, so that the counter is read at
+ * least twice per wrap and the wheel clock is never ambiguous */
+#define STM_WHEEL_MAX_SLEEP     0x40000000UL
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Driver state */
+static stm_wheel_state_t * s_wheelState = NULL;
+
+/* STM channel vectors */
+static const IRQn_Type s_stmIrqs[STM_INSTANCE_COUNT][STM_CHANNEL_COUNT] = STM_IRQS;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_HighestSetBit
+ * Description   : Returns the index of the most significant bit set in a
+ * non-zero value.
+ *
+ *END**************************************************************************/
+static inline uint32_t STM_WHEEL_HighestSetBit(uint32_t value)
+{
+#if defined(__GNUC__)
+    return 31U - (uint32_t)__builtin_clz(value);
+#else
+    uint32_t bitIdx = 0U;
+    uint32_t x = value;
+
+    if ((x & 0xFFFF0000UL) != 0U) { bitIdx += 16U; x >>= 16U; }
+    if ((x & 0x0000FF00UL) != 0U) { bitIdx += 8U; x >>= 8U; }
+    if ((x & 0x000000F0UL) != 0U) { bitIdx += 4U; x >>= 4U; }
+    if ((x & 0x0000000CUL) != 0U) { bitIdx += 2U; x >>= 2U; }
+    if ((x & 0x00000002UL) != 0U) { bitIdx += 1U; }
+
+    return bitIdx;
+#endif
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_Link
+ * Description   : Adds a timer at the head of a list.
+ *
+ *END**************************************************************************/
+static void STM_WHEEL_Link(stm_wheel_state_t * state,
+                           stm_wheel_timer_t * timer,
+                           uint32_t list)
+{
+    timer->next = state->lists[list];
+    if (timer->next != NULL)
+    {
+        timer->next->link = &timer->next;
+    }
+    state->lists[list] = timer;
+    timer->link = &state->lists[list];
+    timer->list = (uint8_t)list;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_Unlink
+ * Description   : Removes a timer from its list, and clears the bit of its
+ * slot if the slot becomes empty.
+ *
+ *END**************************************************************************/
+static void STM_WHEEL_Unlink(stm_wheel_state_t * state,
+                             stm_wheel_timer_t * timer)
+{
+    uint32_t list = timer->list;
+
+    *timer->link = timer->next;
+    if (timer->next != NULL)
+    {
+        timer->next->link = timer->link;
+    }
+    if ((list < STM_WHEEL_SLOT_LISTS) && (state->lists[list] == NULL))
+    {
+        state->occupied[list >> STM_WHEEL_SLOT_BITS] &= ~(1UL << (list & STM_WHEEL_SLOT_MASK));
+    }
+    timer->list = STM_WHEEL_LIST_NONE;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_Insert
+ * Description   : Stores a timer in the level of the highest digit in which
+ * its expiry differs from the wheel time, in the slot of this digit, or in the
+ * expired list if the expiry has been reached.
+ *
+ *END**************************************************************************/
+static void STM_WHEEL_Insert(stm_wheel_state_t * state,
+                             stm_wheel_timer_t * timer)
+{
+    uint32_t now = state->wheelTime;
+    uint32_t delta = timer->expiry - now;
+    uint32_t target = timer->expiry;
+    uint32_t level;
+    uint32_t slot;
+
+    if ((delta == 0U) || (delta > 0x7FFFFFFFUL))
+    {
+        STM_WHEEL_Link(state, timer, STM_WHEEL_LIST_EXPIRED);
+    }
+    else
+    {
+        if (delta > STM_WHEEL_MAX_DELTA)
+        {
+            target = now + STM_WHEEL_MAX_DELTA;
+        }
+        level = STM_WHEEL_HighestSetBit(target ^ now) / STM_WHEEL_SLOT_BITS;
+        if (level >= STM_WHEEL_LEVEL_COUNT)
+        {
+            /* The expiry differs above the highest level only by a carry */
+            level = STM_WHEEL_LEVEL_COUNT - 1U;
+        }
+        slot = (target >> (level * STM_WHEEL_SLOT_BITS)) & STM_WHEEL_SLOT_MASK;
+        state->occupied[level] |= 1UL << slot;
+        STM_WHEEL_Link(state, timer, (level << STM_WHEEL_SLOT_BITS) + slot);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_Cascade
+ * Description   : Empties a slot reached by the wheel, storing its timers
+ * again from the new wheel time.
+ *
+ *END**************************************************************************/
+static void STM_WHEEL_Cascade(stm_wheel_state_t * state,
+                              uint32_t list)
+{
+    stm_wheel_timer_t * timer = state->lists[list];
+    stm_wheel_timer_t * next;
+
+    state->lists[list] = NULL;
+    state->occupied[list >> STM_WHEEL_SLOT_BITS] &= ~(1UL << (list & STM_WHEEL_SLOT_MASK));
+
+    while (timer != NULL)
+    {
+        next = timer->next;
+        STM_WHEEL_Insert(state, timer);
+        timer = next;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_NextEvent
+ * Description   : Finds the distance from the wheel time to the nearest
+ * occupied slot. The slots of a level are all ahead of its current slot, in the
+ * current turn of the level, so the nearest one is the first bit set after the
+ * current slot in the bitmap rotated circularly.
+ *
+ *END**************************************************************************/
+static bool STM_WHEEL_NextEvent(const stm_wheel_state_t * state,
+                                uint32_t * distance)
+{
+    uint32_t now = state->wheelTime;
+    uint32_t nearest = 0xFFFFFFFFUL;
+    uint32_t bitmap;
+    uint32_t shift;
+    uint32_t rotate;
+    uint32_t slots;
+    uint32_t event;
+    uint32_t level;
+    bool found = false;
+
+    for (level = 0U; level < STM_WHEEL_LEVEL_COUNT; level++)
+    {
+        bitmap = state->occupied[level];
+        if (bitmap != 0U)
+        {
+            shift = level * STM_WHEEL_SLOT_BITS;
+            rotate = ((now >> shift) & STM_WHEEL_SLOT_MASK) + 1U;
+            if (rotate < STM_WHEEL_SLOT_COUNT)
+            {
+                bitmap = (bitmap >> rotate) | (bitmap << (STM_WHEEL_SLOT_COUNT - rotate));
+            }
+            /* Lowest bit set of the rotated bitmap */
+            slots = STM_WHEEL_HighestSetBit(bitmap & (0UL - bitmap)) + 1U;
+            event = (((now >> shift) + slots) << shift) - now;
+            if (event < nearest)
+            {
+                nearest = event;
+            }
+            found = true;
+        }
+    }
+
+    *distance = nearest;
+
+    return found;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_Advance
+ * Description   : Moves the wheel to the given time, jumping from one occupied
+ * slot to the next. At each slot reached the higher levels are emptied first,
+ * so that their timers reach the lower levels before these are emptied.
+ *
+ *END**************************************************************************/
+static void STM_WHEEL_Advance(stm_wheel_state_t * state,
+                              uint32_t target)
+{
+    uint32_t distance;
+    uint32_t shift;
+    uint32_t slot;
+    uint32_t level;
+
+    while (STM_WHEEL_NextEvent(state, &distance) && (distance <= (target - state->wheelTime)))
+    {
+        state->wheelTime += distance;
+        for (level = STM_WHEEL_LEVEL_COUNT; level > 0U; level--)
+        {
+            shift = (level - 1U) * STM_WHEEL_SLOT_BITS;
+            if ((state->wheelTime & ((1UL << shift) - 1U)) == 0U)
+            {
+                slot = (state->wheelTime >> shift) & STM_WHEEL_SLOT_MASK;
+                if ((state->occupied[level - 1U] & (1UL << slot)) != 0U)
+                {
+                    STM_WHEEL_Cascade(state, ((level - 1U) << STM_WHEEL_SLOT_BITS) + slot);
+                }
+            }
+        }
+    }
+
+    state->wheelTime = target;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_ReadClock
+ * Description   : Reads the STM counter and returns the current wheel tick,
+ * with the STM ticks elapsed since its start.
+ *
+ *END**************************************************************************/
+static uint32_t STM_WHEEL_ReadClock(stm_wheel_state_t * state,
+                                    uint32_t * remainder)
+{
+    uint32_t counter = STM_DRV_GetCounterValue(state->stmInstance);
+    uint32_t elapsed = (counter - state->clockStm) >> state->tickShift;
+
+    state->clockStm += elapsed << state->tickShift;
+    state->clockTicks += elapsed;
+    *remainder = counter - state->clockStm;
+
+    return state->clockTicks;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_WHEEL_Arm
+ * Description   : Programs the STM channel with the next event of the wheel.
+ * The STM compare only matches on equality, so if the counter has already
+ * passed the compare value the wheel is marked due.
+ *
+ *END**************************************************************************/
+static void STM_WHEEL_Arm(stm_wheel_state_t * state)
+{
+    uint32_t distance;
+    uint32_t compare;
+    int32_t ahead;
+
+    if (state->lists[STM_WHEEL_LIST_EXPIRED] != NULL)
+    {
+        state->pending = true;
+    }
+    else if (!STM_WHEEL_NextEvent(state, &distance))
+    {
+        STM_DRV_DisableChannel(state->stmInstance, state->stmChannel);
+    }
+    else
+    {
+        ahead = (int32_t)((state->wheelTime + distance) - state->clockTicks);
+        if (ahead > (int32_t)(STM_WHEEL_MAX_SLEEP >> state->tickShift))
+        {
+            ahead = (int32_t)(STM_WHEEL_MAX_SLEEP >> state->tickShift);
+        }
+        compare = state->clockStm + ((uint32_t)ahead << state->tickShift);
+        STM_DRV_ConfigChannel(state->stmInstance, state->stmChannel, compare);
+        if ((int32_t)(STM_DRV_GetCounterValue(state->stmInstance) - compare) >= 0)
+        {
+            state->pending = true;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_Init
+ * Description   : Empties the wheel, starts its clock from the STM counter
+ * and installs the handler of the STM channel.
+ *
+ * Implements    : STM_DRV_WHEEL_Init_Activity
+ *END**************************************************************************/
+status_t STM_DRV_WHEEL_Init(stm_wheel_state_t * state,
+                            const stm_wheel_config_t * config)
+{
+    uint32_t i;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->stmInstance < STM_INSTANCE_COUNT);
+    DEV_ASSERT(config->stmChannel < STM_CHANNEL_COUNT);
+    DEV_ASSERT(config->tickShift <= 16U);
+
+    if (s_wheelState != NULL)
+    {
+        return STATUS_BUSY;
+    }
+
+    for (i = 0U; i < STM_WHEEL_LIST_COUNT; i++)
+    {
+        state->lists[i] = NULL;
+    }
+    for (i = 0U; i < STM_WHEEL_LEVEL_COUNT; i++)
+    {
+        state->occupied[i] = 0U;
+    }
+    state->stmInstance = config->stmInstance;
+    state->stmChannel = config->stmChannel;
+    state->tickShift = config->tickShift;
+    state->notify = config->notify;
+    state->pending = false;
+    state->wheelTime = 0U;
+    state->clockTicks = 0U;
+    state->clockStm = STM_DRV_GetCounterValue(config->stmInstance);
+
+    s_wheelState = state;
+
+    STM_DRV_DisableChannel(config->stmInstance, config->stmChannel);
+    STM_DRV_ClearStatusFlags(config->stmInstance, config->stmChannel);
+    INT_SYS_InstallHandler(s_stmIrqs[config->stmInstance][config->stmChannel], STM_DRV_WHEEL_IRQHandler, (isr_t *)0);
+    INT_SYS_SetPriority(s_stmIrqs[config->stmInstance][config->stmChannel], config->priority);
+    INT_SYS_EnableIRQ(s_stmIrqs[config->stmInstance][config->stmChannel]);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_Deinit
+ * Description   : Disables the STM channel and its interrupt.
+ *
+ * Implements    : STM_DRV_WHEEL_Deinit_Activity
+ *END**************************************************************************/
+void STM_DRV_WHEEL_Deinit(void)
+{
+    stm_wheel_state_t * state = s_wheelState;
+
+    DEV_ASSERT(state != NULL);
+
+    INT_SYS_DisableIRQ(s_stmIrqs[state->stmInstance][state->stmChannel]);
+    STM_DRV_DisableChannel(state->stmInstance, state->stmChannel);
+    STM_DRV_ClearStatusFlags(state->stmInstance, state->stmChannel);
+
+    s_wheelState = NULL;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_InitTimer
+ * Description   : Initializes a stopped timer.
+ *
+ * Implements    : STM_DRV_WHEEL_InitTimer_Activity
+ *END**************************************************************************/
+void STM_DRV_WHEEL_InitTimer(stm_wheel_timer_t * timer,
+                             stm_wheel_callback_t callback,
+                             void * userData)
+{
+    DEV_ASSERT(timer != NULL);
+    DEV_ASSERT(callback != NULL);
+
+    timer->next = NULL;
+    timer->link = NULL;
+    timer->expiry = 0U;
+    timer->period = 0U;
+    timer->callback = callback;
+    timer->userData = userData;
+    timer->list = STM_WHEEL_LIST_NONE;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_StartTimer
+ * Description   : Computes the expiry as the first wheel tick at or after the
+ * deadline, advances the wheel to the current tick, stores the timer and
+ * programs the STM channel again, in case the timer is the nearest event.
+ * Timers reached by the advance are moved to the expired list and the wheel is
+ * marked due.
+ *
+ * Implements    : STM_DRV_WHEEL_StartTimer_Activity
+ *END**************************************************************************/
+void STM_DRV_WHEEL_StartTimer(stm_wheel_timer_t * timer,
+                              uint32_t delayTicks,
+                              uint32_t periodTicks)
+{
+    stm_wheel_state_t * state = s_wheelState;
+    uint32_t mask;
+    uint32_t remainder;
+    uint32_t now;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(timer != NULL);
+    DEV_ASSERT(timer->callback != NULL);
+    DEV_ASSERT(delayTicks <= STM_WHEEL_MAX_TICKS);
+    DEV_ASSERT(periodTicks <= STM_WHEEL_MAX_TICKS);
+
+    if (timer->list != STM_WHEEL_LIST_NONE)
+    {
+        STM_WHEEL_Unlink(state, timer);
+    }
+
+    mask = (1UL << state->tickShift) - 1U;
+    now = STM_WHEEL_ReadClock(state, &remainder);
+    /* The wheel time stays behind while the wheel is empty and the channel
+     * disabled: the expiry is compared with the current time, not the stale one */
+    STM_WHEEL_Advance(state, now);
+    timer->expiry = now + ((delayTicks + remainder + mask) >> state->tickShift);
+    timer->period = (periodTicks + mask) >> state->tickShift;
+
+    STM_WHEEL_Insert(state, timer);
+    STM_WHEEL_Arm(state);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_StopTimer
+ * Description   : Removes the timer from its list. The STM channel is left
+ * programmed; if the timer was the nearest event, the wheel wakes up for
+ * nothing once.
+ *
+ * Implements    : STM_DRV_WHEEL_StopTimer_Activity
+ *END**************************************************************************/
+void STM_DRV_WHEEL_StopTimer(stm_wheel_timer_t * timer)
+{
+    stm_wheel_state_t * state = s_wheelState;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(timer != NULL);
+
+    if (timer->list != STM_WHEEL_LIST_NONE)
+    {
+        STM_WHEEL_Unlink(state, timer);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_IsTimerRunning
+ * Description   : Returns whether the timer is in a list.
+ *
+ * Implements    : STM_DRV_WHEEL_IsTimerRunning_Activity
+ *END**************************************************************************/
+bool STM_DRV_WHEEL_IsTimerRunning(const stm_wheel_timer_t * timer)
+{
+    DEV_ASSERT(timer != NULL);
+
+    return (timer->list != STM_WHEEL_LIST_NONE);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_IsPending
+ * Description   : Returns whether the wheel is due.
+ *
+ * Implements    : STM_DRV_WHEEL_IsPending_Activity
+ *END**************************************************************************/
+bool STM_DRV_WHEEL_IsPending(void)
+{
+    DEV_ASSERT(s_wheelState != NULL);
+
+    return s_wheelState->pending;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_Process
+ * Description   : Advances the wheel to the STM counter and calls the
+ * callbacks of the expired timers. The expired timers are moved to a separate
+ * list first, so that a timer started again from its callback with no delay
+ * expires on the next call instead of being called back in a loop. A periodic
+ * timer is stored again before its callback, which may stop it.
+ *
+ * Implements    : STM_DRV_WHEEL_Process_Activity
+ *END**************************************************************************/
+uint32_t STM_DRV_WHEEL_Process(void)
+{
+    stm_wheel_state_t * state = s_wheelState;
+    stm_wheel_timer_t * timer;
+    uint32_t remainder;
+    uint32_t count = 0U;
+
+    DEV_ASSERT(state != NULL);
+
+    /* Cleared before reading the counter, so that a later interrupt is not lost */
+    state->pending = false;
+    STM_WHEEL_Advance(state, STM_WHEEL_ReadClock(state, &remainder));
+
+    state->lists[STM_WHEEL_LIST_READY] = state->lists[STM_WHEEL_LIST_EXPIRED];
+    state->lists[STM_WHEEL_LIST_EXPIRED] = NULL;
+    if (state->lists[STM_WHEEL_LIST_READY] != NULL)
+    {
+        state->lists[STM_WHEEL_LIST_READY]->link = &state->lists[STM_WHEEL_LIST_READY];
+    }
+
+    timer = state->lists[STM_WHEEL_LIST_READY];
+    while (timer != NULL)
+    {
+        STM_WHEEL_Unlink(state, timer);
+        if (timer->period != 0U)
+        {
+            timer->expiry += timer->period;
+            if ((int32_t)(timer->expiry - state->wheelTime) <= 0)
+            {
+                /* Periods missed */
+                timer->expiry = state->wheelTime + timer->period;
+            }
+            STM_WHEEL_Insert(state, timer);
+        }
+        timer->callback(timer, timer->userData);
+        count++;
+        timer = state->lists[STM_WHEEL_LIST_READY];
+    }
+
+    STM_WHEEL_Arm(state);
+
+    return count;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : STM_DRV_WHEEL_IRQHandler
+ * Description   : Compare interrupt of the STM channel. The channel is left
+ * enabled: STM_DRV_WHEEL_Process() programs it again long before the counter
+ * wraps back to the same compare value.
+ *
+ * Implements    : STM_DRV_WHEEL_IRQHandler_Activity
+ *END**************************************************************************/
+void STM_DRV_WHEEL_IRQHandler(void)
+{
+    stm_wheel_state_t * state = s_wheelState;
+
+    DEV_ASSERT(state != NULL);
+
+    STM_DRV_ClearStatusFlags(state->stmInstance, state->stmChannel);
+    state->pending = true;
+    if (state->notify != NULL)
+    {
+        state->notify();
+    }
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -45,21 +45,31 @@
 
   volatile int exit_code = 0;
 /* User includes (#include below this line is not maintained by Processor Expert) */
+#include "stm_wheel_driver.h"
 #define PORT	PTA
 #define LED		10
 
 uint32_t ticks;	/* The number of ticks */
 
-void STM0_Ch0_IRQHandler(void)
+/* Software timers on STM0 channel 0, with a wheel tick of 2^10 system clock cycles */
+stm_wheel_state_t wheelState;
+const stm_wheel_config_t wheelConfig = {
+    .stmInstance = INST_STM0,
+    .stmChannel  = 0U,
+    .priority    = 1U,
+    .tickShift   = 10U,
+    .notify      = NULL
+};
+stm_wheel_timer_t ledTimer;
+
+void ledTimerCallback(stm_wheel_timer_t *timer, void *userData)
 {
-    /* Clear channel interrupt flag */
-    STM_DRV_ClearStatusFlags(INST_STM0, stm0_ChnConfig0.channel);
+    (void)timer;
+    (void)userData;
     /* Toggle Led to check period */
     PINS_DRV_TogglePins(PORT, (1 << LED));
-    /* Increase the number of ticks in compare register to create a periodic for next event */
-    STM_DRV_IncrementTicks(INST_STM0, stm0_ChnConfig0.channel, ticks);
-
 }
+
 /*! 
   \brief The main function for the project.
   \details The startup initialization sequence is the following:
@@ -89,13 +99,20 @@ int main(void)
     STM_DRV_Init(INST_STM0, &stm0_InitConfig0);
     /* Compute the number of ticks from microseconds */
     STM_DRV_ComputeTicksByUs(INST_STM0,1000000U, &ticks);					//usΪλ㶨ʱʱ
-    /* Initialize channel 0 */
-    stm0_ChnConfig0.compareValue = ticks;									//趨ȽϼĴֵ
-    STM_DRV_InitChannel(INST_STM0, &stm0_ChnConfig0);						//ʼSTM_00ͨ
-    /* Enable Interrupt for STM0 channel 0 */
-    INT_SYS_EnableIRQ(STM0_Ch0_IRQn);										//ʹSTM0 channel0жϺ36ΪSTM_0_CIR0[CIF]
     /* Start running the common timer counter */
     STM_DRV_StartTimer(INST_STM0);											//STMSTMƼĴSTM_CR[TEN]1
+    /* Toggle the Led every second from a periodic software timer */
+    STM_DRV_WHEEL_Init(&wheelState, &wheelConfig);
+    STM_DRV_WHEEL_InitTimer(&ledTimer, ledTimerCallback, NULL);
+    STM_DRV_WHEEL_StartTimer(&ledTimer, ticks, ticks);
+    /* Run the timer callbacks when the wheel is due */
+    for (;;)
+    {
+        if (STM_DRV_WHEEL_IsPending())
+        {
+            (void)STM_DRV_WHEEL_Process();
+        }
+    }
 
 
 
@@ -0,0 +1,335 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file host_platform.c
+ *
+ * Host replacements for the platform services used by the application before
+ * the UART PAL is initialized. Clocks and pins do not exist on the host, so the
+ * generated configurations are accepted and ignored.
+ *
+ * The GPIO capture runs on the eDMA and PIT replacements below: starting the PIT
+ * completes the capture at once, with all the inputs low, so that the export is
+ * sent over the UART as on the target.
+ */
+
+#include "Cpu.h"
+#include "pit_driver.h"
+
+/* PIT clock reported to the capture */
+#define HOST_PIT_CLOCK      40000000UL
+
+/* eDMA channel triggered by the PIT */
+static uint32_t s_dmaMajorCount = 0U;
+static uint32_t s_dmaRemaining = 0U;
+static edma_callback_t s_dmaCallback = NULL;
+static void * s_dmaCallbackParam = NULL;
+static bool s_dmaStarted = false;
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : CLOCK_SYS_Init
+ * Description   : Accepts the generated clock configurations.
+ *
+ *END**************************************************************************/
+status_t CLOCK_SYS_Init(clock_manager_user_config_t const **clockConfigsPtr,
+                        uint8_t configsNumber,
+                        clock_manager_callback_user_config_t **callbacksPtr,
+                        uint8_t callbacksNumber)
+{
+    (void)clockConfigsPtr;
+    (void)configsNumber;
+    (void)callbacksPtr;
+    (void)callbacksNumber;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : CLOCK_SYS_UpdateConfiguration
+ * Description   : Accepts the clock configuration switch.
+ *
+ *END**************************************************************************/
+status_t CLOCK_SYS_UpdateConfiguration(uint8_t targetConfigIndex,
+                                       clock_manager_policy_t policy)
+{
+    (void)targetConfigIndex;
+    (void)policy;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_Init
+ * Description   : Accepts the generated pin configuration.
+ *
+ *END**************************************************************************/
+status_t PINS_DRV_Init(uint32_t pinCount,
+                       const pin_settings_config_t config[])
+{
+    (void)pinCount;
+    (void)config;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : CLOCK_SYS_GetFreq
+ * Description   : Reports the PIT clock.
+ *
+ *END**************************************************************************/
+status_t CLOCK_SYS_GetFreq(clock_names_t clockName,
+                           uint32_t *frequency)
+{
+    (void)clockName;
+    *frequency = HOST_PIT_CLOCK;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_Init
+ * Description   : Accepts the generated eDMA configuration.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_Init(edma_state_t * edmaState,
+                       const edma_user_config_t *userConfig,
+                       edma_chn_state_t * const chnStateArray[],
+                       const edma_channel_config_t * const chnConfigArray[],
+                       uint32_t chnCount)
+{
+    (void)edmaState;
+    (void)userConfig;
+    (void)chnStateArray;
+    (void)chnConfigArray;
+    (void)chnCount;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_SetChannelRequestAndTrigger
+ * Description   : Accepts the request routing.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_SetChannelRequestAndTrigger(uint8_t virtualChannel,
+                                              uint8_t request,
+                                              bool enableTrigger)
+{
+    (void)virtualChannel;
+    (void)request;
+    (void)enableTrigger;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_ConfigLoopTransfer
+ * Description   : Records the major loop count.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_ConfigLoopTransfer(uint8_t virtualChannel,
+                                     const edma_transfer_config_t *transferConfig)
+{
+    (void)virtualChannel;
+    s_dmaMajorCount = transferConfig->loopTransferConfig->majorLoopIterationCount;
+    s_dmaRemaining = s_dmaMajorCount;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_DisableRequestsOnTransferComplete
+ * Description   : Accepts the request disabling.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_DisableRequestsOnTransferComplete(uint8_t virtualChannel,
+                                                bool disable)
+{
+    (void)virtualChannel;
+    (void)disable;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_InstallCallback
+ * Description   : Records the channel callback.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_InstallCallback(uint8_t virtualChannel,
+                                  edma_callback_t callback,
+                                  void *parameter)
+{
+    (void)virtualChannel;
+    s_dmaCallback = callback;
+    s_dmaCallbackParam = parameter;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_SetDestAddr
+ * Description   : Accepts the destination; the capture buffer stays as is.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_SetDestAddr(uint8_t virtualChannel,
+                          uint32_t address)
+{
+    (void)virtualChannel;
+    (void)address;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_SetMajorLoopIterationCount
+ * Description   : Rewinds the major loop.
+ *
+ *END**************************************************************************/
+void EDMA_DRV_SetMajorLoopIterationCount(uint8_t virtualChannel,
+                                         uint32_t majorLoopCount)
+{
+    (void)virtualChannel;
+    s_dmaMajorCount = majorLoopCount;
+    s_dmaRemaining = majorLoopCount;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_StartChannel
+ * Description   : Enables the requests.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_StartChannel(uint8_t virtualChannel)
+{
+    (void)virtualChannel;
+    s_dmaStarted = true;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_StopChannel
+ * Description   : Disables the requests.
+ *
+ *END**************************************************************************/
+status_t EDMA_DRV_StopChannel(uint8_t virtualChannel)
+{
+    (void)virtualChannel;
+    s_dmaStarted = false;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_ClearPendingInterrupt
+ * Description   : The completion is reported at once, so none is pending.
+ *
+ *END**************************************************************************/
+bool EDMA_DRV_ClearPendingInterrupt(uint8_t virtualChannel)
+{
+    (void)virtualChannel;
+
+    return false;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_GetRemainingMajorIterationsCount
+ * Description   : Returns the position in the major loop.
+ *
+ *END**************************************************************************/
+uint32_t EDMA_DRV_GetRemainingMajorIterationsCount(uint8_t virtualChannel)
+{
+    (void)virtualChannel;
+
+    return s_dmaRemaining;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PIT_DRV_Init
+ * Description   : Accepts the PIT configuration.
+ *
+ *END**************************************************************************/
+void PIT_DRV_Init(const uint32_t instance,
+                  const pit_config_t * const config)
+{
+    (void)instance;
+    (void)config;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PIT_DRV_InitChannel
+ * Description   : Accepts the channel configuration.
+ *
+ *END**************************************************************************/
+status_t PIT_DRV_InitChannel(const uint32_t instance,
+                             const pit_channel_config_t * const chnlConfig)
+{
+    (void)instance;
+    (void)chnlConfig;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PIT_DRV_StartChannel
+ * Description   : Runs the triggered eDMA channel through one whole major
+ * loop and reports its completion.
+ *
+ *END**************************************************************************/
+void PIT_DRV_StartChannel(const uint32_t instance,
+                          const uint8_t channel)
+{
+    (void)instance;
+    (void)channel;
+
+    if (s_dmaStarted && (s_dmaCallback != NULL))
+    {
+        s_dmaRemaining = s_dmaMajorCount;
+        s_dmaCallback(s_dmaCallbackParam, EDMA_CHN_NORMAL);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PIT_DRV_StopChannel
+ * Description   : Stops the triggers.
+ *
+ *END**************************************************************************/
+void PIT_DRV_StopChannel(const uint32_t instance,
+                         const uint8_t channel)
+{
+    (void)instance;
+    (void)channel;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,578 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file uart_framing_test.c
+ *
+ * Host unit tests and benchmarks of the UART framing layer.
+ *
+ *   make test     runs the unit tests
+ *   make bench    also prints the cycles per byte of the CRCs, the encoders
+ *                 and the decoders, next to a bitwise CRC and a two-pass
+ *                 (CRC then stuffing) encoder
+ *
+ * Cycles are read from the time stamp counter on x86 hosts and derived from
+ * nanoseconds (1 cycle per ns) elsewhere. They compare the implementations
+ * with each other; they are not e200z4 cycle counts.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "uart_framing.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_MAX_PAYLOAD    1024U
+#define TEST_MAX_FRAMES     8U
+#define TEST_RANDOM_ROUNDS  2000U
+
+#define BENCH_SIZE          4096U
+#define BENCH_ROUNDS        2000U
+
+#define CHECK(cond)    TEST_Check((cond), #cond, __LINE__)
+
+/* Frames and events collected by the receive callback */
+typedef struct
+{
+    uint32_t frames;
+    uint32_t frameSize[TEST_MAX_FRAMES];
+    uint8_t frame[TEST_MAX_FRAMES][TEST_MAX_PAYLOAD];
+    uint32_t events[4];
+} test_rx_log_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_failures = 0U;
+static uint32_t s_checks = 0U;
+static uint32_t s_seed = 12345U;
+
+static uint32_t s_uartSent = 0U;
+static bool s_uartBusy = false;
+
+static const uart_framing_type_t s_types[] = { UART_FRAMING_COBS, UART_FRAMING_SLIP };
+static const uart_framing_crc_t s_crcs[] = { UART_FRAMING_CRC_NONE, UART_FRAMING_CRC_16, UART_FRAMING_CRC_32 };
+
+/*******************************************************************************
+ * UART PAL replacements for UART_FRAMING_SendFrame
+ ******************************************************************************/
+
+status_t UART_GetTransmitStatus(const uart_instance_t * const instance, uint32_t * bytesRemaining)
+{
+    (void)instance;
+    *bytesRemaining = s_uartBusy ? 1U : 0U;
+
+    return s_uartBusy ? STATUS_BUSY : STATUS_SUCCESS;
+}
+
+status_t UART_SendData(const uart_instance_t * const instance, const uint8_t * txBuff, uint32_t txSize)
+{
+    (void)instance;
+    (void)txBuff;
+    s_uartSent = txSize;
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char * text, int line)
+{
+    s_checks++;
+    if (!cond)
+    {
+        s_failures++;
+        printf("FAIL line %d: %s\n", line, text);
+    }
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+static void TEST_RxCallback(const uint8_t * frame,
+                            uint32_t frameSize,
+                            uart_framing_event_t event,
+                            void * userData)
+{
+    test_rx_log_t * log = (test_rx_log_t *)userData;
+
+    log->events[event]++;
+    if ((event == UART_FRAMING_EVENT_FRAME_RECEIVED) &&
+        (log->frames < TEST_MAX_FRAMES) &&
+        (frameSize <= TEST_MAX_PAYLOAD))
+    {
+        memcpy(log->frame[log->frames], frame, frameSize);
+        log->frameSize[log->frames] = frameSize;
+        log->frames++;
+    }
+}
+
+static void TEST_InitChannel(uart_framing_state_t * state,
+                             uart_framing_type_t type,
+                             uart_framing_crc_t crc,
+                             uint8_t * rxBuff,
+                             uint32_t rxBuffSize,
+                             test_rx_log_t * log)
+{
+    const uart_framing_user_config_t config =
+    {
+        .framingType = type,
+        .crcType = crc,
+        .rxFrameBuff = rxBuff,
+        .rxFrameBuffSize = rxBuffSize,
+        .rxCallback = TEST_RxCallback,
+        .rxCallbackParam = log
+    };
+
+    memset(log, 0, sizeof(*log));
+    CHECK(UART_FRAMING_Init(state, &config) == STATUS_SUCCESS);
+}
+
+/* Feeds the line bytes to the decoder in random slices */
+static void TEST_FeedSlices(uart_framing_state_t * state, const uint8_t * line, uint32_t size)
+{
+    uint32_t idx = 0U;
+    uint32_t slice;
+
+    while (idx < size)
+    {
+        slice = 1U + (TEST_Random() % 64U);
+        if (slice > (size - idx))
+        {
+            slice = size - idx;
+        }
+        UART_FRAMING_ReceiveSlice(state, &line[idx], slice);
+        idx += slice;
+    }
+}
+
+static uint16_t TEST_Crc16Bitwise(uint16_t crc, const uint8_t * data, uint32_t size)
+{
+    uint32_t i;
+    uint32_t bit;
+
+    for (i = 0U; i < size; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8U);
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1U) ^ 0x1021U) : (uint16_t)(crc << 1U);
+        }
+    }
+
+    return crc;
+}
+
+static uint32_t TEST_Crc32Bitwise(uint32_t crc, const uint8_t * data, uint32_t size)
+{
+    uint32_t i;
+    uint32_t bit;
+
+    for (i = 0U; i < size; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ 0xEDB88320U) : (crc >> 1U);
+        }
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+ * Unit tests
+ ******************************************************************************/
+
+static void TEST_CrcVectors(void)
+{
+    static const uint8_t check[] = "123456789";
+    uint8_t data[64];
+    uint32_t i;
+    uint32_t offset;
+    uint32_t size;
+
+    CHECK(UART_FRAMING_Crc16(UART_FRAMING_CRC16_INIT, check, 9U) == 0x29B1U);
+    CHECK(~UART_FRAMING_Crc32(UART_FRAMING_CRC32_INIT, check, 9U) == 0xCBF43926U);
+    CHECK(UART_FRAMING_Crc16(UART_FRAMING_CRC16_INIT, NULL, 0U) == UART_FRAMING_CRC16_INIT);
+
+    /* Slicing-by-4 against the bitwise definition, any length and alignment */
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)TEST_Random();
+    }
+    for (offset = 0U; offset < 4U; offset++)
+    {
+        for (size = 0U; size <= (sizeof(data) - offset); size++)
+        {
+            CHECK(UART_FRAMING_Crc16(0x1D0FU, &data[offset], size) ==
+                  TEST_Crc16Bitwise(0x1D0FU, &data[offset], size));
+            CHECK(UART_FRAMING_Crc32(0x12345678U, &data[offset], size) ==
+                  TEST_Crc32Bitwise(0x12345678U, &data[offset], size));
+        }
+    }
+
+    /* Incremental updates give the same result as one call */
+    CHECK(UART_FRAMING_Crc32(UART_FRAMING_Crc32(UART_FRAMING_CRC32_INIT, data, 7U), &data[7], 50U) ==
+          UART_FRAMING_Crc32(UART_FRAMING_CRC32_INIT, data, 57U));
+}
+
+static void TEST_EncodeVectors(void)
+{
+    static const struct
+    {
+        uart_framing_type_t type;
+        uint8_t in[4];
+        uint32_t inSize;
+        uint8_t out[8];
+        uint32_t outSize;
+    } vectors[] =
+    {
+        { UART_FRAMING_COBS, { 0x00U }, 1U, { 0x01U, 0x01U, 0x00U }, 3U },
+        { UART_FRAMING_COBS, { 0x00U, 0x00U }, 2U, { 0x01U, 0x01U, 0x01U, 0x00U }, 4U },
+        { UART_FRAMING_COBS, { 0x11U, 0x22U, 0x00U, 0x33U }, 4U, { 0x03U, 0x11U, 0x22U, 0x02U, 0x33U, 0x00U }, 6U },
+        { UART_FRAMING_COBS, { 0x11U, 0x22U, 0x33U, 0x44U }, 4U, { 0x05U, 0x11U, 0x22U, 0x33U, 0x44U, 0x00U }, 6U },
+        { UART_FRAMING_SLIP, { 0xC0U, 0xDBU, 0x01U }, 3U, { 0xC0U, 0xDBU, 0xDCU, 0xDBU, 0xDDU, 0x01U, 0xC0U }, 7U }
+    };
+    uart_framing_state_t state;
+    test_rx_log_t log;
+    uint8_t rxBuff[16];
+    uint8_t txBuff[16];
+    uint32_t encodedSize;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(vectors) / sizeof(vectors[0])); i++)
+    {
+        TEST_InitChannel(&state, vectors[i].type, UART_FRAMING_CRC_NONE, rxBuff, sizeof(rxBuff), &log);
+        CHECK(UART_FRAMING_EncodeFrame(&state, vectors[i].in, vectors[i].inSize,
+                                       txBuff, sizeof(txBuff), &encodedSize) == STATUS_SUCCESS);
+        CHECK((encodedSize == vectors[i].outSize) && (memcmp(txBuff, vectors[i].out, encodedSize) == 0));
+    }
+}
+
+static void TEST_RoundTrips(void)
+{
+    static uint8_t payload[TEST_MAX_FRAMES][TEST_MAX_PAYLOAD];
+    static uint8_t line[TEST_MAX_FRAMES * ((2U * TEST_MAX_PAYLOAD) + 16U)];
+    static test_rx_log_t log;
+    uint32_t payloadSize[TEST_MAX_FRAMES];
+    uint8_t rxBuff[TEST_MAX_PAYLOAD + 4U];
+    uart_framing_state_t state;
+    uint32_t lineSize;
+    uint32_t encodedSize;
+    uint32_t frames;
+    uint32_t round;
+    uint32_t f;
+    uint32_t i;
+    uint32_t t;
+    uint32_t c;
+    bool same;
+
+    for (round = 0U; round < TEST_RANDOM_ROUNDS; round++)
+    {
+        t = round % 2U;
+        c = (round / 2U) % 3U;
+        TEST_InitChannel(&state, s_types[t], s_crcs[c], rxBuff, sizeof(rxBuff), &log);
+
+        /* Several frames back to back, with payloads full of delimiters and
+         * escape characters, and lengths around the 254-byte COBS blocks */
+        frames = 1U + (TEST_Random() % TEST_MAX_FRAMES);
+        lineSize = 0U;
+        for (f = 0U; f < frames; f++)
+        {
+            payloadSize[f] = (round < 600U) ? (round % 600U) : (1U + (TEST_Random() % TEST_MAX_PAYLOAD));
+            if ((payloadSize[f] == 0U) && (s_crcs[c] == UART_FRAMING_CRC_NONE))
+            {
+                payloadSize[f] = 1U;
+            }
+            for (i = 0U; i < payloadSize[f]; i++)
+            {
+                switch (TEST_Random() % 4U)
+                {
+                    case 0U:  payload[f][i] = 0x00U; break;
+                    case 1U:  payload[f][i] = (uint8_t)(0xC0U + (TEST_Random() % 2U) * 0x1BU); break;
+                    default:  payload[f][i] = (uint8_t)TEST_Random(); break;
+                }
+            }
+            CHECK(UART_FRAMING_EncodeFrame(&state, payload[f], payloadSize[f], &line[lineSize],
+                                           UART_FRAMING_GetMaxEncodedSize(&state, payloadSize[f]),
+                                           &encodedSize) == STATUS_SUCCESS);
+            lineSize += encodedSize;
+        }
+
+        TEST_FeedSlices(&state, line, lineSize);
+
+        same = (log.frames == frames);
+        for (f = 0U; same && (f < frames); f++)
+        {
+            same = (log.frameSize[f] == payloadSize[f]) &&
+                   (memcmp(log.frame[f], payload[f], payloadSize[f]) == 0);
+        }
+        CHECK(same);
+        CHECK((log.events[UART_FRAMING_EVENT_CRC_ERROR] + log.events[UART_FRAMING_EVENT_OVERFLOW] +
+               log.events[UART_FRAMING_EVENT_DECODE_ERROR]) == 0U);
+    }
+}
+
+static void TEST_Errors(void)
+{
+    static const uint8_t payload[32] = { 1U, 2U, 0U, 0xC0U, 0xDBU, 5U };
+    static const uint8_t large[200] = { 7U };
+    uart_framing_state_t state;
+    test_rx_log_t log;
+    uint8_t rxBuff[40];
+    uint8_t line[512];
+    uint32_t size;
+    uint32_t more;
+    uint32_t t;
+    uint32_t c;
+    uart_instance_t instance = { 0U, 0U };
+
+    for (t = 0U; t < 2U; t++)
+    {
+        for (c = 0U; c < 3U; c++)
+        {
+            TEST_InitChannel(&state, s_types[t], s_crcs[c], rxBuff, sizeof(rxBuff), &log);
+
+            /* Empty frames need a CRC; the buffer must hold the worst case */
+            CHECK((UART_FRAMING_EncodeFrame(&state, NULL, 0U, line, sizeof(line), &size) == STATUS_SUCCESS) ==
+                  (s_crcs[c] != UART_FRAMING_CRC_NONE));
+            CHECK(UART_FRAMING_EncodeFrame(&state, payload, sizeof(payload), line,
+                                           UART_FRAMING_GetMaxEncodedSize(&state, sizeof(payload)) - 1U,
+                                           &size) == STATUS_ERROR);
+            CHECK(size == 0U);
+
+            /* An empty frame with CRC is delivered */
+            if (s_crcs[c] != UART_FRAMING_CRC_NONE)
+            {
+                (void)UART_FRAMING_EncodeFrame(&state, NULL, 0U, line, sizeof(line), &size);
+                UART_FRAMING_ReceiveSlice(&state, line, size);
+                CHECK((log.frames == 1U) && (log.frameSize[0] == 0U));
+            }
+
+            /* Corrupted payload byte */
+            (void)UART_FRAMING_EncodeFrame(&state, payload, sizeof(payload), line, sizeof(line), &size);
+            line[size - 3U] ^= 0x01U;
+            memset(&log, 0, sizeof(log));
+            UART_FRAMING_ReceiveSlice(&state, line, size);
+            if (s_crcs[c] != UART_FRAMING_CRC_NONE)
+            {
+                CHECK((log.frames == 0U) && (log.events[UART_FRAMING_EVENT_CRC_ERROR] == 1U));
+            }
+
+            /* Frame larger than the receive buffer, then recovery on the next frame */
+            memset(&log, 0, sizeof(log));
+            (void)UART_FRAMING_EncodeFrame(&state, large, sizeof(large), line, sizeof(line), &size);
+            TEST_FeedSlices(&state, line, size);
+            CHECK((log.frames == 0U) && (log.events[UART_FRAMING_EVENT_OVERFLOW] == 1U));
+            (void)UART_FRAMING_EncodeFrame(&state, payload, sizeof(payload), line, sizeof(line), &size);
+            UART_FRAMING_ReceiveSlice(&state, line, size);
+            CHECK((log.frames == 1U) && (memcmp(log.frame[0], payload, sizeof(payload)) == 0));
+
+            /* After a reset, the bytes up to the next delimiter are dropped */
+            memset(&log, 0, sizeof(log));
+            (void)UART_FRAMING_EncodeFrame(&state, payload, sizeof(payload), line, sizeof(line), &size);
+            UART_FRAMING_ReceiveSlice(&state, line, size / 2U);
+            UART_FRAMING_ResetReceiver(&state);
+            UART_FRAMING_ReceiveSlice(&state, &line[size / 2U], size - (size / 2U));
+            (void)UART_FRAMING_EncodeFrame(&state, payload, 6U, line, sizeof(line), &more);
+            UART_FRAMING_ReceiveSlice(&state, line, more);
+            CHECK((log.frames == 1U) && (log.frameSize[0] == 6U));
+
+            /* SendFrame does not touch a buffer still being transmitted */
+            s_uartBusy = true;
+            s_uartSent = 0U;
+            CHECK(UART_FRAMING_SendFrame(&instance, &state, payload, 6U, line, sizeof(line)) == STATUS_BUSY);
+            s_uartBusy = false;
+            CHECK(UART_FRAMING_SendFrame(&instance, &state, payload, 6U, line, sizeof(line)) == STATUS_SUCCESS);
+            CHECK(s_uartSent == more);
+        }
+    }
+
+    /* Stuffing errors */
+    TEST_InitChannel(&state, UART_FRAMING_SLIP, UART_FRAMING_CRC_NONE, rxBuff, sizeof(rxBuff), &log);
+    line[0] = 0xC0U; line[1] = 0x01U; line[2] = 0xDBU; line[3] = 0x02U; line[4] = 0xC0U;
+    UART_FRAMING_ReceiveSlice(&state, line, 5U);
+    CHECK((log.frames == 0U) && (log.events[UART_FRAMING_EVENT_DECODE_ERROR] == 1U));
+
+    TEST_InitChannel(&state, UART_FRAMING_COBS, UART_FRAMING_CRC_NONE, rxBuff, sizeof(rxBuff), &log);
+    line[0] = 0x05U; line[1] = 0x01U; line[2] = 0x00U;
+    UART_FRAMING_ReceiveSlice(&state, line, 3U);
+    CHECK((log.frames == 0U) && (log.events[UART_FRAMING_EVENT_DECODE_ERROR] == 1U));
+
+    /* The receive buffer must hold more than the CRC */
+    {
+        const uart_framing_user_config_t config = { UART_FRAMING_COBS, UART_FRAMING_CRC_32, rxBuff, 4U, NULL, NULL };
+        CHECK(UART_FRAMING_Init(&state, &config) == STATUS_ERROR);
+    }
+}
+
+/*******************************************************************************
+ * Benchmarks
+ ******************************************************************************/
+
+static uint64_t BENCH_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* Two-pass encoder: CRC with the bitwise routine, then COBS stuffing */
+static uint32_t BENCH_CobsTwoPass(const uint8_t * in, uint32_t size, uint8_t * out)
+{
+    uint8_t tmp[BENCH_SIZE + 2U];
+    uint16_t crc = TEST_Crc16Bitwise(UART_FRAMING_CRC16_INIT, in, size);
+    uint32_t codeIdx = 0U;
+    uint32_t outIdx = 1U;
+    uint8_t code = 1U;
+    uint32_t i;
+
+    memcpy(tmp, in, size);
+    tmp[size] = (uint8_t)(crc >> 8U);
+    tmp[size + 1U] = (uint8_t)crc;
+    for (i = 0U; i < (size + 2U); i++)
+    {
+        if (tmp[i] == 0U)
+        {
+            out[codeIdx] = code;
+            codeIdx = outIdx++;
+            code = 1U;
+        }
+        else
+        {
+            out[outIdx++] = tmp[i];
+            if (++code == 0xFFU)
+            {
+                out[codeIdx] = code;
+                codeIdx = outIdx++;
+                code = 1U;
+            }
+        }
+    }
+    out[codeIdx] = code;
+    out[outIdx] = 0U;
+
+    return outIdx + 1U;
+}
+
+static void BENCH_Report(const char * name, uint64_t cycles, uint32_t bytes)
+{
+    printf("  %-34s %7.2f cycles/byte\n", name, (double)cycles / (double)bytes);
+}
+
+static void BENCH_Run(void)
+{
+    static uint8_t data[BENCH_SIZE];
+    static uint8_t line[(2U * BENCH_SIZE) + 16U];
+    static uint8_t rxBuff[BENCH_SIZE + 4U];
+    static test_rx_log_t log;
+    uart_framing_state_t state;
+    volatile uint32_t sink = 0U;
+    uint64_t best;
+    uint64_t start;
+    uint64_t cycles;
+    uint32_t size = 0U;
+    uint32_t round;
+    uint32_t i;
+    uint32_t t;
+
+    for (i = 0U; i < BENCH_SIZE; i++)
+    {
+        data[i] = (uint8_t)TEST_Random();
+    }
+
+    printf("Benchmarks, %u-byte payloads, best of %u runs:\n", BENCH_SIZE, BENCH_ROUNDS);
+
+#define BENCH(name, expr)                                        \
+    do                                                           \
+    {                                                            \
+        best = UINT64_MAX;                                       \
+        for (round = 0U; round < BENCH_ROUNDS; round++)          \
+        {                                                        \
+            start = BENCH_Cycles();                              \
+            expr;                                                \
+            cycles = BENCH_Cycles() - start;                     \
+            best = (cycles < best) ? cycles : best;              \
+        }                                                        \
+        BENCH_Report((name), best, BENCH_SIZE);                  \
+    } while (false)
+
+    BENCH("CRC-16 bitwise", sink += TEST_Crc16Bitwise(0xFFFFU, data, BENCH_SIZE));
+    BENCH("CRC-16 slicing-by-4", sink += UART_FRAMING_Crc16(0xFFFFU, data, BENCH_SIZE));
+    BENCH("CRC-32 bitwise", sink += TEST_Crc32Bitwise(0xFFFFFFFFU, data, BENCH_SIZE));
+    BENCH("CRC-32 slicing-by-4", sink += UART_FRAMING_Crc32(0xFFFFFFFFU, data, BENCH_SIZE));
+    BENCH("COBS+CRC-16 two-pass, bitwise CRC", sink += BENCH_CobsTwoPass(data, BENCH_SIZE, line));
+
+    for (t = 0U; t < 2U; t++)
+    {
+        TEST_InitChannel(&state, s_types[t], UART_FRAMING_CRC_16, rxBuff, sizeof(rxBuff), &log);
+        BENCH((t == 0U) ? "COBS+CRC-16 encode" : "SLIP+CRC-16 encode",
+              (void)UART_FRAMING_EncodeFrame(&state, data, BENCH_SIZE, line, sizeof(line), &size));
+        BENCH((t == 0U) ? "COBS+CRC-16 decode" : "SLIP+CRC-16 decode",
+              UART_FRAMING_ReceiveSlice(&state, line, size));
+        CHECK(log.events[UART_FRAMING_EVENT_FRAME_RECEIVED] == BENCH_ROUNDS);
+    }
+
+#undef BENCH
+
+    (void)sink;
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(int argc, char ** argv)
+{
+    TEST_CrcVectors();
+    TEST_EncodeVectors();
+    TEST_RoundTrips();
+    TEST_Errors();
+
+    if ((argc > 1) && (strcmp(argv[1], "--bench") == 0))
+    {
+        BENCH_Run();
+    }
+
+    printf("uart_framing: %u checks, %u failures\n", s_checks, s_failures);
+
+    return (s_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
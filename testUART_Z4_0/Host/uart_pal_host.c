@@ -0,0 +1,1299 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file uart_pal_host.c
+ *
+ * Host (Linux) implementation of the UART PAL API declared in uart_pal.h.
+ * It replaces uart_pal.c and the LINFlexD driver when the application is built
+ * with Host/Makefile; see uart_pal_host.h for the runtime options.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "uart_pal_host.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Size of the chunk read from the pseudo-terminal in one system call */
+#define UART_HOST_RX_CHUNK        256U
+/* Poll period of the receiver thread, in milliseconds */
+#define UART_HOST_POLL_MS         10
+/* Nanoseconds per second */
+#define UART_HOST_NS_PER_S        1000000000ULL
+
+/*!
+ * @brief Host state of one UART instance
+ */
+typedef struct
+{
+    bool isInitialized;                 /*!< Instance is in use */
+    bool isClaimed;                     /*!< Slot taken by UART_Init(), before the instance is in use */
+    uint32_t instIdx;                   /*!< Instance index of the peripheral */
+    int fd;                             /*!< Line file descriptor (pty master or tty) */
+    int slaveFd;                        /*!< Slave kept open so the master never reports EIO */
+    char slaveName[64];                 /*!< Device the peer must open */
+    char linkName[128];                 /*!< Symlink created to the slave, if any */
+    uint32_t baudRate;                  /*!< Configured baud rate */
+    uint32_t bitsPerChar;               /*!< Start + data + parity + stop bits */
+    uint64_t charTimeNs;                /*!< Duration of one character on the line */
+    pthread_t rxThread;                 /*!< Receiver thread */
+    pthread_t txThread;                 /*!< Transmitter thread */
+    bool stop;                          /*!< Request the threads to terminate */
+    /* Transmit side */
+    const uint8_t * txBuff;             /*!< Data to send */
+    uint32_t txSize;                    /*!< Bytes left to send */
+    bool isTxBusy;                      /*!< Transmission in progress */
+    status_t transmitStatus;            /*!< Status of the last transmission */
+    uint64_t txStartNs;                 /*!< Time the transmission was started */
+    uart_callback_t txCallback;         /*!< Transmit callback */
+    void * txCallbackParam;             /*!< Transmit callback parameter */
+    /* Receive side */
+    uint8_t * rxBuff;                   /*!< Buffer receiving data */
+    uint32_t rxSize;                    /*!< Bytes left to receive */
+    bool isRxBusy;                      /*!< Reception in progress */
+    status_t receiveStatus;             /*!< Status of the last reception */
+    uint64_t rxStartNs;                 /*!< Time the reception was started */
+    uart_callback_t rxCallback;         /*!< Receive callback */
+    void * rxCallbackParam;             /*!< Receive callback parameter */
+    uint8_t rxPending[UART_HOST_RX_CHUNK];      /*!< Bytes read from the line, not yet delivered */
+    uint64_t rxPendingNs[UART_HOST_RX_CHUNK];   /*!< Arrival time of the pending bytes */
+    uint32_t rxPendingHead;             /*!< First pending byte */
+    uint32_t rxPendingCount;            /*!< Number of pending bytes */
+    /* Statistics */
+    uint64_t initNs;                    /*!< Time of UART_Init() */
+    uart_host_stats_t stats;            /*!< Collected statistics */
+} uart_host_state_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Host states, indexed by allocation order */
+static uart_host_state_t s_uartHostState[UART_HOST_MAX_INSTANCES];
+
+/* Models "interrupts disabled": held by the backend threads while they act as an
+ * ISR, and by the API functions while they touch the driver state. Recursive, so
+ * the API can be called from callbacks like on the target. */
+static pthread_mutex_t s_uartHostLock;
+/* Signalled whenever a transfer starts, completes or is aborted */
+static pthread_cond_t s_uartHostCond = PTHREAD_COND_INITIALIZER;
+
+static pthread_once_t s_uartHostOnce = PTHREAD_ONCE_INIT;
+static uint32_t s_uartHostErrorPpm = 0U;
+static bool s_uartHostPacing = true;
+static uint32_t s_uartHostReportPeriod = 0U;
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_Now
+ * Description   : Returns the monotonic time in nanoseconds.
+ *
+ *END**************************************************************************/
+static uint64_t UART_HOST_Now(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * UART_HOST_NS_PER_S) + (uint64_t)ts.tv_nsec;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_SleepUntil
+ * Description   : Sleeps until the given monotonic time.
+ *
+ *END**************************************************************************/
+static void UART_HOST_SleepUntil(uint64_t deadlineNs)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)(deadlineNs / UART_HOST_NS_PER_S);
+    ts.tv_nsec = (long)(deadlineNs % UART_HOST_NS_PER_S);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_InjectError
+ * Description   : Flips one random bit of the byte with the configured probability.
+ *
+ *END**************************************************************************/
+static bool UART_HOST_InjectError(uint8_t * data, unsigned int * seed)
+{
+    bool injected = false;
+
+    if ((s_uartHostErrorPpm != 0U) &&
+        ((uint32_t)(rand_r(seed) % 1000000) < s_uartHostErrorPpm))
+    {
+        *data ^= (uint8_t)(1U << (rand_r(seed) & 7));
+        injected = true;
+    }
+
+    return injected;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_UpdateLatency
+ * Description   : Accounts one completed transfer.
+ *
+ *END**************************************************************************/
+static void UART_HOST_UpdateLatency(uart_host_latency_t * latency, uint64_t startNs)
+{
+    uint64_t delta = UART_HOST_Now() - startNs;
+
+    if ((latency->count == 0U) || (delta < latency->minNs))
+    {
+        latency->minNs = delta;
+    }
+    if (delta > latency->maxNs)
+    {
+        latency->maxNs = delta;
+    }
+    latency->sumNs += delta;
+    latency->count++;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_FindState
+ * Description   : Returns the host state of an initialized instance, or NULL.
+ *
+ *END**************************************************************************/
+static uart_host_state_t * UART_HOST_FindState(const uart_instance_t * const instance)
+{
+    uart_host_state_t * state = NULL;
+    uint32_t i;
+
+    for (i = 0U; i < UART_HOST_MAX_INSTANCES; i++)
+    {
+        if (s_uartHostState[i].isInitialized && (s_uartHostState[i].instIdx == instance->instIdx))
+        {
+            state = &s_uartHostState[i];
+            break;
+        }
+    }
+
+    return state;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_SetBaudRate
+ * Description   : Computes the character time used for pacing.
+ *
+ *END**************************************************************************/
+static void UART_HOST_SetBaudRate(uart_host_state_t * state, uint32_t baudRate)
+{
+    state->baudRate = baudRate;
+    state->charTimeNs = (baudRate != 0U) ?
+        (((uint64_t)state->bitsPerChar * UART_HOST_NS_PER_S) / baudRate) : 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_CompleteSend
+ * Description   : Finishes the transmission. Called with the lock held.
+ *
+ *END**************************************************************************/
+static void UART_HOST_CompleteSend(uart_host_state_t * state)
+{
+    state->isTxBusy = false;
+    if (state->transmitStatus == STATUS_BUSY)
+    {
+        state->transmitStatus = STATUS_SUCCESS;
+        UART_HOST_UpdateLatency(&state->stats.txTransfer, state->txStartNs);
+    }
+    (void)pthread_cond_broadcast(&s_uartHostCond);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_CompleteReceive
+ * Description   : Finishes the reception. Called with the lock held.
+ *
+ *END**************************************************************************/
+static void UART_HOST_CompleteReceive(uart_host_state_t * state)
+{
+    state->isRxBusy = false;
+    if (state->receiveStatus == STATUS_BUSY)
+    {
+        state->receiveStatus = STATUS_SUCCESS;
+        UART_HOST_UpdateLatency(&state->stats.rxTransfer, state->rxStartNs);
+    }
+    (void)pthread_cond_broadcast(&s_uartHostCond);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_TxThread
+ * Description   : Plays the role of the transmit interrupt: writes one byte per
+ * character time and invokes the transmit callback like the LINFlexD driver.
+ *
+ *END**************************************************************************/
+static void * UART_HOST_TxThread(void * arg)
+{
+    uart_host_state_t * state = (uart_host_state_t *)arg;
+    unsigned int seed = 0x5A5AU ^ state->instIdx;
+    uint64_t deadline = 0U;
+    uint8_t data;
+    ssize_t written;
+    bool injected;
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    while (!state->stop)
+    {
+        if (!state->isTxBusy)
+        {
+            (void)pthread_cond_wait(&s_uartHostCond, &s_uartHostLock);
+            continue;
+        }
+
+        if (state->txSize > 0U)
+        {
+            data = *state->txBuff;
+            state->txBuff++;
+            state->txSize--;
+            (void)pthread_mutex_unlock(&s_uartHostLock);
+
+            injected = UART_HOST_InjectError(&data, &seed);
+            /* Keep a running deadline so pacing errors do not accumulate */
+            if (s_uartHostPacing)
+            {
+                uint64_t now = UART_HOST_Now();
+                if ((deadline + state->charTimeNs) < now)
+                {
+                    deadline = now;
+                }
+                deadline += state->charTimeNs;
+                UART_HOST_SleepUntil(deadline);
+            }
+            do
+            {
+                written = write(state->fd, &data, 1U);
+            } while ((written < 0) && (errno == EINTR));
+
+            (void)pthread_mutex_lock(&s_uartHostLock);
+            if (written == 1)
+            {
+                state->stats.txBytes++;
+                if (injected)
+                {
+                    state->stats.txErrorsInjected++;
+                }
+            }
+            else if (state->isTxBusy)
+            {
+                state->transmitStatus = STATUS_ERROR;
+                UART_HOST_CompleteSend(state);
+                if (state->txCallback != NULL)
+                {
+                    state->txCallback(state, UART_EVENT_ERROR, state->txCallbackParam);
+                }
+            }
+            else
+            {
+                /* Transfer aborted meanwhile */
+            }
+        }
+        else
+        {
+            /* Application can provide another buffer inside the callback */
+            if (state->txCallback != NULL)
+            {
+                state->txCallback(state, UART_EVENT_TX_EMPTY, state->txCallbackParam);
+            }
+
+            if (state->txSize == 0U)
+            {
+                UART_HOST_CompleteSend(state);
+                if (state->txCallback != NULL)
+                {
+                    state->txCallback(state, UART_EVENT_END_TRANSFER, state->txCallbackParam);
+                }
+            }
+        }
+    }
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return NULL;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_RxThread
+ * Description   : Plays the role of the receive interrupt: delivers one byte per
+ * character time and invokes the receive callback like the LINFlexD driver.
+ * The line is only read while a reception is active, so bytes sent by the peer
+ * meanwhile wait in the pseudo-terminal instead of being lost.
+ *
+ *END**************************************************************************/
+static void * UART_HOST_RxThread(void * arg)
+{
+    uart_host_state_t * state = (uart_host_state_t *)arg;
+    unsigned int seed = 0xA5A5U ^ state->instIdx;
+    uint64_t deadline = 0U;
+    uint64_t now;
+    uint8_t chunk[UART_HOST_RX_CHUNK];
+    struct pollfd pfd;
+    ssize_t count;
+    ssize_t i;
+    uint8_t data;
+
+    pfd.fd = state->fd;
+    pfd.events = POLLIN;
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    while (!state->stop)
+    {
+        if (!state->isRxBusy)
+        {
+            (void)pthread_cond_wait(&s_uartHostCond, &s_uartHostLock);
+            continue;
+        }
+
+        if (state->rxPendingCount == 0U)
+        {
+            (void)pthread_mutex_unlock(&s_uartHostLock);
+            count = 0;
+            if (poll(&pfd, 1U, UART_HOST_POLL_MS) > 0)
+            {
+                count = read(state->fd, chunk, sizeof(chunk));
+                if (count < 0)
+                {
+                    /* No peer connected yet (EIO on the master) */
+                    count = 0;
+                    (void)usleep(UART_HOST_POLL_MS * 1000);
+                }
+            }
+            now = UART_HOST_Now();
+            (void)pthread_mutex_lock(&s_uartHostLock);
+            for (i = 0; i < count; i++)
+            {
+                state->rxPending[i] = chunk[i];
+                state->rxPendingNs[i] = now;
+            }
+            state->rxPendingHead = 0U;
+            state->rxPendingCount = (uint32_t)count;
+            continue;
+        }
+
+        data = state->rxPending[state->rxPendingHead];
+        now = state->rxPendingNs[state->rxPendingHead];
+        state->rxPendingHead++;
+        state->rxPendingCount--;
+
+        /* A byte cannot be delivered before its last stop bit has been shifted in */
+        if (s_uartHostPacing)
+        {
+            (void)pthread_mutex_unlock(&s_uartHostLock);
+            if ((deadline + state->charTimeNs) < now)
+            {
+                deadline = now;
+            }
+            deadline += state->charTimeNs;
+            UART_HOST_SleepUntil(deadline);
+            (void)pthread_mutex_lock(&s_uartHostLock);
+        }
+
+        if ((!state->isRxBusy) || (state->rxSize == 0U))
+        {
+            /* Reception aborted while waiting; keep the byte for the next one */
+            state->rxPendingHead--;
+            state->rxPendingCount++;
+            continue;
+        }
+
+        if (UART_HOST_InjectError(&data, &seed))
+        {
+            state->stats.rxErrorsInjected++;
+        }
+        *state->rxBuff = data;
+        state->rxBuff++;
+        state->rxSize--;
+        state->stats.rxBytes++;
+        now = UART_HOST_Now() - now;
+        state->stats.rxByteLatencySumNs += now;
+        if (now > state->stats.rxByteLatencyMaxNs)
+        {
+            state->stats.rxByteLatencyMaxNs = now;
+        }
+
+        if (state->rxSize == 0U)
+        {
+            /* Application can provide another buffer inside the callback */
+            if (state->rxCallback != NULL)
+            {
+                state->rxCallback(state, UART_EVENT_RX_FULL, state->rxCallbackParam);
+            }
+        }
+
+        if (state->rxSize == 0U)
+        {
+            UART_HOST_CompleteReceive(state);
+            if (state->rxCallback != NULL)
+            {
+                state->rxCallback(state, UART_EVENT_END_TRANSFER, state->rxCallbackParam);
+            }
+        }
+    }
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return NULL;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_ReportThread
+ * Description   : Prints the report periodically and when the process is
+ * interrupted, then exits.
+ *
+ *END**************************************************************************/
+static void * UART_HOST_ReportThread(void * arg)
+{
+    sigset_t * set = (sigset_t *)arg;
+    struct timespec period;
+    int sig;
+
+    period.tv_sec = (time_t)s_uartHostReportPeriod;
+    period.tv_nsec = 0;
+
+    for (;;)
+    {
+        sig = (s_uartHostReportPeriod != 0U) ? sigtimedwait(set, NULL, &period) : sigwaitinfo(set, NULL);
+        if (sig > 0)
+        {
+            /* Report is printed by the atexit handler */
+            exit(EXIT_SUCCESS);
+        }
+        else if (errno == EAGAIN)
+        {
+            UART_HOST_PrintReport(stderr);
+        }
+        else
+        {
+            /* EINTR, wait again */
+        }
+    }
+
+    return NULL;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_ReportAtExit
+ * Description   : atexit handler printing the final report and removing the
+ * symlinks of the instances which were not de-initialized.
+ *
+ *END**************************************************************************/
+static void UART_HOST_ReportAtExit(void)
+{
+    uint32_t i;
+
+    UART_HOST_PrintReport(stderr);
+
+    for (i = 0U; i < UART_HOST_MAX_INSTANCES; i++)
+    {
+        if (s_uartHostState[i].isInitialized && (s_uartHostState[i].linkName[0] != '\0'))
+        {
+            (void)unlink(s_uartHostState[i].linkName);
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_GlobalInit
+ * Description   : One-time initialization of the backend.
+ *
+ *END**************************************************************************/
+static void UART_HOST_GlobalInit(void)
+{
+    static sigset_t set;
+    pthread_mutexattr_t attr;
+    pthread_t thread;
+    const char * env;
+
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&s_uartHostLock, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+
+    env = getenv("UART_HOST_ERROR_PPM");
+    s_uartHostErrorPpm = (env != NULL) ? (uint32_t)strtoul(env, NULL, 0) : 0U;
+    s_uartHostPacing = (getenv("UART_HOST_NO_PACING") == NULL);
+    env = getenv("UART_HOST_REPORT_S");
+    s_uartHostReportPeriod = (env != NULL) ? (uint32_t)strtoul(env, NULL, 0) : 0U;
+
+    /* SIGINT/SIGTERM are handled synchronously by the report thread; the mask is
+     * inherited by the backend threads created afterwards */
+    (void)sigemptyset(&set);
+    (void)sigaddset(&set, SIGINT);
+    (void)sigaddset(&set, SIGTERM);
+    (void)pthread_sigmask(SIG_BLOCK, &set, NULL);
+    (void)atexit(UART_HOST_ReportAtExit);
+    if (pthread_create(&thread, NULL, UART_HOST_ReportThread, &set) == 0)
+    {
+        (void)pthread_detach(thread);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_OpenLine
+ * Description   : Opens the configured tty or creates a pseudo-terminal pair.
+ *
+ *END**************************************************************************/
+static status_t UART_HOST_OpenLine(uart_host_state_t * state)
+{
+    const char * device = getenv("UART_HOST_DEVICE");
+    const char * link = getenv("UART_HOST_LINK");
+    struct termios tio;
+    int rawFd;
+
+    state->slaveFd = -1;
+    state->linkName[0] = '\0';
+
+    if (device != NULL)
+    {
+        state->fd = open(device, O_RDWR | O_NOCTTY);
+        (void)snprintf(state->slaveName, sizeof(state->slaveName), "%s", device);
+        rawFd = state->fd;
+    }
+    else
+    {
+        state->fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if ((state->fd < 0) || (grantpt(state->fd) != 0) || (unlockpt(state->fd) != 0) ||
+            (ptsname_r(state->fd, state->slaveName, sizeof(state->slaveName)) != 0))
+        {
+            return STATUS_ERROR;
+        }
+        state->slaveFd = open(state->slaveName, O_RDWR | O_NOCTTY);
+        rawFd = state->slaveFd;
+    }
+
+    if ((state->fd < 0) || (rawFd < 0))
+    {
+        return STATUS_ERROR;
+    }
+
+    /* Raw 8-bit line: no echo, no line discipline, no CR/LF translation */
+    if (tcgetattr(rawFd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        (void)tcsetattr(rawFd, TCSANOW, &tio);
+    }
+
+    if ((link != NULL) && (device == NULL))
+    {
+        (void)snprintf(state->linkName, sizeof(state->linkName), "%s%u", link, (unsigned int)state->instIdx);
+        (void)unlink(state->linkName);
+        if (symlink(state->slaveName, state->linkName) != 0)
+        {
+            state->linkName[0] = '\0';
+        }
+    }
+
+    (void)fprintf(stderr, "uart_pal host: instance %u on %s%s%s\n",
+                  (unsigned int)state->instIdx, state->slaveName,
+                  (state->linkName[0] != '\0') ? " -> " : "", state->linkName);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_WaitIdle
+ * Description   : Waits with the lock held until the flag is cleared or the
+ * timeout (milliseconds) expires. Returns false on timeout.
+ *
+ *END**************************************************************************/
+static bool UART_HOST_WaitIdle(const bool * busy, uint32_t timeout)
+{
+    struct timespec ts;
+    uint64_t deadline;
+    bool idle = true;
+
+    (void)clock_gettime(CLOCK_REALTIME, &ts);
+    deadline = ((uint64_t)ts.tv_sec * UART_HOST_NS_PER_S) + (uint64_t)ts.tv_nsec +
+               ((uint64_t)timeout * 1000000ULL);
+    ts.tv_sec = (time_t)(deadline / UART_HOST_NS_PER_S);
+    ts.tv_nsec = (long)(deadline % UART_HOST_NS_PER_S);
+
+    while (*busy)
+    {
+        if (pthread_cond_timedwait(&s_uartHostCond, &s_uartHostLock, &ts) == ETIMEDOUT)
+        {
+            idle = !(*busy);
+            break;
+        }
+    }
+
+    return idle;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_GetDefaultConfig
+ * Description   : Gets the default configuration structure
+ *
+ *END**************************************************************************/
+void UART_GetDefaultConfig(uart_user_config_t * config)
+{
+    DEV_ASSERT(config != NULL);
+
+    config->baudRate = UART_DEFAULT_BAUDRATE_VALUE;
+    config->bitCount = UART_8_BITS_PER_CHAR;
+    config->parityMode = UART_PARITY_DISABLED;
+    config->stopBitCount = UART_ONE_STOP_BIT;
+    config->transferType = UART_USING_INTERRUPTS;
+    config->rxCallback = NULL;
+    config->rxCallbackParam = NULL;
+    config->txCallback = NULL;
+    config->txCallbackParam = NULL;
+    config->extension = NULL;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_Init
+ * Description   : Opens the line and starts the backend threads
+ *
+ *END**************************************************************************/
+status_t UART_Init(const uart_instance_t * const instance, const uart_user_config_t *config)
+{
+    DEV_ASSERT((instance != NULL) &&
+               (config != NULL));
+
+    uart_host_state_t * state = NULL;
+    uint32_t dataBits;
+    uint32_t i;
+
+    (void)pthread_once(&s_uartHostOnce, UART_HOST_GlobalInit);
+
+    /* The duplicate check and the claim of a free slot are one step, so that
+     * concurrent calls neither share a slot nor open the same instance twice */
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    for (i = 0U; i < UART_HOST_MAX_INSTANCES; i++)
+    {
+        if (s_uartHostState[i].isClaimed)
+        {
+            if (s_uartHostState[i].instIdx == instance->instIdx)
+            {
+                state = NULL;
+                break;
+            }
+        }
+        else if (state == NULL)
+        {
+            state = &s_uartHostState[i];
+        }
+        else
+        {
+            /* Free slot after the one claimed */
+        }
+    }
+    if (state != NULL)
+    {
+        (void)memset(state, 0, sizeof(*state));
+        state->instIdx = instance->instIdx;
+        state->isClaimed = true;
+    }
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    if (UART_HOST_OpenLine(state) != STATUS_SUCCESS)
+    {
+        (void)fprintf(stderr, "uart_pal host: cannot open line: %s\n", strerror(errno));
+        (void)pthread_mutex_lock(&s_uartHostLock);
+        state->isClaimed = false;
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+        return STATUS_ERROR;
+    }
+
+    switch (config->bitCount)
+    {
+        case UART_7_BITS_PER_CHAR:
+            dataBits = 7U;
+            break;
+        case UART_9_BITS_PER_CHAR:
+            dataBits = 9U;
+            break;
+        case UART_10_BITS_PER_CHAR:
+            dataBits = 10U;
+            break;
+        case UART_15_BITS_PER_CHAR:
+            dataBits = 15U;
+            break;
+        case UART_16_BITS_PER_CHAR:
+            dataBits = 16U;
+            break;
+        default:
+            dataBits = 8U;
+            break;
+    }
+    state->bitsPerChar = 1U + dataBits +
+                         ((config->parityMode != UART_PARITY_DISABLED) ? 1U : 0U) +
+                         ((config->stopBitCount == UART_TWO_STOP_BIT) ? 2U : 1U);
+    UART_HOST_SetBaudRate(state, config->baudRate);
+
+    state->rxCallback = config->rxCallback;
+    state->rxCallbackParam = config->rxCallbackParam;
+    state->txCallback = config->txCallback;
+    state->txCallbackParam = config->txCallbackParam;
+    state->transmitStatus = STATUS_SUCCESS;
+    state->receiveStatus = STATUS_SUCCESS;
+    state->initNs = UART_HOST_Now();
+    state->isInitialized = true;
+
+    if ((pthread_create(&state->rxThread, NULL, UART_HOST_RxThread, state) != 0) ||
+        (pthread_create(&state->txThread, NULL, UART_HOST_TxThread, state) != 0))
+    {
+        (void)pthread_mutex_lock(&s_uartHostLock);
+        state->isInitialized = false;
+        state->isClaimed = false;
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_Deinit
+ * Description   : Stops the backend threads and closes the line
+ *
+ *END**************************************************************************/
+status_t UART_Deinit(const uart_instance_t * const instance)
+{
+    DEV_ASSERT(instance != NULL);
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    if (state->isTxBusy || state->isRxBusy)
+    {
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+        return STATUS_BUSY;
+    }
+    state->stop = true;
+    (void)pthread_cond_broadcast(&s_uartHostCond);
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    (void)pthread_join(state->rxThread, NULL);
+    (void)pthread_join(state->txThread, NULL);
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    (void)close(state->fd);
+    if (state->slaveFd >= 0)
+    {
+        (void)close(state->slaveFd);
+    }
+    if (state->linkName[0] != '\0')
+    {
+        (void)unlink(state->linkName);
+    }
+    state->isInitialized = false;
+    state->isClaimed = false;
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_SetBaudRate
+ * Description   : Changes the pacing baud rate
+ *
+ *END**************************************************************************/
+status_t UART_SetBaudRate(const uart_instance_t * const instance, uint32_t desiredBaudRate)
+{
+    DEV_ASSERT(instance != NULL);
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+    status_t status = STATUS_ERROR;
+
+    if (state != NULL)
+    {
+        (void)pthread_mutex_lock(&s_uartHostLock);
+        if (state->isTxBusy || state->isRxBusy)
+        {
+            status = STATUS_BUSY;
+        }
+        else
+        {
+            UART_HOST_SetBaudRate(state, desiredBaudRate);
+            status = STATUS_SUCCESS;
+        }
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_GetBaudRate
+ * Description   : Returns the pacing baud rate
+ *
+ *END**************************************************************************/
+status_t UART_GetBaudRate(const uart_instance_t * const instance, uint32_t * configuredBaudRate)
+{
+    DEV_ASSERT((instance != NULL) &&
+               (configuredBaudRate != NULL));
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+    *configuredBaudRate = state->baudRate;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_SendData
+ * Description   : Starts a non-blocking transmission
+ *
+ *END**************************************************************************/
+status_t UART_SendData(const uart_instance_t * const instance, const uint8_t * txBuff, uint32_t txSize)
+{
+    DEV_ASSERT((instance != NULL) &&
+               (txBuff != NULL) &&
+               (txSize > 0U));
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+    status_t status = STATUS_ERROR;
+
+    if (state != NULL)
+    {
+        (void)pthread_mutex_lock(&s_uartHostLock);
+        if (state->isTxBusy)
+        {
+            status = STATUS_BUSY;
+        }
+        else
+        {
+            state->txBuff = txBuff;
+            state->txSize = txSize;
+            state->isTxBusy = true;
+            state->transmitStatus = STATUS_BUSY;
+            state->txStartNs = UART_HOST_Now();
+            (void)pthread_cond_broadcast(&s_uartHostCond);
+            status = STATUS_SUCCESS;
+        }
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_SendDataBlocking
+ * Description   : Performs a blocking transmission
+ *
+ *END**************************************************************************/
+status_t UART_SendDataBlocking(const uart_instance_t * const instance,
+                               const uint8_t * txBuff,
+                               uint32_t txSize,
+                               uint32_t timeout)
+{
+    uart_host_state_t * state;
+    status_t status;
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    status = UART_SendData(instance, txBuff, txSize);
+    if (status == STATUS_SUCCESS)
+    {
+        state = UART_HOST_FindState(instance);
+        if (!UART_HOST_WaitIdle(&state->isTxBusy, timeout))
+        {
+            state->transmitStatus = STATUS_TIMEOUT;
+            UART_HOST_CompleteSend(state);
+        }
+        status = state->transmitStatus;
+    }
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_AbortSendingData
+ * Description   : Terminates a non-blocking transmission early
+ *
+ *END**************************************************************************/
+status_t UART_AbortSendingData(const uart_instance_t * const instance)
+{
+    DEV_ASSERT(instance != NULL);
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    if (state->isTxBusy)
+    {
+        state->transmitStatus = STATUS_UART_ABORTED;
+        state->txSize = 0U;
+        UART_HOST_CompleteSend(state);
+    }
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_GetTransmitStatus
+ * Description   : Returns the status of the current transmission
+ *
+ *END**************************************************************************/
+status_t UART_GetTransmitStatus(const uart_instance_t * const instance, uint32_t * bytesRemaining)
+{
+    DEV_ASSERT(instance != NULL);
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+    status_t status = STATUS_ERROR;
+
+    if (state != NULL)
+    {
+        (void)pthread_mutex_lock(&s_uartHostLock);
+        if (bytesRemaining != NULL)
+        {
+            *bytesRemaining = state->isTxBusy ? state->txSize : 0U;
+        }
+        status = state->transmitStatus;
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+
+        /* Applications poll this in tight loops; let the backend threads run */
+        if (status == STATUS_BUSY)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_ReceiveData
+ * Description   : Starts a non-blocking reception
+ *
+ *END**************************************************************************/
+status_t UART_ReceiveData(const uart_instance_t * const instance, uint8_t * rxBuff, uint32_t rxSize)
+{
+    DEV_ASSERT((instance != NULL) &&
+               (rxBuff != NULL) &&
+               (rxSize > 0U));
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+    status_t status = STATUS_ERROR;
+
+    if (state != NULL)
+    {
+        (void)pthread_mutex_lock(&s_uartHostLock);
+        if (state->isRxBusy)
+        {
+            status = STATUS_BUSY;
+        }
+        else
+        {
+            state->rxBuff = rxBuff;
+            state->rxSize = rxSize;
+            state->isRxBusy = true;
+            state->receiveStatus = STATUS_BUSY;
+            state->rxStartNs = UART_HOST_Now();
+            (void)pthread_cond_broadcast(&s_uartHostCond);
+            status = STATUS_SUCCESS;
+        }
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_ReceiveDataBlocking
+ * Description   : Performs a blocking reception
+ *
+ *END**************************************************************************/
+status_t UART_ReceiveDataBlocking(const uart_instance_t * const instance,
+                                  uint8_t * rxBuff,
+                                  uint32_t rxSize,
+                                  uint32_t timeout)
+{
+    uart_host_state_t * state;
+    status_t status;
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    status = UART_ReceiveData(instance, rxBuff, rxSize);
+    if (status == STATUS_SUCCESS)
+    {
+        state = UART_HOST_FindState(instance);
+        if (!UART_HOST_WaitIdle(&state->isRxBusy, timeout))
+        {
+            state->receiveStatus = STATUS_TIMEOUT;
+            UART_HOST_CompleteReceive(state);
+        }
+        status = state->receiveStatus;
+    }
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_AbortReceivingData
+ * Description   : Terminates a non-blocking reception early
+ *
+ *END**************************************************************************/
+status_t UART_AbortReceivingData(const uart_instance_t * const instance)
+{
+    DEV_ASSERT(instance != NULL);
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    if (state->isRxBusy)
+    {
+        state->receiveStatus = STATUS_UART_ABORTED;
+        state->rxSize = 0U;
+        UART_HOST_CompleteReceive(state);
+    }
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_GetReceiveStatus
+ * Description   : Returns the status of the current reception
+ *
+ *END**************************************************************************/
+status_t UART_GetReceiveStatus(const uart_instance_t * const instance, uint32_t * bytesRemaining)
+{
+    DEV_ASSERT(instance != NULL);
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+    status_t status = STATUS_ERROR;
+
+    if (state != NULL)
+    {
+        (void)pthread_mutex_lock(&s_uartHostLock);
+        if (bytesRemaining != NULL)
+        {
+            *bytesRemaining = state->isRxBusy ? state->rxSize : 0U;
+        }
+        status = state->receiveStatus;
+        (void)pthread_mutex_unlock(&s_uartHostLock);
+
+        /* Applications poll this in tight loops; let the backend threads run */
+        if (status == STATUS_BUSY)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_SetRxBuffer
+ * Description   : Provides a new buffer for the ongoing reception
+ *
+ *END**************************************************************************/
+status_t UART_SetRxBuffer(const uart_instance_t * const instance, uint8_t * rxBuff, uint32_t rxSize)
+{
+    DEV_ASSERT((instance != NULL) &&
+               (rxBuff != NULL) &&
+               (rxSize > 0U));
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    state->rxBuff = rxBuff;
+    state->rxSize = rxSize;
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_SetTxBuffer
+ * Description   : Provides a new buffer for the ongoing transmission
+ *
+ *END**************************************************************************/
+status_t UART_SetTxBuffer(const uart_instance_t * const instance, const uint8_t * txBuff, uint32_t txSize)
+{
+    DEV_ASSERT((instance != NULL) &&
+               (txBuff != NULL) &&
+               (txSize > 0U));
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    state->txBuff = txBuff;
+    state->txSize = txSize;
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_GetStatistics
+ * Description   : Returns the statistics collected for a UART instance
+ *
+ *END**************************************************************************/
+status_t UART_HOST_GetStatistics(const uart_instance_t * const instance, uart_host_stats_t * stats)
+{
+    DEV_ASSERT((instance != NULL) &&
+               (stats != NULL));
+
+    uart_host_state_t * state = UART_HOST_FindState(instance);
+
+    if (state == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    (void)pthread_mutex_lock(&s_uartHostLock);
+    *stats = state->stats;
+    stats->elapsedNs = UART_HOST_Now() - state->initNs;
+    (void)pthread_mutex_unlock(&s_uartHostLock);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_HOST_PrintReport
+ * Description   : Prints throughput and latency of all initialized instances
+ *
+ *END**************************************************************************/
+void UART_HOST_PrintReport(FILE * stream)
+{
+    uart_host_state_t * state;
+    uart_host_stats_t stats;
+    uart_instance_t instance;
+    double seconds;
+    double lineRate;
+    uint32_t i;
+
+    for (i = 0U; i < UART_HOST_MAX_INSTANCES; i++)
+    {
+        state = &s_uartHostState[i];
+        instance.instIdx = state->instIdx;
+        if ((!state->isInitialized) || (UART_HOST_GetStatistics(&instance, &stats) != STATUS_SUCCESS))
+        {
+            continue;
+        }
+
+        seconds = (double)stats.elapsedNs / 1e9;
+        lineRate = (state->charTimeNs != 0U) ? (1e9 / (double)state->charTimeNs) : 0.0;
+        (void)fprintf(stream,
+                      "uart_pal host: instance %u, %u baud (%.0f B/s line capacity), %.3f s\n"
+                      "  tx: %llu B, %.0f B/s, %llu transfers, latency min/avg/max %.1f/%.1f/%.1f us, %llu errors injected\n"
+                      "  rx: %llu B, %.0f B/s, %llu transfers, latency min/avg/max %.1f/%.1f/%.1f us, %llu errors injected\n"
+                      "  rx byte delivery delay avg/max %.1f/%.1f us\n",
+                      (unsigned int)state->instIdx, (unsigned int)state->baudRate, lineRate, seconds,
+                      (unsigned long long)stats.txBytes, (double)stats.txBytes / seconds,
+                      (unsigned long long)stats.txTransfer.count,
+                      (double)stats.txTransfer.minNs / 1e3,
+                      (stats.txTransfer.count != 0U) ? ((double)stats.txTransfer.sumNs / (double)stats.txTransfer.count / 1e3) : 0.0,
+                      (double)stats.txTransfer.maxNs / 1e3,
+                      (unsigned long long)stats.txErrorsInjected,
+                      (unsigned long long)stats.rxBytes, (double)stats.rxBytes / seconds,
+                      (unsigned long long)stats.rxTransfer.count,
+                      (double)stats.rxTransfer.minNs / 1e3,
+                      (stats.rxTransfer.count != 0U) ? ((double)stats.rxTransfer.sumNs / (double)stats.rxTransfer.count / 1e3) : 0.0,
+                      (double)stats.rxTransfer.maxNs / 1e3,
+                      (unsigned long long)stats.rxErrorsInjected,
+                      (stats.rxBytes != 0U) ? ((double)stats.rxByteLatencySumNs / (double)stats.rxBytes / 1e3) : 0.0,
+                      (double)stats.rxByteLatencyMaxNs / 1e3);
+    }
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef UART_PAL_HOST_H
+#define UART_PAL_HOST_H
+
+#include <stdio.h>
+#include "uart_pal.h"
+
+/*!
+ * @defgroup uart_pal_host UART PAL host backend
+ * @ingroup uart_pal
+ * @brief Linux implementation of the UART PAL on top of a pseudo-terminal
+ *
+ * Each UART instance initialized with UART_Init() owns the master side of a
+ * pseudo-terminal; the peer (terminal, script, or another process) opens the
+ * slave side like a serial port. Transmission and reception are paced at the
+ * configured baud rate and callbacks are invoked from backend threads with the
+ * backend "interrupt" lock held, which mirrors the ISR context of the target.
+ *
+ * The backend is configured through environment variables, so the application
+ * code does not need to change:
+ * - UART_HOST_DEVICE    : open this tty instead of creating a pseudo-terminal.
+ * - UART_HOST_LINK      : create a symlink with this name to the slave device
+ *                         (the instance index is appended).
+ * - UART_HOST_ERROR_PPM : probability, in parts per million, that a byte is
+ *                         corrupted (one random bit flipped) on each direction.
+ * - UART_HOST_NO_PACING : if set, bytes are moved as fast as the host allows.
+ * - UART_HOST_REPORT_S  : period in seconds of the statistics report (0: only at exit).
+ *
+ * @addtogroup uart_pal_host
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of UART instances handled by the host backend */
+#define UART_HOST_MAX_INSTANCES    4U
+
+/*!
+ * @brief Latency statistics of one transfer direction, in nanoseconds
+ */
+typedef struct
+{
+    uint64_t count;      /*!< Number of completed transfers */
+    uint64_t minNs;      /*!< Minimum transfer latency */
+    uint64_t maxNs;      /*!< Maximum transfer latency */
+    uint64_t sumNs;      /*!< Sum of transfer latencies */
+} uart_host_latency_t;
+
+/*!
+ * @brief Statistics of one UART instance
+ */
+typedef struct
+{
+    uint64_t txBytes;                 /*!< Bytes written to the line */
+    uint64_t rxBytes;                 /*!< Bytes delivered to the application */
+    uint64_t txErrorsInjected;        /*!< Transmitted bytes corrupted on purpose */
+    uint64_t rxErrorsInjected;        /*!< Received bytes corrupted on purpose */
+    uint64_t elapsedNs;               /*!< Time since UART_Init() */
+    uint64_t rxByteLatencyMaxNs;      /*!< Maximum delay between a byte arriving and its delivery */
+    uint64_t rxByteLatencySumNs;      /*!< Sum of byte delivery delays */
+    uart_host_latency_t txTransfer;   /*!< UART_SendData() to transfer completion */
+    uart_host_latency_t rxTransfer;   /*!< UART_ReceiveData() to transfer completion */
+} uart_host_stats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Returns the statistics collected for a UART instance
+ *
+ * @param[in]  instance Pointer to the UART_PAL instance structure.
+ * @param[out] stats    Pointer to the statistics structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the instance is not initialized.
+ */
+status_t UART_HOST_GetStatistics(const uart_instance_t * const instance, uart_host_stats_t * stats);
+
+/*!
+ * @brief Prints throughput and latency of all initialized instances
+ *
+ * Called automatically at exit and on SIGINT/SIGTERM.
+ *
+ * @param[in] stream Output stream.
+ */
+void UART_HOST_PrintReport(FILE * stream);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* UART_PAL_HOST_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -1576,11 +1576,20 @@ NULL,              /*!< END_OF_PERIPHERAL_CLK_SOURCES       132 */ \
 /* OSIF module features */
 
 #define FEATURE_OSIF_USE_SYSTICK                         (0)
-#define FEATURE_OSIF_USE_PIT                             (1)
+#define FEATURE_OSIF_USE_PIT                             (0)
+/* @brief Tickless bare-metal time base on the STM counter, instead of a 1 ms PIT interrupt.
+ * The STM driver writes the counter of its instance: STM_DRV_Init() sets CNT to the start
+ * value, STM_DRV_Deinit() clears it and STM_DRV_SetStartValueCount() overwrites it. OSIF_STM
+ * must not be enabled in a project using the STM driver on the same instance, such as
+ * testSTM or testgpio_1 on STM_0. */
+#define FEATURE_OSIF_USE_STM                             (1)
 #define FEATURE_OSIF_FREERTOS_ISR_CONTEXT_METHOD         (2)
 #define OSIF_PIT (PIT)
 #define OSIF_PIT_CHAN_ID_MAX (15u)
 #define FEATURE_OSIF_PIT_FRZ_IN_DEBUG                    (1)
+#define OSIF_STM (STM_0)
+#define OSIF_STM_CHAN_ID_MAX (3u)
+#define FEATURE_OSIF_STM_FRZ_IN_DEBUG                    (1)
 
 /* FLASH C55 module features */
 
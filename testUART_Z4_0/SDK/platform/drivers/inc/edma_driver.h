@@ -967,6 +967,19 @@ status_t EDMA_DRV_InstallCallback(uint8_t virtualChannel,
                                   edma_callback_t callback,
                                   void *parameter);
 
+/*!
+ * @brief Clears the pending completion of a stopped channel.
+ *
+ * Waits for the minor loop being served, if any, to complete, then clears the done flag and
+ * the interrupt request of the channel, so that the callback is not invoked for a completion
+ * which the caller accounts itself. The channel requests must be disabled.
+ *
+ * @param virtualChannel eDMA virtual channel number.
+ *
+ * @return True if an interrupt request was pending.
+ */
+bool EDMA_DRV_ClearPendingInterrupt(uint8_t virtualChannel);
+
 /*! @} */
 
 /*!
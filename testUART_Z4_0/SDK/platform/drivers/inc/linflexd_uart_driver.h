@@ -80,6 +80,13 @@ typedef enum
     LINFLEXD_UART_PARITY_ONE = 3U
 } linflexd_uart_parity_type_t;
 
+/*! @brief Number of standard baud rates for which the driver caches the dividers. */
+#define LINFLEXD_UART_STD_BAUD_RATE_COUNT    16U
+
+/*! @brief Maximum deviation, in per mille, between a baud rate measured in auto-baud
+ *  mode and the standard baud rate it is rounded to. */
+#define LINFLEXD_UART_AUTO_BAUD_TOLERANCE    30U
+
 /*! @brief Type of UART transfer (based on interrupts or DMA).
  *
  * Implements : linflexd_uart_transfer_type_t_Class
@@ -120,6 +127,14 @@ typedef struct
 #endif
     volatile status_t transmitStatus;            /*!< Status of last driver transmit operation */
     volatile status_t receiveStatus;             /*!< Status of last driver receive operation */
+    uint32_t baudRate;                           /*!< Last baud rate requested by the application */
+    uint32_t baudClock;                          /*!< Protocol clock the divider cache was computed for */
+    uint32_t baudDivider[LINFLEXD_UART_STD_BAUD_RATE_COUNT]; /*!< Cached dividers (LINIBRR * 16 + LINFBRR)
+                                                                   for the standard baud rates */
+    volatile bool isAutoBaudActive;              /*!< True while the module waits for a sync field */
+    uint32_t autoBaudUartcr;                     /*!< UARTCR value restored when auto-baud completes */
+    uint32_t autoBaudLinier;                     /*!< LINIER value restored when auto-baud completes */
+    uint32_t autoBaudDivider;                    /*!< Divider programmed when auto-baud was started */
 } linflexd_uart_state_t;
 
 /*! @brief UART configuration structure
@@ -171,6 +186,80 @@ status_t LINFLEXD_UART_DRV_SetBaudRate(uint32_t instance, uint32_t baudrate);
  */
 status_t LINFLEXD_UART_DRV_GetBaudRate(uint32_t instance, uint32_t * baudrate);
 
+/*!
+ * @brief Recomputes the cached baud rate dividers.
+ *
+ * The driver keeps the dividers of the standard baud rates (1200 to 3000000 bps)
+ * for the current protocol clock, so LINFLEXD_UART_DRV_SetBaudRate() does not need
+ * any division for them. The cache is filled by LINFLEXD_UART_DRV_Init(); this
+ * function must be called again if the protocol clock changes, either directly or
+ * through LINFLEXD_UART_DRV_ClockNotificationCallback().
+ *
+ * @param instance LINFlexD instance number
+ * @return An error code or STATUS_SUCCESS
+ */
+status_t LINFLEXD_UART_DRV_UpdateBaudRateCache(uint32_t instance);
+
+/*!
+ * @brief Clock manager notification callback.
+ *
+ * Register this function in the clock manager callback table (callbackType
+ * CLOCK_MANAGER_CALLBACK_BEFORE_AFTER, callbackData set to the LINFlexD instance number).
+ * On the BEFORE notification the clock change is refused with STATUS_BUSY if a transfer
+ * is in progress and the policy is CLOCK_MANAGER_POLICY_AGREEMENT. On the AFTER
+ * notification the divider cache is recomputed and the last requested baud rate is
+ * programmed again for the new protocol clock.
+ *
+ * @param notify clock notification structure
+ * @param callbackData LINFlexD instance number, cast to a pointer
+ * @return An error code or STATUS_SUCCESS
+ */
+status_t LINFLEXD_UART_DRV_ClockNotificationCallback(clock_notify_struct_t * notify, void * callbackData);
+
+/*!
+ * @brief Starts automatic baud rate detection.
+ *
+ * The module is switched to LIN slave mode with automatic synchronization enabled,
+ * so the hardware measures the next break + sync field (0x55) received on the line
+ * and updates the baud rate divider. The remote device must send a break followed
+ * by 0x55 at the unknown baud rate; the break must last at least 11 bit times of
+ * the baud rate currently programmed, so detection should start from the highest
+ * expected baud rate.
+ * LINFLEXD_UART_DRV_GetAutoBaudStatus() must be polled to complete the detection;
+ * no transfer can be started until then.
+ *
+ * @param instance LINFlexD instance number
+ * @return STATUS_SUCCESS, or STATUS_BUSY if a transfer or detection is in progress
+ */
+status_t LINFLEXD_UART_DRV_StartAutoBaud(uint32_t instance);
+
+/*!
+ * @brief Returns the state of the automatic baud rate detection.
+ *
+ * When the sync field has been measured, the measured rate is rounded to the closest
+ * standard baud rate if it is within LINFLEXD_UART_AUTO_BAUD_TOLERANCE, the cached
+ * divider of that rate is applied and the module is switched back to UART mode with
+ * its previous frame format.
+ *
+ * @param instance LINFlexD instance number
+ * @param baudrate detected baud rate, valid when STATUS_SUCCESS is returned
+ * @return STATUS_SUCCESS if the detection completed, STATUS_BUSY if the sync field was
+ *         not received yet, or STATUS_ERROR if no detection was started or the measured
+ *         divider is zero; in the latter case the detection stays active until
+ *         LINFLEXD_UART_DRV_AbortAutoBaud().
+ */
+status_t LINFLEXD_UART_DRV_GetAutoBaudStatus(uint32_t instance, uint32_t * baudrate);
+
+/*!
+ * @brief Stops automatic baud rate detection.
+ *
+ * The module is switched back to UART mode with the previous frame format and baud rate.
+ *
+ * @param instance LINFlexD instance number
+ * @return STATUS_SUCCESS
+ */
+status_t LINFLEXD_UART_DRV_AbortAutoBaud(uint32_t instance);
+
 /*!
  * @brief Installs callback function for the UART receive.
  *
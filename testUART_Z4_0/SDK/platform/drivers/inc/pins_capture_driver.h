@@ -0,0 +1,320 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PINS_CAPTURE_DRIVER_H
+#define PINS_CAPTURE_DRIVER_H
+
+#include "pins_driver.h"
+#include "pit_driver.h"
+#include "edma_driver.h"
+
+/*!
+ * @defgroup pins_capture_driver PINS Capture Driver
+ * @ingroup pins
+ * @brief Sampling of GPIO ports at a fixed rate by eDMA, for logic analysis
+ *
+ * A PIT channel triggers an eDMA channel at each period. The eDMA channel is routed to
+ * the always enabled DMAMUX source with the periodic trigger enabled, so each PIT period
+ * gives exactly one request, which copies the parallel input register (PGPDI) of one
+ * port, or of two adjacent ports in one 32-bit read, into a RAM buffer. The CPU is not
+ * involved per sample; the eDMA interrupts once per pass of the buffer.
+ *
+ * In one-shot mode the capture ends when the buffer is full. In continuous mode the
+ * buffer is a ring which is overwritten until PINS_DRV_CAPTURE_Stop(), so it holds the
+ * samples before the stop, as the pre-trigger memory of a logic analyzer.
+ *
+ * Once stopped, the samples are read in time order with PINS_DRV_CAPTURE_GetSample(),
+ * a trigger condition is searched with PINS_DRV_CAPTURE_FindTrigger(), and a window is
+ * exported with the run-length encoder for the host converter (tools/pins_capture).
+ *
+ * The eDMA virtual channel must be initialized by the application (any request source;
+ * the driver selects the always enabled one), and the PIT module with PIT_DRV_Init().
+ * The PIT channel must be the one wired to the trigger input of the DMAMUX channel of
+ * the eDMA channel (see the DMA channel mux chapter of the reference manual).
+ *
+ * The highest sample rate is bound by the eDMA service time of one request, a peripheral
+ * bridge read and a RAM write, and by the other eDMA channels of same or higher priority;
+ * in the order of a few MHz, to be checked on target for a given bus load. A sample rate
+ * above it loses triggers silently.
+ *
+ * Bit order: as in the PGPDI register, pin 0 of a port is the most significant bit.
+ * With two ports, the first port is in the upper 16 bits of the sample.
+ *
+ * @addtogroup pins_capture_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Largest buffer length in samples (15-bit major loop count) */
+#define PINS_CAPTURE_MAX_SAMPLES        0x7FFFU
+
+/*! @brief Trigger index of an export without trigger */
+#define PINS_CAPTURE_NO_TRIGGER         0xFFFFFFFFUL
+
+/*! @brief Size of the export header, in bytes */
+#define PINS_CAPTURE_HEADER_SIZE        28U
+
+/*! @brief Largest size of an export record, in bytes: 4 value bytes and a 5-byte run length */
+#define PINS_CAPTURE_RECORD_MAX_SIZE    9U
+
+/*! @brief Version of the export format */
+#define PINS_CAPTURE_FORMAT_VERSION     1U
+
+/*!
+ * @brief Capture modes
+ *
+ * Implements : pins_capture_mode_t_Class
+ */
+typedef enum
+{
+    PINS_CAPTURE_ONE_SHOT   = 0x00U,    /*!< The capture ends when the buffer is full */
+    PINS_CAPTURE_CONTINUOUS = 0x01U     /*!< The buffer is overwritten until the capture is stopped */
+} pins_capture_mode_t;
+
+/*!
+ * @brief Trigger conditions
+ *
+ * Implements : pins_capture_trigger_type_t_Class
+ */
+typedef enum
+{
+    PINS_CAPTURE_TRIGGER_PATTERN = 0x00U,   /*!< First sample matching the pattern */
+    PINS_CAPTURE_TRIGGER_ENTER   = 0x01U    /*!< First sample matching the pattern after one not matching it */
+} pins_capture_trigger_type_t;
+
+/*!
+ * @brief Trigger condition; a sample matches if (sample & mask) == value
+ *
+ * Implements : pins_capture_trigger_t_Class
+ */
+typedef struct
+{
+    pins_capture_trigger_type_t type;   /*!< Condition */
+    uint32_t mask;                      /*!< Bits compared */
+    uint32_t value;                     /*!< Value of the compared bits */
+} pins_capture_trigger_t;
+
+/*!
+ * @brief Capture configuration
+ *
+ * Implements : pins_capture_config_t_Class
+ */
+typedef struct
+{
+    uint8_t firstPort;                  /*!< Index of the first port captured, 0 for PTA */
+    uint8_t portCount;                  /*!< 1 or 2 ports; with 2 ports, firstPort must be even */
+    uint8_t pitChannel;                 /*!< PIT channel triggering the eDMA channel */
+    uint32_t periodTicks;               /*!< Sample period, in PIT clock periods */
+    uint8_t dmaVirtualChannel;          /*!< eDMA virtual channel */
+    pins_capture_mode_t mode;           /*!< Capture mode */
+    void * buffer;                      /*!< Sample buffer: uint16_t[] for one port, uint32_t[] for two */
+    uint32_t bufferLength;              /*!< Buffer length, in samples */
+} pins_capture_config_t;
+
+/*!
+ * @brief Runtime state of a capture
+ *
+ * The fields are internal to the driver and must not be accessed by the application.
+ *
+ * Implements : pins_capture_state_t_Class
+ */
+typedef struct
+{
+    pins_capture_config_t config;       /*!< Configuration */
+    uint32_t pitClock;                  /*!< PIT clock frequency, in Hz */
+    volatile uint32_t passes;           /*!< Passes of the buffer completed */
+    volatile bool running;              /*!< Capture running */
+    volatile bool dmaError;             /*!< eDMA error during the capture */
+    uint32_t sampleCount;               /*!< Samples held, once stopped */
+    uint32_t oldest;                    /*!< Buffer index of the oldest sample, once stopped */
+} pins_capture_state_t;
+
+/*!
+ * @brief Run-length encoder of a capture window
+ *
+ * The fields are internal to the driver and must not be accessed by the application.
+ *
+ * Implements : pins_capture_encoder_t_Class
+ */
+typedef struct
+{
+    const pins_capture_state_t * capture;   /*!< Capture encoded */
+    uint32_t first;                         /*!< First sample of the window */
+    uint32_t next;                          /*!< Next sample to encode */
+    uint32_t end;                           /*!< Sample after the window */
+    uint32_t channelMask;                   /*!< Bits exported */
+    uint32_t triggerIndex;                  /*!< Trigger sample, relative to the window */
+    bool headerDone;                        /*!< Header written */
+} pins_capture_encoder_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes a capture
+ *
+ * Routes the eDMA channel to the PIT trigger, configures its transfer and the PIT
+ * channel period. The capture is not started.
+ *
+ * @param[out] state  Pointer to the capture state structure.
+ * @param[in]  config Pointer to the capture configuration.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the eDMA channel or the PIT clock could not be configured.
+ */
+status_t PINS_DRV_CAPTURE_Init(pins_capture_state_t * state,
+                               const pins_capture_config_t * config);
+
+/*!
+ * @brief Starts a capture
+ *
+ * The buffer is rewound; the first sample is taken one period after the start.
+ *
+ * @param[in] state Pointer to the capture state structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if the capture is running.
+ */
+status_t PINS_DRV_CAPTURE_Start(pins_capture_state_t * state);
+
+/*!
+ * @brief Stops a capture
+ *
+ * Stops the PIT channel and the eDMA channel and records the samples held. Also to be
+ * called after a one-shot capture has completed. A pass completed while its eDMA
+ * interrupt is still pending is accounted, and the interrupt cleared; the function
+ * must not preempt the eDMA interrupt handler of the channel.
+ *
+ * @param[in] state Pointer to the capture state structure.
+ *
+ * @return Number of samples held.
+ */
+uint32_t PINS_DRV_CAPTURE_Stop(pins_capture_state_t * state);
+
+/*!
+ * @brief Returns whether the capture is running
+ *
+ * A one-shot capture stops by itself when the buffer is full.
+ *
+ * @param[in] state Pointer to the capture state structure.
+ *
+ * @return true if running.
+ */
+bool PINS_DRV_CAPTURE_IsRunning(const pins_capture_state_t * state);
+
+/*!
+ * @brief Returns whether an eDMA error occurred during the last capture
+ *
+ * @param[in] state Pointer to the capture state structure.
+ *
+ * @return true if an error occurred; the capture was stopped.
+ */
+bool PINS_DRV_CAPTURE_HasError(const pins_capture_state_t * state);
+
+/*!
+ * @brief Reads a sample of a stopped capture
+ *
+ * @param[in] state Pointer to the capture state structure.
+ * @param[in] index Sample index in time order, 0 for the oldest.
+ *
+ * @return The sample.
+ */
+uint32_t PINS_DRV_CAPTURE_GetSample(const pins_capture_state_t * state,
+                                    uint32_t index);
+
+/*!
+ * @brief Searches a trigger condition in a stopped capture
+ *
+ * @param[in]  state   Pointer to the capture state structure.
+ * @param[in]  trigger Pointer to the trigger condition.
+ * @param[in]  from    Sample index where the search starts.
+ * @param[out] index   Index of the trigger sample.
+ *
+ * @return true if found.
+ */
+bool PINS_DRV_CAPTURE_FindTrigger(const pins_capture_state_t * state,
+                                  const pins_capture_trigger_t * trigger,
+                                  uint32_t from,
+                                  uint32_t * index);
+
+/*!
+ * @brief Prepares the export of a window of a stopped capture
+ *
+ * The export starts with a PINS_CAPTURE_HEADER_SIZE byte header, all fields little-endian:
+ * - 0: 'L', 'A'
+ * - 2: format version
+ * - 3: sample size in bytes, 2 or 4
+ * - 4: index of the first port
+ * - 5: 3 reserved bytes, 0
+ * - 8: PIT clock frequency in Hz, 32 bits
+ * - 12: sample period in PIT clock periods, 32 bits
+ * - 16: number of samples, 32 bits
+ * - 20: trigger sample, relative to the window, or PINS_CAPTURE_NO_TRIGGER, 32 bits
+ * - 24: channel mask, 32 bits
+ *
+ * followed by records, each a sample value masked with the channel mask (sample size,
+ * little-endian) and its repeat count, at least 1, as an unsigned LEB128 number. The
+ * repeat counts add up to the number of samples.
+ *
+ * @param[out] encoder      Pointer to the encoder.
+ * @param[in]  state        Pointer to the capture state structure.
+ * @param[in]  first        First sample of the window.
+ * @param[in]  count        Number of samples of the window.
+ * @param[in]  channelMask  Bits exported; the other bits do not break the runs.
+ * @param[in]  triggerIndex Trigger sample, in time order, or PINS_CAPTURE_NO_TRIGGER.
+ */
+void PINS_DRV_CAPTURE_EncodeInit(pins_capture_encoder_t * encoder,
+                                 const pins_capture_state_t * state,
+                                 uint32_t first,
+                                 uint32_t count,
+                                 uint32_t channelMask,
+                                 uint32_t triggerIndex);
+
+/*!
+ * @brief Encodes the next part of the export
+ *
+ * Writes the header at the first call, then as many whole records as fit.
+ *
+ * @param[in]  encoder Pointer to the encoder.
+ * @param[out] data    Output buffer.
+ * @param[in]  size    Output buffer size; at least PINS_CAPTURE_HEADER_SIZE.
+ *
+ * @return Number of bytes written, 0 when the export is complete.
+ */
+uint32_t PINS_DRV_CAPTURE_Encode(pins_capture_encoder_t * encoder,
+                                 uint8_t * data,
+                                 uint32_t size);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* PINS_CAPTURE_DRIVER_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -1666,6 +1666,45 @@ static bool EDMA_DRV_ValidTransferSize(edma_transfer_size_t size)
 }
 #endif
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_DRV_ClearPendingInterrupt
+ * Description   : Clears the done and interrupt flags of a stopped channel,
+ * once the minor loop being served, if any, has completed.
+ *
+ * Implements    : EDMA_DRV_ClearPendingInterrupt_Activity
+ *END**************************************************************************/
+bool EDMA_DRV_ClearPendingInterrupt(uint8_t virtualChannel)
+{
+    /* Check that virtual channel number is valid */
+    DEV_ASSERT(virtualChannel < FEATURE_DMA_VIRTUAL_CHANNELS);
+
+    /* Check that eDMA module is initialized */
+    DEV_ASSERT(s_virtEdmaState != NULL);
+
+    /* Check that virtual channel is initialized */
+    DEV_ASSERT(s_virtEdmaState->virtChnState[virtualChannel] != NULL);
+
+    /* Get DMA instance from virtual channel */
+    uint8_t dmaInstance = (uint8_t)FEATURE_DMA_VCH_TO_INSTANCE(virtualChannel);
+
+    /* Get DMA channel from virtual channel*/
+    uint8_t dmaChannel = (uint8_t)FEATURE_DMA_VCH_TO_CH(virtualChannel);
+
+    DMA_Type *edmaRegBase = s_edmaBase[dmaInstance];
+    bool pending;
+
+    /* A request already being served completes */
+    while (EDMA_TCDGetActiveStatus(edmaRegBase, dmaChannel))
+    {
+    }
+
+    pending = EDMA_GetIntStatusFlag(edmaRegBase, dmaChannel);
+    EDMA_DRV_ClearIntStatus(virtualChannel);
+
+    return pending;
+}
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : EDMA_DRV_GetChannelStatus
@@ -392,6 +392,26 @@ void EDMA_ClearIntStatusFlag(DMA_Type * base, uint8_t channel)
 #endif
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_GetIntStatusFlag
+ * Description   : Gets the interrupt status of the eDMA channel.
+ *END**************************************************************************/
+bool EDMA_GetIntStatusFlag(const DMA_Type * base, uint8_t channel)
+{
+#if defined (CUSTOM_DEVASSERT) || defined (DEV_ERROR_DETECT)
+    DEV_ASSERT(channel < FEATURE_DMA_CHANNELS);
+#endif
+    bool result = false;
+#ifdef FEATURE_DMA_HWV3
+    result = ((DMA_TCD(channel).CH_INT & DMA_TCD_CH_INT_INT_MASK) != 0U);
+#endif
+#ifdef FEATURE_DMA_HWV2
+    result = ((base->INT & ((uint32_t)1U << channel)) != 0U);
+#endif
+    return result;
+}
+
 #ifdef FEATURE_DMA_HWV3
 /*FUNCTION**********************************************************************
  *
@@ -996,6 +1016,26 @@ uint32_t EDMA_TCDGetCurrentMajorCount(const DMA_Type * base, uint8_t channel)
     return (uint32_t) result;
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : EDMA_TCDGetActiveStatus
+ * Description   : Gets the active status of the channel.
+ *END**************************************************************************/
+bool EDMA_TCDGetActiveStatus(const DMA_Type * base, uint8_t channel)
+{
+#if defined (CUSTOM_DEVASSERT) || defined (DEV_ERROR_DETECT)
+    DEV_ASSERT(channel < FEATURE_DMA_CHANNELS);
+#endif
+    bool result = false;
+#ifdef FEATURE_DMA_HWV3
+    result = ((DMA_TCD(channel).CH_CSR & DMA_TCD_CH_CSR_ACTIVE_MASK) != 0U);
+#endif
+#ifdef FEATURE_DMA_HWV2
+    result = ((DMA_TCD(channel).CSR & DMA_TCD_CSR_ACTIVE_MASK) != 0U);
+#endif
+    return result;
+}
+
 #ifdef FEATURE_DMAMUX_AVAILABLE
 /*FUNCTION**********************************************************************
  *
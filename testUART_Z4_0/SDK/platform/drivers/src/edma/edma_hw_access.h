@@ -259,6 +259,15 @@ void EDMA_TriggerChannelStart(DMA_Type * base, uint8_t channel);
  */
 void EDMA_ClearIntStatusFlag(DMA_Type * base, uint8_t channel);
 
+/*!
+ * @brief Gets the interrupt status of an eDMA channel.
+ *
+ * @param base Register base address for eDMA module.
+ * @param channel Channel indicator.
+ * @return True if the channel interrupt request is pending.
+ */
+bool EDMA_GetIntStatusFlag(const DMA_Type * base, uint8_t channel);
+
 /*! @} */
 
 /*!
@@ -563,6 +572,15 @@ void EDMA_TCDSetMajorCount(DMA_Type * base, uint8_t channel, uint32_t count);
  */
 uint32_t EDMA_TCDGetCurrentMajorCount(const DMA_Type * base, uint8_t channel);
 
+/*!
+ * @brief Returns whether the channel is executing a minor loop.
+ *
+ * @param base Register base address for eDMA module.
+ * @param channel eDMA channel number.
+ * @return True if the channel is active.
+ */
+bool EDMA_TCDGetActiveStatus(const DMA_Type * base, uint8_t channel);
+
 #ifdef FEATURE_DMAMUX_AVAILABLE
 /*!
  * @brief Initializes the DMAMUX module to the reset state.
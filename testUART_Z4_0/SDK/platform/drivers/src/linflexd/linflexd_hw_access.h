@@ -184,6 +184,26 @@ static inline void LINFLEXD_SetMode(LINFlexD_Type *base, linflexd_mode_t mode)
     base->UARTCR = regValTemp;
 }
 
+/*!
+ * @brief Configures the LIN slave automatic synchronization.
+ *
+ * When enabled, the module operates as LIN slave and updates the baud rate divider
+ * from the sync field measured after each break.
+ * Should be called only when the module is in init mode.
+ *
+ * @param base LINFlexD base pointer.
+ * @param enable Enable (true) or disable (false) automatic synchronization.
+ */
+static inline void LINFLEXD_SetLinAutoSync(LINFlexD_Type *base, bool enable)
+{
+    uint32_t regValTemp;
+
+    regValTemp = base->LINCR1;
+    regValTemp &= ~(LINFlexD_LINCR1_MME_MASK | LINFlexD_LINCR1_LASE_MASK);
+    regValTemp |= LINFlexD_LINCR1_LASE(enable ? 1UL : 0UL);
+    base->LINCR1 = regValTemp;
+}
+
 /*!
  * @brief Returns the current LINFlexD state.
  *
@@ -104,6 +104,13 @@ static const IRQn_Type s_uartLINFlexDIntVec[LINFlexD_INSTANCE_COUNT] = LINFLEXD_
 /*! @brief Table to save LINFlexD clock indexes in clock configuration */
 static const clock_names_t s_uartLINFlexDClkNames[LINFlexD_INSTANCE_COUNT] = LINFLEXD_CLOCK_NAMES;
 
+/*! @brief Standard baud rates for which the dividers are cached in the driver state */
+static const uint32_t s_linflexdUartStdBaudRates[LINFLEXD_UART_STD_BAUD_RATE_COUNT] =
+{
+    1200U, 2400U, 4800U, 9600U, 14400U, 19200U, 38400U, 57600U,
+    115200U, 230400U, 460800U, 921600U, 1000000U, 1500000U, 2000000U, 3000000U
+};
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -127,6 +134,10 @@ static void LINFLEXD_UART_DRV_CompleteReceiveUsingDma(void * parameter, edma_chn
 static void LINFLEXD_UART_DRV_PutData(uint32_t instance);
 static void LINFLEXD_UART_DRV_GetData(uint32_t instance);
 static void LINFLEXD_UART_DRV_FlushRxFifo(const LINFlexD_Type *base, linflexd_uart_word_length_t wordLen);
+static uint32_t LINFLEXD_UART_DRV_ComputeDivider(uint32_t clockFreq, uint32_t baudrate);
+static void LINFLEXD_UART_DRV_FillBaudRateCache(linflexd_uart_state_t * uartState, uint32_t clockFreq);
+static void LINFLEXD_UART_DRV_WriteDivider(LINFlexD_Type *base, uint32_t divider);
+static void LINFLEXD_UART_DRV_StopAutoBaud(uint32_t instance, uint32_t divider);
 
 /*******************************************************************************
  * Code
@@ -142,22 +153,20 @@ static void LINFLEXD_UART_DRV_FlushRxFifo(const LINFlexD_Type *base, linflexd_ua
 status_t LINFLEXD_UART_DRV_SetBaudRate(uint32_t instance, uint32_t baudrate)
 {
     DEV_ASSERT(instance < LINFlexD_INSTANCE_COUNT);
+    DEV_ASSERT(baudrate != 0U);
 
-    float32_t prescaler;
-    float32_t fraction;
-    uint32_t mantissa;
-    uint32_t fractionDenominator;
-    uint8_t fractionNumerator;
+    uint32_t divider = 0U;
+    uint32_t idx;
     uint32_t uartSourceClock;
     clock_names_t instanceClkName;
     LINFlexD_Type * base;
+    linflexd_uart_state_t * uartState;
     bool resetIdle = false;
 
     instanceClkName = s_uartLINFlexDClkNames[instance];
     base = s_LINFlexDBase[instance];
     (void)CLOCK_SYS_GetFreq(instanceClkName, &uartSourceClock);
 
-    const linflexd_uart_state_t * uartState;
     uartState = (linflexd_uart_state_t *)s_uartLINFlexDStatePtr[instance];
 
     if (uartState->isTxBusy == true)
@@ -170,20 +179,34 @@ status_t LINFLEXD_UART_DRV_SetBaudRate(uint32_t instance, uint32_t baudrate)
         return STATUS_BUSY;
     }
 
-    /* Compute the values for baud rate divider mantissa and fraction */
-    prescaler = (float32_t)uartSourceClock / ((float32_t)baudrate * (float32_t)DEFAULT_OSR);
-    mantissa = (uint32_t)prescaler;
-    fraction = prescaler - (float32_t)mantissa;
-    fractionDenominator = ((uint32_t)1U << (uint32_t)BAUDRATE_FRACTION_WIDTH);
-    float32_t float32_tNumerator = ((float32_t)fraction * (float32_t)fractionDenominator) + (float32_t)0.5F;
-    fractionNumerator = (uint8_t)(float32_tNumerator);
+    if (uartState->isAutoBaudActive == true)
+    {
+        return STATUS_BUSY;
+    }
 
-    if (fractionNumerator == fractionDenominator)
+    /* Refresh the divider cache if the protocol clock was changed without notification */
+    if (uartState->baudClock != uartSourceClock)
     {
-        fractionNumerator = 0;
-        mantissa++;
+        LINFLEXD_UART_DRV_FillBaudRateCache(uartState, uartSourceClock);
     }
 
+    /* Standard baud rates use the cached divider, any other rate is computed */
+    for (idx = 0U; idx < LINFLEXD_UART_STD_BAUD_RATE_COUNT; idx++)
+    {
+        if (s_linflexdUartStdBaudRates[idx] == baudrate)
+        {
+            divider = uartState->baudDivider[idx];
+            break;
+        }
+    }
+
+    if (divider == 0U)
+    {
+        divider = LINFLEXD_UART_DRV_ComputeDivider(uartSourceClock, baudrate);
+    }
+
+    uartState->baudRate = baudrate;
+
     if (LINFLEXD_GetLinState(base) != LINFlexD_STATE_INIT_MODE)
     {
         /* Request init mode and wait until the mode entry is complete */
@@ -193,9 +216,8 @@ status_t LINFLEXD_UART_DRV_SetBaudRate(uint32_t instance, uint32_t baudrate)
         resetIdle = true;
     }
 
-    /* Write the computed values to registers */
-    LINFLEXD_SetIntegerBaudRate(base, mantissa);
-    LINFLEXD_SetFractionalBaudRate(base, fractionNumerator);
+    /* Write the divider to registers */
+    LINFLEXD_UART_DRV_WriteDivider(base, divider);
 
     if (resetIdle == true)
     {
@@ -238,6 +260,221 @@ status_t LINFLEXD_UART_DRV_GetBaudRate(uint32_t instance, uint32_t * baudrate)
     return STATUS_SUCCESS;
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_UpdateBaudRateCache
+ * Description   : This function recomputes the cached dividers of the standard
+ * baud rates for the current protocol clock.
+ *
+ * Implements    : LINFLEXD_UART_DRV_UpdateBaudRateCache_Activity
+ *END**************************************************************************/
+status_t LINFLEXD_UART_DRV_UpdateBaudRateCache(uint32_t instance)
+{
+    DEV_ASSERT(instance < LINFlexD_INSTANCE_COUNT);
+    DEV_ASSERT(s_uartLINFlexDStatePtr[instance] != NULL);
+
+    uint32_t uartSourceClock;
+
+    (void)CLOCK_SYS_GetFreq(s_uartLINFlexDClkNames[instance], &uartSourceClock);
+    LINFLEXD_UART_DRV_FillBaudRateCache(s_uartLINFlexDStatePtr[instance], uartSourceClock);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_ClockNotificationCallback
+ * Description   : Clock manager callback; refuses a graceful clock change while
+ * the instance is busy and reprograms the baud rate after the clock changed.
+ *
+ * Implements    : LINFLEXD_UART_DRV_ClockNotificationCallback_Activity
+ *END**************************************************************************/
+status_t LINFLEXD_UART_DRV_ClockNotificationCallback(clock_notify_struct_t * notify, void * callbackData)
+{
+    DEV_ASSERT(notify != NULL);
+
+    uint32_t instance = ((uint32_t)callbackData);
+    const linflexd_uart_state_t * uartState;
+    status_t status = STATUS_SUCCESS;
+
+    DEV_ASSERT(instance < LINFlexD_INSTANCE_COUNT);
+
+    uartState = (linflexd_uart_state_t *)s_uartLINFlexDStatePtr[instance];
+
+    /* Nothing to do for an instance which is not initialized */
+    if (uartState == NULL)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    switch (notify->notifyType)
+    {
+        case CLOCK_MANAGER_NOTIFY_BEFORE:
+            if ((notify->policy == CLOCK_MANAGER_POLICY_AGREEMENT) &&
+                (uartState->isTxBusy || uartState->isRxBusy || uartState->isAutoBaudActive))
+            {
+                status = STATUS_BUSY;
+            }
+            break;
+        case CLOCK_MANAGER_NOTIFY_AFTER:
+            (void)LINFLEXD_UART_DRV_UpdateBaudRateCache(instance);
+            status = LINFLEXD_UART_DRV_SetBaudRate(instance, uartState->baudRate);
+            break;
+        default:
+            /* Nothing to recover */
+            break;
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_StartAutoBaud
+ * Description   : This function switches the module to LIN slave mode with
+ * automatic synchronization, so the next break + sync field received on the line
+ * is measured by the hardware.
+ *
+ * Implements    : LINFLEXD_UART_DRV_StartAutoBaud_Activity
+ *END**************************************************************************/
+status_t LINFLEXD_UART_DRV_StartAutoBaud(uint32_t instance)
+{
+    DEV_ASSERT(instance < LINFlexD_INSTANCE_COUNT);
+    DEV_ASSERT(s_uartLINFlexDStatePtr[instance] != NULL);
+
+    LINFlexD_Type * base = s_LINFlexDBase[instance];
+    linflexd_uart_state_t * uartState = s_uartLINFlexDStatePtr[instance];
+
+    if (uartState->isTxBusy || uartState->isRxBusy || uartState->isAutoBaudActive)
+    {
+        return STATUS_BUSY;
+    }
+
+    /* Request init mode and wait until the mode entry is complete */
+    LINFLEXD_EnterInitMode(base);
+    while (LINFLEXD_GetLinState(base) != LINFlexD_STATE_INIT_MODE) {}
+
+    /* Save the UART configuration; the UART error interrupts are not meaningful in LIN mode */
+    uartState->autoBaudUartcr = base->UARTCR;
+    uartState->autoBaudLinier = base->LINIER;
+    uartState->autoBaudDivider = (LINFLEXD_GetIntegerBaudRate(base) << BAUDRATE_FRACTION_WIDTH) +
+                                 (uint32_t)LINFLEXD_GetFractionalBaudRate(base);
+    base->LINIER = 0U;
+
+    /* Switch to LIN slave mode with automatic synchronization */
+    LINFLEXD_SetMode(base, LINFlexD_LIN_MODE);
+    LINFLEXD_SetLinAutoSync(base, true);
+
+    /* Clear stale status flags */
+    base->LINSR = LINFlexD_LINSR_AUTOSYNC_COMP_MASK | LINFlexD_LINSR_HRF_MASK;
+    base->LINESR = base->LINESR;
+
+    uartState->isAutoBaudActive = true;
+
+    /* Enter normal mode */
+    LINFLEXD_EnterNormalMode(base);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_GetAutoBaudStatus
+ * Description   : This function checks whether the sync field was measured and,
+ * if so, applies the closest standard baud rate and restores UART mode.
+ *
+ * Implements    : LINFLEXD_UART_DRV_GetAutoBaudStatus_Activity
+ *END**************************************************************************/
+status_t LINFLEXD_UART_DRV_GetAutoBaudStatus(uint32_t instance, uint32_t * baudrate)
+{
+    DEV_ASSERT(instance < LINFlexD_INSTANCE_COUNT);
+    DEV_ASSERT(s_uartLINFlexDStatePtr[instance] != NULL);
+    DEV_ASSERT(baudrate != NULL);
+
+    LINFlexD_Type * base = s_LINFlexDBase[instance];
+    linflexd_uart_state_t * uartState = s_uartLINFlexDStatePtr[instance];
+    uint32_t measured;
+    uint32_t divider;
+    uint32_t deviation;
+    uint32_t bestDeviation = 0xFFFFFFFFU;
+    uint32_t bestIdx = 0U;
+    uint32_t idx;
+
+    if (!uartState->isAutoBaudActive)
+    {
+        return STATUS_ERROR;
+    }
+
+    measured = (LINFLEXD_GetIntegerBaudRate(base) << BAUDRATE_FRACTION_WIDTH) +
+               (uint32_t)LINFLEXD_GetFractionalBaudRate(base);
+
+    if (((base->LINSR & LINFlexD_LINSR_AUTOSYNC_COMP_MASK) == 0U) && (measured == uartState->autoBaudDivider))
+    {
+        /* Sync field errors only restart the measurement on the next break */
+        base->LINESR = base->LINESR;
+        return STATUS_BUSY;
+    }
+
+    if (measured == 0U)
+    {
+        /* No rate can be derived from a null divider; the detection stays active */
+        return STATUS_ERROR;
+    }
+
+    /* Find the closest standard baud rate */
+    for (idx = 0U; idx < LINFLEXD_UART_STD_BAUD_RATE_COUNT; idx++)
+    {
+        divider = uartState->baudDivider[idx];
+        deviation = (divider > measured) ? (divider - measured) : (measured - divider);
+        if (deviation < bestDeviation)
+        {
+            bestDeviation = deviation;
+            bestIdx = idx;
+        }
+    }
+
+    divider = uartState->baudDivider[bestIdx];
+    if ((bestDeviation * 1000U) <= (divider * LINFLEXD_UART_AUTO_BAUD_TOLERANCE))
+    {
+        /* Use the exact divider of the standard rate instead of the measurement */
+        *baudrate = s_linflexdUartStdBaudRates[bestIdx];
+    }
+    else
+    {
+        /* Non-standard rate: keep the measured divider */
+        divider = measured;
+        *baudrate = uartState->baudClock / measured;
+    }
+
+    uartState->baudRate = *baudrate;
+    LINFLEXD_UART_DRV_StopAutoBaud(instance, divider);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_AbortAutoBaud
+ * Description   : This function stops the automatic baud rate detection and
+ * restores the previous UART configuration.
+ *
+ * Implements    : LINFLEXD_UART_DRV_AbortAutoBaud_Activity
+ *END**************************************************************************/
+status_t LINFLEXD_UART_DRV_AbortAutoBaud(uint32_t instance)
+{
+    DEV_ASSERT(instance < LINFlexD_INSTANCE_COUNT);
+    DEV_ASSERT(s_uartLINFlexDStatePtr[instance] != NULL);
+
+    const linflexd_uart_state_t * uartState = s_uartLINFlexDStatePtr[instance];
+
+    if (uartState->isAutoBaudActive)
+    {
+        LINFLEXD_UART_DRV_StopAutoBaud(instance, uartState->autoBaudDivider);
+    }
+
+    return STATUS_SUCCESS;
+}
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : LINFLEXD_UART_DRV_InstallRxCallback
@@ -367,6 +604,9 @@ status_t LINFLEXD_UART_DRV_Init(uint32_t instance, linflexd_uart_state_t * uartS
     /* Set UART mode */
     LINFLEXD_SetMode(base, LINFlexD_UART_MODE);
 
+    /* Precompute the dividers of the standard baud rates */
+    LINFLEXD_UART_DRV_FillBaudRateCache(uartStatePtr, uartSourceClock);
+
     /* Set the baud rate */
     (void)LINFLEXD_UART_DRV_SetBaudRate(instance, uartUserConfig->baudRate);
 
@@ -1856,3 +2096,85 @@ static void LINFLEXD_UART_DRV_FlushRxFifo(const LINFlexD_Type *base, linflexd_ua
         (void)dummy;
     }
 }
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_ComputeDivider
+ * Description   : Computes the baud rate divider, in 1/16 units of the protocol
+ * clock (LINIBRR * 16 + LINFBRR), rounded to the nearest value.
+ * This is not a public API as it is called from other driver functions.
+ *
+ *END**************************************************************************/
+static uint32_t LINFLEXD_UART_DRV_ComputeDivider(uint32_t clockFreq, uint32_t baudrate)
+{
+    return (clockFreq + (baudrate >> 1U)) / baudrate;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_FillBaudRateCache
+ * Description   : Computes the dividers of the standard baud rates for the
+ * given protocol clock.
+ * This is not a public API as it is called from other driver functions.
+ *
+ *END**************************************************************************/
+static void LINFLEXD_UART_DRV_FillBaudRateCache(linflexd_uart_state_t * uartState, uint32_t clockFreq)
+{
+    uint32_t idx;
+
+    for (idx = 0U; idx < LINFLEXD_UART_STD_BAUD_RATE_COUNT; idx++)
+    {
+        uartState->baudDivider[idx] = LINFLEXD_UART_DRV_ComputeDivider(clockFreq, s_linflexdUartStdBaudRates[idx]);
+    }
+
+    uartState->baudClock = clockFreq;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_WriteDivider
+ * Description   : Writes the integer and fractional baud rate registers.
+ * Should be called only when the module is in init mode.
+ * This is not a public API as it is called from other driver functions.
+ *
+ *END**************************************************************************/
+static void LINFLEXD_UART_DRV_WriteDivider(LINFlexD_Type *base, uint32_t divider)
+{
+    LINFLEXD_SetIntegerBaudRate(base, divider >> BAUDRATE_FRACTION_WIDTH);
+    LINFLEXD_SetFractionalBaudRate(base, (uint8_t)(divider & (DEFAULT_OSR - 1U)));
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LINFLEXD_UART_DRV_StopAutoBaud
+ * Description   : Leaves LIN slave mode, restores the saved UART configuration
+ * and programs the given divider.
+ * This is not a public API as it is called from other driver functions.
+ *
+ *END**************************************************************************/
+static void LINFLEXD_UART_DRV_StopAutoBaud(uint32_t instance, uint32_t divider)
+{
+    LINFlexD_Type * base = s_LINFlexDBase[instance];
+    linflexd_uart_state_t * uartState = s_uartLINFlexDStatePtr[instance];
+
+    /* Request init mode and wait until the mode entry is complete */
+    LINFLEXD_EnterInitMode(base);
+    while (LINFLEXD_GetLinState(base) != LINFlexD_STATE_INIT_MODE) {}
+
+    /* Restore UART mode; UARTCR can only be written once the UART bit is set */
+    LINFLEXD_SetLinAutoSync(base, false);
+    LINFLEXD_SetMode(base, LINFlexD_UART_MODE);
+    base->UARTCR = uartState->autoBaudUartcr;
+    LINFLEXD_UART_DRV_WriteDivider(base, divider);
+
+    /* Clear the flags raised in LIN mode and restore the interrupts */
+    base->LINSR = base->LINSR;
+    base->LINESR = base->LINESR;
+    base->UARTSR = base->UARTSR;
+    base->LINIER = uartState->autoBaudLinier;
+
+    uartState->isAutoBaudActive = false;
+
+    /* Enter normal mode */
+    LINFLEXD_EnterNormalMode(base);
+}
@@ -0,0 +1,513 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file pins_capture_driver.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.4, Conversion between a pointer and
+ * integer type.
+ * The eDMA driver takes the register and buffer addresses as integers.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.5, Conversion from pointer to void to
+ * pointer to other type.
+ * The sample buffer is given as void * as its element type depends on the
+ * number of ports; the eDMA callback parameter is the capture state.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.6, Cast from unsigned int to pointer.
+ * The cast is required to initialize a pointer with an unsigned long define,
+ * representing an address.
+ */
+
+#include "pins_capture_driver.h"
+#include "clock_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* PIT instance; the device has a single one */
+#define PINS_CAPTURE_PIT_INSTANCE   0U
+
+/* Always enabled DMAMUX request sources, one per DMAMUX instance */
+static const dma_request_source_t s_alwaysEnabled[] =
+{
+    EDMA_REQ_MUX_0_ALWAYS_ENABLED_0, EDMA_REQ_MUX_1_ALWAYS_ENABLED_0
+};
+
+/* PIT clock */
+static const clock_names_t s_pitClockNames[PIT_INSTANCE_COUNT] = PIT_CLOCK_NAMES;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void PINS_CAPTURE_DmaCallback(void * parameter,
+                                     edma_chn_status_t status);
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_CAPTURE_DmaCallback
+ * Description   : Counts the passes of the buffer; a one-shot capture is
+ * complete after the first one, its requests having been disabled by the
+ * eDMA. The PIT channel is stopped as it has nothing left to trigger.
+ *
+ *END**************************************************************************/
+static void PINS_CAPTURE_DmaCallback(void * parameter,
+                                     edma_chn_status_t status)
+{
+    pins_capture_state_t * state = (pins_capture_state_t *)parameter;
+
+    if (status == EDMA_CHN_ERROR)
+    {
+        PIT_DRV_StopChannel(PINS_CAPTURE_PIT_INSTANCE, state->config.pitChannel);
+        state->dmaError = true;
+        state->running = false;
+    }
+    else
+    {
+        state->passes++;
+        if (state->config.mode == PINS_CAPTURE_ONE_SHOT)
+        {
+            PIT_DRV_StopChannel(PINS_CAPTURE_PIT_INSTANCE, state->config.pitChannel);
+            state->running = false;
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_CAPTURE_ReadBuffer
+ * Description   : Reads a sample at a buffer index.
+ *
+ *END**************************************************************************/
+static inline uint32_t PINS_CAPTURE_ReadBuffer(const pins_capture_state_t * state,
+                                               uint32_t bufferIndex)
+{
+    uint32_t ret;
+
+    if (state->config.portCount == 1U)
+    {
+        ret = ((const uint16_t *)state->config.buffer)[bufferIndex];
+    }
+    else
+    {
+        ret = ((const uint32_t *)state->config.buffer)[bufferIndex];
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_CAPTURE_Put32
+ * Description   : Writes a 32-bit little-endian field.
+ *
+ *END**************************************************************************/
+static inline void PINS_CAPTURE_Put32(uint8_t * data,
+                                      uint32_t value)
+{
+    data[0U] = (uint8_t)value;
+    data[1U] = (uint8_t)(value >> 8U);
+    data[2U] = (uint8_t)(value >> 16U);
+    data[3U] = (uint8_t)(value >> 24U);
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_Init
+ * Description   : Each request moves one sample from PGPDI into the buffer;
+ * the destination wraps at the end of the major loop, so the same TCD serves
+ * both modes, the one-shot mode only clearing the requests at completion.
+ *
+ * Implements    : PINS_DRV_CAPTURE_Init_Activity
+ *END**************************************************************************/
+status_t PINS_DRV_CAPTURE_Init(pins_capture_state_t * state,
+                               const pins_capture_config_t * config)
+{
+    edma_loop_transfer_config_t loopConfig;
+    edma_transfer_config_t transferConfig;
+    pit_channel_config_t pitConfig;
+    uint32_t sampleSize;
+    status_t ret;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->buffer != NULL);
+    DEV_ASSERT((config->bufferLength > 0U) && (config->bufferLength <= PINS_CAPTURE_MAX_SAMPLES));
+    DEV_ASSERT((config->portCount == 1U) || (config->portCount == 2U));
+    DEV_ASSERT((config->portCount == 1U) || ((config->firstPort & 1U) == 0U));
+    DEV_ASSERT(((uint32_t)config->firstPort + config->portCount) <= SIUL2_PGPDI_COUNT);
+    DEV_ASSERT(config->pitChannel < PIT_TIMER_COUNT);
+    DEV_ASSERT(config->periodTicks != 0U);
+    DEV_ASSERT((config->dmaVirtualChannel / FEATURE_DMAMUX_CHANNELS) < (sizeof(s_alwaysEnabled) / sizeof(s_alwaysEnabled[0U])));
+
+    state->config = *config;
+    state->passes = 0U;
+    state->running = false;
+    state->dmaError = false;
+    state->sampleCount = 0U;
+    state->oldest = 0U;
+    sampleSize = 2UL * config->portCount;
+
+    if (CLOCK_SYS_GetFreq(s_pitClockNames[PINS_CAPTURE_PIT_INSTANCE], &state->pitClock) != STATUS_SUCCESS)
+    {
+        return STATUS_ERROR;
+    }
+
+    loopConfig.majorLoopIterationCount = config->bufferLength;
+    loopConfig.srcOffsetEnable = false;
+    loopConfig.dstOffsetEnable = false;
+    loopConfig.minorLoopOffset = 0;
+    loopConfig.minorLoopChnLinkEnable = false;
+    loopConfig.minorLoopChnLinkNumber = 0U;
+    loopConfig.majorLoopChnLinkEnable = false;
+    loopConfig.majorLoopChnLinkNumber = 0U;
+
+    transferConfig.srcAddr = (uint32_t)&SIUL2->PGPDI[config->firstPort];
+    transferConfig.destAddr = (uint32_t)config->buffer;
+    transferConfig.srcTransferSize = (config->portCount == 1U) ? EDMA_TRANSFER_SIZE_2B : EDMA_TRANSFER_SIZE_4B;
+    transferConfig.destTransferSize = transferConfig.srcTransferSize;
+    transferConfig.srcOffset = 0;
+    transferConfig.destOffset = (int16_t)sampleSize;
+    transferConfig.srcLastAddrAdjust = 0;
+    transferConfig.destLastAddrAdjust = -(int32_t)(config->bufferLength * sampleSize);
+    transferConfig.srcModulo = EDMA_MODULO_OFF;
+    transferConfig.destModulo = EDMA_MODULO_OFF;
+    transferConfig.minorByteTransferCount = sampleSize;
+    transferConfig.scatterGatherEnable = false;
+    transferConfig.scatterGatherNextDescAddr = 0U;
+    transferConfig.interruptEnable = true;
+    transferConfig.loopTransferConfig = &loopConfig;
+
+    ret = EDMA_DRV_SetChannelRequestAndTrigger(config->dmaVirtualChannel,
+                                               (uint8_t)s_alwaysEnabled[config->dmaVirtualChannel / FEATURE_DMAMUX_CHANNELS],
+                                               true);
+    if (ret == STATUS_SUCCESS)
+    {
+        ret = EDMA_DRV_ConfigLoopTransfer(config->dmaVirtualChannel, &transferConfig);
+    }
+    if (ret == STATUS_SUCCESS)
+    {
+        EDMA_DRV_DisableRequestsOnTransferComplete(config->dmaVirtualChannel, config->mode == PINS_CAPTURE_ONE_SHOT);
+        ret = EDMA_DRV_InstallCallback(config->dmaVirtualChannel, PINS_CAPTURE_DmaCallback, state);
+    }
+
+    if (ret == STATUS_SUCCESS)
+    {
+        pitConfig.hwChannel = config->pitChannel;
+        pitConfig.periodUnit = PIT_PERIOD_UNITS_COUNTS;
+        pitConfig.period = config->periodTicks;
+        pitConfig.enableChain = false;
+        pitConfig.enableInterrupt = false;
+        ret = PIT_DRV_InitChannel(PINS_CAPTURE_PIT_INSTANCE, &pitConfig);
+    }
+
+    return (ret == STATUS_SUCCESS) ? STATUS_SUCCESS : STATUS_ERROR;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_Start
+ * Description   : Rewinds the TCD and enables the requests before the PIT, so
+ * that the first trigger is served.
+ *
+ * Implements    : PINS_DRV_CAPTURE_Start_Activity
+ *END**************************************************************************/
+status_t PINS_DRV_CAPTURE_Start(pins_capture_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    if (state->running)
+    {
+        return STATUS_BUSY;
+    }
+
+    EDMA_DRV_SetDestAddr(state->config.dmaVirtualChannel, (uint32_t)state->config.buffer);
+    EDMA_DRV_SetMajorLoopIterationCount(state->config.dmaVirtualChannel, state->config.bufferLength);
+    state->passes = 0U;
+    state->sampleCount = 0U;
+    state->oldest = 0U;
+    state->dmaError = false;
+    state->running = true;
+
+    (void)EDMA_DRV_StartChannel(state->config.dmaVirtualChannel);
+    PIT_DRV_StartChannel(PINS_CAPTURE_PIT_INSTANCE, state->config.pitChannel);
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_Stop
+ * Description   : The samples written are the completed passes plus the
+ * position in the current one; once the buffer has wrapped, it is full and
+ * the oldest sample is the next one to be overwritten. The last pass may have
+ * completed with its interrupt still pending, the major loop count already
+ * reloaded: it is taken from the channel flags, which are cleared so that it
+ * does not count into the next capture.
+ *
+ * Implements    : PINS_DRV_CAPTURE_Stop_Activity
+ *END**************************************************************************/
+uint32_t PINS_DRV_CAPTURE_Stop(pins_capture_state_t * state)
+{
+    uint32_t length;
+    uint32_t position;
+    bool wrapped;
+
+    DEV_ASSERT(state != NULL);
+
+    PIT_DRV_StopChannel(PINS_CAPTURE_PIT_INSTANCE, state->config.pitChannel);
+    (void)EDMA_DRV_StopChannel(state->config.dmaVirtualChannel);
+    /* The flag is read before the count, as the handler clears it before counting */
+    wrapped = EDMA_DRV_ClearPendingInterrupt(state->config.dmaVirtualChannel);
+    wrapped = wrapped || (state->passes != 0U);
+    state->running = false;
+
+    length = state->config.bufferLength;
+    position = length - EDMA_DRV_GetRemainingMajorIterationsCount(state->config.dmaVirtualChannel);
+    if (!wrapped)
+    {
+        state->sampleCount = position;
+        state->oldest = 0U;
+    }
+    else
+    {
+        state->sampleCount = length;
+        state->oldest = (state->config.mode == PINS_CAPTURE_ONE_SHOT) ? 0U : position;
+    }
+
+    return state->sampleCount;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_IsRunning
+ * Description   : Returns whether the capture is running.
+ *
+ * Implements    : PINS_DRV_CAPTURE_IsRunning_Activity
+ *END**************************************************************************/
+bool PINS_DRV_CAPTURE_IsRunning(const pins_capture_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    return state->running;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_HasError
+ * Description   : Returns whether an eDMA error stopped the capture.
+ *
+ * Implements    : PINS_DRV_CAPTURE_HasError_Activity
+ *END**************************************************************************/
+bool PINS_DRV_CAPTURE_HasError(const pins_capture_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    return state->dmaError;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_GetSample
+ * Description   : Maps the time order index onto the ring.
+ *
+ * Implements    : PINS_DRV_CAPTURE_GetSample_Activity
+ *END**************************************************************************/
+uint32_t PINS_DRV_CAPTURE_GetSample(const pins_capture_state_t * state,
+                                    uint32_t index)
+{
+    uint32_t bufferIndex;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(index < state->sampleCount);
+
+    bufferIndex = state->oldest + index;
+    if (bufferIndex >= state->config.bufferLength)
+    {
+        bufferIndex -= state->config.bufferLength;
+    }
+
+    return PINS_CAPTURE_ReadBuffer(state, bufferIndex);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_FindTrigger
+ * Description   : Scans the samples in time order. An entering condition
+ * needs the previous sample, so it cannot match on the oldest one.
+ *
+ * Implements    : PINS_DRV_CAPTURE_FindTrigger_Activity
+ *END**************************************************************************/
+bool PINS_DRV_CAPTURE_FindTrigger(const pins_capture_state_t * state,
+                                  const pins_capture_trigger_t * trigger,
+                                  uint32_t from,
+                                  uint32_t * index)
+{
+    uint32_t i = from;
+    bool matched;
+    bool previous = true;
+    bool found = false;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(trigger != NULL);
+    DEV_ASSERT(index != NULL);
+
+    if ((trigger->type == PINS_CAPTURE_TRIGGER_ENTER) && (i > 0U) && (i < state->sampleCount))
+    {
+        previous = ((PINS_DRV_CAPTURE_GetSample(state, i - 1U) & trigger->mask) == trigger->value);
+    }
+
+    for (; (i < state->sampleCount) && (found == false); i++)
+    {
+        matched = ((PINS_DRV_CAPTURE_GetSample(state, i) & trigger->mask) == trigger->value);
+        if (matched && ((trigger->type == PINS_CAPTURE_TRIGGER_PATTERN) || (previous == false)))
+        {
+            *index = i;
+            found = true;
+        }
+        previous = matched;
+    }
+
+    return found;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_EncodeInit
+ * Description   : Prepares the export of a window.
+ *
+ * Implements    : PINS_DRV_CAPTURE_EncodeInit_Activity
+ *END**************************************************************************/
+void PINS_DRV_CAPTURE_EncodeInit(pins_capture_encoder_t * encoder,
+                                 const pins_capture_state_t * state,
+                                 uint32_t first,
+                                 uint32_t count,
+                                 uint32_t channelMask,
+                                 uint32_t triggerIndex)
+{
+    DEV_ASSERT(encoder != NULL);
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(first <= state->sampleCount);
+    DEV_ASSERT(count <= (state->sampleCount - first));
+
+    encoder->capture = state;
+    encoder->first = first;
+    encoder->next = first;
+    encoder->end = first + count;
+    encoder->channelMask = channelMask;
+    if ((triggerIndex >= first) && (triggerIndex < encoder->end))
+    {
+        encoder->triggerIndex = triggerIndex - first;
+    }
+    else
+    {
+        encoder->triggerIndex = PINS_CAPTURE_NO_TRIGGER;
+    }
+    encoder->headerDone = false;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_CAPTURE_Encode
+ * Description   : Writes the header, then one record per run of equal masked
+ * samples while a record of the largest size still fits.
+ *
+ * Implements    : PINS_DRV_CAPTURE_Encode_Activity
+ *END**************************************************************************/
+uint32_t PINS_DRV_CAPTURE_Encode(pins_capture_encoder_t * encoder,
+                                 uint8_t * data,
+                                 uint32_t size)
+{
+    const pins_capture_state_t * state;
+    uint32_t sampleSize;
+    uint32_t written = 0U;
+    uint32_t value;
+    uint32_t run;
+    uint32_t i;
+
+    DEV_ASSERT(encoder != NULL);
+    DEV_ASSERT(data != NULL);
+    DEV_ASSERT(size >= PINS_CAPTURE_HEADER_SIZE);
+
+    state = encoder->capture;
+    sampleSize = 2UL * state->config.portCount;
+
+    if (encoder->headerDone == false)
+    {
+        data[0U] = (uint8_t)'L';
+        data[1U] = (uint8_t)'A';
+        data[2U] = (uint8_t)PINS_CAPTURE_FORMAT_VERSION;
+        data[3U] = (uint8_t)sampleSize;
+        data[4U] = state->config.firstPort;
+        data[5U] = 0U;
+        data[6U] = 0U;
+        data[7U] = 0U;
+        PINS_CAPTURE_Put32(&data[8U], state->pitClock);
+        PINS_CAPTURE_Put32(&data[12U], state->config.periodTicks);
+        PINS_CAPTURE_Put32(&data[16U], encoder->end - encoder->first);
+        PINS_CAPTURE_Put32(&data[20U], encoder->triggerIndex);
+        PINS_CAPTURE_Put32(&data[24U], encoder->channelMask);
+        written = PINS_CAPTURE_HEADER_SIZE;
+        encoder->headerDone = true;
+    }
+
+    while ((encoder->next < encoder->end) && ((size - written) >= PINS_CAPTURE_RECORD_MAX_SIZE))
+    {
+        value = PINS_DRV_CAPTURE_GetSample(state, encoder->next) & encoder->channelMask;
+        run = 1U;
+        while (((encoder->next + run) < encoder->end) &&
+               ((PINS_DRV_CAPTURE_GetSample(state, encoder->next + run) & encoder->channelMask) == value))
+        {
+            run++;
+        }
+        encoder->next += run;
+
+        for (i = 0U; i < sampleSize; i++)
+        {
+            data[written] = (uint8_t)(value >> (8U * i));
+            written++;
+        }
+        while (run >= 0x80U)
+        {
+            data[written] = (uint8_t)((run & 0x7FU) | 0x80U);
+            written++;
+            run >>= 7U;
+        }
+        data[written] = (uint8_t)run;
+        written++;
+    }
+
+    return written;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
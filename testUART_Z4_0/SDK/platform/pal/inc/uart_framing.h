@@ -0,0 +1,276 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef UART_FRAMING_H
+#define UART_FRAMING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_pal.h"
+
+/*!
+ * @defgroup uart_framing UART Framing
+ * @ingroup uart_pal
+ * @brief Packet framing layer (COBS / SLIP with CRC) on top of the UART PAL
+ *
+ * The framing layer encodes packets directly into the buffer handed to
+ * UART_SendData() and decodes packets incrementally from the slices delivered
+ * by the receive path (UART_EVENT_RX_FULL callback or a DMA buffer half),
+ * so no intermediate copy or second pass over the data is needed.
+ * CRCs are computed with 4 bytes per iteration (slicing-by-4 tables in flash).
+ *
+ * @addtogroup uart_framing
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Initial value of the CRC-16/CCITT-FALSE register */
+#define UART_FRAMING_CRC16_INIT    0xFFFFU
+/*! @brief Initial value of the CRC-32 (IEEE 802.3) register */
+#define UART_FRAMING_CRC32_INIT    0xFFFFFFFFU
+
+/*!
+ * @brief Defines the byte stuffing algorithm
+ *
+ * Implements : uart_framing_type_t_Class
+ */
+typedef enum
+{
+    UART_FRAMING_COBS = 0U,    /*!< Consistent Overhead Byte Stuffing, frames delimited by 0x00 */
+    UART_FRAMING_SLIP = 1U     /*!< SLIP (RFC 1055), frames delimited by 0xC0 */
+} uart_framing_type_t;
+
+/*!
+ * @brief Defines the CRC appended to each frame
+ *
+ * The enumerator value is the number of CRC bytes appended to the payload.
+ *
+ * Implements : uart_framing_crc_t_Class
+ */
+typedef enum
+{
+    UART_FRAMING_CRC_NONE = 0U,    /*!< No CRC */
+    UART_FRAMING_CRC_16   = 2U,    /*!< CRC-16/CCITT-FALSE, appended MSB first */
+    UART_FRAMING_CRC_32   = 4U     /*!< CRC-32 (IEEE 802.3), appended LSB first */
+} uart_framing_crc_t;
+
+/*!
+ * @brief Defines the events reported by the frame decoder
+ *
+ * Implements : uart_framing_event_t_Class
+ */
+typedef enum
+{
+    UART_FRAMING_EVENT_FRAME_RECEIVED = 0x00U,    /*!< A complete frame with a valid CRC was decoded */
+    UART_FRAMING_EVENT_CRC_ERROR      = 0x01U,    /*!< A complete frame was decoded but the CRC does not match */
+    UART_FRAMING_EVENT_OVERFLOW       = 0x02U,    /*!< The frame does not fit in the receive frame buffer */
+    UART_FRAMING_EVENT_DECODE_ERROR   = 0x03U     /*!< Invalid byte stuffing sequence on the line */
+} uart_framing_event_t;
+
+/*!
+ * @brief Callback invoked by the frame decoder
+ *
+ * For UART_FRAMING_EVENT_FRAME_RECEIVED, frame points to the decoded payload
+ * (CRC stripped) and frameSize is its length. The buffer is reused for the next
+ * frame as soon as the callback returns. For error events frame is NULL.
+ *
+ * Implements : uart_framing_callback_t_Class
+ */
+typedef void (*uart_framing_callback_t)(const uint8_t * frame,
+                                        uint32_t frameSize,
+                                        uart_framing_event_t event,
+                                        void * userData);
+
+/*!
+ * @brief Defines the framing configuration structure
+ *
+ * Implements : uart_framing_user_config_t_Class
+ */
+typedef struct
+{
+    uart_framing_type_t framingType;     /*!< Byte stuffing algorithm */
+    uart_framing_crc_t crcType;          /*!< CRC appended to each frame */
+    uint8_t * rxFrameBuff;               /*!< Buffer storing the frame being decoded (payload + CRC) */
+    uint32_t rxFrameBuffSize;            /*!< Size of the receive frame buffer */
+    uart_framing_callback_t rxCallback;  /*!< Callback to invoke for decoded frames and errors */
+    void * rxCallbackParam;              /*!< Receive callback parameter */
+} uart_framing_user_config_t;
+
+/*!
+ * @brief Runtime state of a framing channel
+ *
+ * The fields are internal to the framing layer and must not be accessed by the application.
+ *
+ * Implements : uart_framing_state_t_Class
+ */
+typedef struct
+{
+    uart_framing_type_t framingType;     /*!< Byte stuffing algorithm */
+    uart_framing_crc_t crcType;          /*!< CRC appended to each frame */
+    uint8_t * rxFrameBuff;               /*!< Buffer storing the frame being decoded */
+    uint32_t rxFrameBuffSize;            /*!< Size of the receive frame buffer */
+    uint32_t rxCount;                    /*!< Number of decoded bytes in the current frame */
+    uart_framing_callback_t rxCallback;  /*!< Callback to invoke for decoded frames and errors */
+    void * rxCallbackParam;              /*!< Receive callback parameter */
+    uint8_t cobsCode;                    /*!< Code byte of the current COBS block, 0 at frame start */
+    uint8_t cobsRemaining;               /*!< Data bytes left in the current COBS block */
+    bool slipEscape;                     /*!< Previous SLIP byte was ESC */
+    bool discard;                        /*!< Drop bytes until the next delimiter */
+} uart_framing_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes a framing channel
+ *
+ * @param[out] state  Pointer to the framing state structure.
+ * @param[in]  config Pointer to the framing configuration structure.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if the receive frame buffer cannot hold the CRC.
+ */
+status_t UART_FRAMING_Init(uart_framing_state_t * state, const uart_framing_user_config_t * config);
+
+/*!
+ * @brief Drops the partially decoded frame and waits for the next delimiter
+ *
+ * @param[in] state Pointer to the framing state structure.
+ */
+void UART_FRAMING_ResetReceiver(uart_framing_state_t * state);
+
+/*!
+ * @brief Returns the worst case encoded size of a payload
+ *
+ * The returned size includes the CRC, the byte stuffing overhead and the delimiters,
+ * and can be used to dimension the transmit buffer.
+ *
+ * @param[in] state       Pointer to the framing state structure.
+ * @param[in] payloadSize Payload length in bytes.
+ *
+ * @return    Maximum number of bytes produced by UART_FRAMING_EncodeFrame().
+ */
+uint32_t UART_FRAMING_GetMaxEncodedSize(const uart_framing_state_t * state, uint32_t payloadSize);
+
+/*!
+ * @brief Encodes a payload into a transmit buffer
+ *
+ * The CRC is computed over the payload and the payload and CRC are stuffed directly
+ * into txBuff in a single pass, ready to be passed to UART_SendData().
+ * Empty payloads can only be sent with a CRC: an empty frame without CRC is
+ * dropped by the receiver like back-to-back delimiters.
+ *
+ * @param[in]  state       Pointer to the framing state structure.
+ * @param[in]  payload     Pointer to the payload.
+ * @param[in]  payloadSize Payload length in bytes.
+ * @param[out] txBuff      Pointer to the transmit buffer.
+ * @param[in]  txBuffSize  Size of the transmit buffer.
+ * @param[out] encodedSize Number of bytes written to txBuff.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_ERROR  : if txBuff is smaller than UART_FRAMING_GetMaxEncodedSize(),
+ *                            or if payloadSize is 0 and the channel has no CRC.
+ */
+status_t UART_FRAMING_EncodeFrame(const uart_framing_state_t * state,
+                                  const uint8_t * payload,
+                                  uint32_t payloadSize,
+                                  uint8_t * txBuff,
+                                  uint32_t txBuffSize,
+                                  uint32_t * encodedSize);
+
+/*!
+ * @brief Encodes a payload and starts a non-blocking UART transmission
+ *
+ * txBuff must remain valid until the transmission completes.
+ *
+ * @param[in]  instance    Pointer to the UART_PAL instance structure.
+ * @param[in]  state       Pointer to the framing state structure.
+ * @param[in]  payload     Pointer to the payload.
+ * @param[in]  payloadSize Payload length in bytes.
+ * @param[out] txBuff      Pointer to the transmit buffer.
+ * @param[in]  txBuffSize  Size of the transmit buffer.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if a transmission is already in progress;
+ *            STATUS_ERROR  : if the frame cannot be encoded or an error occurred.
+ */
+status_t UART_FRAMING_SendFrame(const uart_instance_t * const instance,
+                                const uart_framing_state_t * state,
+                                const uint8_t * payload,
+                                uint32_t payloadSize,
+                                uint8_t * txBuff,
+                                uint32_t txBuffSize);
+
+/*!
+ * @brief Feeds a slice of received bytes into the frame decoder
+ *
+ * Can be called from the UART rx callback with the buffer just completed, or with
+ * each half of a circular DMA receive buffer. Frames may span any number of slices;
+ * the receive callback is invoked once per decoded frame or error.
+ *
+ * @param[in] state Pointer to the framing state structure.
+ * @param[in] data  Pointer to the received bytes.
+ * @param[in] size  Number of received bytes.
+ */
+void UART_FRAMING_ReceiveSlice(uart_framing_state_t * state, const uint8_t * data, uint32_t size);
+
+/*!
+ * @brief Updates a CRC-16/CCITT-FALSE register
+ *
+ * Start with UART_FRAMING_CRC16_INIT; no final XOR is applied.
+ *
+ * @param[in] crc  Current CRC register value.
+ * @param[in] data Pointer to the data.
+ * @param[in] size Data length in bytes.
+ *
+ * @return    Updated CRC register value.
+ */
+uint16_t UART_FRAMING_Crc16(uint16_t crc, const uint8_t * data, uint32_t size);
+
+/*!
+ * @brief Updates a CRC-32 (IEEE 802.3) register
+ *
+ * Start with UART_FRAMING_CRC32_INIT; the final CRC is the bitwise complement
+ * of the returned register.
+ *
+ * @param[in] crc  Current CRC register value.
+ * @param[in] data Pointer to the data.
+ * @param[in] size Data length in bytes.
+ *
+ * @return    Updated CRC register value.
+ */
+uint32_t UART_FRAMING_Crc32(uint32_t crc, const uint8_t * data, uint32_t size);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* UART_FRAMING_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,1105 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file uart_framing.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 15.5, Return statement before end of function.
+ * Early return is used when the frame cannot be encoded.
+ */
+
+#include <stddef.h>
+#include "uart_framing.h"
+#include "devassert.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* COBS frame delimiter and maximum block code */
+#define UART_FRAMING_COBS_DELIMITER    0x00U
+#define UART_FRAMING_COBS_MAX_CODE     0xFFU
+
+/* SLIP special characters (RFC 1055) */
+#define UART_FRAMING_SLIP_END          0xC0U
+#define UART_FRAMING_SLIP_ESC          0xDBU
+#define UART_FRAMING_SLIP_ESC_END      0xDCU
+#define UART_FRAMING_SLIP_ESC_ESC      0xDDU
+
+/*!
+ * @brief Single pass COBS encoder context
+ */
+typedef struct
+{
+    uint8_t * buff;        /*!< Destination buffer */
+    uint32_t codeIdx;      /*!< Index of the code byte of the current block */
+    uint32_t outIdx;       /*!< Index of the next free byte */
+    uint8_t code;          /*!< Code value of the current block */
+} uart_framing_cobs_enc_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Slicing-by-4 tables: table[k][i] is the CRC of byte i followed by k zero bytes. */
+static const uint16_t s_uartFramingCrc16Table[4U][256U] =
+{
+    {
+        0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+        0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+        0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+        0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+        0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+        0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+        0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+        0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+        0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+        0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+        0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+        0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+        0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+        0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+        0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+        0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+        0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+        0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+        0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+        0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+        0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+        0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+        0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+        0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+        0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+        0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+        0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+        0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+        0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+        0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+        0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+        0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+    },
+    {
+        0x0000U, 0x3331U, 0x6662U, 0x5553U, 0xCCC4U, 0xFFF5U, 0xAAA6U, 0x9997U,
+        0x89A9U, 0xBA98U, 0xEFCBU, 0xDCFAU, 0x456DU, 0x765CU, 0x230FU, 0x103EU,
+        0x0373U, 0x3042U, 0x6511U, 0x5620U, 0xCFB7U, 0xFC86U, 0xA9D5U, 0x9AE4U,
+        0x8ADAU, 0xB9EBU, 0xECB8U, 0xDF89U, 0x461EU, 0x752FU, 0x207CU, 0x134DU,
+        0x06E6U, 0x35D7U, 0x6084U, 0x53B5U, 0xCA22U, 0xF913U, 0xAC40U, 0x9F71U,
+        0x8F4FU, 0xBC7EU, 0xE92DU, 0xDA1CU, 0x438BU, 0x70BAU, 0x25E9U, 0x16D8U,
+        0x0595U, 0x36A4U, 0x63F7U, 0x50C6U, 0xC951U, 0xFA60U, 0xAF33U, 0x9C02U,
+        0x8C3CU, 0xBF0DU, 0xEA5EU, 0xD96FU, 0x40F8U, 0x73C9U, 0x269AU, 0x15ABU,
+        0x0DCCU, 0x3EFDU, 0x6BAEU, 0x589FU, 0xC108U, 0xF239U, 0xA76AU, 0x945BU,
+        0x8465U, 0xB754U, 0xE207U, 0xD136U, 0x48A1U, 0x7B90U, 0x2EC3U, 0x1DF2U,
+        0x0EBFU, 0x3D8EU, 0x68DDU, 0x5BECU, 0xC27BU, 0xF14AU, 0xA419U, 0x9728U,
+        0x8716U, 0xB427U, 0xE174U, 0xD245U, 0x4BD2U, 0x78E3U, 0x2DB0U, 0x1E81U,
+        0x0B2AU, 0x381BU, 0x6D48U, 0x5E79U, 0xC7EEU, 0xF4DFU, 0xA18CU, 0x92BDU,
+        0x8283U, 0xB1B2U, 0xE4E1U, 0xD7D0U, 0x4E47U, 0x7D76U, 0x2825U, 0x1B14U,
+        0x0859U, 0x3B68U, 0x6E3BU, 0x5D0AU, 0xC49DU, 0xF7ACU, 0xA2FFU, 0x91CEU,
+        0x81F0U, 0xB2C1U, 0xE792U, 0xD4A3U, 0x4D34U, 0x7E05U, 0x2B56U, 0x1867U,
+        0x1B98U, 0x28A9U, 0x7DFAU, 0x4ECBU, 0xD75CU, 0xE46DU, 0xB13EU, 0x820FU,
+        0x9231U, 0xA100U, 0xF453U, 0xC762U, 0x5EF5U, 0x6DC4U, 0x3897U, 0x0BA6U,
+        0x18EBU, 0x2BDAU, 0x7E89U, 0x4DB8U, 0xD42FU, 0xE71EU, 0xB24DU, 0x817CU,
+        0x9142U, 0xA273U, 0xF720U, 0xC411U, 0x5D86U, 0x6EB7U, 0x3BE4U, 0x08D5U,
+        0x1D7EU, 0x2E4FU, 0x7B1CU, 0x482DU, 0xD1BAU, 0xE28BU, 0xB7D8U, 0x84E9U,
+        0x94D7U, 0xA7E6U, 0xF2B5U, 0xC184U, 0x5813U, 0x6B22U, 0x3E71U, 0x0D40U,
+        0x1E0DU, 0x2D3CU, 0x786FU, 0x4B5EU, 0xD2C9U, 0xE1F8U, 0xB4ABU, 0x879AU,
+        0x97A4U, 0xA495U, 0xF1C6U, 0xC2F7U, 0x5B60U, 0x6851U, 0x3D02U, 0x0E33U,
+        0x1654U, 0x2565U, 0x7036U, 0x4307U, 0xDA90U, 0xE9A1U, 0xBCF2U, 0x8FC3U,
+        0x9FFDU, 0xACCCU, 0xF99FU, 0xCAAEU, 0x5339U, 0x6008U, 0x355BU, 0x066AU,
+        0x1527U, 0x2616U, 0x7345U, 0x4074U, 0xD9E3U, 0xEAD2U, 0xBF81U, 0x8CB0U,
+        0x9C8EU, 0xAFBFU, 0xFAECU, 0xC9DDU, 0x504AU, 0x637BU, 0x3628U, 0x0519U,
+        0x10B2U, 0x2383U, 0x76D0U, 0x45E1U, 0xDC76U, 0xEF47U, 0xBA14U, 0x8925U,
+        0x991BU, 0xAA2AU, 0xFF79U, 0xCC48U, 0x55DFU, 0x66EEU, 0x33BDU, 0x008CU,
+        0x13C1U, 0x20F0U, 0x75A3U, 0x4692U, 0xDF05U, 0xEC34U, 0xB967U, 0x8A56U,
+        0x9A68U, 0xA959U, 0xFC0AU, 0xCF3BU, 0x56ACU, 0x659DU, 0x30CEU, 0x03FFU
+    },
+    {
+        0x0000U, 0x3730U, 0x6E60U, 0x5950U, 0xDCC0U, 0xEBF0U, 0xB2A0U, 0x8590U,
+        0xA9A1U, 0x9E91U, 0xC7C1U, 0xF0F1U, 0x7561U, 0x4251U, 0x1B01U, 0x2C31U,
+        0x4363U, 0x7453U, 0x2D03U, 0x1A33U, 0x9FA3U, 0xA893U, 0xF1C3U, 0xC6F3U,
+        0xEAC2U, 0xDDF2U, 0x84A2U, 0xB392U, 0x3602U, 0x0132U, 0x5862U, 0x6F52U,
+        0x86C6U, 0xB1F6U, 0xE8A6U, 0xDF96U, 0x5A06U, 0x6D36U, 0x3466U, 0x0356U,
+        0x2F67U, 0x1857U, 0x4107U, 0x7637U, 0xF3A7U, 0xC497U, 0x9DC7U, 0xAAF7U,
+        0xC5A5U, 0xF295U, 0xABC5U, 0x9CF5U, 0x1965U, 0x2E55U, 0x7705U, 0x4035U,
+        0x6C04U, 0x5B34U, 0x0264U, 0x3554U, 0xB0C4U, 0x87F4U, 0xDEA4U, 0xE994U,
+        0x1DADU, 0x2A9DU, 0x73CDU, 0x44FDU, 0xC16DU, 0xF65DU, 0xAF0DU, 0x983DU,
+        0xB40CU, 0x833CU, 0xDA6CU, 0xED5CU, 0x68CCU, 0x5FFCU, 0x06ACU, 0x319CU,
+        0x5ECEU, 0x69FEU, 0x30AEU, 0x079EU, 0x820EU, 0xB53EU, 0xEC6EU, 0xDB5EU,
+        0xF76FU, 0xC05FU, 0x990FU, 0xAE3FU, 0x2BAFU, 0x1C9FU, 0x45CFU, 0x72FFU,
+        0x9B6BU, 0xAC5BU, 0xF50BU, 0xC23BU, 0x47ABU, 0x709BU, 0x29CBU, 0x1EFBU,
+        0x32CAU, 0x05FAU, 0x5CAAU, 0x6B9AU, 0xEE0AU, 0xD93AU, 0x806AU, 0xB75AU,
+        0xD808U, 0xEF38U, 0xB668U, 0x8158U, 0x04C8U, 0x33F8U, 0x6AA8U, 0x5D98U,
+        0x71A9U, 0x4699U, 0x1FC9U, 0x28F9U, 0xAD69U, 0x9A59U, 0xC309U, 0xF439U,
+        0x3B5AU, 0x0C6AU, 0x553AU, 0x620AU, 0xE79AU, 0xD0AAU, 0x89FAU, 0xBECAU,
+        0x92FBU, 0xA5CBU, 0xFC9BU, 0xCBABU, 0x4E3BU, 0x790BU, 0x205BU, 0x176BU,
+        0x7839U, 0x4F09U, 0x1659U, 0x2169U, 0xA4F9U, 0x93C9U, 0xCA99U, 0xFDA9U,
+        0xD198U, 0xE6A8U, 0xBFF8U, 0x88C8U, 0x0D58U, 0x3A68U, 0x6338U, 0x5408U,
+        0xBD9CU, 0x8AACU, 0xD3FCU, 0xE4CCU, 0x615CU, 0x566CU, 0x0F3CU, 0x380CU,
+        0x143DU, 0x230DU, 0x7A5DU, 0x4D6DU, 0xC8FDU, 0xFFCDU, 0xA69DU, 0x91ADU,
+        0xFEFFU, 0xC9CFU, 0x909FU, 0xA7AFU, 0x223FU, 0x150FU, 0x4C5FU, 0x7B6FU,
+        0x575EU, 0x606EU, 0x393EU, 0x0E0EU, 0x8B9EU, 0xBCAEU, 0xE5FEU, 0xD2CEU,
+        0x26F7U, 0x11C7U, 0x4897U, 0x7FA7U, 0xFA37U, 0xCD07U, 0x9457U, 0xA367U,
+        0x8F56U, 0xB866U, 0xE136U, 0xD606U, 0x5396U, 0x64A6U, 0x3DF6U, 0x0AC6U,
+        0x6594U, 0x52A4U, 0x0BF4U, 0x3CC4U, 0xB954U, 0x8E64U, 0xD734U, 0xE004U,
+        0xCC35U, 0xFB05U, 0xA255U, 0x9565U, 0x10F5U, 0x27C5U, 0x7E95U, 0x49A5U,
+        0xA031U, 0x9701U, 0xCE51U, 0xF961U, 0x7CF1U, 0x4BC1U, 0x1291U, 0x25A1U,
+        0x0990U, 0x3EA0U, 0x67F0U, 0x50C0U, 0xD550U, 0xE260U, 0xBB30U, 0x8C00U,
+        0xE352U, 0xD462U, 0x8D32U, 0xBA02U, 0x3F92U, 0x08A2U, 0x51F2U, 0x66C2U,
+        0x4AF3U, 0x7DC3U, 0x2493U, 0x13A3U, 0x9633U, 0xA103U, 0xF853U, 0xCF63U
+    },
+    {
+        0x0000U, 0x76B4U, 0xED68U, 0x9BDCU, 0xCAF1U, 0xBC45U, 0x2799U, 0x512DU,
+        0x85C3U, 0xF377U, 0x68ABU, 0x1E1FU, 0x4F32U, 0x3986U, 0xA25AU, 0xD4EEU,
+        0x1BA7U, 0x6D13U, 0xF6CFU, 0x807BU, 0xD156U, 0xA7E2U, 0x3C3EU, 0x4A8AU,
+        0x9E64U, 0xE8D0U, 0x730CU, 0x05B8U, 0x5495U, 0x2221U, 0xB9FDU, 0xCF49U,
+        0x374EU, 0x41FAU, 0xDA26U, 0xAC92U, 0xFDBFU, 0x8B0BU, 0x10D7U, 0x6663U,
+        0xB28DU, 0xC439U, 0x5FE5U, 0x2951U, 0x787CU, 0x0EC8U, 0x9514U, 0xE3A0U,
+        0x2CE9U, 0x5A5DU, 0xC181U, 0xB735U, 0xE618U, 0x90ACU, 0x0B70U, 0x7DC4U,
+        0xA92AU, 0xDF9EU, 0x4442U, 0x32F6U, 0x63DBU, 0x156FU, 0x8EB3U, 0xF807U,
+        0x6E9CU, 0x1828U, 0x83F4U, 0xF540U, 0xA46DU, 0xD2D9U, 0x4905U, 0x3FB1U,
+        0xEB5FU, 0x9DEBU, 0x0637U, 0x7083U, 0x21AEU, 0x571AU, 0xCCC6U, 0xBA72U,
+        0x753BU, 0x038FU, 0x9853U, 0xEEE7U, 0xBFCAU, 0xC97EU, 0x52A2U, 0x2416U,
+        0xF0F8U, 0x864CU, 0x1D90U, 0x6B24U, 0x3A09U, 0x4CBDU, 0xD761U, 0xA1D5U,
+        0x59D2U, 0x2F66U, 0xB4BAU, 0xC20EU, 0x9323U, 0xE597U, 0x7E4BU, 0x08FFU,
+        0xDC11U, 0xAAA5U, 0x3179U, 0x47CDU, 0x16E0U, 0x6054U, 0xFB88U, 0x8D3CU,
+        0x4275U, 0x34C1U, 0xAF1DU, 0xD9A9U, 0x8884U, 0xFE30U, 0x65ECU, 0x1358U,
+        0xC7B6U, 0xB102U, 0x2ADEU, 0x5C6AU, 0x0D47U, 0x7BF3U, 0xE02FU, 0x969BU,
+        0xDD38U, 0xAB8CU, 0x3050U, 0x46E4U, 0x17C9U, 0x617DU, 0xFAA1U, 0x8C15U,
+        0x58FBU, 0x2E4FU, 0xB593U, 0xC327U, 0x920AU, 0xE4BEU, 0x7F62U, 0x09D6U,
+        0xC69FU, 0xB02BU, 0x2BF7U, 0x5D43U, 0x0C6EU, 0x7ADAU, 0xE106U, 0x97B2U,
+        0x435CU, 0x35E8U, 0xAE34U, 0xD880U, 0x89ADU, 0xFF19U, 0x64C5U, 0x1271U,
+        0xEA76U, 0x9CC2U, 0x071EU, 0x71AAU, 0x2087U, 0x5633U, 0xCDEFU, 0xBB5BU,
+        0x6FB5U, 0x1901U, 0x82DDU, 0xF469U, 0xA544U, 0xD3F0U, 0x482CU, 0x3E98U,
+        0xF1D1U, 0x8765U, 0x1CB9U, 0x6A0DU, 0x3B20U, 0x4D94U, 0xD648U, 0xA0FCU,
+        0x7412U, 0x02A6U, 0x997AU, 0xEFCEU, 0xBEE3U, 0xC857U, 0x538BU, 0x253FU,
+        0xB3A4U, 0xC510U, 0x5ECCU, 0x2878U, 0x7955U, 0x0FE1U, 0x943DU, 0xE289U,
+        0x3667U, 0x40D3U, 0xDB0FU, 0xADBBU, 0xFC96U, 0x8A22U, 0x11FEU, 0x674AU,
+        0xA803U, 0xDEB7U, 0x456BU, 0x33DFU, 0x62F2U, 0x1446U, 0x8F9AU, 0xF92EU,
+        0x2DC0U, 0x5B74U, 0xC0A8U, 0xB61CU, 0xE731U, 0x9185U, 0x0A59U, 0x7CEDU,
+        0x84EAU, 0xF25EU, 0x6982U, 0x1F36U, 0x4E1BU, 0x38AFU, 0xA373U, 0xD5C7U,
+        0x0129U, 0x779DU, 0xEC41U, 0x9AF5U, 0xCBD8U, 0xBD6CU, 0x26B0U, 0x5004U,
+        0x9F4DU, 0xE9F9U, 0x7225U, 0x0491U, 0x55BCU, 0x2308U, 0xB8D4U, 0xCE60U,
+        0x1A8EU, 0x6C3AU, 0xF7E6U, 0x8152U, 0xD07FU, 0xA6CBU, 0x3D17U, 0x4BA3U
+    }
+};
+
+static const uint32_t s_uartFramingCrc32Table[4U][256U] =
+{
+    {
+        0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU,
+        0xE963A535U, 0x9E6495A3U, 0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U,
+        0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U, 0x1DB71064U, 0x6AB020F2U,
+        0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+        0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U,
+        0xFA0F3D63U, 0x8D080DF5U, 0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U,
+        0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU, 0x35B5A8FAU, 0x42B2986CU,
+        0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+        0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U,
+        0xCFBA9599U, 0xB8BDA50FU, 0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U,
+        0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU, 0x76DC4190U, 0x01DB7106U,
+        0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+        0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU,
+        0x91646C97U, 0xE6635C01U, 0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU,
+        0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U, 0x65B0D9C6U, 0x12B7E950U,
+        0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+        0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U,
+        0xA4D1C46DU, 0xD3D6F4FBU, 0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U,
+        0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U, 0x5005713CU, 0x270241AAU,
+        0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+        0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U,
+        0xB7BD5C3BU, 0xC0BA6CADU, 0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU,
+        0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U, 0xE3630B12U, 0x94643B84U,
+        0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+        0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU,
+        0x196C3671U, 0x6E6B06E7U, 0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU,
+        0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U, 0xD6D6A3E8U, 0xA1D1937EU,
+        0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+        0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U,
+        0x316E8EEFU, 0x4669BE79U, 0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U,
+        0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU, 0xC5BA3BBEU, 0xB2BD0B28U,
+        0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+        0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU,
+        0x72076785U, 0x05005713U, 0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U,
+        0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U, 0x86D3D2D4U, 0xF1D4E242U,
+        0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+        0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U,
+        0x616BFFD3U, 0x166CCF45U, 0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U,
+        0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU, 0xAED16A4AU, 0xD9D65ADCU,
+        0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+        0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U,
+        0x54DE5729U, 0x23D967BFU, 0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U,
+        0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU
+    },
+    {
+        0x00000000U, 0x191B3141U, 0x32366282U, 0x2B2D53C3U, 0x646CC504U, 0x7D77F445U,
+        0x565AA786U, 0x4F4196C7U, 0xC8D98A08U, 0xD1C2BB49U, 0xFAEFE88AU, 0xE3F4D9CBU,
+        0xACB54F0CU, 0xB5AE7E4DU, 0x9E832D8EU, 0x87981CCFU, 0x4AC21251U, 0x53D92310U,
+        0x78F470D3U, 0x61EF4192U, 0x2EAED755U, 0x37B5E614U, 0x1C98B5D7U, 0x05838496U,
+        0x821B9859U, 0x9B00A918U, 0xB02DFADBU, 0xA936CB9AU, 0xE6775D5DU, 0xFF6C6C1CU,
+        0xD4413FDFU, 0xCD5A0E9EU, 0x958424A2U, 0x8C9F15E3U, 0xA7B24620U, 0xBEA97761U,
+        0xF1E8E1A6U, 0xE8F3D0E7U, 0xC3DE8324U, 0xDAC5B265U, 0x5D5DAEAAU, 0x44469FEBU,
+        0x6F6BCC28U, 0x7670FD69U, 0x39316BAEU, 0x202A5AEFU, 0x0B07092CU, 0x121C386DU,
+        0xDF4636F3U, 0xC65D07B2U, 0xED705471U, 0xF46B6530U, 0xBB2AF3F7U, 0xA231C2B6U,
+        0x891C9175U, 0x9007A034U, 0x179FBCFBU, 0x0E848DBAU, 0x25A9DE79U, 0x3CB2EF38U,
+        0x73F379FFU, 0x6AE848BEU, 0x41C51B7DU, 0x58DE2A3CU, 0xF0794F05U, 0xE9627E44U,
+        0xC24F2D87U, 0xDB541CC6U, 0x94158A01U, 0x8D0EBB40U, 0xA623E883U, 0xBF38D9C2U,
+        0x38A0C50DU, 0x21BBF44CU, 0x0A96A78FU, 0x138D96CEU, 0x5CCC0009U, 0x45D73148U,
+        0x6EFA628BU, 0x77E153CAU, 0xBABB5D54U, 0xA3A06C15U, 0x888D3FD6U, 0x91960E97U,
+        0xDED79850U, 0xC7CCA911U, 0xECE1FAD2U, 0xF5FACB93U, 0x7262D75CU, 0x6B79E61DU,
+        0x4054B5DEU, 0x594F849FU, 0x160E1258U, 0x0F152319U, 0x243870DAU, 0x3D23419BU,
+        0x65FD6BA7U, 0x7CE65AE6U, 0x57CB0925U, 0x4ED03864U, 0x0191AEA3U, 0x188A9FE2U,
+        0x33A7CC21U, 0x2ABCFD60U, 0xAD24E1AFU, 0xB43FD0EEU, 0x9F12832DU, 0x8609B26CU,
+        0xC94824ABU, 0xD05315EAU, 0xFB7E4629U, 0xE2657768U, 0x2F3F79F6U, 0x362448B7U,
+        0x1D091B74U, 0x04122A35U, 0x4B53BCF2U, 0x52488DB3U, 0x7965DE70U, 0x607EEF31U,
+        0xE7E6F3FEU, 0xFEFDC2BFU, 0xD5D0917CU, 0xCCCBA03DU, 0x838A36FAU, 0x9A9107BBU,
+        0xB1BC5478U, 0xA8A76539U, 0x3B83984BU, 0x2298A90AU, 0x09B5FAC9U, 0x10AECB88U,
+        0x5FEF5D4FU, 0x46F46C0EU, 0x6DD93FCDU, 0x74C20E8CU, 0xF35A1243U, 0xEA412302U,
+        0xC16C70C1U, 0xD8774180U, 0x9736D747U, 0x8E2DE606U, 0xA500B5C5U, 0xBC1B8484U,
+        0x71418A1AU, 0x685ABB5BU, 0x4377E898U, 0x5A6CD9D9U, 0x152D4F1EU, 0x0C367E5FU,
+        0x271B2D9CU, 0x3E001CDDU, 0xB9980012U, 0xA0833153U, 0x8BAE6290U, 0x92B553D1U,
+        0xDDF4C516U, 0xC4EFF457U, 0xEFC2A794U, 0xF6D996D5U, 0xAE07BCE9U, 0xB71C8DA8U,
+        0x9C31DE6BU, 0x852AEF2AU, 0xCA6B79EDU, 0xD37048ACU, 0xF85D1B6FU, 0xE1462A2EU,
+        0x66DE36E1U, 0x7FC507A0U, 0x54E85463U, 0x4DF36522U, 0x02B2F3E5U, 0x1BA9C2A4U,
+        0x30849167U, 0x299FA026U, 0xE4C5AEB8U, 0xFDDE9FF9U, 0xD6F3CC3AU, 0xCFE8FD7BU,
+        0x80A96BBCU, 0x99B25AFDU, 0xB29F093EU, 0xAB84387FU, 0x2C1C24B0U, 0x350715F1U,
+        0x1E2A4632U, 0x07317773U, 0x4870E1B4U, 0x516BD0F5U, 0x7A468336U, 0x635DB277U,
+        0xCBFAD74EU, 0xD2E1E60FU, 0xF9CCB5CCU, 0xE0D7848DU, 0xAF96124AU, 0xB68D230BU,
+        0x9DA070C8U, 0x84BB4189U, 0x03235D46U, 0x1A386C07U, 0x31153FC4U, 0x280E0E85U,
+        0x674F9842U, 0x7E54A903U, 0x5579FAC0U, 0x4C62CB81U, 0x8138C51FU, 0x9823F45EU,
+        0xB30EA79DU, 0xAA1596DCU, 0xE554001BU, 0xFC4F315AU, 0xD7626299U, 0xCE7953D8U,
+        0x49E14F17U, 0x50FA7E56U, 0x7BD72D95U, 0x62CC1CD4U, 0x2D8D8A13U, 0x3496BB52U,
+        0x1FBBE891U, 0x06A0D9D0U, 0x5E7EF3ECU, 0x4765C2ADU, 0x6C48916EU, 0x7553A02FU,
+        0x3A1236E8U, 0x230907A9U, 0x0824546AU, 0x113F652BU, 0x96A779E4U, 0x8FBC48A5U,
+        0xA4911B66U, 0xBD8A2A27U, 0xF2CBBCE0U, 0xEBD08DA1U, 0xC0FDDE62U, 0xD9E6EF23U,
+        0x14BCE1BDU, 0x0DA7D0FCU, 0x268A833FU, 0x3F91B27EU, 0x70D024B9U, 0x69CB15F8U,
+        0x42E6463BU, 0x5BFD777AU, 0xDC656BB5U, 0xC57E5AF4U, 0xEE530937U, 0xF7483876U,
+        0xB809AEB1U, 0xA1129FF0U, 0x8A3FCC33U, 0x9324FD72U
+    },
+    {
+        0x00000000U, 0x01C26A37U, 0x0384D46EU, 0x0246BE59U, 0x0709A8DCU, 0x06CBC2EBU,
+        0x048D7CB2U, 0x054F1685U, 0x0E1351B8U, 0x0FD13B8FU, 0x0D9785D6U, 0x0C55EFE1U,
+        0x091AF964U, 0x08D89353U, 0x0A9E2D0AU, 0x0B5C473DU, 0x1C26A370U, 0x1DE4C947U,
+        0x1FA2771EU, 0x1E601D29U, 0x1B2F0BACU, 0x1AED619BU, 0x18ABDFC2U, 0x1969B5F5U,
+        0x1235F2C8U, 0x13F798FFU, 0x11B126A6U, 0x10734C91U, 0x153C5A14U, 0x14FE3023U,
+        0x16B88E7AU, 0x177AE44DU, 0x384D46E0U, 0x398F2CD7U, 0x3BC9928EU, 0x3A0BF8B9U,
+        0x3F44EE3CU, 0x3E86840BU, 0x3CC03A52U, 0x3D025065U, 0x365E1758U, 0x379C7D6FU,
+        0x35DAC336U, 0x3418A901U, 0x3157BF84U, 0x3095D5B3U, 0x32D36BEAU, 0x331101DDU,
+        0x246BE590U, 0x25A98FA7U, 0x27EF31FEU, 0x262D5BC9U, 0x23624D4CU, 0x22A0277BU,
+        0x20E69922U, 0x2124F315U, 0x2A78B428U, 0x2BBADE1FU, 0x29FC6046U, 0x283E0A71U,
+        0x2D711CF4U, 0x2CB376C3U, 0x2EF5C89AU, 0x2F37A2ADU, 0x709A8DC0U, 0x7158E7F7U,
+        0x731E59AEU, 0x72DC3399U, 0x7793251CU, 0x76514F2BU, 0x7417F172U, 0x75D59B45U,
+        0x7E89DC78U, 0x7F4BB64FU, 0x7D0D0816U, 0x7CCF6221U, 0x798074A4U, 0x78421E93U,
+        0x7A04A0CAU, 0x7BC6CAFDU, 0x6CBC2EB0U, 0x6D7E4487U, 0x6F38FADEU, 0x6EFA90E9U,
+        0x6BB5866CU, 0x6A77EC5BU, 0x68315202U, 0x69F33835U, 0x62AF7F08U, 0x636D153FU,
+        0x612BAB66U, 0x60E9C151U, 0x65A6D7D4U, 0x6464BDE3U, 0x662203BAU, 0x67E0698DU,
+        0x48D7CB20U, 0x4915A117U, 0x4B531F4EU, 0x4A917579U, 0x4FDE63FCU, 0x4E1C09CBU,
+        0x4C5AB792U, 0x4D98DDA5U, 0x46C49A98U, 0x4706F0AFU, 0x45404EF6U, 0x448224C1U,
+        0x41CD3244U, 0x400F5873U, 0x4249E62AU, 0x438B8C1DU, 0x54F16850U, 0x55330267U,
+        0x5775BC3EU, 0x56B7D609U, 0x53F8C08CU, 0x523AAABBU, 0x507C14E2U, 0x51BE7ED5U,
+        0x5AE239E8U, 0x5B2053DFU, 0x5966ED86U, 0x58A487B1U, 0x5DEB9134U, 0x5C29FB03U,
+        0x5E6F455AU, 0x5FAD2F6DU, 0xE1351B80U, 0xE0F771B7U, 0xE2B1CFEEU, 0xE373A5D9U,
+        0xE63CB35CU, 0xE7FED96BU, 0xE5B86732U, 0xE47A0D05U, 0xEF264A38U, 0xEEE4200FU,
+        0xECA29E56U, 0xED60F461U, 0xE82FE2E4U, 0xE9ED88D3U, 0xEBAB368AU, 0xEA695CBDU,
+        0xFD13B8F0U, 0xFCD1D2C7U, 0xFE976C9EU, 0xFF5506A9U, 0xFA1A102CU, 0xFBD87A1BU,
+        0xF99EC442U, 0xF85CAE75U, 0xF300E948U, 0xF2C2837FU, 0xF0843D26U, 0xF1465711U,
+        0xF4094194U, 0xF5CB2BA3U, 0xF78D95FAU, 0xF64FFFCDU, 0xD9785D60U, 0xD8BA3757U,
+        0xDAFC890EU, 0xDB3EE339U, 0xDE71F5BCU, 0xDFB39F8BU, 0xDDF521D2U, 0xDC374BE5U,
+        0xD76B0CD8U, 0xD6A966EFU, 0xD4EFD8B6U, 0xD52DB281U, 0xD062A404U, 0xD1A0CE33U,
+        0xD3E6706AU, 0xD2241A5DU, 0xC55EFE10U, 0xC49C9427U, 0xC6DA2A7EU, 0xC7184049U,
+        0xC25756CCU, 0xC3953CFBU, 0xC1D382A2U, 0xC011E895U, 0xCB4DAFA8U, 0xCA8FC59FU,
+        0xC8C97BC6U, 0xC90B11F1U, 0xCC440774U, 0xCD866D43U, 0xCFC0D31AU, 0xCE02B92DU,
+        0x91AF9640U, 0x906DFC77U, 0x922B422EU, 0x93E92819U, 0x96A63E9CU, 0x976454ABU,
+        0x9522EAF2U, 0x94E080C5U, 0x9FBCC7F8U, 0x9E7EADCFU, 0x9C381396U, 0x9DFA79A1U,
+        0x98B56F24U, 0x99770513U, 0x9B31BB4AU, 0x9AF3D17DU, 0x8D893530U, 0x8C4B5F07U,
+        0x8E0DE15EU, 0x8FCF8B69U, 0x8A809DECU, 0x8B42F7DBU, 0x89044982U, 0x88C623B5U,
+        0x839A6488U, 0x82580EBFU, 0x801EB0E6U, 0x81DCDAD1U, 0x8493CC54U, 0x8551A663U,
+        0x8717183AU, 0x86D5720DU, 0xA9E2D0A0U, 0xA820BA97U, 0xAA6604CEU, 0xABA46EF9U,
+        0xAEEB787CU, 0xAF29124BU, 0xAD6FAC12U, 0xACADC625U, 0xA7F18118U, 0xA633EB2FU,
+        0xA4755576U, 0xA5B73F41U, 0xA0F829C4U, 0xA13A43F3U, 0xA37CFDAAU, 0xA2BE979DU,
+        0xB5C473D0U, 0xB40619E7U, 0xB640A7BEU, 0xB782CD89U, 0xB2CDDB0CU, 0xB30FB13BU,
+        0xB1490F62U, 0xB08B6555U, 0xBBD72268U, 0xBA15485FU, 0xB853F606U, 0xB9919C31U,
+        0xBCDE8AB4U, 0xBD1CE083U, 0xBF5A5EDAU, 0xBE9834EDU
+    },
+    {
+        0x00000000U, 0xB8BC6765U, 0xAA09C88BU, 0x12B5AFEEU, 0x8F629757U, 0x37DEF032U,
+        0x256B5FDCU, 0x9DD738B9U, 0xC5B428EFU, 0x7D084F8AU, 0x6FBDE064U, 0xD7018701U,
+        0x4AD6BFB8U, 0xF26AD8DDU, 0xE0DF7733U, 0x58631056U, 0x5019579FU, 0xE8A530FAU,
+        0xFA109F14U, 0x42ACF871U, 0xDF7BC0C8U, 0x67C7A7ADU, 0x75720843U, 0xCDCE6F26U,
+        0x95AD7F70U, 0x2D111815U, 0x3FA4B7FBU, 0x8718D09EU, 0x1ACFE827U, 0xA2738F42U,
+        0xB0C620ACU, 0x087A47C9U, 0xA032AF3EU, 0x188EC85BU, 0x0A3B67B5U, 0xB28700D0U,
+        0x2F503869U, 0x97EC5F0CU, 0x8559F0E2U, 0x3DE59787U, 0x658687D1U, 0xDD3AE0B4U,
+        0xCF8F4F5AU, 0x7733283FU, 0xEAE41086U, 0x525877E3U, 0x40EDD80DU, 0xF851BF68U,
+        0xF02BF8A1U, 0x48979FC4U, 0x5A22302AU, 0xE29E574FU, 0x7F496FF6U, 0xC7F50893U,
+        0xD540A77DU, 0x6DFCC018U, 0x359FD04EU, 0x8D23B72BU, 0x9F9618C5U, 0x272A7FA0U,
+        0xBAFD4719U, 0x0241207CU, 0x10F48F92U, 0xA848E8F7U, 0x9B14583DU, 0x23A83F58U,
+        0x311D90B6U, 0x89A1F7D3U, 0x1476CF6AU, 0xACCAA80FU, 0xBE7F07E1U, 0x06C36084U,
+        0x5EA070D2U, 0xE61C17B7U, 0xF4A9B859U, 0x4C15DF3CU, 0xD1C2E785U, 0x697E80E0U,
+        0x7BCB2F0EU, 0xC377486BU, 0xCB0D0FA2U, 0x73B168C7U, 0x6104C729U, 0xD9B8A04CU,
+        0x446F98F5U, 0xFCD3FF90U, 0xEE66507EU, 0x56DA371BU, 0x0EB9274DU, 0xB6054028U,
+        0xA4B0EFC6U, 0x1C0C88A3U, 0x81DBB01AU, 0x3967D77FU, 0x2BD27891U, 0x936E1FF4U,
+        0x3B26F703U, 0x839A9066U, 0x912F3F88U, 0x299358EDU, 0xB4446054U, 0x0CF80731U,
+        0x1E4DA8DFU, 0xA6F1CFBAU, 0xFE92DFECU, 0x462EB889U, 0x549B1767U, 0xEC277002U,
+        0x71F048BBU, 0xC94C2FDEU, 0xDBF98030U, 0x6345E755U, 0x6B3FA09CU, 0xD383C7F9U,
+        0xC1366817U, 0x798A0F72U, 0xE45D37CBU, 0x5CE150AEU, 0x4E54FF40U, 0xF6E89825U,
+        0xAE8B8873U, 0x1637EF16U, 0x048240F8U, 0xBC3E279DU, 0x21E91F24U, 0x99557841U,
+        0x8BE0D7AFU, 0x335CB0CAU, 0xED59B63BU, 0x55E5D15EU, 0x47507EB0U, 0xFFEC19D5U,
+        0x623B216CU, 0xDA874609U, 0xC832E9E7U, 0x708E8E82U, 0x28ED9ED4U, 0x9051F9B1U,
+        0x82E4565FU, 0x3A58313AU, 0xA78F0983U, 0x1F336EE6U, 0x0D86C108U, 0xB53AA66DU,
+        0xBD40E1A4U, 0x05FC86C1U, 0x1749292FU, 0xAFF54E4AU, 0x322276F3U, 0x8A9E1196U,
+        0x982BBE78U, 0x2097D91DU, 0x78F4C94BU, 0xC048AE2EU, 0xD2FD01C0U, 0x6A4166A5U,
+        0xF7965E1CU, 0x4F2A3979U, 0x5D9F9697U, 0xE523F1F2U, 0x4D6B1905U, 0xF5D77E60U,
+        0xE762D18EU, 0x5FDEB6EBU, 0xC2098E52U, 0x7AB5E937U, 0x680046D9U, 0xD0BC21BCU,
+        0x88DF31EAU, 0x3063568FU, 0x22D6F961U, 0x9A6A9E04U, 0x07BDA6BDU, 0xBF01C1D8U,
+        0xADB46E36U, 0x15080953U, 0x1D724E9AU, 0xA5CE29FFU, 0xB77B8611U, 0x0FC7E174U,
+        0x9210D9CDU, 0x2AACBEA8U, 0x38191146U, 0x80A57623U, 0xD8C66675U, 0x607A0110U,
+        0x72CFAEFEU, 0xCA73C99BU, 0x57A4F122U, 0xEF189647U, 0xFDAD39A9U, 0x45115ECCU,
+        0x764DEE06U, 0xCEF18963U, 0xDC44268DU, 0x64F841E8U, 0xF92F7951U, 0x41931E34U,
+        0x5326B1DAU, 0xEB9AD6BFU, 0xB3F9C6E9U, 0x0B45A18CU, 0x19F00E62U, 0xA14C6907U,
+        0x3C9B51BEU, 0x842736DBU, 0x96929935U, 0x2E2EFE50U, 0x2654B999U, 0x9EE8DEFCU,
+        0x8C5D7112U, 0x34E11677U, 0xA9362ECEU, 0x118A49ABU, 0x033FE645U, 0xBB838120U,
+        0xE3E09176U, 0x5B5CF613U, 0x49E959FDU, 0xF1553E98U, 0x6C820621U, 0xD43E6144U,
+        0xC68BCEAAU, 0x7E37A9CFU, 0xD67F4138U, 0x6EC3265DU, 0x7C7689B3U, 0xC4CAEED6U,
+        0x591DD66FU, 0xE1A1B10AU, 0xF3141EE4U, 0x4BA87981U, 0x13CB69D7U, 0xAB770EB2U,
+        0xB9C2A15CU, 0x017EC639U, 0x9CA9FE80U, 0x241599E5U, 0x36A0360BU, 0x8E1C516EU,
+        0x866616A7U, 0x3EDA71C2U, 0x2C6FDE2CU, 0x94D3B949U, 0x090481F0U, 0xB1B8E695U,
+        0xA30D497BU, 0x1BB12E1EU, 0x43D23E48U, 0xFB6E592DU, 0xE9DBF6C3U, 0x516791A6U,
+        0xCCB0A91FU, 0x740CCE7AU, 0x66B96194U, 0xDE0506F1U
+    }
+};
+
+/*******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_CobsPutByte
+ * Description   : Appends one byte to the COBS encoded stream.
+ *
+ *END**************************************************************************/
+static inline void UART_FRAMING_CobsPutByte(uart_framing_cobs_enc_t * enc, uint8_t data)
+{
+    if (data == UART_FRAMING_COBS_DELIMITER)
+    {
+        /* Close the current block; the zero is implied by its code */
+        enc->buff[enc->codeIdx] = enc->code;
+        enc->codeIdx = enc->outIdx;
+        enc->outIdx++;
+        enc->code = 1U;
+    }
+    else
+    {
+        enc->buff[enc->outIdx] = data;
+        enc->outIdx++;
+        enc->code++;
+        if (enc->code == UART_FRAMING_COBS_MAX_CODE)
+        {
+            /* Maximum block length reached, start a new block without implied zero */
+            enc->buff[enc->codeIdx] = enc->code;
+            enc->codeIdx = enc->outIdx;
+            enc->outIdx++;
+            enc->code = 1U;
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_SlipPutByte
+ * Description   : Appends one byte to the SLIP encoded stream.
+ *
+ *END**************************************************************************/
+static inline uint32_t UART_FRAMING_SlipPutByte(uint8_t * buff, uint32_t outIdx, uint8_t data)
+{
+    uint32_t idx = outIdx;
+
+    if (data == UART_FRAMING_SLIP_END)
+    {
+        buff[idx] = UART_FRAMING_SLIP_ESC;
+        buff[idx + 1U] = UART_FRAMING_SLIP_ESC_END;
+        idx += 2U;
+    }
+    else if (data == UART_FRAMING_SLIP_ESC)
+    {
+        buff[idx] = UART_FRAMING_SLIP_ESC;
+        buff[idx + 1U] = UART_FRAMING_SLIP_ESC_ESC;
+        idx += 2U;
+    }
+    else
+    {
+        buff[idx] = data;
+        idx++;
+    }
+
+    return idx;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Crc16Block
+ * Description   : Updates a CRC-16 register with 4 bytes (slicing-by-4).
+ *
+ *END**************************************************************************/
+static inline uint32_t UART_FRAMING_Crc16Block(uint32_t reg, const uint8_t * data)
+{
+    /* The 16-bit register is fully shifted out after 2 bytes, so the last two
+     * bytes of each block only go through the tables */
+    return (uint32_t)s_uartFramingCrc16Table[3][((reg >> 8U) ^ data[0U]) & 0xFFU] ^
+           (uint32_t)s_uartFramingCrc16Table[2][(reg ^ data[1U]) & 0xFFU] ^
+           (uint32_t)s_uartFramingCrc16Table[1][data[2U]] ^
+           (uint32_t)s_uartFramingCrc16Table[0][data[3U]];
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Crc16Byte
+ * Description   : Updates a CRC-16 register with one byte.
+ *
+ *END**************************************************************************/
+static inline uint32_t UART_FRAMING_Crc16Byte(uint32_t reg, uint8_t data)
+{
+    return ((reg << 8U) & 0xFFFFU) ^ (uint32_t)s_uartFramingCrc16Table[0][((reg >> 8U) ^ data) & 0xFFU];
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Crc32Block
+ * Description   : Updates a CRC-32 register with 4 bytes (slicing-by-4).
+ *
+ *END**************************************************************************/
+static inline uint32_t UART_FRAMING_Crc32Block(uint32_t crc, const uint8_t * data)
+{
+    /* Bytes are assembled explicitly, so the update does not depend on the core
+     * endianness or on the alignment of data */
+    uint32_t reg = crc ^
+                   ((uint32_t)data[0U] |
+                    ((uint32_t)data[1U] << 8U) |
+                    ((uint32_t)data[2U] << 16U) |
+                    ((uint32_t)data[3U] << 24U));
+
+    return s_uartFramingCrc32Table[3][reg & 0xFFU] ^
+           s_uartFramingCrc32Table[2][(reg >> 8U) & 0xFFU] ^
+           s_uartFramingCrc32Table[1][(reg >> 16U) & 0xFFU] ^
+           s_uartFramingCrc32Table[0][reg >> 24U];
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Crc32Byte
+ * Description   : Updates a CRC-32 register with one byte.
+ *
+ *END**************************************************************************/
+static inline uint32_t UART_FRAMING_Crc32Byte(uint32_t reg, uint8_t data)
+{
+    return (reg >> 8U) ^ s_uartFramingCrc32Table[0][(reg ^ data) & 0xFFU];
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_CrcUpdate
+ * Description   : Updates the CRC register of a frame with the next 1 to 4
+ * payload bytes, so that the encoder computes the CRC while it stuffs them.
+ *
+ *END**************************************************************************/
+static inline uint32_t UART_FRAMING_CrcUpdate(uart_framing_crc_t crcType,
+                                              uint32_t reg,
+                                              const uint8_t * data,
+                                              uint32_t size)
+{
+    uint32_t crc = reg;
+    uint32_t idx;
+
+    if (crcType == UART_FRAMING_CRC_16)
+    {
+        if (size == 4U)
+        {
+            crc = UART_FRAMING_Crc16Block(crc, data);
+        }
+        else
+        {
+            for (idx = 0U; idx < size; idx++)
+            {
+                crc = UART_FRAMING_Crc16Byte(crc, data[idx]);
+            }
+        }
+    }
+    else if (crcType == UART_FRAMING_CRC_32)
+    {
+        if (size == 4U)
+        {
+            crc = UART_FRAMING_Crc32Block(crc, data);
+        }
+        else
+        {
+            for (idx = 0U; idx < size; idx++)
+            {
+                crc = UART_FRAMING_Crc32Byte(crc, data[idx]);
+            }
+        }
+    }
+    else
+    {
+        /* No CRC */
+    }
+
+    return crc;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_GetCrcBytes
+ * Description   : Serializes the final CRC of a frame in transmission order.
+ * Returns the number of CRC bytes.
+ *
+ *END**************************************************************************/
+static uint32_t UART_FRAMING_GetCrcBytes(uart_framing_crc_t crcType,
+                                         uint32_t reg,
+                                         uint8_t * crcBytes)
+{
+    uint32_t crc32;
+
+    switch (crcType)
+    {
+        case UART_FRAMING_CRC_16:
+            crcBytes[0] = (uint8_t)(reg >> 8U);
+            crcBytes[1] = (uint8_t)reg;
+            break;
+        case UART_FRAMING_CRC_32:
+            crc32 = ~reg;
+            crcBytes[0] = (uint8_t)crc32;
+            crcBytes[1] = (uint8_t)(crc32 >> 8U);
+            crcBytes[2] = (uint8_t)(crc32 >> 16U);
+            crcBytes[3] = (uint8_t)(crc32 >> 24U);
+            break;
+        default:
+            /* No CRC */
+            break;
+    }
+
+    return (uint32_t)crcType;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_ClearFrame
+ * Description   : Prepares the decoder for a new frame.
+ *
+ *END**************************************************************************/
+static inline void UART_FRAMING_ClearFrame(uart_framing_state_t * state)
+{
+    state->rxCount = 0U;
+    state->cobsCode = 0U;
+    state->cobsRemaining = 0U;
+    state->slipEscape = false;
+    state->discard = false;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Notify
+ * Description   : Invokes the receive callback, if installed.
+ *
+ *END**************************************************************************/
+static inline void UART_FRAMING_Notify(const uart_framing_state_t * state,
+                                       const uint8_t * frame,
+                                       uint32_t frameSize,
+                                       uart_framing_event_t event)
+{
+    if (state->rxCallback != NULL)
+    {
+        state->rxCallback(frame, frameSize, event, state->rxCallbackParam);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_StoreByte
+ * Description   : Stores one decoded byte; reports an overflow and starts
+ * discarding the frame if the frame buffer is full.
+ *
+ *END**************************************************************************/
+static inline void UART_FRAMING_StoreByte(uart_framing_state_t * state, uint8_t data)
+{
+    if (state->rxCount < state->rxFrameBuffSize)
+    {
+        state->rxFrameBuff[state->rxCount] = data;
+        state->rxCount++;
+    }
+    else
+    {
+        state->discard = true;
+        UART_FRAMING_Notify(state, NULL, 0U, UART_FRAMING_EVENT_OVERFLOW);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_EndFrame
+ * Description   : Called on a frame delimiter; checks the CRC and reports the frame.
+ *
+ *END**************************************************************************/
+static void UART_FRAMING_EndFrame(uart_framing_state_t * state, bool stuffingError)
+{
+    uint8_t crcBytes[4];
+    uint32_t crcSize = (uint32_t)state->crcType;
+    uint32_t payloadSize;
+    uint32_t crc;
+    uint32_t i;
+    bool crcOk = true;
+
+    if (state->discard)
+    {
+        /* Error already reported when the frame was dropped */
+    }
+    else if (stuffingError)
+    {
+        UART_FRAMING_Notify(state, NULL, 0U, UART_FRAMING_EVENT_DECODE_ERROR);
+    }
+    else if (state->rxCount == 0U)
+    {
+        /* Back-to-back delimiters, nothing to report */
+    }
+    else if (state->rxCount < crcSize)
+    {
+        UART_FRAMING_Notify(state, NULL, 0U, UART_FRAMING_EVENT_CRC_ERROR);
+    }
+    else
+    {
+        payloadSize = state->rxCount - crcSize;
+        if (state->crcType == UART_FRAMING_CRC_16)
+        {
+            crc = UART_FRAMING_Crc16(UART_FRAMING_CRC16_INIT, state->rxFrameBuff, payloadSize);
+        }
+        else if (state->crcType == UART_FRAMING_CRC_32)
+        {
+            crc = UART_FRAMING_Crc32(UART_FRAMING_CRC32_INIT, state->rxFrameBuff, payloadSize);
+        }
+        else
+        {
+            crc = 0U;
+        }
+        (void)UART_FRAMING_GetCrcBytes(state->crcType, crc, crcBytes);
+        for (i = 0U; i < crcSize; i++)
+        {
+            if (crcBytes[i] != state->rxFrameBuff[payloadSize + i])
+            {
+                crcOk = false;
+            }
+        }
+
+        if (crcOk)
+        {
+            UART_FRAMING_Notify(state, state->rxFrameBuff, payloadSize, UART_FRAMING_EVENT_FRAME_RECEIVED);
+        }
+        else
+        {
+            UART_FRAMING_Notify(state, NULL, 0U, UART_FRAMING_EVENT_CRC_ERROR);
+        }
+    }
+
+    UART_FRAMING_ClearFrame(state);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_CobsDecode
+ * Description   : Incremental COBS decoder.
+ *
+ *END**************************************************************************/
+static void UART_FRAMING_CobsDecode(uart_framing_state_t * state, const uint8_t * data, uint32_t size)
+{
+    uint32_t i;
+    uint8_t byte;
+
+    for (i = 0U; i < size; i++)
+    {
+        byte = data[i];
+        if (byte == UART_FRAMING_COBS_DELIMITER)
+        {
+            /* A delimiter inside a block means the frame was truncated */
+            UART_FRAMING_EndFrame(state, (state->cobsRemaining != 0U));
+        }
+        else if (state->discard)
+        {
+            /* Wait for the next delimiter */
+        }
+        else if (state->cobsRemaining == 0U)
+        {
+            /* New block: emit the zero implied by the previous block, if any */
+            if ((state->cobsCode != 0U) && (state->cobsCode != UART_FRAMING_COBS_MAX_CODE))
+            {
+                UART_FRAMING_StoreByte(state, UART_FRAMING_COBS_DELIMITER);
+            }
+            state->cobsCode = byte;
+            state->cobsRemaining = (uint8_t)(byte - 1U);
+        }
+        else
+        {
+            UART_FRAMING_StoreByte(state, byte);
+            state->cobsRemaining--;
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_SlipDecode
+ * Description   : Incremental SLIP decoder.
+ *
+ *END**************************************************************************/
+static void UART_FRAMING_SlipDecode(uart_framing_state_t * state, const uint8_t * data, uint32_t size)
+{
+    uint32_t i;
+    uint8_t byte;
+
+    for (i = 0U; i < size; i++)
+    {
+        byte = data[i];
+        if (byte == UART_FRAMING_SLIP_END)
+        {
+            UART_FRAMING_EndFrame(state, state->slipEscape);
+        }
+        else if (state->discard)
+        {
+            /* Wait for the next delimiter */
+        }
+        else if (state->slipEscape)
+        {
+            state->slipEscape = false;
+            if (byte == UART_FRAMING_SLIP_ESC_END)
+            {
+                UART_FRAMING_StoreByte(state, UART_FRAMING_SLIP_END);
+            }
+            else if (byte == UART_FRAMING_SLIP_ESC_ESC)
+            {
+                UART_FRAMING_StoreByte(state, UART_FRAMING_SLIP_ESC);
+            }
+            else
+            {
+                /* Protocol violation, drop the frame */
+                state->discard = true;
+                UART_FRAMING_Notify(state, NULL, 0U, UART_FRAMING_EVENT_DECODE_ERROR);
+            }
+        }
+        else if (byte == UART_FRAMING_SLIP_ESC)
+        {
+            state->slipEscape = true;
+        }
+        else
+        {
+            UART_FRAMING_StoreByte(state, byte);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Init
+ * Description   : Initializes a framing channel
+ *
+ * Implements    : UART_FRAMING_Init_Activity
+ *END**************************************************************************/
+status_t UART_FRAMING_Init(uart_framing_state_t * state, const uart_framing_user_config_t * config)
+{
+    DEV_ASSERT((state != NULL) &&
+               (config != NULL) &&
+               (config->rxFrameBuff != NULL));
+
+    status_t status = STATUS_SUCCESS;
+
+    state->framingType = config->framingType;
+    state->crcType = config->crcType;
+    state->rxFrameBuff = config->rxFrameBuff;
+    state->rxFrameBuffSize = config->rxFrameBuffSize;
+    state->rxCallback = config->rxCallback;
+    state->rxCallbackParam = config->rxCallbackParam;
+    UART_FRAMING_ClearFrame(state);
+
+    /* The frame buffer stores the CRC together with the payload */
+    if (config->rxFrameBuffSize <= (uint32_t)config->crcType)
+    {
+        status = STATUS_ERROR;
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_ResetReceiver
+ * Description   : Drops the partially decoded frame
+ *
+ * Implements    : UART_FRAMING_ResetReceiver_Activity
+ *END**************************************************************************/
+void UART_FRAMING_ResetReceiver(uart_framing_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    UART_FRAMING_ClearFrame(state);
+    /* The line may be in the middle of a frame; resynchronize on the next delimiter */
+    state->discard = true;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_GetMaxEncodedSize
+ * Description   : Returns the worst case encoded size of a payload
+ *
+ * Implements    : UART_FRAMING_GetMaxEncodedSize_Activity
+ *END**************************************************************************/
+uint32_t UART_FRAMING_GetMaxEncodedSize(const uart_framing_state_t * state, uint32_t payloadSize)
+{
+    DEV_ASSERT(state != NULL);
+
+    uint32_t dataSize = payloadSize + (uint32_t)state->crcType;
+    uint32_t encodedSize;
+
+    if (state->framingType == UART_FRAMING_COBS)
+    {
+        /* One code byte per 254 data bytes, one leading code byte and the delimiter */
+        encodedSize = dataSize + (dataSize / 254U) + 2U;
+    }
+    else
+    {
+        /* Every byte may be escaped, plus leading and trailing END */
+        encodedSize = (2U * dataSize) + 2U;
+    }
+
+    return encodedSize;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_EncodeFrame
+ * Description   : Encodes a payload into a transmit buffer
+ *
+ * Implements    : UART_FRAMING_EncodeFrame_Activity
+ *END**************************************************************************/
+status_t UART_FRAMING_EncodeFrame(const uart_framing_state_t * state,
+                                  const uint8_t * payload,
+                                  uint32_t payloadSize,
+                                  uint8_t * txBuff,
+                                  uint32_t txBuffSize,
+                                  uint32_t * encodedSize)
+{
+    DEV_ASSERT((state != NULL) &&
+               ((payload != NULL) || (payloadSize == 0U)) &&
+               (txBuff != NULL) &&
+               (encodedSize != NULL));
+
+    uint8_t crcBytes[4];
+    uint32_t crcSize;
+    uint32_t crc;
+    uint32_t outIdx;
+    uint32_t block;
+    uint32_t i;
+    uint32_t j;
+    uart_framing_cobs_enc_t enc;
+
+    /* An empty frame without CRC is indistinguishable from back-to-back delimiters,
+     * which the decoder drops. Bounds are checked once for the worst case, so the
+     * loops below need no checks. */
+    if (((payloadSize == 0U) && (state->crcType == UART_FRAMING_CRC_NONE)) ||
+        (txBuffSize < UART_FRAMING_GetMaxEncodedSize(state, payloadSize)))
+    {
+        *encodedSize = 0U;
+        return STATUS_ERROR;
+    }
+
+    /* The payload is read once: each block of 4 bytes updates the CRC and is
+     * stuffed while it is in registers */
+    crc = (state->crcType == UART_FRAMING_CRC_32) ? UART_FRAMING_CRC32_INIT : UART_FRAMING_CRC16_INIT;
+
+    if (state->framingType == UART_FRAMING_COBS)
+    {
+        enc.buff = txBuff;
+        enc.codeIdx = 0U;
+        enc.outIdx = 1U;
+        enc.code = 1U;
+        for (i = 0U; i < payloadSize; i += block)
+        {
+            block = ((payloadSize - i) < 4U) ? (payloadSize - i) : 4U;
+            crc = UART_FRAMING_CrcUpdate(state->crcType, crc, &payload[i], block);
+            for (j = 0U; j < block; j++)
+            {
+                UART_FRAMING_CobsPutByte(&enc, payload[i + j]);
+            }
+        }
+        crcSize = UART_FRAMING_GetCrcBytes(state->crcType, crc, crcBytes);
+        for (i = 0U; i < crcSize; i++)
+        {
+            UART_FRAMING_CobsPutByte(&enc, crcBytes[i]);
+        }
+        txBuff[enc.codeIdx] = enc.code;
+        txBuff[enc.outIdx] = UART_FRAMING_COBS_DELIMITER;
+        outIdx = enc.outIdx + 1U;
+    }
+    else
+    {
+        /* Leading END flushes any line noise accumulated by the receiver */
+        txBuff[0] = UART_FRAMING_SLIP_END;
+        outIdx = 1U;
+        for (i = 0U; i < payloadSize; i += block)
+        {
+            block = ((payloadSize - i) < 4U) ? (payloadSize - i) : 4U;
+            crc = UART_FRAMING_CrcUpdate(state->crcType, crc, &payload[i], block);
+            for (j = 0U; j < block; j++)
+            {
+                outIdx = UART_FRAMING_SlipPutByte(txBuff, outIdx, payload[i + j]);
+            }
+        }
+        crcSize = UART_FRAMING_GetCrcBytes(state->crcType, crc, crcBytes);
+        for (i = 0U; i < crcSize; i++)
+        {
+            outIdx = UART_FRAMING_SlipPutByte(txBuff, outIdx, crcBytes[i]);
+        }
+        txBuff[outIdx] = UART_FRAMING_SLIP_END;
+        outIdx++;
+    }
+
+    *encodedSize = outIdx;
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_SendFrame
+ * Description   : Encodes a payload and starts a non-blocking transmission
+ *
+ * Implements    : UART_FRAMING_SendFrame_Activity
+ *END**************************************************************************/
+status_t UART_FRAMING_SendFrame(const uart_instance_t * const instance,
+                                const uart_framing_state_t * state,
+                                const uint8_t * payload,
+                                uint32_t payloadSize,
+                                uint8_t * txBuff,
+                                uint32_t txBuffSize)
+{
+    DEV_ASSERT(instance != NULL);
+
+    uint32_t encodedSize;
+    uint32_t bytesRemaining;
+    status_t status;
+
+    /* Do not overwrite a buffer which is still being transmitted */
+    status = UART_GetTransmitStatus(instance, &bytesRemaining);
+    if (status != STATUS_BUSY)
+    {
+        status = UART_FRAMING_EncodeFrame(state, payload, payloadSize, txBuff, txBuffSize, &encodedSize);
+        if (status == STATUS_SUCCESS)
+        {
+            status = UART_SendData(instance, txBuff, encodedSize);
+        }
+    }
+
+    return status;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_ReceiveSlice
+ * Description   : Feeds a slice of received bytes into the frame decoder
+ *
+ * Implements    : UART_FRAMING_ReceiveSlice_Activity
+ *END**************************************************************************/
+void UART_FRAMING_ReceiveSlice(uart_framing_state_t * state, const uint8_t * data, uint32_t size)
+{
+    DEV_ASSERT((state != NULL) &&
+               ((data != NULL) || (size == 0U)));
+
+    if (state->framingType == UART_FRAMING_COBS)
+    {
+        UART_FRAMING_CobsDecode(state, data, size);
+    }
+    else
+    {
+        UART_FRAMING_SlipDecode(state, data, size);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Crc16
+ * Description   : Updates a CRC-16/CCITT-FALSE register, 4 bytes per iteration
+ *
+ * Implements    : UART_FRAMING_Crc16_Activity
+ *END**************************************************************************/
+uint16_t UART_FRAMING_Crc16(uint16_t crc, const uint8_t * data, uint32_t size)
+{
+    DEV_ASSERT((data != NULL) || (size == 0U));
+
+    uint32_t reg = crc;
+    uint32_t idx = 0U;
+
+    while ((size - idx) >= 4U)
+    {
+        reg = UART_FRAMING_Crc16Block(reg, &data[idx]);
+        idx += 4U;
+    }
+
+    while (idx < size)
+    {
+        reg = UART_FRAMING_Crc16Byte(reg, data[idx]);
+        idx++;
+    }
+
+    return (uint16_t)reg;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : UART_FRAMING_Crc32
+ * Description   : Updates a CRC-32 register, 4 bytes per iteration
+ *
+ * Implements    : UART_FRAMING_Crc32_Activity
+ *END**************************************************************************/
+uint32_t UART_FRAMING_Crc32(uint32_t crc, const uint8_t * data, uint32_t size)
+{
+    DEV_ASSERT((data != NULL) || (size == 0U));
+
+    uint32_t reg = crc;
+    uint32_t idx = 0U;
+
+    while ((size - idx) >= 4U)
+    {
+        reg = UART_FRAMING_Crc32Block(reg, &data[idx]);
+        idx += 4U;
+    }
+
+    while (idx < size)
+    {
+        reg = UART_FRAMING_Crc32Byte(reg, data[idx]);
+        idx++;
+    }
+
+    return reg;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -46,14 +46,67 @@
   volatile int exit_code = 0;
 /* User includes (#include below this line is not maintained by Processor Expert) */
 #include <string.h>
+#include "pins_capture_driver.h"
 #define TIMEOUT    100UL
 #define welcomeMsg "Hello MPC5748G UART PAL!\r\n"
 #define BUFFER_SIZE     256UL
 
+/* GPIO capture: port A at 1 MHz with a 40 MHz PIT clock, PIT channel 0 triggering eDMA channel 0 */
+#define CAPTURE_SAMPLES         4096UL
+#define CAPTURE_PIT_CHANNEL     0U
+#define CAPTURE_PERIOD_TICKS    40UL
+
   /* Buffer used to receive data from the console */
   uint8_t buffer[BUFFER_SIZE];
   uint8_t bufferIdx;
 
+  /* GPIO capture */
+  uint16_t captureBuffer[CAPTURE_SAMPLES];
+  pins_capture_state_t captureState;
+  const pins_capture_config_t captureConfig = {
+      .firstPort         = 0U,
+      .portCount         = 1U,
+      .pitChannel        = CAPTURE_PIT_CHANNEL,
+      .periodTicks       = CAPTURE_PERIOD_TICKS,
+      .dmaVirtualChannel = EDMA_CHN0_NUMBER,
+      .mode              = PINS_CAPTURE_ONE_SHOT,
+      .buffer            = captureBuffer,
+      .bufferLength      = CAPTURE_SAMPLES
+  };
+  const pit_config_t pitConfig = {
+      .enableStandardTimers = true,
+      .enableRTITimer       = false,
+      .stopRunInDebug       = true
+  };
+
+  /* Captures port A once and sends the run-length export, starting 16 samples
+   * before the first rising edge of PA0 if there is one
+   */
+void sendCapture(void) {
+      pins_capture_encoder_t encoder;
+      const pins_capture_trigger_t trigger = { PINS_CAPTURE_TRIGGER_ENTER, 0x8000UL, 0x8000UL };
+      uint32_t triggerIndex = PINS_CAPTURE_NO_TRIGGER;
+      uint32_t first = 0UL;
+      uint32_t count;
+      uint32_t length;
+
+      (void)PINS_DRV_CAPTURE_Start(&captureState);
+      while (PINS_DRV_CAPTURE_IsRunning(&captureState));
+      count = PINS_DRV_CAPTURE_Stop(&captureState);
+
+      if (PINS_DRV_CAPTURE_FindTrigger(&captureState, &trigger, 0UL, &triggerIndex))
+      {
+          first = (triggerIndex > 16UL) ? (triggerIndex - 16UL) : 0UL;
+      }
+      PINS_DRV_CAPTURE_EncodeInit(&encoder, &captureState, first, count - first, 0xFFFFUL, triggerIndex);
+      length = PINS_DRV_CAPTURE_Encode(&encoder, buffer, BUFFER_SIZE);
+      while (length != 0UL)
+      {
+          UART_SendDataBlocking(&uart_pal1_instance, buffer, length, TIMEOUT);
+          length = PINS_DRV_CAPTURE_Encode(&encoder, buffer, BUFFER_SIZE);
+      }
+  }
+
   /* UART rx callback for continuous reception, byte by byte
    * Receive and store data byte by byte until new line character is received,
    * or the buffer becomes full (256 characters received)
@@ -106,6 +159,11 @@ int main(void)
     /* Initialize UART PAL over LINFlexD */
     UART_Init(&uart_pal1_instance, &uart_pal1_Config0);
 
+    /* Initialize the GPIO capture */
+    EDMA_DRV_Init(&dmaController1_State, &dmaController1_InitConfig0, edmaChnStateArray, edmaChnConfigArray, EDMA_CONFIGURED_CHANNELS_COUNT);
+    PIT_DRV_Init(0U, &pitConfig);
+    PINS_DRV_CAPTURE_Init(&captureState, &captureConfig);
+
     /* Send a welcome message */
     UART_SendDataBlocking(&uart_pal1_instance, (uint8_t *)welcomeMsg, strlen(welcomeMsg), TIMEOUT);
 
@@ -142,6 +200,12 @@ int main(void)
           {
               strcpy((char *)buffer, "Hello World!\n");
           }
+          /* If the received string is "capture", capture port A and send the export */
+          else if(strcmp((char *)buffer, "capture") == 0)
+          {
+              sendCapture();
+              strcpy((char *)buffer, "\n");
+          }
           else
           {
               buffer[bufferIdx] = '\n';
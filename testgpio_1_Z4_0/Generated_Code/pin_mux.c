@@ -135,9 +135,11 @@ pin_settings_config_t g_pin_mux_InitConfigArr[NUM_OF_CONFIGURED_PINS] =
         .gpioBase          = PTE,
         .intConfig         =
         {
+            .eirqPinIdx    = 11u,
             .intEdgeSel    = SIUL2_INT_DISABLE
         },
-        .inputMux[0]       = PORT_INPUT_MUX_NO_INIT,
+        .inputMux[0]       = PORT_INPUT_MUX_ALT1,
+        .inputMuxReg[0]    = 523,
         .inputMux[1]       = PORT_INPUT_MUX_NO_INIT,
         .inputMux[2]       = PORT_INPUT_MUX_NO_INIT,
         .inputMux[3]       = PORT_INPUT_MUX_NO_INIT,
@@ -236,9 +238,11 @@ pin_settings_config_t g_pin_mux_InitConfigArr[NUM_OF_CONFIGURED_PINS] =
         .gpioBase          = PTA,
         .intConfig         =
         {
+            .eirqPinIdx    = 0u,
             .intEdgeSel    = SIUL2_INT_DISABLE
         },
-        .inputMux[0]       = PORT_INPUT_MUX_NO_INIT,
+        .inputMux[0]       = PORT_INPUT_MUX_ALT1,
+        .inputMuxReg[0]    = 512,
         .inputMux[1]       = PORT_INPUT_MUX_NO_INIT,
         .inputMux[2]       = PORT_INPUT_MUX_NO_INIT,
         .inputMux[3]       = PORT_INPUT_MUX_NO_INIT,
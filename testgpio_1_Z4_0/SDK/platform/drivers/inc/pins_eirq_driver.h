@@ -0,0 +1,213 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PINS_EIRQ_DRIVER_H
+#define PINS_EIRQ_DRIVER_H
+
+#include "pins_driver.h"
+#include "stm_driver.h"
+
+/*!
+ * @defgroup pins_eirq_driver PINS External Interrupt Driver
+ * @ingroup pins
+ * @brief Timestamped and debounced events of the SIUL2 external interrupt lines
+ *
+ * Each configured EIRQ line interrupts on its selected edges, optionally through the
+ * SIUL2 glitch filter. A single handler, installed on the four combined SIUL2 vectors,
+ * reads and clears the interrupt flags once per entry and serves every pending line.
+ * Each edge is stored as an event, stamped with the STM counter, in a queue read by the
+ * application with PINS_DRV_EIRQ_GetEvent(). The handler is the only writer and the
+ * application the only reader, so the queue needs no lock.
+ *
+ * A line with a debounce time is masked at its first edge, and its level is sampled when
+ * the debounce time has elapsed, from the compare interrupt of an STM channel. An event
+ * is stored only if the sampled level differs from the last reported one and matches the
+ * selected edges, and is stamped with the time of the first edge. The channel is shared
+ * by all the lines and is programmed with the nearest deadline, so no polling is needed.
+ *
+ * The EIRQ and STM channel interrupts are given the same priority so that they never
+ * preempt each other, which keeps a single writer on the queue.
+ *
+ * The pins must be routed to their EIRQ lines by the pin configuration, with their input
+ * buffer enabled. The STM instance must be initialized and started by the application.
+ *
+ * @addtogroup pins_eirq_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of SIUL2 external interrupt lines */
+#define PINS_EIRQ_LINE_COUNT    32U
+
+/*!
+ * @brief Configuration of an external interrupt line
+ *
+ * Implements : pins_eirq_line_config_t_Class
+ */
+typedef struct
+{
+    uint8_t eirqIdx;                    /*!< External interrupt line, 0 to 31 */
+    GPIO_Type * gpioBase;               /*!< GPIO port of the pin routed to the line */
+    pins_channel_type_t pin;            /*!< Pin number in the port */
+    siul2_interrupt_type_t edge;        /*!< Edges generating events */
+    bool digitalFilter;                 /*!< Enables the SIUL2 glitch filter */
+    uint8_t filterMaxCnt;               /*!< Glitch filter counter, in filter clock periods */
+    uint32_t debounceTicks;             /*!< Debounce time in STM ticks, 0 for none */
+} pins_eirq_line_config_t;
+
+/*!
+ * @brief Configuration of the external interrupt driver
+ *
+ * Implements : pins_eirq_config_t_Class
+ */
+typedef struct
+{
+    uint32_t stmInstance;                       /*!< STM instance giving the time stamps */
+    uint8_t stmChannel;                         /*!< STM channel used for the debounce timer */
+    uint8_t filterPrescaler;                    /*!< Glitch filter clock prescaler (IFCPR) */
+    uint8_t priority;                           /*!< Priority of the EIRQ and STM interrupts */
+    const pins_eirq_line_config_t * lines;      /*!< Lines configuration */
+    uint8_t lineCount;                          /*!< Number of lines */
+} pins_eirq_config_t;
+
+/*!
+ * @brief Edge event
+ *
+ * Implements : pins_eirq_event_t_Class
+ */
+typedef struct
+{
+    uint32_t timestamp;                 /*!< STM counter at the edge */
+    uint8_t eirqIdx;                    /*!< External interrupt line */
+    pins_level_type_t level;            /*!< Level of the pin after the edge */
+} pins_eirq_event_t;
+
+/*!
+ * @brief Runtime state of an external interrupt line
+ *
+ * Implements : pins_eirq_line_state_t_Class
+ */
+typedef struct
+{
+    const GPIO_Type * gpioBase;         /*!< GPIO port of the pin */
+    uint16_t pinMask;                   /*!< Bit of the pin in PGPDI */
+    siul2_interrupt_type_t edge;        /*!< Edges generating events */
+    pins_level_type_t level;            /*!< Last reported level */
+    uint32_t debounceTicks;             /*!< Debounce time in STM ticks */
+    uint32_t edgeTime;                  /*!< Time of the first edge being debounced */
+} pins_eirq_line_state_t;
+
+/*!
+ * @brief Runtime state of the external interrupt driver
+ *
+ * The fields are internal to the driver and must not be accessed by the application.
+ *
+ * Implements : pins_eirq_state_t_Class
+ */
+typedef struct
+{
+    pins_eirq_line_state_t line[PINS_EIRQ_LINE_COUNT];  /*!< Lines state */
+    volatile pins_eirq_event_t * queue;                 /*!< Event queue */
+    uint32_t queueMask;                                 /*!< Queue length - 1 */
+    volatile uint32_t head;                             /*!< Events written, by the handlers */
+    volatile uint32_t tail;                             /*!< Events read, by the application */
+    volatile uint32_t lostEvents;                       /*!< Events dropped on a full queue */
+    uint32_t lineMask;                                  /*!< Configured lines */
+    uint32_t debouncing;                                /*!< Lines being debounced */
+    uint32_t stmInstance;                               /*!< STM instance */
+    uint8_t stmChannel;                                 /*!< STM channel of the debounce timer */
+} pins_eirq_state_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the external interrupt lines
+ *
+ * Configures the edges and glitch filters of the lines, installs the handlers and
+ * enables the interrupts.
+ *
+ * @param[out] state       Pointer to the driver state structure; must stay valid until
+ *                         PINS_DRV_EIRQ_Deinit().
+ * @param[in]  config      Pointer to the driver configuration.
+ * @param[in]  queue       Event queue buffer.
+ * @param[in]  queueLength Number of events in the queue; must be a power of two.
+ *
+ * @return    STATUS_SUCCESS: if successful;
+ *            STATUS_BUSY   : if the driver is already initialized.
+ */
+status_t PINS_DRV_EIRQ_Init(pins_eirq_state_t * state,
+                            const pins_eirq_config_t * config,
+                            pins_eirq_event_t * queue,
+                            uint32_t queueLength);
+
+/*!
+ * @brief De-initializes the external interrupt lines
+ *
+ * Disables the interrupts of the lines and the debounce timer.
+ */
+void PINS_DRV_EIRQ_Deinit(void);
+
+/*!
+ * @brief Reads the oldest event
+ *
+ * @param[out] event The event.
+ *
+ * @return true if an event was read, false if the queue is empty.
+ */
+bool PINS_DRV_EIRQ_GetEvent(pins_eirq_event_t * event);
+
+/*!
+ * @brief Returns the number of events dropped because the queue was full
+ *
+ * @return Number of events lost since the initialization.
+ */
+uint32_t PINS_DRV_EIRQ_GetLostEvents(void);
+
+/*!
+ * @brief Handler of the SIUL2 external interrupts
+ *
+ * Installed by PINS_DRV_EIRQ_Init() on the four combined vectors.
+ */
+void PINS_DRV_EIRQ_IRQHandler(void);
+
+/*!
+ * @brief Handler of the debounce timer
+ *
+ * Installed by PINS_DRV_EIRQ_Init() on the vector of the STM channel.
+ */
+void PINS_DRV_EIRQ_TimerIRQHandler(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* PINS_EIRQ_DRIVER_H */
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
@@ -0,0 +1,480 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file pins_eirq_driver.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.9, An object should be defined at block scope
+ * if its identifier only appears in a single function.
+ * The driver state is shared by the interrupt handlers and the application functions.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.4, Conversion between a pointer and
+ * integer type.
+ * The cast is required to initialize a pointer with an unsigned long define,
+ * representing an address.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.6, Cast from unsigned int to pointer.
+ * The cast is required to initialize a pointer with an unsigned long define,
+ * representing an address.
+ */
+
+#include "pins_eirq_driver.h"
+#include "siul2_hw_access.h"
+#include "interrupt_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Number of combined SIUL2 external interrupt vectors, 8 lines each */
+#define PINS_EIRQ_VECTOR_COUNT      4U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Driver state */
+static pins_eirq_state_t * s_eirqState = NULL;
+
+/* Combined SIUL2 external interrupt vectors */
+static const IRQn_Type s_eirqIrqs[PINS_EIRQ_VECTOR_COUNT] =
+{
+    SIUL_EIRQ_00_07_IRQn, SIUL_EIRQ_08_15_IRQn, SIUL_EIRQ_16_23_IRQn, SIUL_EIRQ_24_31_IRQn
+};
+
+/* STM channel vectors */
+static const IRQn_Type s_stmIrqs[STM_INSTANCE_COUNT][STM_CHANNEL_COUNT] = STM_IRQS;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_EIRQ_ReadLevel
+ * Description   : Reads the level of the pin of a line.
+ *
+ *END**************************************************************************/
+static inline pins_level_type_t PINS_EIRQ_ReadLevel(const pins_eirq_line_state_t * line)
+{
+    return ((line->gpioBase->PGPDI & line->pinMask) != 0U) ? 1U : 0U;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_EIRQ_Push
+ * Description   : Stores an event; called from the handlers only. The event is
+ * written before the head is advanced, so the reader never sees a partial one.
+ *
+ *END**************************************************************************/
+static void PINS_EIRQ_Push(pins_eirq_state_t * state,
+                           uint32_t timestamp,
+                           uint8_t eirqIdx,
+                           pins_level_type_t level)
+{
+    uint32_t head = state->head;
+    volatile pins_eirq_event_t * event;
+
+    if ((head - state->tail) > state->queueMask)
+    {
+        state->lostEvents++;
+    }
+    else
+    {
+        event = &state->queue[head & state->queueMask];
+        event->timestamp = timestamp;
+        event->eirqIdx = eirqIdx;
+        event->level = level;
+        state->head = head + 1U;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_EIRQ_Settle
+ * Description   : Ends the debounce of a line: its flag is cleared before the
+ * level is sampled, so that an edge after the sample interrupts again, and the
+ * line is unmasked.
+ *
+ *END**************************************************************************/
+static void PINS_EIRQ_Settle(pins_eirq_state_t * state,
+                             uint8_t eirqIdx)
+{
+    SIUL2_Type * const base = SIUL2;
+    pins_eirq_line_state_t * line = &state->line[eirqIdx];
+    uint32_t bit = 1UL << eirqIdx;
+    pins_level_type_t level;
+
+    state->debouncing &= ~bit;
+    base->ISR0 = bit;
+    level = PINS_EIRQ_ReadLevel(line);
+
+    if (level != line->level)
+    {
+        line->level = level;
+        if ((line->edge == SIUL2_INT_EITHER_EDGE) ||
+            ((line->edge == SIUL2_INT_RISING_EDGE) && (level == 1U)) ||
+            ((line->edge == SIUL2_INT_FALLING_EDGE) && (level == 0U)))
+        {
+            PINS_EIRQ_Push(state, line->edgeTime, eirqIdx, level);
+        }
+    }
+
+    base->IRER0 |= bit;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_EIRQ_ServiceDebounce
+ * Description   : Settles the lines whose debounce time has elapsed and
+ * programs the timer with the nearest remaining deadline. The STM compare
+ * only matches on equality, so if the counter has already passed the new
+ * compare value the lines are checked again.
+ *
+ *END**************************************************************************/
+static void PINS_EIRQ_ServiceDebounce(pins_eirq_state_t * state)
+{
+    const pins_eirq_line_state_t * line;
+    uint32_t pending;
+    uint32_t now;
+    uint32_t next;
+    uint32_t compare = 0U;
+    int32_t remaining;
+    uint8_t idx;
+    bool again;
+
+    do
+    {
+        now = STM_DRV_GetCounterValue(state->stmInstance);
+        next = 0x7FFFFFFFUL;
+        pending = state->debouncing;
+        for (idx = 0U; pending != 0U; idx++)
+        {
+            if ((pending & 1UL) != 0U)
+            {
+                line = &state->line[idx];
+                remaining = (int32_t)((line->edgeTime + line->debounceTicks) - now);
+                if (remaining <= 0)
+                {
+                    PINS_EIRQ_Settle(state, idx);
+                }
+                else if ((uint32_t)remaining < next)
+                {
+                    next = (uint32_t)remaining;
+                }
+                else
+                {
+                    /* Later deadline */
+                }
+            }
+            pending >>= 1U;
+        }
+
+        if (state->debouncing == 0U)
+        {
+            STM_DRV_DisableChannel(state->stmInstance, state->stmChannel);
+            again = false;
+        }
+        else
+        {
+            compare = now + next;
+            STM_DRV_ConfigChannel(state->stmInstance, state->stmChannel, compare);
+            again = ((int32_t)(STM_DRV_GetCounterValue(state->stmInstance) - compare) >= 0);
+        }
+    } while (again);
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_EIRQ_Init
+ * Description   : Configures the lines with PINS_SetExInt(), which also clears
+ * their flags and enables them, then installs the handlers.
+ *
+ * Implements    : PINS_DRV_EIRQ_Init_Activity
+ *END**************************************************************************/
+status_t PINS_DRV_EIRQ_Init(pins_eirq_state_t * state,
+                            const pins_eirq_config_t * config,
+                            pins_eirq_event_t * queue,
+                            uint32_t queueLength)
+{
+    const pins_eirq_line_config_t * lineConfig;
+    pins_eirq_line_state_t * line;
+    siul2_interrupt_config_t intConfig;
+    bool debounce = false;
+    uint32_t i;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT((config->lines != NULL) || (config->lineCount == 0U));
+    DEV_ASSERT(queue != NULL);
+    DEV_ASSERT((queueLength != 0U) && ((queueLength & (queueLength - 1U)) == 0U));
+    DEV_ASSERT(config->stmInstance < STM_INSTANCE_COUNT);
+    DEV_ASSERT(config->stmChannel < STM_CHANNEL_COUNT);
+
+    if (s_eirqState != NULL)
+    {
+        return STATUS_BUSY;
+    }
+
+    state->queue = queue;
+    state->queueMask = queueLength - 1U;
+    state->head = 0U;
+    state->tail = 0U;
+    state->lostEvents = 0U;
+    state->lineMask = 0U;
+    state->debouncing = 0U;
+    state->stmInstance = config->stmInstance;
+    state->stmChannel = config->stmChannel;
+
+    for (i = 0U; i < config->lineCount; i++)
+    {
+        lineConfig = &config->lines[i];
+        DEV_ASSERT(lineConfig->eirqIdx < PINS_EIRQ_LINE_COUNT);
+        DEV_ASSERT(lineConfig->gpioBase != NULL);
+        DEV_ASSERT(lineConfig->pin < SIUL2_NUM_OF_PIN_PORT);
+        DEV_ASSERT(lineConfig->edge != SIUL2_INT_DISABLE);
+        DEV_ASSERT(lineConfig->debounceTicks < 0x80000000UL);
+
+        line = &state->line[lineConfig->eirqIdx];
+        line->gpioBase = lineConfig->gpioBase;
+        line->pinMask = (uint16_t)(0x8000U >> lineConfig->pin);
+        line->edge = lineConfig->edge;
+        line->debounceTicks = lineConfig->debounceTicks;
+        line->edgeTime = 0U;
+        line->level = PINS_EIRQ_ReadLevel(line);
+        state->lineMask |= 1UL << lineConfig->eirqIdx;
+        debounce = debounce || (lineConfig->debounceTicks != 0U);
+    }
+
+    s_eirqState = state;
+
+    if (debounce)
+    {
+        STM_DRV_DisableChannel(config->stmInstance, config->stmChannel);
+        STM_DRV_ClearStatusFlags(config->stmInstance, config->stmChannel);
+        INT_SYS_InstallHandler(s_stmIrqs[config->stmInstance][config->stmChannel], PINS_DRV_EIRQ_TimerIRQHandler, (isr_t *)0);
+        INT_SYS_SetPriority(s_stmIrqs[config->stmInstance][config->stmChannel], config->priority);
+        INT_SYS_EnableIRQ(s_stmIrqs[config->stmInstance][config->stmChannel]);
+    }
+
+    for (i = 0U; i < PINS_EIRQ_VECTOR_COUNT; i++)
+    {
+        if (((state->lineMask >> (8U * i)) & 0xFFUL) != 0U)
+        {
+            INT_SYS_InstallHandler(s_eirqIrqs[i], PINS_DRV_EIRQ_IRQHandler, (isr_t *)0);
+            INT_SYS_SetPriority(s_eirqIrqs[i], config->priority);
+            INT_SYS_EnableIRQ(s_eirqIrqs[i]);
+        }
+    }
+
+    PINS_ConfigIntFilterClock(config->filterPrescaler);
+    for (i = 0U; i < config->lineCount; i++)
+    {
+        lineConfig = &config->lines[i];
+        intConfig.eirqPinIdx = lineConfig->eirqIdx;
+        intConfig.intEdgeSel = lineConfig->edge;
+        intConfig.digitalFilter = lineConfig->digitalFilter;
+        intConfig.maxCnt = lineConfig->filterMaxCnt;
+#ifdef FEATURE_SIUL2_EXTERNAL_INT_SUPPORT_DMA
+        intConfig.intExeSel = SIUL2_INT_USING_INTERUPT;
+#endif
+        PINS_SetExInt(intConfig);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_EIRQ_Deinit
+ * Description   : Masks the lines, stops the debounce timer and disables the
+ * vectors.
+ *
+ * Implements    : PINS_DRV_EIRQ_Deinit_Activity
+ *END**************************************************************************/
+void PINS_DRV_EIRQ_Deinit(void)
+{
+    pins_eirq_state_t * state = s_eirqState;
+    SIUL2_Type * const base = SIUL2;
+    uint32_t i;
+
+    DEV_ASSERT(state != NULL);
+
+    base->IRER0 &= ~state->lineMask;
+    base->ISR0 = state->lineMask;
+
+    for (i = 0U; i < PINS_EIRQ_VECTOR_COUNT; i++)
+    {
+        if (((state->lineMask >> (8U * i)) & 0xFFUL) != 0U)
+        {
+            INT_SYS_DisableIRQ(s_eirqIrqs[i]);
+        }
+    }
+
+    STM_DRV_DisableChannel(state->stmInstance, state->stmChannel);
+    STM_DRV_ClearStatusFlags(state->stmInstance, state->stmChannel);
+    INT_SYS_DisableIRQ(s_stmIrqs[state->stmInstance][state->stmChannel]);
+
+    state->debouncing = 0U;
+    s_eirqState = NULL;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_EIRQ_GetEvent
+ * Description   : Reads the oldest event; the tail is advanced only after the
+ * event is copied, so the handlers never overwrite it while it is read.
+ *
+ * Implements    : PINS_DRV_EIRQ_GetEvent_Activity
+ *END**************************************************************************/
+bool PINS_DRV_EIRQ_GetEvent(pins_eirq_event_t * event)
+{
+    pins_eirq_state_t * state = s_eirqState;
+    const volatile pins_eirq_event_t * entry;
+    uint32_t tail;
+    bool ret = false;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(event != NULL);
+
+    tail = state->tail;
+    if (tail != state->head)
+    {
+        entry = &state->queue[tail & state->queueMask];
+        event->timestamp = entry->timestamp;
+        event->eirqIdx = entry->eirqIdx;
+        event->level = entry->level;
+        state->tail = tail + 1U;
+        ret = true;
+    }
+
+    return ret;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_EIRQ_GetLostEvents
+ * Description   : Returns the number of events dropped on a full queue.
+ *
+ * Implements    : PINS_DRV_EIRQ_GetLostEvents_Activity
+ *END**************************************************************************/
+uint32_t PINS_DRV_EIRQ_GetLostEvents(void)
+{
+    DEV_ASSERT(s_eirqState != NULL);
+
+    return s_eirqState->lostEvents;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_EIRQ_IRQHandler
+ * Description   : Reads and clears the flags of the enabled lines in one access
+ * each, takes one time stamp for them, then serves the lines from the
+ * snapshot: an event for the lines without debounce, the start of the
+ * debounce for the others.
+ *
+ * Implements    : PINS_DRV_EIRQ_IRQHandler_Activity
+ *END**************************************************************************/
+void PINS_DRV_EIRQ_IRQHandler(void)
+{
+    pins_eirq_state_t * state = s_eirqState;
+    SIUL2_Type * const base = SIUL2;
+    pins_eirq_line_state_t * line;
+    pins_level_type_t level;
+    uint32_t pending;
+    uint32_t debounced = 0U;
+    uint32_t now;
+    uint8_t idx;
+
+    DEV_ASSERT(state != NULL);
+
+    pending = base->ISR0 & base->IRER0 & state->lineMask;
+    base->ISR0 = pending;
+    now = STM_DRV_GetCounterValue(state->stmInstance);
+
+    for (idx = 0U; pending != 0U; idx++)
+    {
+        if ((pending & 1UL) != 0U)
+        {
+            line = &state->line[idx];
+            if (line->debounceTicks == 0U)
+            {
+                if (line->edge == SIUL2_INT_RISING_EDGE)
+                {
+                    level = 1U;
+                }
+                else if (line->edge == SIUL2_INT_FALLING_EDGE)
+                {
+                    level = 0U;
+                }
+                else
+                {
+                    level = PINS_EIRQ_ReadLevel(line);
+                }
+                line->level = level;
+                PINS_EIRQ_Push(state, now, idx, level);
+            }
+            else
+            {
+                line->edgeTime = now;
+                debounced |= 1UL << idx;
+            }
+        }
+        pending >>= 1U;
+    }
+
+    if (debounced != 0U)
+    {
+        base->IRER0 &= ~debounced;
+        state->debouncing |= debounced;
+        PINS_EIRQ_ServiceDebounce(state);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_EIRQ_TimerIRQHandler
+ * Description   : Compare interrupt of the debounce timer.
+ *
+ * Implements    : PINS_DRV_EIRQ_TimerIRQHandler_Activity
+ *END**************************************************************************/
+void PINS_DRV_EIRQ_TimerIRQHandler(void)
+{
+    pins_eirq_state_t * state = s_eirqState;
+
+    DEV_ASSERT(state != NULL);
+
+    STM_DRV_ClearStatusFlags(state->stmInstance, state->stmChannel);
+    PINS_EIRQ_ServiceDebounce(state);
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
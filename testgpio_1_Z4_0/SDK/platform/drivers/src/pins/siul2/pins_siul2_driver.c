@@ -24,10 +24,20 @@
  * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
  * Function is defined for usage by application code.
  *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 11.4, Conversion between a pointer and
+ * integer type.
+ * The register image holds the addresses of the registers as integers.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.6, Cast from unsigned int to pointer.
+ * The register image holds the addresses of the registers as integers.
+ *
  */
 
 #include "pins_driver.h"
 #include "siul2_hw_access.h"
+#include "interrupt_manager.h"
 
 /*******************************************************************************
  * Definitions
@@ -306,6 +316,161 @@ uint32_t PINS_DRV_GetExIntFlag(void)
     return PINS_GetExIntFlag();
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_InitFromImage
+ * Description   : This function writes the registers of a precomputed pin
+ * configuration image in order.
+ *
+ * Implements    : PINS_DRV_InitFromImage_Activity
+ *END**************************************************************************/
+status_t PINS_DRV_InitFromImage(uint32_t regCount,
+                                const pins_reg_write_t image[])
+{
+    uint32_t i;
+
+    DEV_ASSERT((image != NULL) || (regCount == 0U));
+
+    for (i = 0U; i < regCount; i++)
+    {
+        DEV_ASSERT((image[i].address >= SIUL2_BASE) && (image[i].address < (SIUL2_BASE + sizeof(SIUL2_Type))));
+        *(volatile uint32_t *)image[i].address = image[i].value;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_InitProfiles
+ * Description   : This function records the table of profiles and the profile
+ * the pins are configured as.
+ *
+ * Implements    : PINS_DRV_InitProfiles_Activity
+ *END**************************************************************************/
+void PINS_DRV_InitProfiles(pins_profile_state_t * state,
+                           const pins_profile_table_t * table,
+                           uint8_t initialProfile)
+{
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(table != NULL);
+    DEV_ASSERT(initialProfile < table->profileCount);
+
+    state->table = table;
+    state->current = initialProfile;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_SwitchProfile
+ * Description   : This function writes the precomputed transition from the
+ * current profile to the requested one. The interrupts are disabled so that
+ * the pins spend the shortest time in the intermediate states, and no other
+ * access to the pins is interleaved.
+ *
+ * Implements    : PINS_DRV_SwitchProfile_Activity
+ *END**************************************************************************/
+status_t PINS_DRV_SwitchProfile(pins_profile_state_t * state,
+                                uint8_t profile)
+{
+    const pins_profile_transition_t * transition;
+
+    DEV_ASSERT(state != NULL);
+    DEV_ASSERT(state->table != NULL);
+    DEV_ASSERT(profile < state->table->profileCount);
+
+    if (profile != state->current)
+    {
+        transition = &state->table->transitions[((uint32_t)state->current * state->table->profileCount) + profile];
+        INT_SYS_DisableIRQGlobal();
+        (void)PINS_DRV_InitFromImage(transition->regCount, transition->writes);
+        INT_SYS_EnableIRQGlobal();
+        state->current = profile;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_GetProfile
+ * Description   : This function returns the current profile.
+ *
+ * Implements    : PINS_DRV_GetProfile_Activity
+ *END**************************************************************************/
+uint8_t PINS_DRV_GetProfile(const pins_profile_state_t * state)
+{
+    DEV_ASSERT(state != NULL);
+
+    return state->current;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_WritePinSet
+ * Description   : This function writes pin n of the set with bit n of value.
+ * The values are gathered per port in RAM first, then each port is written
+ * once through its masked parallel output register.
+ *
+ * Implements    : PINS_DRV_WritePinSet_Activity
+ *END**************************************************************************/
+void PINS_DRV_WritePinSet(const pins_set_t * pinSet,
+                          uint32_t value)
+{
+    uint16_t portValues[SIUL2_MPGPDO_COUNT];
+    const pins_set_pin_t * pin;
+    uint32_t i;
+
+    DEV_ASSERT(pinSet != NULL);
+    DEV_ASSERT(pinSet->portCount <= SIUL2_MPGPDO_COUNT);
+    DEV_ASSERT(pinSet->pinCount <= 32U);
+
+    for (i = 0U; i < pinSet->portCount; i++)
+    {
+        portValues[i] = 0U;
+    }
+
+    for (i = 0U; i < pinSet->pinCount; i++)
+    {
+        pin = &pinSet->pins[i];
+        DEV_ASSERT(pin->portEntry < pinSet->portCount);
+        DEV_ASSERT((pin->mask & pinSet->ports[pin->portEntry].mask) == pin->mask);
+        if (((value >> i) & 1UL) != 0UL)
+        {
+            portValues[pin->portEntry] |= pin->mask;
+        }
+    }
+
+    for (i = 0U; i < pinSet->portCount; i++)
+    {
+        PINS_WriteMaskedPins(pinSet->ports[i].portIdx, pinSet->ports[i].mask, portValues[i]);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_DRV_WritePinSetLevel
+ * Description   : This function writes all pins of the set with the given
+ * value, with one masked write per port.
+ *
+ * Implements    : PINS_DRV_WritePinSetLevel_Activity
+ *END**************************************************************************/
+void PINS_DRV_WritePinSetLevel(const pins_set_t * pinSet,
+                               pins_level_type_t value)
+{
+    uint32_t i;
+    uint16_t mask;
+
+    DEV_ASSERT(pinSet != NULL);
+    DEV_ASSERT(value <= 1U);
+
+    for (i = 0U; i < pinSet->portCount; i++)
+    {
+        mask = pinSet->ports[i].mask;
+        PINS_WriteMaskedPins(pinSet->ports[i].portIdx, mask, (value != 0U) ? mask : 0U);
+    }
+}
+
 /******************************************************************************
  * EOF
  *****************************************************************************/
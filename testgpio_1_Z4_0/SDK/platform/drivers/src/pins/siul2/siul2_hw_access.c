@@ -45,19 +45,15 @@
 
 /*FUNCTION**********************************************************************
  *
- * Function Name : PINS_Init
- * Description   : This function configures the pin feature with the options
- * provided in the given structure.
+ * Function Name : PINS_GetMscrValue
+ * Description   : This function computes the Multiplexed Signal Configuration
+ * Register value of the pin from the options provided in the given structure.
  *
  *END**************************************************************************/
-void PINS_Init(const pin_settings_config_t * config)
+uint32_t PINS_GetMscrValue(const pin_settings_config_t * config)
 {
     DEV_ASSERT(config != NULL);
-    DEV_ASSERT(config->pinPortIdx < SIUL2_MSCR_COUNT);
     uint32_t pinsValues = 0U;
-    uint32_t pinsValuesInput = 0U;
-    uint8_t inputMuxIterator;
-    uint32_t pinIntValue;
 
 #ifdef FEATURE_SIUL2_HAS_DDR_PAD
     pinsValues |= SIUL2_MSCR_CRPOINT_TRIM(config->ddrConfiguration.crosspointAdjustment);
@@ -115,6 +111,47 @@ void PINS_Init(const pin_settings_config_t * config)
     pinsValues |= SIUL2_MSCR_IBE(config->inputBuffer);
     pinsValues |= SIUL2_MSCR_SSS(config->mux);
 
+    return pinsValues;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_GetImcrValue
+ * Description   : This function computes the value of the Input Multiplexed
+ * Signal Configuration Register selected by the given input mux entry.
+ *
+ *END**************************************************************************/
+uint32_t PINS_GetImcrValue(const pin_settings_config_t * config,
+                           uint8_t inputMuxIdx)
+{
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(inputMuxIdx < FEATURE_SIUL2_INPUT_MUX_WIDTH);
+    /* Input mux value */
+    uint32_t pinsValuesInput = SIUL2_IMCR_SSS(config->inputMux[inputMuxIdx]);
+
+    /* Input inversion feature */
+#ifdef FEATURE_SIUL2_HAS_INVERT_DATA_INPUT
+    pinsValuesInput |= SIUL2_IMCR_INV(config->inputInvert[inputMuxIdx]);
+#endif
+
+    return pinsValuesInput;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : PINS_Init
+ * Description   : This function configures the pin feature with the options
+ * provided in the given structure.
+ *
+ *END**************************************************************************/
+void PINS_Init(const pin_settings_config_t * config)
+{
+    DEV_ASSERT(config != NULL);
+    DEV_ASSERT(config->pinPortIdx < SIUL2_MSCR_COUNT);
+    uint32_t pinsValues = PINS_GetMscrValue(config);
+    uint8_t inputMuxIterator;
+    uint32_t pinIntValue;
+
     /* Configure initial value for GPIO pin in GPIO mux */
 #ifdef FEATURE_SIUL2_HAS_OUTPUT_DRIVE_CONTROL
     if ((PORT_MUX_AS_GPIO == config->mux) && (PORT_OUTPUT_DRIVE_DISABLED != config->outputDriveCtrl))
@@ -135,15 +172,8 @@ void PINS_Init(const pin_settings_config_t * config)
             /* Check if input mux information needs to be configured */
             if (PORT_INPUT_MUX_NO_INIT != config->inputMux[inputMuxIterator])
             {
-                /* Input mux value */
-                pinsValuesInput = SIUL2_IMCR_SSS(config->inputMux[inputMuxIterator]);
-
-                /* Input inversion feature */
-            #ifdef FEATURE_SIUL2_HAS_INVERT_DATA_INPUT
-                pinsValuesInput |= SIUL2_IMCR_INV(config->inputInvert[inputMuxIterator]);
-            #endif
                 /* Write to Input Mux register */
-                config->base->IMCR[config->inputMuxReg[inputMuxIterator]] = (uint32_t)pinsValuesInput;
+                config->base->IMCR[config->inputMuxReg[inputMuxIterator]] = PINS_GetImcrValue(config, inputMuxIterator);
             }
         }
 
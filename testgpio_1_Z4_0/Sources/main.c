@@ -45,27 +45,61 @@
 
   volatile int exit_code = 0;
 /* User includes (#include below this line is not maintained by Processor Expert) */
+#include "pin_mux_image.h"
+#include "pins_eirq_driver.h"
 
+/* Buttons, active high, routed to their EIRQ lines by pin_mux (IMCR[512 + line]) */
 #define BTN_PORT        PTA
 #define BTN_PIN         3U
+#define BTN_EIRQ        0U		/* SW1, PA[3] on EIRQ[0] */
 #define BTN_PORT0        PTE
 #define BTN_PIN0         12U
-#define PORT0	PTA
-#define LED0 	7
-#define PORT1	PTA
-#define LED1	10
-#define PORT2	PTH
-#define LED2	13
-#define PORT3	PTC
-#define LED3	4
-#define PORT4	PTH
-#define LED4	5
-#define PORT5   PTJ
-#define LED5    4U
-#define PORT6	PTA
-#define LED6 	0
-#define PORT7	PTA
-#define LED7 	4
+#define BTN_EIRQ0        11U	/* SW2, PE[12] on EIRQ[11] */
+
+/* Time stamps and debounce timer on STM0 channel 0, clocked by the system clock */
+#define BTN_STM_INSTANCE	0U
+#define BTN_STM_CHANNEL		0U
+#define BTN_DEBOUNCE_US		20000U
+
+static const stm_config_t btnStmConfig = {
+	.clockSource = STM_CLOCK_SYSTEM,
+	.clockPrescaler = 0U,
+	.stopInDebugMode = true,
+	.startValue = 0U
+};
+static pins_eirq_line_config_t btnLines[] = {
+	{ BTN_EIRQ, BTN_PORT, BTN_PIN, SIUL2_INT_RISING_EDGE, false, 0U, 0U },
+	{ BTN_EIRQ0, BTN_PORT0, BTN_PIN0, SIUL2_INT_RISING_EDGE, false, 0U, 0U },
+};
+static const pins_eirq_config_t btnConfig = {
+	.stmInstance = BTN_STM_INSTANCE,
+	.stmChannel = BTN_STM_CHANNEL,
+	.filterPrescaler = 0U,
+	.priority = 5U,
+	.lines = btnLines,
+	.lineCount = 2U
+};
+static pins_eirq_state_t btnState;
+static pins_eirq_event_t btnQueue[8];
+/* LED bar, LED0 to LED7: PTA7, PTA10, PTH13, PTC4, PTH5, PTJ4, PTA0, PTA4 */
+static const pins_set_port_t ledBarPorts[] = {
+	{ PINS_PORT_IDX(PTA_BASE), PINS_PORT_PIN_MASK(7U) | PINS_PORT_PIN_MASK(10U) |
+	                           PINS_PORT_PIN_MASK(0U) | PINS_PORT_PIN_MASK(4U) },
+	{ PINS_PORT_IDX(PTC_BASE), PINS_PORT_PIN_MASK(4U) },
+	{ PINS_PORT_IDX(PTH_BASE), PINS_PORT_PIN_MASK(13U) | PINS_PORT_PIN_MASK(5U) },
+	{ PINS_PORT_IDX(PTJ_BASE), PINS_PORT_PIN_MASK(4U) },
+};
+static const pins_set_pin_t ledBarPins[] = {
+	{ 0U, PINS_PORT_PIN_MASK(7U) },		/* LED0 */
+	{ 0U, PINS_PORT_PIN_MASK(10U) },	/* LED1 */
+	{ 2U, PINS_PORT_PIN_MASK(13U) },	/* LED2 */
+	{ 1U, PINS_PORT_PIN_MASK(4U) },		/* LED3 */
+	{ 2U, PINS_PORT_PIN_MASK(5U) },		/* LED4 */
+	{ 3U, PINS_PORT_PIN_MASK(4U) },		/* LED5 */
+	{ 0U, PINS_PORT_PIN_MASK(0U) },		/* LED6 */
+	{ 0U, PINS_PORT_PIN_MASK(4U) },		/* LED7 */
+};
+static const pins_set_t ledBar = { ledBarPorts, 4U, ledBarPins, 8U };
 #define GPIO_PORT	PTG
 #define GPIO_PIN	2
 
@@ -94,32 +128,30 @@ int main(void)
        CLOCK_SYS_UpdateConfiguration(0U, CLOCK_MANAGER_POLICY_FORCIBLE);
 
        /* Initialize pins */
-       PINS_DRV_Init(NUM_OF_CONFIGURED_PINS, g_pin_mux_InitConfigArr);
+       PINS_DRV_InitFromImage(PIN_MUX_INIT_IMAGE_COUNT, g_pin_mux_InitImage);
+
+       /* Start the time base of the button events */
+       STM_DRV_Init(BTN_STM_INSTANCE, &btnStmConfig);
+       STM_DRV_StartTimer(BTN_STM_INSTANCE);
+
+       /* Buttons on external interrupts, debounced from the STM channel */
+       uint32_t debounceTicks;
+       (void)STM_DRV_ComputeTicksByUs(BTN_STM_INSTANCE, BTN_DEBOUNCE_US, &debounceTicks);
+       btnLines[0].debounceTicks = debounceTicks;
+       btnLines[1].debounceTicks = debounceTicks;
+       (void)PINS_DRV_EIRQ_Init(&btnState, &btnConfig, btnQueue, 8U);
 
        while(1) {
-       	uint32_t btn_return = (PINS_DRV_ReadPins(BTN_PORT) >> BTN_PIN) & 0x01;//read SW1
-       	uint32_t btn_return0 = (PINS_DRV_ReadPins(BTN_PORT0) >> BTN_PIN0) & 0x01;//read SW2
-       	if(btn_return == 1) {	//button pressed
-       		PINS_DRV_WritePin(PTA, 7, 0);
-       		PINS_DRV_WritePin(PORT1, LED1, 0);
-       		PINS_DRV_WritePin(PORT2, LED2, 0);
-       		PINS_DRV_WritePin(PORT3, LED3, 0);
-       		PINS_DRV_WritePin(PORT4, LED4, 0);	//led on
-       		PINS_DRV_WritePin(PORT5, LED5, 0);
-       		PINS_DRV_WritePin(PORT6, LED6, 0);
-       		PINS_DRV_WritePin(PORT7, LED7, 0);
-       		PINS_DRV_WritePin(GPIO_PORT, GPIO_PIN, 1);	//PG2 1
-       	}
-       	if(btn_return0 == 1) {
-       		PINS_DRV_WritePin(PORT0, LED0, 1);
-       		PINS_DRV_WritePin(PORT1, LED1, 1);
-       		PINS_DRV_WritePin(PORT2, LED2, 1);
-       		PINS_DRV_WritePin(PORT3, LED3, 1);
-       		PINS_DRV_WritePin(PORT4, LED4, 1);	//led off
-       		PINS_DRV_WritePin(PORT5, LED5, 1);
-       		PINS_DRV_WritePin(PORT6, LED6, 1);
-       		PINS_DRV_WritePin(PORT7, LED7, 1);
-       		PINS_DRV_WritePin(GPIO_PORT, GPIO_PIN, 0); //PG2 0
+       	pins_eirq_event_t event;
+       	while (PINS_DRV_EIRQ_GetEvent(&event)) {
+       		if(event.eirqIdx == BTN_EIRQ) {	//SW1 pressed
+       			PINS_DRV_WritePinSetLevel(&ledBar, 0U);	//led on
+       			PINS_DRV_WritePin(GPIO_PORT, GPIO_PIN, 1);	//PG2 1
+       		}
+       		else if(event.eirqIdx == BTN_EIRQ0) {	//SW2 pressed
+       			PINS_DRV_WritePinSetLevel(&ledBar, 1U);	//led off
+       			PINS_DRV_WritePin(GPIO_PORT, GPIO_PIN, 0); //PG2 0
+       		}
        	}
        }
 
@@ -0,0 +1,25 @@
+/* Generated by pins_image_gen from g_pin_mux_InitConfigArr. Do not modify it. */
+
+#include "pin_mux_image.h"
+
+const pins_reg_write_t g_pin_mux_InitImage[PIN_MUX_INIT_IMAGE_COUNT] =
+{
+    { 0xFFFC1780u, 0x89200000u },    /* MPGPDO[0] */
+    { 0xFFFC1788u, 0x08000000u },    /* MPGPDO[2] */
+    { 0xFFFC1798u, 0x20000000u },    /* MPGPDO[6] */
+    { 0xFFFC179Cu, 0x04040000u },    /* MPGPDO[7] */
+    { 0xFFFC17A4u, 0x08000000u },    /* MPGPDO[9] */
+    { 0xFFFC0490u, 0x02000000u },    /* MSCR[148] */
+    { 0xFFFC0414u, 0x02000000u },    /* MSCR[117] */
+    { 0xFFFC02D0u, 0x02000000u },    /* MSCR[36] */
+    { 0xFFFC0370u, 0x00080000u },    /* MSCR[76] */
+    { 0xFFFC0268u, 0x02000000u },    /* MSCR[10] */
+    { 0xFFFC0434u, 0x02000000u },    /* MSCR[125] */
+    { 0xFFFC025Cu, 0x02000000u },    /* MSCR[7] */
+    { 0xFFFC03C8u, 0x02000000u },    /* MSCR[98] */
+    { 0xFFFC0240u, 0x02000000u },    /* MSCR[0] */
+    { 0xFFFC024Cu, 0x00080000u },    /* MSCR[3] */
+    { 0xFFFC0250u, 0x02000000u },    /* MSCR[4] */
+    { 0xFFFC126Cu, 0x00000001u },    /* IMCR[523] */
+    { 0xFFFC1240u, 0x00000001u },    /* IMCR[512] */
+};
@@ -0,0 +1,397 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file adc_lin_gen.c
+ *
+ * Host tool building the breakpoint table of a sensor, converted at runtime by
+ * ADC_LIN_Convert(), from its calibration data.
+ *
+ * The calibration file holds one "code value" pair per line, the raw 12-bit result
+ * and the engineering value measured at it; lines starting with '#' are comments.
+ * The pairs are joined by a monotone cubic (Fritsch-Carlson), which goes through
+ * every pair and does not overshoot between them, extended linearly beyond the first
+ * and the last pair. The table holds this curve at the segment boundaries, multiplied
+ * by the scale (e.g. 100 for values in 0.01 C from a file in C) and rounded.
+ *
+ * The tool is built with the host compiler against the sources of the project, so
+ * that the reported error is the one of the conversion of the target. From the
+ * project directory:
+ *
+ *   I=""; for d in $(find SDK -type d); do I="$I -I$d"; done
+ *   gcc -DCPU_MPC5748G $I -o adc_lin_gen ../tools/adc_lin/adc_lin_gen.c \
+ *       SDK/platform/pal/src/adc/adc_lin.c -lm
+ *   ./adc_lin_gen ../tools/adc_lin/ntc_10k_b3950.txt g_adcLinNtc10k 6 100 Sources/adc_lin_ntc10k
+ *
+ * This writes Sources/adc_lin_ntc10k.c and Sources/adc_lin_ntc10k.h, and prints the
+ * largest difference between the conversion and the curve over the calibrated codes.
+ * The table must be generated again whenever the calibration data change.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "adc_lin.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Maximum number of calibration pairs */
+#define CAL_MAX_PAIRS       256U
+
+/* Number of raw codes */
+#define ADC_LIN_CODES       ((uint32_t)1U << ADC_LIN_RESULT_BITS)
+
+typedef struct
+{
+    double code;
+    double value;
+    double slope;      /* Derivative of the curve at the pair */
+} cal_pair_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static cal_pair_t s_cal[CAL_MAX_PAIRS];
+static uint32_t s_calCount = 0U;
+static int32_t s_points[ADC_LIN_CODES + 1U];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static int ComparePairs(const void * a, const void * b)
+{
+    double ca = ((const cal_pair_t *)a)->code;
+    double cb = ((const cal_pair_t *)b)->code;
+
+    return (ca < cb) ? -1 : ((ca > cb) ? 1 : 0);
+}
+
+static int ReadCalibration(const char * path)
+{
+    FILE * f = fopen(path, "r");
+    char line[256];
+    unsigned long lineNum = 0UL;
+    double code;
+    double value;
+    uint32_t i;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    while (fgets(line, (int)sizeof(line), f) != NULL)
+    {
+        lineNum++;
+        if ((line[strspn(line, " \t\r\n")] == '\0') || (line[strspn(line, " \t")] == '#'))
+        {
+            continue;
+        }
+        if ((sscanf(line, "%lf %lf", &code, &value) != 2) || (code < 0.0) || (code > (double)ADC_LIN_CODES))
+        {
+            fprintf(stderr, "%s:%lu: expected \"code value\" with code 0 to %lu\n",
+                    path, lineNum, (unsigned long)ADC_LIN_CODES);
+            (void)fclose(f);
+            return 1;
+        }
+        if (s_calCount >= CAL_MAX_PAIRS)
+        {
+            fprintf(stderr, "%s: more than %u pairs\n", path, (unsigned)CAL_MAX_PAIRS);
+            (void)fclose(f);
+            return 1;
+        }
+        s_cal[s_calCount].code = code;
+        s_cal[s_calCount].value = value;
+        s_calCount++;
+    }
+    (void)fclose(f);
+
+    if (s_calCount < 2U)
+    {
+        fprintf(stderr, "%s: at least two pairs are needed\n", path);
+        return 1;
+    }
+
+    qsort(s_cal, s_calCount, sizeof(s_cal[0]), ComparePairs);
+    for (i = 1U; i < s_calCount; i++)
+    {
+        if (s_cal[i].code == s_cal[i - 1U].code)
+        {
+            fprintf(stderr, "%s: two pairs at code %g\n", path, s_cal[i].code);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Slopes of the monotone cubic, Fritsch-Carlson */
+static void FitCurve(void)
+{
+    double secant[CAL_MAX_PAIRS];
+    double a;
+    double b;
+    double r;
+    uint32_t i;
+
+    for (i = 0U; (i + 1U) < s_calCount; i++)
+    {
+        secant[i] = (s_cal[i + 1U].value - s_cal[i].value) / (s_cal[i + 1U].code - s_cal[i].code);
+    }
+
+    s_cal[0].slope = secant[0];
+    s_cal[s_calCount - 1U].slope = secant[s_calCount - 2U];
+    for (i = 1U; (i + 1U) < s_calCount; i++)
+    {
+        s_cal[i].slope = ((secant[i - 1U] * secant[i]) <= 0.0) ? 0.0 : ((secant[i - 1U] + secant[i]) / 2.0);
+    }
+
+    /* Limits the slopes so the curve stays monotone between the pairs */
+    for (i = 0U; (i + 1U) < s_calCount; i++)
+    {
+        if (secant[i] == 0.0)
+        {
+            s_cal[i].slope = 0.0;
+            s_cal[i + 1U].slope = 0.0;
+        }
+        else
+        {
+            a = s_cal[i].slope / secant[i];
+            b = s_cal[i + 1U].slope / secant[i];
+            r = (a * a) + (b * b);
+            if (r > 9.0)
+            {
+                r = 3.0 / sqrt(r);
+                s_cal[i].slope = r * a * secant[i];
+                s_cal[i + 1U].slope = r * b * secant[i];
+            }
+        }
+    }
+}
+
+static double Curve(double code)
+{
+    const cal_pair_t * p0;
+    const cal_pair_t * p1;
+    double h;
+    double t;
+    uint32_t i;
+
+    if (code <= s_cal[0].code)
+    {
+        return s_cal[0].value + (s_cal[0].slope * (code - s_cal[0].code));
+    }
+    if (code >= s_cal[s_calCount - 1U].code)
+    {
+        p1 = &s_cal[s_calCount - 1U];
+        return p1->value + (p1->slope * (code - p1->code));
+    }
+
+    for (i = 1U; s_cal[i].code < code; i++)
+    {
+    }
+    p0 = &s_cal[i - 1U];
+    p1 = &s_cal[i];
+    h = p1->code - p0->code;
+    t = (code - p0->code) / h;
+
+    return (((2.0 * t * t * t) - (3.0 * t * t) + 1.0) * p0->value) +
+           (((t * t * t) - (2.0 * t * t) + t) * h * p0->slope) +
+           (((-2.0 * t * t * t) + (3.0 * t * t)) * p1->value) +
+           (((t * t * t) - (t * t)) * h * p1->slope);
+}
+
+static int BuildTable(uint32_t shift, double scale)
+{
+    uint32_t numPoints = ADC_LIN_TABLE_POINTS(shift);
+    double value;
+    uint32_t i;
+
+    for (i = 0U; i < numPoints; i++)
+    {
+        value = round(Curve((double)(i << shift)) * scale);
+        if ((value > (double)INT32_MAX) || (value < (double)INT32_MIN))
+        {
+            fprintf(stderr, "adc_lin_gen: value at code %lu out of range, reduce the scale\n",
+                    (unsigned long)(i << shift));
+            return 1;
+        }
+        s_points[i] = (int32_t)value;
+    }
+
+    return 0;
+}
+
+static int WriteHeader(const char * path, const char * guard, const char * name, const char * calPath)
+{
+    FILE * f = fopen(path, "w");
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/* Generated by adc_lin_gen from %s. Do not modify it. */\n\n", calPath);
+    fprintf(f, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(f, "#include \"adc_lin.h\"\n\n");
+    fprintf(f, "/*! @brief Breakpoint table, converted by ADC_LIN_Convert() */\n");
+    fprintf(f, "extern const adc_lin_table_t %s;\n\n", name);
+    fprintf(f, "#endif /* %s */\n", guard);
+
+    return (fclose(f) == 0) ? 0 : 1;
+}
+
+static int WriteSource(const char * path, const char * header, const char * name, const char * calPath,
+                       uint32_t shift, double scale)
+{
+    FILE * f = fopen(path, "w");
+    uint32_t numPoints = ADC_LIN_TABLE_POINTS(shift);
+    uint32_t i;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/* Generated by adc_lin_gen from %s. Do not modify it. */\n\n", calPath);
+    fprintf(f, "#include \"%s\"\n\n", header);
+    fprintf(f, "/* Value x %g at code (i << %lu) */\n", scale, (unsigned long)shift);
+    fprintf(f, "static const int32_t %sPoints[%luU] =\n{\n", name, (unsigned long)numPoints);
+    for (i = 0U; i < numPoints; i++)
+    {
+        fprintf(f, "%s%ld,%s", ((i % 8U) == 0U) ? "    " : " ", (long)s_points[i],
+                (((i % 8U) == 7U) || ((i + 1U) == numPoints)) ? "\n" : "");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const adc_lin_table_t %s =\n{\n", name);
+    fprintf(f, "    .points = %sPoints,\n", name);
+    fprintf(f, "    .segmentShift = %luU\n", (unsigned long)shift);
+    fprintf(f, "};\n");
+
+    return (fclose(f) == 0) ? 0 : 1;
+}
+
+int main(int argc, char * argv[])
+{
+    char sourcePath[512];
+    char headerPath[512];
+    char headerName[128];
+    char guard[128];
+    const char * base;
+    const char * calName;
+    adc_lin_table_t table;
+    unsigned long shift;
+    double scale;
+    double error;
+    double maxError = 0.0;
+    uint32_t maxErrorCode = 0U;
+    uint32_t code;
+    char * end;
+    size_t i;
+
+    if (argc != 6)
+    {
+        fprintf(stderr, "usage: %s <calibration file> <table name> <segment shift> <scale> "
+                "<output path without extension>\n", argv[0]);
+        return 2;
+    }
+
+    shift = strtoul(argv[3], &end, 0);
+    if ((*end != '\0') || (shift > ADC_LIN_RESULT_BITS))
+    {
+        fprintf(stderr, "adc_lin_gen: segment shift 0 to %u\n", (unsigned)ADC_LIN_RESULT_BITS);
+        return 2;
+    }
+    scale = strtod(argv[4], &end);
+    if ((*end != '\0') || !(scale > 0.0))
+    {
+        fprintf(stderr, "adc_lin_gen: the scale must be positive\n");
+        return 2;
+    }
+
+    (void)snprintf(sourcePath, sizeof(sourcePath), "%s.c", argv[5]);
+    (void)snprintf(headerPath, sizeof(headerPath), "%s.h", argv[5]);
+
+    /* Include guard and include directive from the file name */
+    base = strrchr(argv[5], '/');
+    base = (base != NULL) ? (base + 1) : argv[5];
+    for (i = 0U; (base[i] != '\0') && (i < (sizeof(guard) - 3U)); i++)
+    {
+        guard[i] = ((base[i] >= 'a') && (base[i] <= 'z')) ? (char)(base[i] - 'a' + 'A') :
+                   (((base[i] >= 'A') && (base[i] <= 'Z')) || ((base[i] >= '0') && (base[i] <= '9'))) ? base[i] : '_';
+    }
+    guard[i] = '\0';
+    (void)strcat(guard, "_H");
+    (void)snprintf(headerName, sizeof(headerName), "%s.h", base);
+
+    calName = strrchr(argv[1], '/');
+    calName = (calName != NULL) ? (calName + 1) : argv[1];
+
+    if (ReadCalibration(argv[1]) != 0)
+    {
+        return 1;
+    }
+    FitCurve();
+    if (BuildTable((uint32_t)shift, scale) != 0)
+    {
+        return 1;
+    }
+
+    table.points = s_points;
+    table.segmentShift = (uint8_t)shift;
+    if (ADC_LIN_CheckTable(&table) != STATUS_SUCCESS)
+    {
+        fprintf(stderr, "adc_lin_gen: adjacent points too far apart, reduce the scale\n");
+        return 1;
+    }
+
+    /* Error of the conversion over the calibrated codes, in the unit of the file */
+    for (code = (uint32_t)ceil(s_cal[0].code); (double)code <= s_cal[s_calCount - 1U].code; code++)
+    {
+        if (code >= ADC_LIN_CODES)
+        {
+            break;
+        }
+        error = fabs(((double)ADC_LIN_Convert(&table, (uint16_t)code) / scale) - Curve((double)code));
+        if (error > maxError)
+        {
+            maxError = error;
+            maxErrorCode = code;
+        }
+    }
+
+    if ((WriteHeader(headerPath, guard, argv[2], calName) != 0) ||
+        (WriteSource(sourcePath, headerName, argv[2], calName, (uint32_t)shift, scale) != 0))
+    {
+        return 1;
+    }
+
+    fprintf(stderr, "adc_lin_gen: %lu pairs, %lu points, codes %g to %g within %g (largest at code %lu)\n",
+            (unsigned long)s_calCount, (unsigned long)ADC_LIN_TABLE_POINTS(shift),
+            s_cal[0].code, s_cal[s_calCount - 1U].code, maxError, (unsigned long)maxErrorCode);
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file pins_capture_vcd.c
+ *
+ * Host tool converting a GPIO capture exported by PINS_DRV_CAPTURE_Encode() into a
+ * Value Change Dump file, for a waveform viewer such as GTKWave.
+ *
+ *   gcc -o pins_capture_vcd tools/pins_capture/pins_capture_vcd.c
+ *   ./pins_capture_vcd capture.bin capture.vcd
+ *
+ * The input is the byte stream received from the UART; anything before the header
+ * (a console message for instance) is skipped. Each exported bit is a signal named
+ * after its pin (PA3, PB12, ...); a "trigger" signal pulses on the trigger sample.
+ * The time unit is the picosecond, the sample times being computed from the PIT
+ * clock and period given in the header.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Export format, see PINS_DRV_CAPTURE_EncodeInit() */
+#define HEADER_SIZE         28U
+#define FORMAT_VERSION      1U
+#define NO_TRIGGER          0xFFFFFFFFUL
+
+/* Largest input size */
+#define INPUT_MAX_SIZE      (4UL * 1024UL * 1024UL)
+
+typedef struct
+{
+    uint32_t sampleSize;
+    uint32_t firstPort;
+    uint32_t pitClock;
+    uint32_t periodTicks;
+    uint32_t sampleCount;
+    uint32_t triggerIndex;
+    uint32_t channelMask;
+} capture_header_t;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t Get32(const uint8_t * data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static int FindHeader(const uint8_t * data, size_t size, size_t * offset, capture_header_t * header)
+{
+    size_t i;
+
+    for (i = 0U; (i + HEADER_SIZE) <= size; i++)
+    {
+        if ((data[i] == 'L') && (data[i + 1U] == 'A') && (data[i + 2U] == FORMAT_VERSION) &&
+            ((data[i + 3U] == 2U) || (data[i + 3U] == 4U)) &&
+            (data[i + 5U] == 0U) && (data[i + 6U] == 0U) && (data[i + 7U] == 0U))
+        {
+            header->sampleSize = data[i + 3U];
+            header->firstPort = data[i + 4U];
+            header->pitClock = Get32(&data[i + 8U]);
+            header->periodTicks = Get32(&data[i + 12U]);
+            header->sampleCount = Get32(&data[i + 16U]);
+            header->triggerIndex = Get32(&data[i + 20U]);
+            header->channelMask = Get32(&data[i + 24U]);
+            if (header->pitClock != 0U)
+            {
+                *offset = i + HEADER_SIZE;
+                return 0;
+            }
+        }
+    }
+
+    return -1;
+}
+
+/* Name of the pin of a sample bit; pin 0 of a port is its most significant bit */
+static void BitName(const capture_header_t * header, uint32_t bit, char * name, size_t size)
+{
+    uint32_t port = header->firstPort;
+    uint32_t pin;
+
+    if ((header->sampleSize == 4U) && (bit < 16U))
+    {
+        port++;
+    }
+    pin = 15U - (bit & 15U);
+    (void)snprintf(name, size, "P%c%u", (char)('A' + port), (unsigned)pin);
+}
+
+static uint64_t SampleTime(const capture_header_t * header, uint32_t index)
+{
+    return (uint64_t)(((double)index * header->periodTicks * 1e12 / header->pitClock) + 0.5);
+}
+
+static int Convert(const uint8_t * data, size_t size, FILE * out)
+{
+    capture_header_t header;
+    size_t pos = 0U;
+    uint32_t sampleIndex = 0U;
+    uint32_t value;
+    uint32_t previous = 0U;
+    uint32_t run;
+    uint32_t shift;
+    uint32_t bit;
+    uint32_t i;
+    char name[16];
+    int first = 1;
+
+    if (FindHeader(data, size, &pos, &header) != 0)
+    {
+        fprintf(stderr, "no capture header found\n");
+        return -1;
+    }
+
+    fprintf(out, "$comment PIT clock %lu Hz, period %lu ticks, %lu samples $end\n",
+            (unsigned long)header.pitClock, (unsigned long)header.periodTicks, (unsigned long)header.sampleCount);
+    fprintf(out, "$timescale 1ps $end\n$scope module gpio $end\n");
+    for (bit = 0U; bit < (8U * header.sampleSize); bit++)
+    {
+        if ((header.channelMask & (1UL << bit)) != 0U)
+        {
+            BitName(&header, bit, name, sizeof(name));
+            fprintf(out, "$var wire 1 %c %s $end\n", (char)('"' + bit), name);
+        }
+    }
+    fprintf(out, "$var wire 1 ! trigger $end\n$upscope $end\n$enddefinitions $end\n");
+
+    while (sampleIndex < header.sampleCount)
+    {
+        if ((pos + header.sampleSize) >= size)
+        {
+            fprintf(stderr, "capture truncated at sample %lu\n", (unsigned long)sampleIndex);
+            return -1;
+        }
+        value = 0U;
+        for (i = 0U; i < header.sampleSize; i++)
+        {
+            value |= (uint32_t)data[pos] << (8U * i);
+            pos++;
+        }
+        run = 0U;
+        shift = 0U;
+        do
+        {
+            if ((pos >= size) || (shift > 28U))
+            {
+                fprintf(stderr, "bad run length at sample %lu\n", (unsigned long)sampleIndex);
+                return -1;
+            }
+            run |= (uint32_t)(data[pos] & 0x7FU) << shift;
+            shift += 7U;
+            pos++;
+        } while ((data[pos - 1U] & 0x80U) != 0U);
+        if ((run == 0U) || (run > (header.sampleCount - sampleIndex)))
+        {
+            fprintf(stderr, "bad run length at sample %lu\n", (unsigned long)sampleIndex);
+            return -1;
+        }
+
+        fprintf(out, "#%llu\n", (unsigned long long)SampleTime(&header, sampleIndex));
+        for (bit = 0U; bit < (8U * header.sampleSize); bit++)
+        {
+            if (((header.channelMask & (1UL << bit)) != 0U) &&
+                (first || (((value ^ previous) & (1UL << bit)) != 0U)))
+            {
+                fprintf(out, "%u%c\n", (unsigned)((value >> bit) & 1U), (char)('"' + bit));
+            }
+        }
+        if (first)
+        {
+            fprintf(out, "0!\n");
+        }
+        first = 0;
+        previous = value;
+
+        /* The trigger pulse lasts one sample */
+        if ((header.triggerIndex != NO_TRIGGER) && (header.triggerIndex >= sampleIndex) &&
+            (header.triggerIndex < (sampleIndex + run)))
+        {
+            fprintf(out, "#%llu\n1!\n", (unsigned long long)SampleTime(&header, header.triggerIndex));
+            fprintf(out, "#%llu\n0!\n", (unsigned long long)SampleTime(&header, header.triggerIndex + 1U));
+        }
+        sampleIndex += run;
+    }
+    fprintf(out, "#%llu\n", (unsigned long long)SampleTime(&header, sampleIndex));
+
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    uint8_t * data;
+    size_t size;
+    FILE * in;
+    FILE * out;
+    int ret;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <capture.bin> <output.vcd>\n", argv[0]);
+        return 1;
+    }
+
+    in = fopen(argv[1], "rb");
+    if (in == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    data = malloc(INPUT_MAX_SIZE);
+    if (data == NULL)
+    {
+        fclose(in);
+        return 1;
+    }
+    size = fread(data, 1U, INPUT_MAX_SIZE, in);
+    fclose(in);
+
+    out = fopen(argv[2], "w");
+    if (out == NULL)
+    {
+        perror(argv[2]);
+        free(data);
+        return 1;
+    }
+    ret = Convert(data, size, out);
+    fclose(out);
+    free(data);
+
+    return (ret == 0) ? 0 : 1;
+}
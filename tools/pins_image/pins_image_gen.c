@@ -0,0 +1,342 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @file pins_image_gen.c
+ *
+ * Host tool compiling the pin configuration of a project (g_pin_mux_InitConfigArr
+ * in Generated_Code/pin_mux.c) into the register image applied at startup by
+ * PINS_DRV_InitFromImage().
+ *
+ * The tool is built with the host compiler against the sources of the project, so
+ * that the register values are computed by the same code as on the target
+ * (PINS_GetMscrValue() and PINS_GetImcrValue() of siul2_hw_access.c). From the
+ * project directory:
+ *
+ *   I=""; for d in $(find SDK Generated_Code -type d); do I="$I -I$d"; done
+ *   gcc -DCPU_MPC5748G $I -o pins_image_gen ../tools/pins_image/pins_image_gen.c \
+ *       Generated_Code/pin_mux.c SDK/platform/drivers/src/pins/siul2/siul2_hw_access.c
+ *   ./pins_image_gen Sources/pin_mux_image
+ *
+ * This writes Sources/pin_mux_image.c and Sources/pin_mux_image.h. The image must be
+ * generated again whenever the pin configuration is generated again.
+ *
+ * The image assumes that the SIUL2 registers are at their reset values, as they
+ * are at startup: the read-modify-write accesses of PINS_Init() to the external
+ * interrupt registers are replayed on zeroed copies and only the non-zero results
+ * are written.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "pin_mux.h"
+#include "siul2_hw_access.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Maximum number of register writes in the image */
+#define IMAGE_MAX_WRITES    (SIUL2_MPGPDO_COUNT + (2U * SIUL2_MSCR_COUNT) + 8U)
+
+/* Address of a SIUL2 register */
+#define SIUL2_REG_ADDR(reg) ((uint32_t)(SIUL2_BASE + offsetof(SIUL2_Type, reg)))
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t value;
+    char name[24];
+} image_write_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static image_write_t s_image[IMAGE_MAX_WRITES];
+static uint32_t s_imageCount = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void ImageAdd(uint32_t address, uint32_t value, const char * name, int32_t idx)
+{
+    image_write_t * write;
+
+    if (s_imageCount >= IMAGE_MAX_WRITES)
+    {
+        fprintf(stderr, "pins_image_gen: too many register writes\n");
+        return;
+    }
+
+    write = &s_image[s_imageCount];
+    write->address = address;
+    write->value = value;
+    if (idx >= 0)
+    {
+        (void)snprintf(write->name, sizeof(write->name), "%s[%ld]", name, (long)idx);
+    }
+    else
+    {
+        (void)snprintf(write->name, sizeof(write->name), "%s", name);
+    }
+    s_imageCount++;
+}
+
+static uint32_t GpioPortIdx(const GPIO_Type * gpioBase)
+{
+    return (uint32_t)(((uintptr_t)gpioBase - (uintptr_t)PTA_BASE) >> 1U);
+}
+
+static void BuildImage(const pin_settings_config_t * config, uint32_t pinCount)
+{
+    uint16_t levelMask[SIUL2_MPGPDO_COUNT] = { 0U };
+    uint16_t levelValue[SIUL2_MPGPDO_COUNT] = { 0U };
+    uint32_t intRising = 0U;
+    uint32_t intFalling = 0U;
+#ifdef FEATURE_SIUL2_EXTERNAL_INT_SUPPORT_DMA
+    uint32_t intDmaSelect = 0U;
+#endif
+    uint32_t intEnable = 0U;
+    uint32_t intClear = 0U;
+    uint32_t pinIntValue;
+    uint32_t port;
+    uint16_t bit;
+    uint32_t i;
+    uint8_t k;
+    bool gpioOutput;
+
+    /* Initial output levels, written first so that the outputs come up at their level */
+    for (i = 0U; i < pinCount; i++)
+    {
+#ifdef FEATURE_SIUL2_HAS_OUTPUT_DRIVE_CONTROL
+        gpioOutput = (PORT_MUX_AS_GPIO == config[i].mux) && (PORT_OUTPUT_DRIVE_DISABLED != config[i].outputDriveCtrl);
+#else
+        gpioOutput = (PORT_MUX_AS_GPIO == config[i].mux) && (PORT_OUTPUT_BUFFER_ENABLED == config[i].outputBuffer);
+#endif
+        if (gpioOutput)
+        {
+            port = GpioPortIdx(config[i].gpioBase);
+            bit = (uint16_t)(0x8000U >> (config[i].pinPortIdx % SIUL2_NUM_OF_PIN_PORT));
+            levelMask[port] |= bit;
+            if ((config[i].initValue & 1U) != 0U)
+            {
+                levelValue[port] |= bit;
+            }
+            else
+            {
+                levelValue[port] &= (uint16_t)~bit;
+            }
+        }
+    }
+
+    for (port = 0U; port < SIUL2_MPGPDO_COUNT; port++)
+    {
+        if (levelMask[port] != 0U)
+        {
+            ImageAdd(SIUL2_REG_ADDR(MPGPDO[0]) + (4U * port),
+                     SIUL2_MPGPDO_MASK(levelMask[port]) | SIUL2_MPGPDO_MPPDO(levelValue[port]),
+                     "MPGPDO", (int32_t)port);
+        }
+    }
+
+    for (i = 0U; i < pinCount; i++)
+    {
+        ImageAdd(SIUL2_REG_ADDR(MSCR[0]) + (4U * config[i].pinPortIdx),
+                 PINS_GetMscrValue(&config[i]), "MSCR", (int32_t)config[i].pinPortIdx);
+    }
+
+    /* Input muxes and external interrupts, as PINS_Init() */
+    for (i = 0U; i < pinCount; i++)
+    {
+        if (PORT_INPUT_BUFFER_ENABLED != config[i].inputBuffer)
+        {
+            continue;
+        }
+
+        for (k = 0U; k < FEATURE_SIUL2_INPUT_MUX_WIDTH; k++)
+        {
+            if (PORT_INPUT_MUX_NO_INIT != config[i].inputMux[k])
+            {
+                ImageAdd(SIUL2_REG_ADDR(IMCR[0]) + (4U * config[i].inputMuxReg[k]),
+                         PINS_GetImcrValue(&config[i], k), "IMCR", (int32_t)config[i].inputMuxReg[k]);
+            }
+        }
+
+        pinIntValue = 1UL << config[i].intConfig.eirqPinIdx;
+        if (config[i].intConfig.intEdgeSel != SIUL2_INT_DISABLE)
+        {
+            if ((config[i].intConfig.intEdgeSel == SIUL2_INT_RISING_EDGE) || (config[i].intConfig.intEdgeSel == SIUL2_INT_EITHER_EDGE))
+            {
+                intRising |= pinIntValue;
+            }
+            else
+            {
+                intRising &= ~pinIntValue;
+            }
+            if ((config[i].intConfig.intEdgeSel == SIUL2_INT_FALLING_EDGE) || (config[i].intConfig.intEdgeSel == SIUL2_INT_EITHER_EDGE))
+            {
+                intFalling |= pinIntValue;
+            }
+            else
+            {
+                intFalling &= ~pinIntValue;
+            }
+#ifdef FEATURE_SIUL2_EXTERNAL_INT_SUPPORT_DMA
+            if (SIUL2_INT_USING_DMA == config[i].intConfig.intExeSel)
+            {
+                intDmaSelect |= pinIntValue;
+            }
+            else
+            {
+                intDmaSelect &= ~pinIntValue;
+            }
+#endif
+            intClear |= pinIntValue;
+            intEnable |= pinIntValue;
+        }
+        else
+        {
+            intEnable &= ~pinIntValue;
+        }
+    }
+
+    /* The interrupts are enabled last, once all the pads are configured */
+#ifdef FEATURE_SIUL2_EXTERNAL_INT_SUPPORT_DMA
+    if (intDmaSelect != 0U)
+    {
+        ImageAdd(SIUL2_REG_ADDR(DIRSR0), intDmaSelect, "DIRSR0", -1);
+    }
+#endif
+    if (intRising != 0U)
+    {
+        ImageAdd(SIUL2_REG_ADDR(IREER0), intRising, "IREER0", -1);
+    }
+    if (intFalling != 0U)
+    {
+        ImageAdd(SIUL2_REG_ADDR(IFEER0), intFalling, "IFEER0", -1);
+    }
+    if (intClear != 0U)
+    {
+#ifdef FEATURE_SIUL2_EXTERNAL_INT_SUPPORT_DMA
+        ImageAdd(SIUL2_REG_ADDR(DISR0), intClear, "DISR0", -1);
+#else
+        ImageAdd(SIUL2_REG_ADDR(ISR0), intClear, "ISR0", -1);
+#endif
+    }
+    if (intEnable != 0U)
+    {
+#ifdef FEATURE_SIUL2_EXTERNAL_INT_SUPPORT_DMA
+        ImageAdd(SIUL2_REG_ADDR(DIRER0), intEnable, "DIRER0", -1);
+#else
+        ImageAdd(SIUL2_REG_ADDR(IRER0), intEnable, "IRER0", -1);
+#endif
+    }
+}
+
+static int WriteHeader(const char * path, const char * guard)
+{
+    FILE * f = fopen(path, "w");
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/* Generated by pins_image_gen from g_pin_mux_InitConfigArr. Do not modify it. */\n\n");
+    fprintf(f, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(f, "#include \"pins_driver.h\"\n\n");
+    fprintf(f, "/*! @brief Number of register writes in the pin configuration image */\n");
+    fprintf(f, "#define PIN_MUX_INIT_IMAGE_COUNT %luU\n\n", (unsigned long)s_imageCount);
+    fprintf(f, "/*! @brief Pin configuration image, applied by PINS_DRV_InitFromImage() */\n");
+    fprintf(f, "extern const pins_reg_write_t g_pin_mux_InitImage[PIN_MUX_INIT_IMAGE_COUNT];\n\n");
+    fprintf(f, "#endif /* %s */\n", guard);
+
+    return (fclose(f) == 0) ? 0 : 1;
+}
+
+static int WriteSource(const char * path, const char * header)
+{
+    FILE * f = fopen(path, "w");
+    uint32_t i;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/* Generated by pins_image_gen from g_pin_mux_InitConfigArr. Do not modify it. */\n\n");
+    fprintf(f, "#include \"%s\"\n\n", header);
+    fprintf(f, "const pins_reg_write_t g_pin_mux_InitImage[PIN_MUX_INIT_IMAGE_COUNT] =\n{\n");
+    for (i = 0U; i < s_imageCount; i++)
+    {
+        fprintf(f, "    { 0x%08lXu, 0x%08lXu },    /* %s */\n",
+                (unsigned long)s_image[i].address, (unsigned long)s_image[i].value, s_image[i].name);
+    }
+    fprintf(f, "};\n");
+
+    return (fclose(f) == 0) ? 0 : 1;
+}
+
+int main(int argc, char * argv[])
+{
+    char sourcePath[512];
+    char headerPath[512];
+    char headerName[128];
+    char guard[128];
+    const char * base;
+    size_t i;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <output path without extension>\n", argv[0]);
+        return 2;
+    }
+
+    (void)snprintf(sourcePath, sizeof(sourcePath), "%s.c", argv[1]);
+    (void)snprintf(headerPath, sizeof(headerPath), "%s.h", argv[1]);
+
+    /* Include guard and include directive from the file name */
+    base = strrchr(argv[1], '/');
+    base = (base != NULL) ? (base + 1) : argv[1];
+    for (i = 0U; (base[i] != '\0') && (i < (sizeof(guard) - 3U)); i++)
+    {
+        guard[i] = ((base[i] >= 'a') && (base[i] <= 'z')) ? (char)(base[i] - 'a' + 'A') :
+                   (((base[i] >= 'A') && (base[i] <= 'Z')) || ((base[i] >= '0') && (base[i] <= '9'))) ? base[i] : '_';
+    }
+    guard[i] = '\0';
+    (void)strcat(guard, "_H");
+    (void)snprintf(headerName, sizeof(headerName), "%s.h", base);
+
+    BuildImage(g_pin_mux_InitConfigArr, NUM_OF_CONFIGURED_PINS);
+
+    if ((WriteHeader(headerPath, guard) != 0) || (WriteSource(sourcePath, headerName) != 0))
+    {
+        return 1;
+    }
+
+    fprintf(stderr, "pins_image_gen: %u pins, %lu register writes, %lu bytes\n",
+            (unsigned)NUM_OF_CONFIGURED_PINS, (unsigned long)s_imageCount,
+            (unsigned long)(s_imageCount * sizeof(pins_reg_write_t)));
+
+    return 0;
+}
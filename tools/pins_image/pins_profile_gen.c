@@ -0,0 +1,478 @@
+/*
+ * Copyright 2017-2019 NXP
+ * All rights reserved.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*!
+ * @file pins_profile_gen.c
+ *
+ * Host tool compiling the pin profiles of a project (g_pin_profilesCfg in
+ * Profiles/pin_profiles_cfg.c) into the register writes switching between each
+ * pair of profiles, applied at runtime by PINS_DRV_SwitchProfile().
+ *
+ * As pins_image_gen, the tool is built with the host compiler against the sources
+ * of the project, so that the register values are computed by the same code as on
+ * the target. From the project directory:
+ *
+ *   I=""; for d in $(find SDK Generated_Code Profiles -type d); do I="$I -I$d"; done
+ *   gcc -DCPU_MPC5748G $I -o pins_profile_gen ../tools/pins_image/pins_profile_gen.c \
+ *       Profiles/pin_profiles_cfg.c Generated_Code/pin_mux.c \
+ *       SDK/platform/drivers/src/pins/siul2/siul2_hw_access.c
+ *   ./pins_profile_gen Sources/pin_profiles
+ *
+ * This writes Sources/pin_profiles.c and Sources/pin_profiles.h, and prints the
+ * registers each switch writes.
+ *
+ * All the profiles must configure the same pins with the same external interrupt
+ * configuration: external interrupts are not switched. An input multiplexer which
+ * a profile does not set is at its reset value (0) in this profile.
+ *
+ * Only the registers which differ are written, in this order:
+ * - MPGPDO, for the pins which become GPIO outputs or whose level changes, so that
+ *   the level is right before the output buffer is enabled,
+ * - MSCR, for the pins whose configuration changes, with the output buffer enabled
+ *   only if it is enabled in both profiles and the input buffer enabled if it is
+ *   in either,
+ * - IMCR, for the input multiplexers which change,
+ * - MSCR again, for the pins whose final configuration differs from the first
+ *   write, enabling the new output buffers and disabling the old input buffers.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "pin_profiles_cfg.h"
+#include "siul2_hw_access.h"
+
+#ifdef FEATURE_SIUL2_HAS_OUTPUT_DRIVE_CONTROL
+#error "pins_profile_gen does not support the output drive control of this device"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Maximum number of pins in a profile */
+#define PROFILE_MAX_PINS        SIUL2_MSCR_COUNT
+
+/* Maximum number of input multiplexers set by the profiles */
+#define PROFILE_MAX_IMCRS       64U
+
+/* Maximum number of register writes of a transition */
+#define TRANSITION_MAX_WRITES   (SIUL2_MPGPDO_COUNT + (2U * PROFILE_MAX_PINS) + PROFILE_MAX_IMCRS)
+
+/* Address of a SIUL2 register */
+#define SIUL2_REG_ADDR(reg)     ((uint32_t)(SIUL2_BASE + offsetof(SIUL2_Type, reg)))
+
+typedef struct
+{
+    uint32_t mscr[PROFILE_MAX_PINS];        /* MSCR value, per pin of the first profile  */
+    bool gpioOutput[PROFILE_MAX_PINS];      /* The pin is a GPIO output                  */
+    bool level[PROFILE_MAX_PINS];           /* Level of the GPIO output                  */
+    uint32_t imcr[PROFILE_MAX_IMCRS];       /* IMCR value, per input multiplexer         */
+} profile_regs_t;
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t value;
+    char name[24];
+} transition_write_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static profile_regs_t s_profiles[PIN_PROFILE_CFG_COUNT];
+static uint32_t s_imcrReg[PROFILE_MAX_IMCRS];
+static uint32_t s_imcrCount = 0U;
+static transition_write_t s_writes[TRANSITION_MAX_WRITES];
+static uint32_t s_writeCount = 0U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void WriteAdd(uint32_t address, uint32_t value, const char * name, uint32_t idx)
+{
+    transition_write_t * write = &s_writes[s_writeCount];
+
+    write->address = address;
+    write->value = value;
+    (void)snprintf(write->name, sizeof(write->name), "%s[%lu]", name, (unsigned long)idx);
+    s_writeCount++;
+}
+
+static uint32_t GpioPortIdx(const GPIO_Type * gpioBase)
+{
+    return (uint32_t)(((uintptr_t)gpioBase - (uintptr_t)PTA_BASE) >> 1U);
+}
+
+/* Index of a pin in a profile, -1 if not configured */
+static int32_t FindPin(const pin_profile_cfg_t * profile, uint32_t pinPortIdx)
+{
+    uint32_t i;
+
+    for (i = 0U; i < profile->pinCount; i++)
+    {
+        if (profile->pins[i].pinPortIdx == pinPortIdx)
+        {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+/* Slot of an input multiplexer, PROFILE_MAX_IMCRS if there is no free slot */
+static uint32_t ImcrSlot(uint32_t reg)
+{
+    uint32_t i;
+
+    for (i = 0U; i < s_imcrCount; i++)
+    {
+        if (s_imcrReg[i] == reg)
+        {
+            return i;
+        }
+    }
+    if (s_imcrCount < PROFILE_MAX_IMCRS)
+    {
+        s_imcrReg[s_imcrCount] = reg;
+        s_imcrCount++;
+    }
+
+    return i;
+}
+
+/* Computes the register values of all the profiles, in the pin order of the first one */
+static int BuildProfiles(void)
+{
+    const pin_profile_cfg_t * first = &g_pin_profilesCfg[0];
+    const pin_settings_config_t * pin;
+    const pin_settings_config_t * ref;
+    uint32_t slot;
+    uint32_t p;
+    uint32_t i;
+    int32_t idx;
+    uint8_t k;
+
+    if (first->pinCount > PROFILE_MAX_PINS)
+    {
+        fprintf(stderr, "pins_profile_gen: too many pins\n");
+        return 1;
+    }
+
+    for (p = 0U; p < PIN_PROFILE_CFG_COUNT; p++)
+    {
+        if (g_pin_profilesCfg[p].pinCount != first->pinCount)
+        {
+            fprintf(stderr, "pins_profile_gen: profile %s does not configure the same pins as %s\n",
+                    g_pin_profilesCfg[p].name, first->name);
+            return 1;
+        }
+
+        for (i = 0U; i < first->pinCount; i++)
+        {
+            ref = &first->pins[i];
+            idx = FindPin(&g_pin_profilesCfg[p], ref->pinPortIdx);
+            if (idx < 0)
+            {
+                fprintf(stderr, "pins_profile_gen: profile %s does not configure MSCR[%u]\n",
+                        g_pin_profilesCfg[p].name, (unsigned)ref->pinPortIdx);
+                return 1;
+            }
+            pin = &g_pin_profilesCfg[p].pins[idx];
+
+            if ((pin->intConfig.intEdgeSel != ref->intConfig.intEdgeSel) ||
+                ((pin->intConfig.intEdgeSel != SIUL2_INT_DISABLE) &&
+                 ((pin->intConfig.eirqPinIdx != ref->intConfig.eirqPinIdx)
+#ifdef FEATURE_SIUL2_EXTERNAL_INT_SUPPORT_DMA
+                  || (pin->intConfig.intExeSel != ref->intConfig.intExeSel)
+#endif
+                 )))
+            {
+                fprintf(stderr, "pins_profile_gen: profile %s changes the external interrupt of MSCR[%u]\n",
+                        g_pin_profilesCfg[p].name, (unsigned)ref->pinPortIdx);
+                return 1;
+            }
+
+            s_profiles[p].mscr[i] = PINS_GetMscrValue(pin);
+            s_profiles[p].gpioOutput[i] = (PORT_MUX_AS_GPIO == pin->mux) && (PORT_OUTPUT_BUFFER_ENABLED == pin->outputBuffer);
+            s_profiles[p].level[i] = ((pin->initValue & 1U) != 0U);
+
+            if (PORT_INPUT_BUFFER_ENABLED != pin->inputBuffer)
+            {
+                continue;
+            }
+            for (k = 0U; k < FEATURE_SIUL2_INPUT_MUX_WIDTH; k++)
+            {
+                if (PORT_INPUT_MUX_NO_INIT != pin->inputMux[k])
+                {
+                    slot = ImcrSlot(pin->inputMuxReg[k]);
+                    if (slot >= PROFILE_MAX_IMCRS)
+                    {
+                        fprintf(stderr, "pins_profile_gen: too many input multiplexers\n");
+                        return 1;
+                    }
+                    s_profiles[p].imcr[slot] = PINS_GetImcrValue(pin, k);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* Computes the register writes switching from profile 'from' to profile 'to' */
+static void BuildTransition(uint32_t from, uint32_t to)
+{
+    const profile_regs_t * prev = &s_profiles[from];
+    const profile_regs_t * next = &s_profiles[to];
+    const pin_settings_config_t * pins = g_pin_profilesCfg[0].pins;
+    uint32_t pinCount = g_pin_profilesCfg[0].pinCount;
+    uint32_t mid[PROFILE_MAX_PINS];
+    uint16_t levelMask[SIUL2_MPGPDO_COUNT] = { 0U };
+    uint16_t levelValue[SIUL2_MPGPDO_COUNT] = { 0U };
+    const uint32_t bufferMask = SIUL2_MSCR_OBE_MASK | SIUL2_MSCR_IBE_MASK;
+    uint32_t port;
+    uint16_t bit;
+    uint32_t i;
+
+    s_writeCount = 0U;
+
+    for (i = 0U; i < pinCount; i++)
+    {
+        if (next->gpioOutput[i] && ((!prev->gpioOutput[i]) || (prev->level[i] != next->level[i])))
+        {
+            port = GpioPortIdx(pins[i].gpioBase);
+            bit = (uint16_t)(0x8000U >> (pins[i].pinPortIdx % SIUL2_NUM_OF_PIN_PORT));
+            levelMask[port] |= bit;
+            if (next->level[i])
+            {
+                levelValue[port] |= bit;
+            }
+        }
+    }
+    for (port = 0U; port < SIUL2_MPGPDO_COUNT; port++)
+    {
+        if (levelMask[port] != 0U)
+        {
+            WriteAdd(SIUL2_REG_ADDR(MPGPDO[0]) + (4U * port),
+                     SIUL2_MPGPDO_MASK(levelMask[port]) | SIUL2_MPGPDO_MPPDO(levelValue[port]),
+                     "MPGPDO", port);
+        }
+    }
+
+    for (i = 0U; i < pinCount; i++)
+    {
+        mid[i] = (next->mscr[i] & ~bufferMask) |
+                 (prev->mscr[i] & next->mscr[i] & SIUL2_MSCR_OBE_MASK) |
+                 ((prev->mscr[i] | next->mscr[i]) & SIUL2_MSCR_IBE_MASK);
+        if (mid[i] != prev->mscr[i])
+        {
+            WriteAdd(SIUL2_REG_ADDR(MSCR[0]) + (4U * pins[i].pinPortIdx), mid[i], "MSCR", pins[i].pinPortIdx);
+        }
+    }
+
+    for (i = 0U; i < s_imcrCount; i++)
+    {
+        if (next->imcr[i] != prev->imcr[i])
+        {
+            WriteAdd(SIUL2_REG_ADDR(IMCR[0]) + (4U * s_imcrReg[i]), next->imcr[i], "IMCR", s_imcrReg[i]);
+        }
+    }
+
+    for (i = 0U; i < pinCount; i++)
+    {
+        if (next->mscr[i] != mid[i])
+        {
+            WriteAdd(SIUL2_REG_ADDR(MSCR[0]) + (4U * pins[i].pinPortIdx), next->mscr[i], "MSCR", pins[i].pinPortIdx);
+        }
+    }
+}
+
+/* Name of a profile as an upper case identifier */
+static void UpperName(char * out, size_t size, const char * name)
+{
+    size_t i;
+
+    for (i = 0U; (name[i] != '\0') && (i < (size - 1U)); i++)
+    {
+        out[i] = ((name[i] >= 'a') && (name[i] <= 'z')) ? (char)(name[i] - 'a' + 'A') :
+                 (((name[i] >= 'A') && (name[i] <= 'Z')) || ((name[i] >= '0') && (name[i] <= '9'))) ? name[i] : '_';
+    }
+    out[i] = '\0';
+}
+
+static int WriteHeader(const char * path, const char * guard)
+{
+    FILE * f = fopen(path, "w");
+    char name[64];
+    uint32_t p;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/* Generated by pins_profile_gen from g_pin_profilesCfg. Do not modify it. */\n\n");
+    fprintf(f, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(f, "#include \"pins_driver.h\"\n\n");
+    fprintf(f, "/*! @brief Number of pin profiles */\n");
+    fprintf(f, "#define PIN_PROFILE_COUNT %luU\n\n", (unsigned long)PIN_PROFILE_CFG_COUNT);
+    fprintf(f, "/*! @brief Pin profiles */\n");
+    for (p = 0U; p < PIN_PROFILE_CFG_COUNT; p++)
+    {
+        UpperName(name, sizeof(name), g_pin_profilesCfg[p].name);
+        fprintf(f, "#define PIN_PROFILE_%s %luU\n", name, (unsigned long)p);
+    }
+    fprintf(f, "\n/*! @brief Pin profiles, switched by PINS_DRV_SwitchProfile() */\n");
+    fprintf(f, "extern const pins_profile_table_t g_pin_profiles;\n\n");
+    fprintf(f, "#endif /* %s */\n", guard);
+
+    return (fclose(f) == 0) ? 0 : 1;
+}
+
+static int WriteSource(const char * path, const char * header)
+{
+    FILE * f = fopen(path, "w");
+    uint32_t writeCount[PIN_PROFILE_CFG_COUNT][PIN_PROFILE_CFG_COUNT];
+    uint32_t totalCount = 0U;
+    uint32_t from;
+    uint32_t to;
+    uint32_t i;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/* Generated by pins_profile_gen from g_pin_profilesCfg. Do not modify it. */\n\n");
+    fprintf(f, "#include \"%s\"\n\n", header);
+
+    for (from = 0U; from < PIN_PROFILE_CFG_COUNT; from++)
+    {
+        for (to = 0U; to < PIN_PROFILE_CFG_COUNT; to++)
+        {
+            if (from == to)
+            {
+                writeCount[from][to] = 0U;
+                continue;
+            }
+
+            BuildTransition(from, to);
+            writeCount[from][to] = s_writeCount;
+            totalCount += s_writeCount;
+            fprintf(stderr, "pins_profile_gen: %s -> %s: %lu register writes\n",
+                    g_pin_profilesCfg[from].name, g_pin_profilesCfg[to].name, (unsigned long)s_writeCount);
+            if (s_writeCount == 0U)
+            {
+                continue;
+            }
+
+            fprintf(f, "/* %s -> %s */\n", g_pin_profilesCfg[from].name, g_pin_profilesCfg[to].name);
+            fprintf(f, "static const pins_reg_write_t s_pinProfile_%s_%s[%luU] =\n{\n",
+                    g_pin_profilesCfg[from].name, g_pin_profilesCfg[to].name, (unsigned long)s_writeCount);
+            for (i = 0U; i < s_writeCount; i++)
+            {
+                fprintf(f, "    { 0x%08lXu, 0x%08lXu },    /* %s */\n",
+                        (unsigned long)s_writes[i].address, (unsigned long)s_writes[i].value, s_writes[i].name);
+                fprintf(stderr, "    %-12s 0x%08lX\n", s_writes[i].name, (unsigned long)s_writes[i].value);
+            }
+            fprintf(f, "};\n\n");
+        }
+    }
+
+    fprintf(f, "static const char * const s_pinProfileNames[%luU] =\n{\n", (unsigned long)PIN_PROFILE_CFG_COUNT);
+    for (from = 0U; from < PIN_PROFILE_CFG_COUNT; from++)
+    {
+        fprintf(f, "    \"%s\",\n", g_pin_profilesCfg[from].name);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "static const pins_profile_transition_t s_pinProfileTransitions[%luU] =\n{\n",
+            (unsigned long)(PIN_PROFILE_CFG_COUNT * PIN_PROFILE_CFG_COUNT));
+    for (from = 0U; from < PIN_PROFILE_CFG_COUNT; from++)
+    {
+        for (to = 0U; to < PIN_PROFILE_CFG_COUNT; to++)
+        {
+            if (writeCount[from][to] == 0U)
+            {
+                fprintf(f, "    { 0U, NULL },    /* %s -> %s */\n",
+                        g_pin_profilesCfg[from].name, g_pin_profilesCfg[to].name);
+            }
+            else
+            {
+                fprintf(f, "    { %luU, s_pinProfile_%s_%s },\n", (unsigned long)writeCount[from][to],
+                        g_pin_profilesCfg[from].name, g_pin_profilesCfg[to].name);
+            }
+        }
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const pins_profile_table_t g_pin_profiles =\n{\n");
+    fprintf(f, "    .profileCount = PIN_PROFILE_COUNT,\n");
+    fprintf(f, "    .names        = s_pinProfileNames,\n");
+    fprintf(f, "    .transitions  = s_pinProfileTransitions\n");
+    fprintf(f, "};\n");
+
+    fprintf(stderr, "pins_profile_gen: %lu profiles, %lu register writes, %lu bytes\n",
+            (unsigned long)PIN_PROFILE_CFG_COUNT, (unsigned long)totalCount,
+            (unsigned long)(totalCount * sizeof(pins_reg_write_t)));
+
+    return (fclose(f) == 0) ? 0 : 1;
+}
+
+int main(int argc, char * argv[])
+{
+    char sourcePath[512];
+    char headerPath[512];
+    char headerName[128];
+    char guard[128];
+    const char * base;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <output path without extension>\n", argv[0]);
+        return 2;
+    }
+
+    (void)snprintf(sourcePath, sizeof(sourcePath), "%s.c", argv[1]);
+    (void)snprintf(headerPath, sizeof(headerPath), "%s.h", argv[1]);
+
+    /* Include guard and include directive from the file name */
+    base = strrchr(argv[1], '/');
+    base = (base != NULL) ? (base + 1) : argv[1];
+    UpperName(guard, sizeof(guard) - 2U, base);
+    (void)strcat(guard, "_H");
+    (void)snprintf(headerName, sizeof(headerName), "%s.h", base);
+
+    if (BuildProfiles() != 0)
+    {
+        return 1;
+    }
+
+    if ((WriteHeader(headerPath, guard) != 0) || (WriteSource(sourcePath, headerName) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}